@@ -57,7 +57,7 @@ namespace sfad
 		{
 			setADValue(real_t(0));
 		}
-		FwdET(const real_t val) SFAD_NOEXCEPT_EXPR(noexcept(storage_t<real_t>()) : storage_t<real_t>(), _val(val)
+		FwdET(const real_t val) SFAD_NOEXCEPT_EXPR(noexcept(storage_t<real_t>())) : storage_t<real_t>(), _val(val)
 		{
 			setADValue(real_t(0));
 		}
@@ -66,13 +66,13 @@ namespace sfad
 			storage_t<real_t>::copyGradient(grad);
 		}
 		FwdET(const FwdET<real_t, storage_t>& cpy) SFAD_NOEXCEPT_EXPR(noexcept(storage_t<real_t>(cpy))) : storage_t<real_t>(cpy), _val(cpy._val) { }
-		FwdET(FwdET<real_t, storage_t>&& other) SFAD_NOEXCEPT_EXPR(noexcept(storage_t<real_t>(std::move(other))) : storage_t<real_t>(std::move(other)), _val(std::move(other._val)) { }
+		FwdET(FwdET<real_t, storage_t>&& other) SFAD_NOEXCEPT_EXPR(noexcept(storage_t<real_t>(std::move(other)))) : storage_t<real_t>(std::move(other)), _val(std::move(other._val)) { }
 
 		// Contains the one (and only) loop in expression template paradigm
 		template <typename A>
-		FwdET(const Expr<A, real_t>& other) SFAD_NOEXCEPT_EXPR(noexcept(storage_t<real_t>()) : storage_t<real_t>(), _val(other.value())
+		FwdET(const Expr<A, real_t>& other) SFAD_NOEXCEPT_EXPR(noexcept(storage_t<real_t>())) : storage_t<real_t>(), _val(other.value())
 		{
-			for (idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 				storage_t<real_t>::_grad[i] = other.gradient(i);
 		}
 
@@ -91,13 +91,13 @@ namespace sfad
 			if (sfad_likely(this != &other))
 			{
 				_val = other._val;
-				storage_t<real_t>::copyGradient(other._grad);
+				storage_t<real_t>::copyGradient(static_cast<const storage_t<real_t>&>(other));
 			}
 
 			return *this;
 		}
 
-		inline const idx_t gradientSize() const SFAD_NOEXCEPT { return detail::globalGradSize; }
+		inline const idx_t gradientSize() const SFAD_NOEXCEPT { return storage_t<real_t>::gradSize(); }
 
 		template<typename T, template <class T2> class s_t> friend void swap (FwdET<T, s_t>& x, FwdET<T, s_t>& y) SFAD_NOEXCEPT;
 
@@ -112,7 +112,8 @@ namespace sfad
 		inline void setADValue(const idx_t idx, const real_t v) { storage_t<real_t>::_grad[idx] = v; }
 		inline void setADValue(const real_t v)
 		{
-			std::fill(storage_t<real_t>::_grad, storage_t<real_t>::_grad + detail::globalGradSize, v);
+			storage_t<real_t>::reserveGradient();
+			std::fill(storage_t<real_t>::_grad, storage_t<real_t>::_grad + storage_t<real_t>::gradSize(), v);
 		}
 
 		// Modern C++ accessor
@@ -137,7 +138,8 @@ namespace sfad
 		inline FwdET<real_t, storage_t>& operator=(const Expr<T, real_t>& v)
 		{
 			_val = v.value();
-			for (idx_t i = 0; i < detail::globalGradSize; ++i)
+			storage_t<real_t>::reserveGradient();
+			for (idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 				storage_t<real_t>::_grad[i] = v.gradient(i);
 
 			return *this;
@@ -160,7 +162,8 @@ namespace sfad
 		inline FwdET<real_t, storage_t>& operator+=(const FwdET<real_t, storage_t>& a)
 		{
 			_val += a._val;
-			for (idx_t i = 0; i < detail::globalGradSize; ++i)
+			storage_t<real_t>::reserveGradient();
+			for (idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 				storage_t<real_t>::_grad[i] += a._grad[i];
 
 			return *this;
@@ -176,7 +179,8 @@ namespace sfad
 		inline FwdET<real_t, storage_t>& operator-=(const FwdET<real_t, storage_t>& a)
 		{
 			_val -= a._val;
-			for (idx_t i = 0; i < detail::globalGradSize; ++i)
+			storage_t<real_t>::reserveGradient();
+			for (idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 				storage_t<real_t>::_grad[i] -= a._grad[i];
 
 			return *this;
@@ -191,7 +195,8 @@ namespace sfad
 
 		inline FwdET<real_t, storage_t>& operator*=(const FwdET<real_t, storage_t>& a)
 		{
-			for (idx_t i = 0; i < detail::globalGradSize; ++i)
+			storage_t<real_t>::reserveGradient();
+			for (idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 				storage_t<real_t>::_grad[i] = a._val * storage_t<real_t>::_grad[i] + _val * a._grad[i];
 
 			_val *= a._val;
@@ -207,7 +212,8 @@ namespace sfad
 
 		inline FwdET<real_t, storage_t>& operator/=(const FwdET<real_t, storage_t>& a)
 		{
-			for (idx_t i = 0; i < detail::globalGradSize; ++i)
+			storage_t<real_t>::reserveGradient();
+			for (idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 //				_grad[i] = (_grad[i] - _val / a._val * a._grad[i]) / a._val;
 				storage_t<real_t>::_grad[i] = (storage_t<real_t>::_grad[i] * a._val - _val * a._grad[i]) / (a._val * a._val);
 
@@ -19,7 +19,7 @@
 #endif
 
 #ifndef SFAD_GLOBAL_GRAD_SIZE
-	#define SFAD_GLOBAL_GRAD_SIZE std::size_t sfad::detail::globalGradSize = SFAD_DEFAULT_DIR;
+	#define SFAD_GLOBAL_GRAD_SIZE thread_local std::size_t sfad::detail::globalGradSize = SFAD_DEFAULT_DIR;
 #endif
 
 // Improve branch prediction by marking likely and unlikely execution paths
@@ -89,12 +89,16 @@
 
 
 #include <algorithm>
+#include <vector>
+#include <cstddef>
+#include <mutex>
 
 namespace sfad
 {
 	namespace detail
 	{
-		extern std::size_t globalGradSize;
+		// The gradient size is thread-local so that different threads can work with different numbers of directions
+		extern thread_local std::size_t globalGradSize;
 	}
 
 	static void setGradientSize(const std::size_t n) SFAD_NOEXCEPT
@@ -127,6 +131,8 @@ namespace sfad
 			delete[] _grad;
 		}
 
+		static std::size_t gradSize() SFAD_NOEXCEPT { return detail::globalGradSize; }
+
 		void resizeGradient()
 		{
 			delete[] _grad;
@@ -135,6 +141,16 @@ namespace sfad
 			std::fill(_grad, _grad + detail::globalGradSize, real_t(0));
 		}
 
+		void reserveGradient()
+		{
+			// Only moved-from objects lack a gradient
+			if (sfad_unlikely(!_grad))
+			{
+				_grad = new real_t[detail::globalGradSize];
+				std::fill(_grad, _grad + detail::globalGradSize, real_t(0));
+			}
+		}
+
 	protected:
 		real_t* _grad;
 
@@ -150,6 +166,274 @@ namespace sfad
 		{
 			std::copy(cpy, cpy + detail::globalGradSize, _grad);
 		}
+
+		void copyGradient(const HeapStorage<real_t>& cpy) { copyGradient(cpy._grad); }
+	};
+
+
+	namespace detail
+	{
+		/**
+		 * @brief Pool of gradient blocks with runtime size
+		 * @details Blocks are carved from larger chunks and kept in thread-local free lists, one list per
+		 *          block size (i.e., number of directions). Allocation and deallocation only push to or pop
+		 *          from the free list of the calling thread and do not require synchronization. Blocks may be
+		 *          released by a different thread than the one that allocated them.
+		 *
+		 *          The size of a block is stored in a small header in front of the gradient. While a block
+		 *          is free, the header holds the link to the next free block.
+		 *
+		 *          Chunks are never returned to the operating system. Their memory is reused for subsequent
+		 *          allocations (e.g., by the next simulation). When a thread exits, its free blocks are moved
+		 *          to a shared pool from which other threads refill their lists. Thus, the memory consumption
+		 *          is bounded by the peak demand of concurrently running threads.
+		 */
+		template <typename real_t>
+		class GradientArena
+		{
+		public:
+			static real_t* allocate(std::size_t n)
+			{
+				std::vector<BlockHeader*>& lists = freeLists();
+				if (sfad_unlikely(n >= lists.size()))
+					lists.resize(n + 1, nullptr);
+
+				if (sfad_unlikely(!lists[n]))
+					refill(n, lists);
+
+				BlockHeader* const block = lists[n];
+				lists[n] = block->next;
+				block->capacity = n;
+				return reinterpret_cast<real_t*>(block + 1);
+			}
+
+			static void deallocate(real_t* const grad) SFAD_NOEXCEPT
+			{
+				BlockHeader* const block = reinterpret_cast<BlockHeader*>(grad) - 1;
+				std::vector<BlockHeader*>& lists = freeLists();
+				const std::size_t n = block->capacity;
+
+				// The list is guaranteed to exist if the block has been allocated by this thread
+				if (sfad_unlikely(n >= lists.size()))
+				{
+					try
+					{
+						lists.resize(n + 1, nullptr);
+					}
+					catch (...)
+					{
+						// Drop the block, it is lost until program exit
+						return;
+					}
+				}
+
+				block->next = lists[n];
+				lists[n] = block;
+			}
+
+			static std::size_t capacity(real_t const* const grad) SFAD_NOEXCEPT
+			{
+				return (reinterpret_cast<BlockHeader const*>(grad) - 1)->capacity;
+			}
+
+		private:
+			union BlockHeader
+			{
+				std::size_t capacity;
+				BlockHeader* next;
+			};
+
+			static_assert(sizeof(BlockHeader) % alignof(real_t) == 0, "Gradient blocks are not properly aligned");
+
+			/**
+			 * @brief Free lists of a thread that are handed over to the shared pool on thread exit
+			 */
+			struct ThreadFreeLists
+			{
+				std::vector<BlockHeader*> lists;
+
+				~ThreadFreeLists() SFAD_NOEXCEPT
+				{
+					std::lock_guard<std::mutex> lock(sharedMutex());
+					std::vector<BlockHeader*>& shared = sharedLists();
+					for (std::size_t n = 0; n < lists.size(); ++n)
+					{
+						if (!lists[n])
+							continue;
+
+						if (n >= shared.size())
+						{
+							try
+							{
+								shared.resize(n + 1, nullptr);
+							}
+							catch (...)
+							{
+								return;
+							}
+						}
+
+						// Append shared list to the end of the local list
+						BlockHeader* tail = lists[n];
+						while (tail->next)
+							tail = tail->next;
+
+						tail->next = shared[n];
+						shared[n] = lists[n];
+					}
+				}
+			};
+
+			static std::vector<BlockHeader*>& freeLists()
+			{
+				static thread_local ThreadFreeLists tfl;
+				return tfl.lists;
+			}
+
+			static std::vector<BlockHeader*>& sharedLists()
+			{
+				static std::vector<BlockHeader*> lists;
+				return lists;
+			}
+
+			static std::mutex& sharedMutex()
+			{
+				static std::mutex m;
+				return m;
+			}
+
+			static void refill(std::size_t n, std::vector<BlockHeader*>& lists)
+			{
+				// Take over blocks left behind by finished threads
+				{
+					std::lock_guard<std::mutex> lock(sharedMutex());
+					std::vector<BlockHeader*>& shared = sharedLists();
+					if ((n < shared.size()) && shared[n])
+					{
+						lists[n] = shared[n];
+						shared[n] = nullptr;
+						return;
+					}
+				}
+
+				// Block stride in units of headers
+				const std::size_t stride = 1 + (n * sizeof(real_t) + sizeof(BlockHeader) - 1) / sizeof(BlockHeader);
+				const std::size_t numBlocks = std::max<std::size_t>(16, 4096 / stride);
+
+				BlockHeader* const chunk = new BlockHeader[stride * numBlocks];
+				for (std::size_t i = 0; i < numBlocks; ++i)
+				{
+					BlockHeader* const block = chunk + i * stride;
+					block->next = (i + 1 < numBlocks) ? chunk + (i + 1) * stride : lists[n];
+				}
+				lists[n] = chunk;
+			}
+		};
+	}
+
+	/**
+	 * @brief Storage of the gradient in a block taken from a thread-local pool
+	 * @details The size of the gradient is determined at runtime by the current number of directions
+	 *          (see setGradientSize()) when the object is created. Assigning to an object with too little
+	 *          storage (including compound assignments) enlarges its gradient, additional directions of
+	 *          compound assignments start from zero. Copies take over the directions of the source that
+	 *          are available and set the remaining ones to zero. Objects used as operands must have been
+	 *          created or assigned with the current number of directions. Moving exchanges the gradient blocks and
+	 *          leaves the moved-from object without gradient until it is assigned to.
+	 */
+	template <typename real_t>
+	class ArenaStorage
+	{
+	public:
+		ArenaStorage() : _grad(detail::GradientArena<real_t>::allocate(detail::globalGradSize)) { }
+		ArenaStorage(ArenaStorage<real_t>&& other) SFAD_NOEXCEPT : _grad(other._grad)
+		{
+			other._grad = nullptr;
+		}
+		ArenaStorage(const ArenaStorage<real_t>& cpy) : _grad(detail::GradientArena<real_t>::allocate(detail::globalGradSize))
+		{
+			copyAvailableDirections(cpy);
+		}
+
+		~ArenaStorage() SFAD_NOEXCEPT
+		{
+			if (_grad)
+				detail::GradientArena<real_t>::deallocate(_grad);
+		}
+
+		static std::size_t gradSize() SFAD_NOEXCEPT { return detail::globalGradSize; }
+
+		void resizeGradient()
+		{
+			if (capacity() < detail::globalGradSize)
+				reallocate();
+			std::fill(_grad, _grad + detail::globalGradSize, real_t(0));
+		}
+
+		/**
+		 * @brief Enlarges the gradient to the current number of directions
+		 * @details Existing derivatives are kept, additional directions are set to zero.
+		 */
+		void reserveGradient()
+		{
+			const std::size_t cap = capacity();
+			if (sfad_likely(cap >= detail::globalGradSize))
+				return;
+
+			real_t* const grad = detail::GradientArena<real_t>::allocate(detail::globalGradSize);
+			if (_grad)
+			{
+				std::copy(_grad, _grad + cap, grad);
+				detail::GradientArena<real_t>::deallocate(_grad);
+			}
+			std::fill(grad + cap, grad + detail::globalGradSize, real_t(0));
+			_grad = grad;
+		}
+
+	protected:
+		real_t* _grad;
+
+		void moveAssign(ArenaStorage&& other) SFAD_NOEXCEPT
+		{
+			std::swap(_grad, other._grad);
+		}
+
+		void copyGradient(real_t const* const cpy)
+		{
+			if (sfad_unlikely(capacity() < detail::globalGradSize))
+				reallocate();
+			std::copy(cpy, cpy + detail::globalGradSize, _grad);
+		}
+
+		// The source may have been created with fewer directions than the current number of directions
+		void copyGradient(const ArenaStorage<real_t>& cpy)
+		{
+			if (sfad_unlikely(capacity() < detail::globalGradSize))
+				reallocate();
+			copyAvailableDirections(cpy);
+		}
+
+		// Copies the directions stored in cpy and sets the remaining ones to zero
+		void copyAvailableDirections(const ArenaStorage<real_t>& cpy) SFAD_NOEXCEPT
+		{
+			const std::size_t n = std::min(cpy.capacity(), detail::globalGradSize);
+			std::copy(cpy._grad, cpy._grad + n, _grad);
+			std::fill(_grad + n, _grad + detail::globalGradSize, real_t(0));
+		}
+
+		std::size_t capacity() const SFAD_NOEXCEPT
+		{
+			return _grad ? detail::GradientArena<real_t>::capacity(_grad) : 0;
+		}
+
+		// Replaces the gradient by an uninitialized block for the current number of directions
+		void reallocate()
+		{
+			if (_grad)
+				detail::GradientArena<real_t>::deallocate(_grad);
+			_grad = nullptr;
+			_grad = detail::GradientArena<real_t>::allocate(detail::globalGradSize);
+		}
 	};
 
 
@@ -164,7 +448,10 @@ namespace sfad
 
 		~StackStorage() SFAD_NOEXCEPT { }
 
+		static std::size_t gradSize() SFAD_NOEXCEPT { return detail::globalGradSize; }
+
 		void resizeGradient() SFAD_NOEXCEPT { }
+		void reserveGradient() SFAD_NOEXCEPT { }
 
 	protected:
 		real_t _grad[SFAD_DEFAULT_DIR];
@@ -179,6 +466,53 @@ namespace sfad
 		{
 			std::copy(cpy, cpy + detail::globalGradSize, _grad);
 		}
+
+		void copyGradient(const StackStorage<real_t>& cpy) { copyGradient(cpy._grad); }
+	};
+
+
+	/**
+	 * @brief Provides a storage of the gradient whose number of directions is fixed at compile time
+	 * @details The number of directions @p N does not depend on the current setting (see setGradientSize()).
+	 *          Since all loops over the gradient have a constant trip count, the compiler is able to unroll
+	 *          and vectorize them. The gradient is embedded in the object.
+	 *
+	 *          Use FixedSize<N>::Storage as storage policy (e.g., <tt>Fwd<double, FixedSize<8>::Storage></tt>).
+	 * @tparam N Number of directions
+	 */
+	template <std::size_t N>
+	struct FixedSize
+	{
+		template <typename real_t>
+		class Storage
+		{
+		public:
+			Storage() SFAD_NOEXCEPT { }
+			Storage(const Storage<real_t>& cpy) SFAD_NOEXCEPT { copyGradient(cpy._grad); }
+			Storage(Storage<real_t>&& other) SFAD_NOEXCEPT { copyGradient(other._grad); }
+
+			~Storage() SFAD_NOEXCEPT { }
+
+			static constexpr std::size_t gradSize() SFAD_NOEXCEPT { return N; }
+
+			void resizeGradient() SFAD_NOEXCEPT { }
+			void reserveGradient() SFAD_NOEXCEPT { }
+
+		protected:
+			real_t _grad[N];
+
+			void moveAssign(Storage&& other) SFAD_NOEXCEPT
+			{
+				copyGradient(other._grad);
+			}
+
+			void copyGradient(real_t const* const cpy) SFAD_NOEXCEPT
+			{
+				std::copy(cpy, cpy + N, _grad);
+			}
+
+			void copyGradient(const Storage<real_t>& cpy) SFAD_NOEXCEPT { copyGradient(cpy._grad); }
+		};
 	};
 
 }
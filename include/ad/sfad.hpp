@@ -59,13 +59,13 @@ namespace sfad
 			if (sfad_likely(this != &other))
 			{
 				_val = other._val;
-				storage_t<real_t>::copyGradient(other._grad);
+				storage_t<real_t>::copyGradient(static_cast<const storage_t<real_t>&>(other));
 			}
 
 			return *this;
 		}
 
-		const idx_t gradientSize() const SFAD_NOEXCEPT { return detail::globalGradSize; }
+		const idx_t gradientSize() const SFAD_NOEXCEPT { return storage_t<real_t>::gradSize(); }
 
 		template<typename T, template <class T2> class s_t> friend void swap (Fwd<T, s_t>& x, Fwd<T, s_t>& y) SFAD_NOEXCEPT;
 
@@ -80,7 +80,8 @@ namespace sfad
 		inline void setADValue(const idx_t idx, const real_t v) { storage_t<real_t>::_grad[idx] = v; }
 		inline void setADValue(const real_t v)
 		{
-			std::fill(storage_t<real_t>::_grad, storage_t<real_t>::_grad + detail::globalGradSize, v);
+			storage_t<real_t>::reserveGradient();
+			std::fill(storage_t<real_t>::_grad, storage_t<real_t>::_grad + storage_t<real_t>::gradSize(), v);
 		}
 
 		// Modern C++ accessor
@@ -111,7 +112,8 @@ namespace sfad
 		inline Fwd<real_t, storage_t>& operator+=(const Fwd<real_t, storage_t>& a)
 		{
 			_val += a._val;
-			for (idx_t i = 0; i < detail::globalGradSize; ++i)
+			storage_t<real_t>::reserveGradient();
+			for (idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 				storage_t<real_t>::_grad[i] += a._grad[i];
 
 			return *this;
@@ -127,7 +129,8 @@ namespace sfad
 		inline Fwd<real_t, storage_t>& operator-=(const Fwd<real_t, storage_t>& a)
 		{
 			_val -= a._val;
-			for (idx_t i = 0; i < detail::globalGradSize; ++i)
+			storage_t<real_t>::reserveGradient();
+			for (idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 				storage_t<real_t>::_grad[i] -= a._grad[i];
 
 			return *this;
@@ -142,7 +145,8 @@ namespace sfad
 
 		inline Fwd<real_t, storage_t>& operator*=(const Fwd<real_t, storage_t>& a)
 		{
-			for (idx_t i = 0; i < detail::globalGradSize; ++i)
+			storage_t<real_t>::reserveGradient();
+			for (idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 				storage_t<real_t>::_grad[i] = a._val * storage_t<real_t>::_grad[i] + _val * a._grad[i];
 
 			_val *= a._val;
@@ -158,7 +162,8 @@ namespace sfad
 
 		inline Fwd<real_t, storage_t>& operator/=(const Fwd<real_t, storage_t>& a)
 		{
-			for (idx_t i = 0; i < detail::globalGradSize; ++i)
+			storage_t<real_t>::reserveGradient();
+			for (idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 //				_grad[i] = (_grad[i] - _val / a._val * a._grad[i]) / a._val;
 				storage_t<real_t>::_grad[i] = (storage_t<real_t>::_grad[i] * a._val - _val * a._grad[i]) / (a._val * a._val);
 
@@ -197,7 +202,7 @@ namespace sfad
 		inline Fwd<real_t, storage_t> operator-() const
 		{
 			Fwd<real_t, storage_t> cpy(-_val, false);
-			for (idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 				cpy._grad[i] = -storage_t<real_t>::_grad[i];
 
 			return cpy;
@@ -214,7 +219,7 @@ namespace sfad
 		inline Fwd<real_t, storage_t> operator+(const Fwd<real_t, storage_t>& a) const
 		{
 			Fwd<real_t, storage_t> cpy(_val + a._val, false);
-			for (idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 				cpy._grad[i] = storage_t<real_t>::_grad[i] + a._grad[i];
 			return cpy;
 		}
@@ -233,7 +238,7 @@ namespace sfad
 		inline Fwd<real_t, storage_t> operator-(const Fwd<real_t, storage_t>& a) const
 		{
 			Fwd<real_t, storage_t> cpy(_val - a._val, false);
-			for (idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 				cpy._grad[i] = storage_t<real_t>::_grad[i] - a._grad[i];
 			return cpy;
 		}
@@ -241,7 +246,7 @@ namespace sfad
 		inline friend Fwd<real_t, storage_t> operator-(const real_t v, const Fwd<real_t, storage_t>& a)
 		{
 			Fwd<real_t, storage_t> res(v - a._val, false);
-			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 				res._grad[i] = -a._grad[i];
 			return res;
 		}
@@ -250,7 +255,7 @@ namespace sfad
 		inline Fwd<real_t, storage_t> operator*(const real_t v) const
 		{
 			Fwd<real_t, storage_t> res(_val * v);
-			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 				res._grad[i] = v * storage_t<real_t>::_grad[i];
 			return res;
 		}
@@ -258,7 +263,7 @@ namespace sfad
 		inline Fwd<real_t, storage_t> operator*(const Fwd<real_t, storage_t>& a) const
 		{
 			Fwd<real_t, storage_t> cpy(_val * a._val, false);
-			for (idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 				cpy._grad[i] = a._val * storage_t<real_t>::_grad[i] + _val * a._grad[i];
 			return cpy;
 		}
@@ -266,7 +271,7 @@ namespace sfad
 		inline friend Fwd<real_t, storage_t> operator*(const real_t v, const Fwd<real_t, storage_t>& a)
 		{
 			Fwd<real_t, storage_t> res(v * a._val, false);
-			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 				res._grad[i] = v * a._grad[i];
 			return res;
 		}
@@ -275,7 +280,7 @@ namespace sfad
 		inline Fwd<real_t, storage_t> operator/(const real_t v) const
 		{
 			Fwd<real_t, storage_t> res(_val / v, false);
-			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 				res._grad[i] = storage_t<real_t>::_grad[i] / v;
 			return res;
 		}
@@ -283,7 +288,7 @@ namespace sfad
 		inline Fwd<real_t, storage_t> operator/(const Fwd<real_t, storage_t>& a) const
 		{
 			Fwd<real_t, storage_t> res(_val / a._val, false);
-			for (idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 //				res._grad[i] = (storage_t<real_t>::_grad[i] - _val / a._val * a._grad[i]) / a._val;
 				res._grad[i] = (storage_t<real_t>::_grad[i] * a._val - _val * a._grad[i]) / (a._val * a._val);
 			return res;
@@ -292,7 +297,7 @@ namespace sfad
 		inline friend Fwd<real_t, storage_t> operator/(const real_t v, const Fwd<real_t, storage_t>& a)
 		{
 			Fwd<real_t, storage_t> res(v / a._val, false);
-			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 //				res._grad[i] = -(v / (a._val * a._val) * a._grad[i]);
 				res._grad[i] = -v * a._grad[i] / (a._val * a._val);
 			return res;
@@ -343,7 +348,7 @@ namespace sfad
 	inline Fwd<real_t, storage_t> exp(const Fwd<real_t, storage_t> &a)
 	{
 		Fwd<real_t, storage_t> res(std::exp(a._val), false);
-		for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+		for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 			res._grad[i] = a._grad[i] * res._val;
 		return res;
 	}
@@ -356,19 +361,19 @@ namespace sfad
 		Fwd<real_t, storage_t> res(std::log(a._val), false);
 		if (sfad_likely(a._val > real_t(0)))
 		{
-			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 				res._grad[i] = a._grad[i] / a._val;
 		}
 		else if (a._val == real_t(0))
 		{
 			const real_t inf = std::numeric_limits<real_t>::infinity();
-			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 				res._grad[i] = copysign(inf, -a._grad[i]);
 		}
 		else
 		{
 			const real_t nAn = std::numeric_limits<real_t>::quiet_NaN();
-			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 				res._grad[i] = nAn;
 		}
 
@@ -384,19 +389,19 @@ namespace sfad
 		if (sfad_likely(a._val > real_t(0)))
 		{
 			const real_t tmp = std::log(real_t(10)) * a._val;
-			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 				res._grad[i] = a._grad[i] / tmp;
 		}
 		else if (a._val == real_t(0))
 		{
 			const real_t inf = std::numeric_limits<real_t>::infinity();
-			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 				res._grad[i] = copysign(inf, -a._grad[i]);
 		}
 		else
 		{
 			const real_t nAn = std::numeric_limits<real_t>::quiet_NaN();
-			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 				res._grad[i] = nAn;
 		}
 
@@ -412,19 +417,19 @@ namespace sfad
 		if (sfad_likely(a._val > real_t(0)))
 		{
 			const real_t tmp = real_t(2) * res._val;
-			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 				res._grad[i] = a._grad[i] / tmp;
 		}
 		else if (a._val == real_t(0))
 		{
 			const real_t inf = std::numeric_limits<real_t>::infinity();
-			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 				res._grad[i] = copysign(inf, a._grad[i]);
 		}
 		else
 		{
 			const real_t nAn = std::numeric_limits<real_t>::quiet_NaN();
-			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 				res._grad[i] = nAn;
 		}
 
@@ -436,7 +441,7 @@ namespace sfad
 	{
 		Fwd<real_t, storage_t> res(a._val * a._val, false);
 		const real_t tmp = real_t(2) * a._val;
-		for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+		for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 			res._grad[i] = tmp * a._grad[i];
 		return res;
 	}
@@ -446,7 +451,7 @@ namespace sfad
 	{
 		Fwd<real_t, storage_t> res(std::sin(a._val), false);
 		const real_t tmp = std::cos(a._val);
-		for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+		for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 			res._grad[i] = a._grad[i] * tmp;
 		return res;
 	}
@@ -456,7 +461,7 @@ namespace sfad
 	{
 		Fwd<real_t, storage_t> res(std::cos(a._val), false);
 		const real_t tmp = -std::sin(a._val);
-		for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+		for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 			res._grad[i] = a._grad[i] * tmp;
 		return res;
 	}
@@ -468,7 +473,7 @@ namespace sfad
 
 		const real_t tmpCos = std::cos(a._val);
 		const real_t tmp = tmpCos * tmpCos;
-		for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+		for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 			res._grad[i] = a._grad[i] / tmp;
 		return res;
 	}
@@ -478,7 +483,7 @@ namespace sfad
 	{
 		Fwd<real_t, storage_t> res(std::asin(a._val), false);
 		const real_t tmp = std::sqrt(real_t(1) - a._val * a._val);
-		for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+		for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 			res._grad[i] = a._grad[i] / tmp;
 		return res;
 	}
@@ -488,7 +493,7 @@ namespace sfad
 	{
 		Fwd<real_t, storage_t> res(std::acos(a._val), false);
 		const real_t tmp = std::sqrt(real_t(1) - a._val * a._val);
-		for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+		for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 			res._grad[i] = -a._grad[i] / tmp;
 		return res;
 	}
@@ -498,7 +503,7 @@ namespace sfad
 	{
 		Fwd<real_t, storage_t> res(std::atan(a._val), false);
 		const real_t tmp = real_t(1) + a._val * a._val;
-		for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+		for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 			res._grad[i] = a._grad[i] / tmp;
 		return res;
 	}
@@ -508,7 +513,7 @@ namespace sfad
 	{
 		Fwd<real_t, storage_t> res(std::pow(a._val, v), false);
 		const real_t tmp = v * std::pow(a._val, v - real_t(1));
-		for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+		for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 			res._grad[i] = a._grad[i] * tmp;
 		return res;
 	}
@@ -518,7 +523,7 @@ namespace sfad
 	{
 		Fwd<real_t, storage_t> res(std::pow(v, a._val), false);
 		const real_t tmp = res._val * std::log(v);
-		for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+		for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 			res._grad[i] = a._grad[i] * tmp;
 		return res;
 	}
@@ -529,7 +534,7 @@ namespace sfad
 		Fwd<real_t, storage_t> res(std::pow(a._val, b._val), false);
 		const real_t tmp1 = b._val * std::pow(a._val, b._val - real_t(1));
 		const real_t tmp2 = res._val * std::log(a._val);
-		for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+		for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 			res._grad[i] = a._grad[i] * tmp1 + b._grad[i] * tmp2;
 		return res;
 	}
@@ -539,7 +544,7 @@ namespace sfad
 	{
 		Fwd<real_t, storage_t> res(std::sinh(a._val), false);
 		const real_t tmp = std::cosh(a._val);
-		for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+		for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 			res._grad[i] = a._grad[i] * tmp;
 		return res;
 	}
@@ -549,7 +554,7 @@ namespace sfad
 	{
 		Fwd<real_t, storage_t> res(std::cosh(a._val), false);
 		const real_t tmp = std::sinh(a._val);
-		for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+		for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 			res._grad[i] = a._grad[i] * tmp;
 		return res;
 	}
@@ -560,12 +565,12 @@ namespace sfad
 		Fwd<real_t, storage_t> res(std::tanh(a._val), false);
 /*
 		const real_t tmp = real_t(1) - res._val * res._val;
-		for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+		for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 			res._grad[i] = a._grad[i] * tmp;
 */
 		const real_t tmp = std::cosh(a._val);
 		const real_t tmp2 = tmp * tmp;
-		for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+		for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 			res._grad[i] = a._grad[i] / tmp2;
 		return res;
 	}
@@ -577,17 +582,17 @@ namespace sfad
 		
 		if (a._val > real_t(0))
 		{
-			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 				res._grad[i] = a._grad[i];
 		}
 		else if (a._val < real_t(0))
 		{
-			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 				res._grad[i] = -a._grad[i];
 		}
 		else
 		{
-			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 			{
 				if (a._grad[i] > real_t(0))
 					res._grad[i] = a._grad[i];
@@ -607,7 +612,7 @@ namespace sfad
 	{
 		Fwd<real_t, storage_t> res(std::ceil(a._val), false);
 		const real_t tmp(0);
-		for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+		for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 			res._grad[i] = tmp;
 		return res;
 	}
@@ -617,7 +622,7 @@ namespace sfad
 	{
 		Fwd<real_t, storage_t> res(std::floor(a._val), false);
 		const real_t tmp(0);
-		for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+		for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 			res._grad[i] = tmp;
 		return res;
 	}
@@ -640,7 +645,7 @@ namespace sfad
 		else
 		{
 			res._val = b._val;
-			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 				res._grad[i] = std::max(a._grad[i], b._grad[i]);
 		}
 		return res;
@@ -654,7 +659,7 @@ namespace sfad
 		if (diff > real_t(0))
 		{
 			res._val = v;
-			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 				res._grad[i] = real_t(0);
 		}
 		else if (diff < real_t(0))
@@ -666,7 +671,7 @@ namespace sfad
 		{
 			res._val = a._val;
 			const real_t tmp(0);
-			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 				res._grad[i] = std::max(tmp, a._grad[i]);
 		}
 		return res;
@@ -685,14 +690,14 @@ namespace sfad
 		else if (diff < real_t(0))
 		{
 			res._val = v;
-			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 				res._grad[i] = real_t(0);
 		}
 		else
 		{
 			res._val = a._val;
 			const real_t tmp(0);
-			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 				res._grad[i] = std::max(tmp, a._grad[i]);
 		}
 		return res;
@@ -716,7 +721,7 @@ namespace sfad
 		else
 		{
 			res._val = b._val;
-			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 				res._grad[i] = std::min(a._grad[i], b._grad[i]);
 		}
 		return res;
@@ -730,7 +735,7 @@ namespace sfad
 		if (diff < real_t(0))
 		{
 			res._val = v;
-			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 				res._grad[i] = real_t(0);
 		}
 		else if (diff > real_t(0))
@@ -742,7 +747,7 @@ namespace sfad
 		{
 			res._val = a._val;
 			const real_t tmp(0);
-			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 				res._grad[i] = std::min(tmp, a._grad[i]);
 		}
 		return res;
@@ -761,14 +766,14 @@ namespace sfad
 		else if (diff > real_t(0))
 		{
 			res._val = v;
-			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 				res._grad[i] = real_t(0);
 		}
 		else
 		{
 			res._val = a._val;
 			const real_t tmp(0);
-			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, storage_t>::idx_t i = 0; i < storage_t<real_t>::gradSize(); ++i)
 				res._grad[i] = std::min(tmp, a._grad[i]);
 		}
 		return res;
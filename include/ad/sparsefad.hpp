@@ -0,0 +1,703 @@
+// =============================================================================
+//  SFAD - Simple Forward Automatic Differentiation
+//
+//  Copyright © 2015-2016: Samuel Leweke¹
+//
+//    ¹ Forschungszentrum Juelich GmbH, IBG-1, Juelich, Germany.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+#ifndef _SFAD_SPARSE_HPP_
+#define _SFAD_SPARSE_HPP_
+
+#include <cmath>
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <type_traits>
+#include <cstdint>
+#include <ostream>
+
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#endif
+
+#include "sfad-common.hpp"
+
+namespace sfad
+{
+	namespace detail
+	{
+		typedef std::uint64_t dirmask_t;
+
+		// Number of bits in a direction mask. Each bit marks one direction, except for the
+		// last bit which marks all remaining directions.
+		static const std::size_t maskBits = 64;
+
+		inline dirmask_t directionBit(const std::size_t idx) SFAD_NOEXCEPT
+		{
+			return dirmask_t(1) << std::min(idx, maskBits - 1);
+		}
+
+		inline dirmask_t allDirections(const std::size_t n) SFAD_NOEXCEPT
+		{
+			if (n >= maskBits)
+				return ~dirmask_t(0);
+			return (dirmask_t(1) << n) - 1;
+		}
+
+		inline std::size_t lowestBit(dirmask_t mask) SFAD_NOEXCEPT
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			return __builtin_ctzll(mask);
+#elif defined(_MSC_VER) && defined(_WIN64)
+			unsigned long idx;
+			_BitScanForward64(&idx, mask);
+			return idx;
+#else
+			std::size_t idx = 0;
+			for (; !(mask & dirmask_t(1)); mask >>= 1)
+				++idx;
+			return idx;
+#endif
+		}
+
+		// Calls f(i) for each direction i marked in the mask
+		template <typename F>
+		inline void forEachDirection(dirmask_t mask, const std::size_t n, F f)
+		{
+			while (mask)
+			{
+				const std::size_t b = lowestBit(mask);
+				mask &= mask - 1;
+
+				if (sfad_likely(b < maskBits - 1))
+					f(b);
+				else
+				{
+					for (std::size_t i = maskBits - 1; i < n; ++i)
+						f(i);
+				}
+			}
+		}
+	}
+
+	/**
+	 * Forward AD type that only propagates directions with (potentially) nonzero derivatives
+	 *
+	 * A bitmask marks the directions whose derivatives may be nonzero. All other derivatives
+	 * are zero and their storage is left uninitialized. Operations only process the marked
+	 * directions, which is considerably faster than dense propagation if each variable only
+	 * depends on a few of many directions (e.g., parameter sensitivities).
+	 *
+	 * The first 63 directions have a bit on their own, the last bit marks all remaining directions.
+	 * Note that the derivatives of unmarked directions remain zero even in operations whose dense
+	 * counterpart would produce NaN or infinity (e.g., log() of a negative number).
+	 */
+	template <typename real_t, template <class T> class storage_t>
+	class SparseFwd : public storage_t<real_t>
+	{
+	public:
+		typedef std::size_t idx_t;
+		typedef detail::dirmask_t mask_t;
+
+		SparseFwd() : storage_t<real_t>(), _val(0), _mask(0) { }
+		SparseFwd(const real_t val) : storage_t<real_t>(), _val(val), _mask(0) { }
+		SparseFwd(const real_t val, real_t const* const grad) : storage_t<real_t>(), _val(val), _mask(0)
+		{
+			gatherGradient(grad);
+		}
+		SparseFwd(const SparseFwd<real_t, storage_t>& cpy) : storage_t<real_t>(), _val(cpy._val), _mask(cpy._mask)
+		{
+			copyMarked(cpy);
+		}
+		SparseFwd(SparseFwd<real_t, storage_t>&& other) : storage_t<real_t>(), _val(other._val), _mask(other._mask)
+		{
+			// Exchange gradients to leave a valid gradient in the moved-from object
+			std::swap(storage_t<real_t>::_grad, other._grad);
+			other._mask = 0;
+		}
+
+		// Conversion from a dense AD type (e.g., Fwd)
+		template <typename dense_t, typename = typename std::enable_if<!std::is_arithmetic<dense_t>::value && !std::is_same<dense_t, SparseFwd<real_t, storage_t>>::value>::type>
+		explicit SparseFwd(const dense_t& dense) : storage_t<real_t>(), _val(static_cast<real_t>(dense)), _mask(0)
+		{
+			const idx_t n = gradientSize();
+			for (idx_t i = 0; i < n; ++i)
+			{
+				const real_t g = dense.getADValue(i);
+				storage_t<real_t>::_grad[i] = g;
+				if (g != real_t(0))
+					_mask |= detail::directionBit(i);
+			}
+		}
+
+		~SparseFwd() { }
+
+		SparseFwd<real_t, storage_t>& operator=(SparseFwd<real_t, storage_t>&& other) SFAD_NOEXCEPT
+		{
+			_val = other._val;
+			_mask = other._mask;
+			storage_t<real_t>::moveAssign(std::move(other));
+			other._mask = 0;
+
+			return *this;
+		}
+
+		SparseFwd<real_t, storage_t>& operator=(const SparseFwd<real_t, storage_t>& other)
+		{
+			if (sfad_likely(this != &other))
+			{
+				_val = other._val;
+				_mask = other._mask;
+				copyMarked(other);
+			}
+
+			return *this;
+		}
+
+		const idx_t gradientSize() const SFAD_NOEXCEPT { return storage_t<real_t>::gradSize(); }
+
+		inline const mask_t nonzeroMask() const SFAD_NOEXCEPT { return _mask; }
+
+		// ADOL-C compatibility
+
+		inline real_t getValue() SFAD_NOEXCEPT { return _val; }
+		inline const real_t getValue() const SFAD_NOEXCEPT { return _val; }
+		inline void setValue(const real_t v) SFAD_NOEXCEPT { _val = v; }
+
+		inline const real_t getADValue(const idx_t idx) const
+		{
+			return (_mask & detail::directionBit(idx)) ? storage_t<real_t>::_grad[idx] : real_t(0);
+		}
+
+		inline void setADValue(const idx_t idx, const real_t v)
+		{
+			const mask_t bit = detail::directionBit(idx);
+			if (!(_mask & bit))
+			{
+				if (v == real_t(0))
+					return;
+				markDirections(bit);
+			}
+			storage_t<real_t>::_grad[idx] = v;
+		}
+
+		inline void setADValue(const real_t v)
+		{
+			if (v == real_t(0))
+			{
+				_mask = 0;
+				return;
+			}
+
+			std::fill(storage_t<real_t>::_grad, storage_t<real_t>::_grad + gradientSize(), v);
+			_mask = detail::allDirections(gradientSize());
+		}
+
+		/**
+		 * Writes the derivatives of all marked directions to the given dense gradient
+		 *
+		 * Entries of unmarked directions are left untouched and are expected to be zero.
+		 */
+		inline void scatterGradient(real_t* const grad) const
+		{
+			real_t const* const src = storage_t<real_t>::_grad;
+			detail::forEachDirection(_mask, gradientSize(), [=](idx_t i) { grad[i] = src[i]; });
+		}
+
+		explicit operator real_t() const SFAD_NOEXCEPT { return _val; }
+
+		// Operators with non-temporary results
+
+		// Assignment
+		inline SparseFwd<real_t, storage_t>& operator=(const real_t v)
+		{
+			_val = v;
+			_mask = 0;
+			return *this;
+		}
+
+		// Addition
+		inline SparseFwd<real_t, storage_t>& operator+=(const real_t v)
+		{
+			_val += v;
+			return *this;
+		}
+
+		inline SparseFwd<real_t, storage_t>& operator+=(const SparseFwd<real_t, storage_t>& a)
+		{
+			combine(*this, *this, a, [](real_t x, real_t y) { return x + y; });
+			_val += a._val;
+			return *this;
+		}
+
+		// Substraction
+		inline SparseFwd<real_t, storage_t>& operator-=(const real_t v)
+		{
+			_val -= v;
+			return *this;
+		}
+
+		inline SparseFwd<real_t, storage_t>& operator-=(const SparseFwd<real_t, storage_t>& a)
+		{
+			combine(*this, *this, a, [](real_t x, real_t y) { return x - y; });
+			_val -= a._val;
+			return *this;
+		}
+
+		// Multiplication
+		inline SparseFwd<real_t, storage_t>& operator*=(const real_t v)
+		{
+			transform(*this, *this, [=](real_t x) { return x * v; });
+			_val *= v;
+			return *this;
+		}
+
+		inline SparseFwd<real_t, storage_t>& operator*=(const SparseFwd<real_t, storage_t>& a)
+		{
+			const real_t fa = a._val;
+			const real_t fb = _val;
+			combine(*this, *this, a, [=](real_t x, real_t y) { return fa * x + fb * y; });
+			_val *= a._val;
+			return *this;
+		}
+
+		// Division
+		inline SparseFwd<real_t, storage_t>& operator/=(const real_t v)
+		{
+			transform(*this, *this, [=](real_t x) { return x / v; });
+			_val /= v;
+			return *this;
+		}
+
+		inline SparseFwd<real_t, storage_t>& operator/=(const SparseFwd<real_t, storage_t>& a)
+		{
+			const real_t av = a._val;
+			const real_t v = _val;
+			const real_t denom = a._val * a._val;
+			combine(*this, *this, a, [=](real_t x, real_t y) { return (x * av - v * y) / denom; });
+			_val /= a._val;
+			return *this;
+		}
+
+		// Comparisons
+		inline bool operator!=(const SparseFwd<real_t, storage_t>& v) const SFAD_NOEXCEPT { return v._val != _val; }
+		inline bool operator!=(const real_t v) const SFAD_NOEXCEPT { return v != _val; }
+		inline friend bool operator!=(const real_t v, const SparseFwd<real_t, storage_t>& a) SFAD_NOEXCEPT { return v != a._val; }
+
+		inline bool operator==(const SparseFwd<real_t, storage_t>& v) const SFAD_NOEXCEPT { return v._val == _val; }
+		inline bool operator==(const real_t v) const SFAD_NOEXCEPT { return v == _val; }
+		inline friend bool operator==(const real_t v, const SparseFwd<real_t, storage_t>& a) SFAD_NOEXCEPT { return v == a._val; }
+
+		inline bool operator<=(const SparseFwd<real_t, storage_t>& v) const SFAD_NOEXCEPT { return _val <= v._val; }
+		inline bool operator<=(const real_t v) const SFAD_NOEXCEPT { return _val <= v; }
+		inline friend bool operator<=(const real_t v, const SparseFwd<real_t, storage_t>& a) SFAD_NOEXCEPT { return v <= a._val; }
+
+		inline bool operator>=(const SparseFwd<real_t, storage_t>& v) const SFAD_NOEXCEPT { return _val >= v._val; }
+		inline bool operator>=(const real_t v) const SFAD_NOEXCEPT { return _val >= v; }
+		inline friend bool operator>=(const real_t v, const SparseFwd<real_t, storage_t>& a) SFAD_NOEXCEPT { return v >= a._val; }
+
+		inline bool operator>(const SparseFwd<real_t, storage_t>& v) const SFAD_NOEXCEPT { return _val > v._val; }
+		inline bool operator>(const real_t v) const SFAD_NOEXCEPT { return _val > v; }
+		inline friend bool operator>(const real_t v, const SparseFwd<real_t, storage_t>& a) SFAD_NOEXCEPT { return v > a._val; }
+
+		inline bool operator<(const SparseFwd<real_t, storage_t>& v) const SFAD_NOEXCEPT { return _val < v._val; }
+		inline bool operator<(const real_t v) const SFAD_NOEXCEPT { return _val < v; }
+		inline friend bool operator<(const real_t v, const SparseFwd<real_t, storage_t>& a) SFAD_NOEXCEPT { return v < a._val; }
+
+		// Operators with temporary results
+
+		// Unary sign
+		inline SparseFwd<real_t, storage_t> operator-() const
+		{
+			return unary(*this, -_val, real_t(-1));
+		}
+
+		inline SparseFwd<real_t, storage_t> operator+() const { return *this; }
+
+		// Addition
+		inline SparseFwd<real_t, storage_t> operator+(const real_t v) const
+		{
+			SparseFwd<real_t, storage_t> res(*this);
+			res._val += v;
+			return res;
+		}
+
+		inline SparseFwd<real_t, storage_t> operator+(const SparseFwd<real_t, storage_t>& a) const
+		{
+			return binary(*this, a, _val + a._val, real_t(1), real_t(1));
+		}
+
+		inline friend SparseFwd<real_t, storage_t> operator+(const real_t v, const SparseFwd<real_t, storage_t>& a)
+		{
+			return a + v;
+		}
+
+		// Substraction
+		inline SparseFwd<real_t, storage_t> operator-(const real_t v) const
+		{
+			SparseFwd<real_t, storage_t> res(*this);
+			res._val -= v;
+			return res;
+		}
+
+		inline SparseFwd<real_t, storage_t> operator-(const SparseFwd<real_t, storage_t>& a) const
+		{
+			return binary(*this, a, _val - a._val, real_t(1), real_t(-1));
+		}
+
+		inline friend SparseFwd<real_t, storage_t> operator-(const real_t v, const SparseFwd<real_t, storage_t>& a)
+		{
+			return unary(a, v - a._val, real_t(-1));
+		}
+
+		// Multiplication
+		inline SparseFwd<real_t, storage_t> operator*(const real_t v) const
+		{
+			return unary(*this, _val * v, v);
+		}
+
+		inline SparseFwd<real_t, storage_t> operator*(const SparseFwd<real_t, storage_t>& a) const
+		{
+			return binary(*this, a, _val * a._val, a._val, _val);
+		}
+
+		inline friend SparseFwd<real_t, storage_t> operator*(const real_t v, const SparseFwd<real_t, storage_t>& a)
+		{
+			return unary(a, v * a._val, v);
+		}
+
+		// Division
+		inline SparseFwd<real_t, storage_t> operator/(const real_t v) const
+		{
+			return unary(*this, _val / v, real_t(1) / v);
+		}
+
+		inline SparseFwd<real_t, storage_t> operator/(const SparseFwd<real_t, storage_t>& a) const
+		{
+			return binary(*this, a, _val / a._val, real_t(1) / a._val, -_val / (a._val * a._val));
+		}
+
+		inline friend SparseFwd<real_t, storage_t> operator/(const real_t v, const SparseFwd<real_t, storage_t>& a)
+		{
+			return unary(a, v / a._val, -v / (a._val * a._val));
+		}
+
+		// Math functions
+
+		inline friend SparseFwd<real_t, storage_t> exp(const SparseFwd<real_t, storage_t>& a)
+		{
+			const real_t val = std::exp(a._val);
+			return unary(a, val, val);
+		}
+
+		inline friend SparseFwd<real_t, storage_t> log(const SparseFwd<real_t, storage_t>& a)
+		{
+			return logarithm(a, std::log(a._val), a._val);
+		}
+
+		inline friend SparseFwd<real_t, storage_t> log10(const SparseFwd<real_t, storage_t>& a)
+		{
+			return logarithm(a, std::log10(a._val), std::log(real_t(10)) * a._val);
+		}
+
+		inline friend SparseFwd<real_t, storage_t> sqrt(const SparseFwd<real_t, storage_t>& a)
+		{
+			const real_t val = std::sqrt(a._val);
+			if (sfad_likely(a._val > real_t(0)))
+				return unary(a, val, real_t(1) / (real_t(2) * val));
+
+			SparseFwd<real_t, storage_t> res(val);
+			if (a._val == real_t(0))
+			{
+				const real_t inf = std::numeric_limits<real_t>::infinity();
+				transform(res, a, [=](real_t x) { return std::copysign(inf, x); });
+			}
+			else
+			{
+				const real_t nAn = std::numeric_limits<real_t>::quiet_NaN();
+				transform(res, a, [=](real_t x) { return nAn; });
+			}
+			return res;
+		}
+
+		inline friend SparseFwd<real_t, storage_t> sqr(const SparseFwd<real_t, storage_t>& a)
+		{
+			return unary(a, a._val * a._val, real_t(2) * a._val);
+		}
+
+		inline friend SparseFwd<real_t, storage_t> sin(const SparseFwd<real_t, storage_t>& a)
+		{
+			return unary(a, std::sin(a._val), std::cos(a._val));
+		}
+
+		inline friend SparseFwd<real_t, storage_t> cos(const SparseFwd<real_t, storage_t>& a)
+		{
+			return unary(a, std::cos(a._val), -std::sin(a._val));
+		}
+
+		inline friend SparseFwd<real_t, storage_t> tan(const SparseFwd<real_t, storage_t>& a)
+		{
+			const real_t tmpCos = std::cos(a._val);
+			return unary(a, std::tan(a._val), real_t(1) / (tmpCos * tmpCos));
+		}
+
+		inline friend SparseFwd<real_t, storage_t> asin(const SparseFwd<real_t, storage_t>& a)
+		{
+			return unary(a, std::asin(a._val), real_t(1) / std::sqrt(real_t(1) - a._val * a._val));
+		}
+
+		inline friend SparseFwd<real_t, storage_t> acos(const SparseFwd<real_t, storage_t>& a)
+		{
+			return unary(a, std::acos(a._val), real_t(-1) / std::sqrt(real_t(1) - a._val * a._val));
+		}
+
+		inline friend SparseFwd<real_t, storage_t> atan(const SparseFwd<real_t, storage_t>& a)
+		{
+			return unary(a, std::atan(a._val), real_t(1) / (real_t(1) + a._val * a._val));
+		}
+
+		inline friend SparseFwd<real_t, storage_t> pow(const SparseFwd<real_t, storage_t>& a, const real_t v)
+		{
+			return unary(a, std::pow(a._val, v), v * std::pow(a._val, v - real_t(1)));
+		}
+
+		inline friend SparseFwd<real_t, storage_t> pow(const real_t v, const SparseFwd<real_t, storage_t>& a)
+		{
+			const real_t val = std::pow(v, a._val);
+			return unary(a, val, val * std::log(v));
+		}
+
+		inline friend SparseFwd<real_t, storage_t> pow(const SparseFwd<real_t, storage_t>& a, const SparseFwd<real_t, storage_t>& b)
+		{
+			const real_t val = std::pow(a._val, b._val);
+			return binary(a, b, val, b._val * std::pow(a._val, b._val - real_t(1)), val * std::log(a._val));
+		}
+
+		inline friend SparseFwd<real_t, storage_t> sinh(const SparseFwd<real_t, storage_t>& a)
+		{
+			return unary(a, std::sinh(a._val), std::cosh(a._val));
+		}
+
+		inline friend SparseFwd<real_t, storage_t> cosh(const SparseFwd<real_t, storage_t>& a)
+		{
+			return unary(a, std::cosh(a._val), std::sinh(a._val));
+		}
+
+		inline friend SparseFwd<real_t, storage_t> tanh(const SparseFwd<real_t, storage_t>& a)
+		{
+			const real_t tmp = std::cosh(a._val);
+			return unary(a, std::tanh(a._val), real_t(1) / (tmp * tmp));
+		}
+
+		inline friend SparseFwd<real_t, storage_t> fabs(const SparseFwd<real_t, storage_t>& a)
+		{
+			if (a._val > real_t(0))
+				return a;
+			else if (a._val < real_t(0))
+				return -a;
+
+			SparseFwd<real_t, storage_t> res(real_t(0));
+			transform(res, a, [](real_t x) { return (x < real_t(0)) ? -x : x; });
+			return res;
+		}
+
+		inline friend SparseFwd<real_t, storage_t> abs(const SparseFwd<real_t, storage_t>& a) { return fabs(a); }
+
+		inline friend SparseFwd<real_t, storage_t> ceil(const SparseFwd<real_t, storage_t>& a)
+		{
+			return SparseFwd<real_t, storage_t>(std::ceil(a._val));
+		}
+
+		inline friend SparseFwd<real_t, storage_t> floor(const SparseFwd<real_t, storage_t>& a)
+		{
+			return SparseFwd<real_t, storage_t>(std::floor(a._val));
+		}
+
+		inline friend SparseFwd<real_t, storage_t> fmax(const SparseFwd<real_t, storage_t>& a, const SparseFwd<real_t, storage_t>& b)
+		{
+			const real_t diff = a._val - b._val;
+			if (diff > real_t(0))
+				return a;
+			else if (diff < real_t(0))
+				return b;
+
+			SparseFwd<real_t, storage_t> res(b._val);
+			combine(res, a, b, [](real_t x, real_t y) { return std::max(x, y); });
+			return res;
+		}
+
+		inline friend SparseFwd<real_t, storage_t> fmax(const real_t v, const SparseFwd<real_t, storage_t>& a)
+		{
+			const real_t diff = v - a._val;
+			if (diff > real_t(0))
+				return SparseFwd<real_t, storage_t>(v);
+			else if (diff < real_t(0))
+				return a;
+
+			SparseFwd<real_t, storage_t> res(a._val);
+			transform(res, a, [](real_t x) { return std::max(real_t(0), x); });
+			return res;
+		}
+
+		inline friend SparseFwd<real_t, storage_t> fmax(const SparseFwd<real_t, storage_t>& a, const real_t v) { return fmax(v, a); }
+
+		inline friend SparseFwd<real_t, storage_t> fmin(const SparseFwd<real_t, storage_t>& a, const SparseFwd<real_t, storage_t>& b)
+		{
+			const real_t diff = a._val - b._val;
+			if (diff < real_t(0))
+				return a;
+			else if (diff > real_t(0))
+				return b;
+
+			SparseFwd<real_t, storage_t> res(b._val);
+			combine(res, a, b, [](real_t x, real_t y) { return std::min(x, y); });
+			return res;
+		}
+
+		inline friend SparseFwd<real_t, storage_t> fmin(const real_t v, const SparseFwd<real_t, storage_t>& a)
+		{
+			const real_t diff = v - a._val;
+			if (diff < real_t(0))
+				return SparseFwd<real_t, storage_t>(v);
+			else if (diff > real_t(0))
+				return a;
+
+			SparseFwd<real_t, storage_t> res(a._val);
+			transform(res, a, [](real_t x) { return std::min(real_t(0), x); });
+			return res;
+		}
+
+		inline friend SparseFwd<real_t, storage_t> fmin(const SparseFwd<real_t, storage_t>& a, const real_t v) { return fmin(v, a); }
+
+		inline friend SparseFwd<real_t, storage_t> max(const SparseFwd<real_t, storage_t>& a, const SparseFwd<real_t, storage_t>& b) { return fmax(a, b); }
+		inline friend SparseFwd<real_t, storage_t> max(const real_t v, const SparseFwd<real_t, storage_t>& a) { return fmax(v, a); }
+		inline friend SparseFwd<real_t, storage_t> max(const SparseFwd<real_t, storage_t>& a, const real_t v) { return fmax(a, v); }
+		inline friend SparseFwd<real_t, storage_t> min(const SparseFwd<real_t, storage_t>& a, const SparseFwd<real_t, storage_t>& b) { return fmin(a, b); }
+		inline friend SparseFwd<real_t, storage_t> min(const real_t v, const SparseFwd<real_t, storage_t>& a) { return fmin(v, a); }
+		inline friend SparseFwd<real_t, storage_t> min(const SparseFwd<real_t, storage_t>& a, const real_t v) { return fmin(a, v); }
+
+		inline friend void swap(SparseFwd<real_t, storage_t>& x, SparseFwd<real_t, storage_t>& y) SFAD_NOEXCEPT
+		{
+			using std::swap;
+			swap(x._val, y._val);
+			swap(x._mask, y._mask);
+			swap(x._grad, y._grad);
+		}
+
+		inline friend std::ostream& operator<<(std::ostream& os, const SparseFwd<real_t, storage_t>& a)
+		{
+			os << a._val << " [";
+			const idx_t n = a.gradientSize();
+			for (idx_t i = 0; i < n; ++i)
+			{
+				if (i > 0)
+					os << ", ";
+				os << a.getADValue(i);
+			}
+			os << "]";
+			return os;
+		}
+
+	protected:
+		real_t _val;
+		mask_t _mask; //!< Marks the directions whose derivatives may be nonzero
+
+		// Sets the derivatives of the given directions to zero and marks them
+		inline void markDirections(const mask_t dirs)
+		{
+			real_t* const grad = storage_t<real_t>::_grad;
+			detail::forEachDirection(dirs & ~_mask, gradientSize(), [=](idx_t i) { grad[i] = real_t(0); });
+			_mask |= dirs;
+		}
+
+		inline void copyMarked(const SparseFwd<real_t, storage_t>& cpy)
+		{
+			real_t* const grad = storage_t<real_t>::_grad;
+			real_t const* const src = cpy._grad;
+			detail::forEachDirection(cpy._mask, gradientSize(), [=](idx_t i) { grad[i] = src[i]; });
+		}
+
+		inline void gatherGradient(real_t const* const src)
+		{
+			const idx_t n = gradientSize();
+			real_t* const grad = storage_t<real_t>::_grad;
+			for (idx_t i = 0; i < n; ++i)
+			{
+				grad[i] = src[i];
+				if (src[i] != real_t(0))
+					_mask |= detail::directionBit(i);
+			}
+		}
+
+		// Sets res to f(a) in all directions of a (res may alias a)
+		template <typename F>
+		static inline void transform(SparseFwd<real_t, storage_t>& res, const SparseFwd<real_t, storage_t>& a, F f)
+		{
+			real_t* const grad = res._grad;
+			real_t const* const ga = a._grad;
+			detail::forEachDirection(a._mask, a.gradientSize(), [&](idx_t i) { grad[i] = f(ga[i]); });
+			res._mask = a._mask;
+		}
+
+		// Sets res to f(a, b) in all directions of a or b, missing derivatives are passed as zero (res may alias a or b)
+		template <typename F>
+		static inline void combine(SparseFwd<real_t, storage_t>& res, const SparseFwd<real_t, storage_t>& a, const SparseFwd<real_t, storage_t>& b, F f)
+		{
+			const idx_t n = a.gradientSize();
+			real_t* const grad = res._grad;
+			real_t const* const ga = a._grad;
+			real_t const* const gb = b._grad;
+			const mask_t maskA = a._mask;
+			const mask_t maskB = b._mask;
+
+			detail::forEachDirection(maskA & maskB, n, [&](idx_t i) { grad[i] = f(ga[i], gb[i]); });
+			detail::forEachDirection(maskA & ~maskB, n, [&](idx_t i) { grad[i] = f(ga[i], real_t(0)); });
+			detail::forEachDirection(maskB & ~maskA, n, [&](idx_t i) { grad[i] = f(real_t(0), gb[i]); });
+			res._mask = maskA | maskB;
+		}
+
+		// Returns a variable with value val and derivatives factor * a
+		static inline SparseFwd<real_t, storage_t> unary(const SparseFwd<real_t, storage_t>& a, const real_t val, const real_t factor)
+		{
+			SparseFwd<real_t, storage_t> res(val);
+			transform(res, a, [=](real_t x) { return factor * x; });
+			return res;
+		}
+
+		// Returns a variable with value val and derivatives fa * a + fb * b
+		static inline SparseFwd<real_t, storage_t> binary(const SparseFwd<real_t, storage_t>& a, const SparseFwd<real_t, storage_t>& b, const real_t val, const real_t fa, const real_t fb)
+		{
+			SparseFwd<real_t, storage_t> res(val);
+			combine(res, a, b, [=](real_t x, real_t y) { return fa * x + fb * y; });
+			return res;
+		}
+
+		static inline SparseFwd<real_t, storage_t> logarithm(const SparseFwd<real_t, storage_t>& a, const real_t val, const real_t denom)
+		{
+			if (sfad_likely(a._val > real_t(0)))
+				return unary(a, val, real_t(1) / denom);
+
+			SparseFwd<real_t, storage_t> res(val);
+			if (a._val == real_t(0))
+			{
+				const real_t inf = std::numeric_limits<real_t>::infinity();
+				transform(res, a, [=](real_t x) { return std::copysign(inf, -x); });
+			}
+			else
+			{
+				const real_t nAn = std::numeric_limits<real_t>::quiet_NaN();
+				transform(res, a, [=](real_t x) { return nAn; });
+			}
+			return res;
+		}
+	};
+
+}
+
+#endif
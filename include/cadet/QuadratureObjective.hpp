@@ -0,0 +1,62 @@
+// =============================================================================
+//  CADET - The Chromatography Analysis and Design Toolkit
+//  
+//  Copyright © 2008-2016: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//  
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+/**
+ * @file 
+ * Defines an objective function given by a time integral over the simulated state.
+ */
+
+#ifndef LIBCADET_QUADRATUREOBJECTIVE_HPP_
+#define LIBCADET_QUADRATUREOBJECTIVE_HPP_
+
+#include "cadet/LibExportImport.hpp"
+#include "cadet/cadetCompilerInfo.hpp"
+
+namespace cadet
+{
+
+/**
+ * @brief Interface for objective functions given by a time integral
+ * @details The objective function is defined as \f[ G(p) = \int_{t_0}^{t_{end}} g\left(t, y(t)\right) \, \mathrm{d}t, \f]
+ *          where @f$ y @f$ is the full state vector of the model system. The integrand @f$ g @f$ must
+ *          not depend on the parameters @f$ p @f$ explicitly. Its gradient with respect to the
+ *          parameters is computed by ISimulator::integrateAdjoint().
+ */
+class CADET_API IQuadratureObjective
+{
+public:
+	virtual ~IQuadratureObjective() CADET_NOEXCEPT { }
+
+	/**
+	 * @brief Evaluates the integrand @f$ g @f$ at the given time and state
+	 * 
+	 * @param [in] t Simulation time
+	 * @param [in] y Pointer to the full state vector
+	 * @param [in] nDof Number of elements in the state vector
+	 * @return Value of the integrand
+	 */
+	virtual double integrand(double t, double const* const y, unsigned int nDof) = 0;
+
+	/**
+	 * @brief Evaluates the gradient @f$ \frac{\partial g}{\partial y} @f$ of the integrand with respect to the state
+	 * 
+	 * @param [in] t Simulation time
+	 * @param [in] y Pointer to the full state vector
+	 * @param [in] nDof Number of elements in the state and gradient vectors
+	 * @param [out] grad Pointer to the gradient vector, which has to be overwritten completely
+	 */
+	virtual void stateGradient(double t, double const* const y, unsigned int nDof, double* const grad) = 0;
+};
+
+} // namespace cadet
+
+#endif  // LIBCADET_QUADRATUREOBJECTIVE_HPP_
@@ -32,6 +32,7 @@ namespace cadet
 
 class IModelSystem;
 class ISolutionRecorder;
+class IQuadratureObjective;
 class IParameterProvider;
 
 enum class ConsistentInitialization : int
@@ -410,6 +411,31 @@ public:
 	 */
 	virtual void integrate() = 0;
 
+	/**
+	 * @brief Computes an objective function and its gradient with respect to the sensitive parameters by adjoint sensitivity analysis
+	 * @details The objective is given by a time integral over the full time domain (see cadet::IQuadratureObjective).
+	 *          The model is integrated forward in time while IDAS stores checkpoints of the trajectory. Afterwards,
+	 *          the adjoint system is integrated backwards in time and the gradient is obtained from a backward quadrature.
+	 *          The cost of the backward pass does not scale with the number of parameters, which makes this mode
+	 *          favorable over forward sensitivities (see #setSensitiveParameter) for many parameters and few objectives.
+	 *          The adjoint system is initialized consistently at the end of the time domain and at every discontinuous
+	 *          section transition. Its linear systems are solved with the transposed LU factors of the full (sparse)
+	 *          Jacobian instead of the block decomposition used by the forward integration, which requires more memory
+	 *          for large discretizations.
+	 *
+	 *          The parameters are selected by #setSensitiveParameter, but no forward sensitivity systems are solved
+	 *          in this mode. Previously initialized forward sensitivities (see #initializeFwdSensitivities) remain active
+	 *          for subsequent calls of #integrate. Solutions are not recorded. Sensitivities of algebraic state variables induced by 
+	 *          the consistent initialization of the first section are neglected, which is exact if the initial 
+	 *          conditions do not depend on the sensitive parameters.
+	 *
+	 * @param [in] objective Objective function
+	 * @param [in] numStepsCheckpoint Number of integration steps between two consecutive checkpoints
+	 * @param [out] gradient Gradient of the objective function with respect to the sensitive parameters (resized to #numSensParams)
+	 * @return Value of the objective function
+	 */
+	virtual double integrateAdjoint(IQuadratureObjective& objective, unsigned int numStepsCheckpoint, std::vector<double>& gradient) = 0;
+
 
 	/**
 	 * @brief Returns the bare state vector for the last timepoint
@@ -596,6 +622,33 @@ public:
 	 */
 	virtual void setRelativeErrorToleranceSens(double relTol) = 0;
 
+	/**
+	 * @brief Sets whether factorizations of the Jacobian are reused over multiple time steps
+	 * @details If enabled, the Jacobian is only updated and factorized when requested by the time
+	 *          integrator (e.g., on convergence failures) and the resulting modified Newton method
+	 *          accounts for changes in the BDF coefficient @f$ \alpha @f$ by rescaling the Newton
+	 *          correction. A new Jacobian is requested as soon as the ratio of the current @f$ \alpha @f$
+	 *          and the one used for the factorization deviates from @f$ 1 @f$ by more than @p cjRatioTol.
+	 *          Otherwise, the Jacobian is updated in every residual evaluation and factorized before
+	 *          each linear solve that follows an update. Reusing factorizations is disabled by default
+	 *          and has no effect while forward sensitivities are integrated, since the sensitivity
+	 *          residuals require the Jacobian at the current state.
+	 * @param [in] reuse Determines whether factorizations are reused
+	 * @param [in] cjRatioTol Maximum deviation of the ratio of current and factorized @f$ \alpha @f$ from @f$ 1 @f$
+	 */
+	virtual void setJacobianReuse(bool reuse, double cjRatioTol) = 0;
+
+	/**
+	 * @brief Sets whether the sensitivity systems are corrected simultaneously with the original system
+	 * @details In the staggered corrector method (default), the Newton iteration of the original system
+	 *          converges before the sensitivity systems are corrected. In the simultaneous corrector
+	 *          method, state and sensitivities are corrected in one Newton iteration and the linear systems
+	 *          of all of them are solved in a single batch with the same factorization of the Jacobian.
+	 *          The setting takes effect with the next call of integrate().
+	 * @param [in] simultaneous Determines whether the simultaneous corrector method is used
+	 */
+	virtual void setSimultaneousSensitivityCorrector(bool simultaneous) = 0;
+
 	/**
 	 * @brief Returns the elapsed time of the last simulation run in seconds
 	 * @return Elapsed time the last call of integrate() took in seconds
@@ -42,5 +42,6 @@
 #include "cadet/ModelBuilder.hpp"
 #include "cadet/SolutionExporter.hpp"
 #include "cadet/SolutionRecorder.hpp"
+#include "cadet/QuadratureObjective.hpp"
 #include "cadet/Simulator.hpp"
 #include "cadet/FactoryFuncs.hpp"
@@ -20,6 +20,7 @@
 
 #include <vector>
 #include <sstream>
+#include <algorithm>
 
 #include "cadet/SolutionRecorder.hpp"
 
@@ -49,7 +50,7 @@ public:
 	InternalStorageUnitOpRecorder(UnitOpIdx idx) : _cfgSolution({false, false, false, true, false}),
 		_cfgSolutionDot({false, false, false, false, false}), _cfgSensitivity({false, false, false, true, false}),
 		_cfgSensitivityDot({false, false, false, true, false}), _storeTime(false), _splitComponents(true), _curCfg(nullptr),
-		_nComp(0), _numTimesteps(0), _numSens(0), _unitOp(idx), _needsReAlloc(false)
+		_nComp(0), _numTimesteps(0), _numSens(0), _unitOp(idx), _needsReAlloc(false), _transposeColumn(false), _transposeFlux(false)
 	{
 	}
 
@@ -240,6 +241,11 @@ public:
 			}
 		}
 
+		// Cell-major column data is stored in canonical component-major layout
+		_transposeColumn = isCellMajor(order, len);
+		if (_transposeColumn)
+			std::swap(_columnLayout[1], _columnLayout[2]);
+
 		order = exporter.mobilePhaseOrdering(len);
 		_particleLayout.clear();
 		_particleLayout.reserve(len + 1); // First slot is time
@@ -281,6 +287,11 @@ public:
 					break;
 			}
 		}
+
+		// Cell-major flux data is stored in canonical component-major layout
+		_transposeFlux = isCellMajor(order, len);
+		if (_transposeFlux)
+			std::swap(_fluxLayout[1], _fluxLayout[2]);
 		
 		// Everything is ok, we have nothing to do
 		if (!_needsReAlloc)
@@ -347,7 +358,10 @@ public:
 		if (_curCfg->storeColumn)
 		{
 			double const* const data = exporter.concentration();
-			_curBulk->insert(_curBulk->end(), data, data + exporter.numColumnDofs());
+			if (_transposeColumn)
+				appendTransposed(*_curBulk, data, exporter.numAxialCells(), _nComp);
+			else
+				_curBulk->insert(_curBulk->end(), data, data + exporter.numColumnDofs());
 		}
 
 		if (_curCfg->storeParticle)
@@ -359,7 +373,10 @@ public:
 		if (_curCfg->storeFlux)
 		{
 			double const* const data = exporter.flux();
-			_curFlux->insert(_curFlux->end(), data, data + exporter.numFluxDofs());
+			if (_transposeFlux)
+				appendTransposed(*_curFlux, data, exporter.numAxialCells(), _nComp);
+			else
+				_curFlux->insert(_curFlux->end(), data, data + exporter.numFluxDofs());
 		}
 	}
 
@@ -655,6 +672,37 @@ protected:
 	UnitOpIdx _unitOp;
 
 	bool _needsReAlloc;
+	bool _transposeColumn; //!< Determines whether column data is exported in cell-major ordering and has to be transposed
+	bool _transposeFlux; //!< Determines whether flux data is exported in cell-major ordering and has to be transposed
+
+	/**
+	 * @brief Checks whether the given ordering is a cell-major (axial cell, component) ordering
+	 * @param [in] order Array with state ordering
+	 * @param [in] len Length of the array
+	 * @return @c true if the ordering is cell-major, otherwise @c false
+	 */
+	static inline bool isCellMajor(StateOrdering const* order, unsigned int len)
+	{
+		return (len == 2) && (order[0] == StateOrdering::AxialCell) && (order[1] == StateOrdering::Component);
+	}
+
+	/**
+	 * @brief Appends a cell-major block to the storage in component-major ordering
+	 * @param [in,out] storage Storage the data is appended to
+	 * @param [in] data Cell-major data block of size @p nCells times @p nComp
+	 * @param [in] nCells Number of axial cells
+	 * @param [in] nComp Number of components
+	 */
+	static inline void appendTransposed(std::vector<double>& storage, double const* const data, unsigned int nCells, unsigned int nComp)
+	{
+		const std::size_t offset = storage.size();
+		storage.resize(offset + nCells * nComp);
+		for (unsigned int cell = 0; cell < nCells; ++cell)
+		{
+			for (unsigned int comp = 0; comp < nComp; ++comp)
+				storage[offset + comp * nCells + cell] = data[cell * nComp + comp];
+		}
+	}
 };
 
 
@@ -23,14 +23,15 @@ namespace cadet
 namespace ad
 {
 
-void prepareAdVectorSeedsForBandMatrix(active* const adVec, unsigned int adDirOffset, unsigned int rows, 
-	unsigned int lowerBandwidth, unsigned int upperBandwidth, unsigned int diagDir)
+template <typename AdType>
+void prepareAdVectorSeedsForBandMatrix(AdType* const adVec, unsigned int adDirOffset, unsigned int rows, 
+	unsigned int lowerBandwidth, unsigned int upperBandwidth, unsigned int diagDir, unsigned int vecStride)
 {
 	// Start with diagonal Jacobian element
 	unsigned int dir = diagDir;
 	for (unsigned int eq = 0; eq < rows; ++eq)
 	{
-		adVec[eq].setADValue(adDirOffset + dir, 1.0);
+		adVec[eq * vecStride].setADValue(adDirOffset + dir, 1.0);
 
 		// Wrap around at end of row and jump to lowest subdiagonal
 		if (dir == diagDir + upperBandwidth)
@@ -40,7 +41,8 @@ void prepareAdVectorSeedsForBandMatrix(active* const adVec, unsigned int adDirOf
 	}
 }
 
-void extractBandedJacobianFromAd(active const* const adVec, unsigned int adDirOffset, unsigned int diagDir, linalg::BandMatrix& mat)
+template <typename AdType>
+void extractBandedJacobianFromAd(AdType const* const adVec, unsigned int adDirOffset, unsigned int diagDir, linalg::BandMatrix& mat, unsigned int vecStride)
 {
 	const unsigned int lowerBandwidth = mat.lowerBandwidth();
 	const unsigned int upperBandwidth = mat.upperBandwidth();
@@ -55,7 +57,7 @@ void extractBandedJacobianFromAd(active const* const adVec, unsigned int adDirOf
 		// Loop over diagonals
 		for (unsigned int diag = 0; diag < stride; ++diag)
 		{
-			mat.native(eq, diag) = adVec[eq].getADValue(adDirOffset + dir);
+			mat.native(eq, diag) = adVec[eq * vecStride].getADValue(adDirOffset + dir);
 
 			// Wrap around at end of row and jump to lowest subdiagonal
 			if (dir == diagDir + upperBandwidth)
@@ -94,7 +96,7 @@ void extractDenseJacobianFromBandedAd(active const* const adVec, unsigned int ro
 	}
 }
 
-double compareBandedJacobianWithAd(active const* const adVec, unsigned int adDirOffset, unsigned int diagDir, const linalg::BandMatrix& mat)
+double compareBandedJacobianWithAd(active const* const adVec, unsigned int adDirOffset, unsigned int diagDir, const linalg::BandMatrix& mat, unsigned int vecStride)
 {
 	const unsigned int lowerBandwidth = mat.lowerBandwidth();
 	const unsigned int upperBandwidth = mat.upperBandwidth();
@@ -111,7 +113,7 @@ double compareBandedJacobianWithAd(active const* const adVec, unsigned int adDir
 		// Loop over diagonals
 		for (unsigned int diag = 0; diag < stride; ++diag)
 		{
-			double baseVal = adVec[eq].getADValue(adDirOffset + dir);
+			double baseVal = adVec[eq * vecStride].getADValue(adDirOffset + dir);
 			if (std::isnan(mat.native(eq, diag)) || std::isnan(baseVal))
 				return std::numeric_limits<double>::quiet_NaN();
 			const double diff = std::abs(mat.native(eq, diag) - baseVal);
@@ -173,6 +175,21 @@ double compareDenseJacobianWithBandedAd(active const* const adVec, unsigned int
 	return maxDiff;
 }
 
+template void prepareAdVectorSeedsForBandMatrix<active>(active* const adVec, unsigned int adDirOffset, unsigned int rows, 
+	unsigned int lowerBandwidth, unsigned int upperBandwidth, unsigned int diagDir, unsigned int vecStride);
+template void extractBandedJacobianFromAd<active>(active const* const adVec, unsigned int adDirOffset, unsigned int diagDir, linalg::BandMatrix& mat, unsigned int vecStride);
+
+// Instantiate band compression for all fixed size AD types
+#define CADET_ADUTILS_INSTANTIATE_FIXED(N, UNUSED1, UNUSED2)                                                                         \
+	template void prepareAdVectorSeedsForBandMatrix<fixedActive<N>>(fixedActive<N>* const adVec, unsigned int adDirOffset,        \
+		unsigned int rows, unsigned int lowerBandwidth, unsigned int upperBandwidth, unsigned int diagDir, unsigned int vecStride); \
+	template void extractBandedJacobianFromAd<fixedActive<N>>(fixedActive<N> const* const adVec, unsigned int adDirOffset,        \
+		unsigned int diagDir, linalg::BandMatrix& mat, unsigned int vecStride);
+
+CADET_FOREACH_FIXED_AD_DIRECTIONS(CADET_ADUTILS_INSTANTIATE_FIXED, , )
+
+#undef CADET_ADUTILS_INSTANTIATE_FIXED
+
 }  // namespace ad
 
 }  // namespace cadet
@@ -47,9 +47,12 @@ namespace ad
  * @param [in] lowerBandwidth Lower bandwidth (number of lower subdiagonals) of the banded Jacobian
  * @param [in] upperBandwidth Upper bandwidth (number of upper superdiagonals) of the banded Jacobian
  * @param [in] diagDir Diagonal direction index
+ * @param [in] vecStride Distance between consecutive rows in the AD vector (defaults to 1, i.e., contiguous rows)
+ * @tparam AdType AD datatype (either active or one of the fixed size types fixedActive)
  */
-void prepareAdVectorSeedsForBandMatrix(active* const adVec, unsigned int adDirOffset, unsigned int rows, 
-	unsigned int lowerBandwidth, unsigned int upperBandwidth, unsigned int diagDir);
+template <typename AdType>
+void prepareAdVectorSeedsForBandMatrix(AdType* const adVec, unsigned int adDirOffset, unsigned int rows, 
+	unsigned int lowerBandwidth, unsigned int upperBandwidth, unsigned int diagDir, unsigned int vecStride = 1);
 
 /**
  * @brief Extracts a band matrix from band compressed AD seed vectors
@@ -59,8 +62,11 @@ void prepareAdVectorSeedsForBandMatrix(active* const adVec, unsigned int adDirOf
  * @param [in] adDirOffset Offset in the AD directions (can be used to move past parameter sensitivity directions)
  * @param [in] diagDir Diagonal direction index
  * @param [out] mat BandMatrix to be populated with the Jacobian
+ * @param [in] vecStride Distance between consecutive rows in the AD vector (defaults to 1, i.e., contiguous rows)
+ * @tparam AdType AD datatype (either active or one of the fixed size types fixedActive)
  */
-void extractBandedJacobianFromAd(active const* const adVec, unsigned int adDirOffset, unsigned int diagDir, linalg::BandMatrix& mat);
+template <typename AdType>
+void extractBandedJacobianFromAd(AdType const* const adVec, unsigned int adDirOffset, unsigned int diagDir, linalg::BandMatrix& mat, unsigned int vecStride = 1);
 
 /**
  * @brief Extracts a dense submatrix from band compressed AD seed vectors
@@ -91,9 +97,10 @@ void extractDenseJacobianFromBandedAd(active const* const adVec, unsigned int ro
  * @param [in] adDirOffset Offset in the AD directions (can be used to move past parameter sensitivity directions)
  * @param [in] diagDir Diagonal direction index
  * @param [in] mat BandMatrix populated with the analytic Jacobian
+ * @param [in] vecStride Distance between consecutive rows in the AD vector (defaults to 1, i.e., contiguous rows)
  * @return The maximum absolute relative difference between the matrix elements
  */
-double compareBandedJacobianWithAd(active const* const adVec, unsigned int adDirOffset, unsigned int diagDir, const linalg::BandMatrix& mat);
+double compareBandedJacobianWithAd(active const* const adVec, unsigned int adDirOffset, unsigned int diagDir, const linalg::BandMatrix& mat, unsigned int vecStride = 1);
 
 /**
  * @brief Compares a dense submatrix with a band compressed AD version
@@ -122,9 +129,11 @@ double compareDenseJacobianWithBandedAd(active const* const adVec, unsigned int
  * @param [in] adVec Source vector of AD datatypes
  * @param [out] dest Destination vector
  * @param [in] size Size of the vectors
+ * @tparam AdType AD datatype
  * @todo Check if loop unrolling is beneficial
  */
-inline void copyFromAd(active const* const adVec, double* const dest, unsigned int size)
+template <typename AdType>
+inline void copyFromAd(AdType const* const adVec, double* const dest, unsigned int size)
 {
 	for (unsigned int i = 0; i < size; ++i)
 		dest[i] = static_cast<double>(adVec[i]);
@@ -135,14 +144,34 @@ inline void copyFromAd(active const* const adVec, double* const dest, unsigned i
  * @param [in] src Source vector
  * @param [out] adVec Destination vector of AD datatypes
  * @param [in] size Size of the vectors
+ * @tparam AdType AD datatype
  * @todo Check if loop unrolling is beneficial
  */
-inline void copyToAd(double const* const src, active* const adVec, unsigned int size)
+template <typename AdType>
+inline void copyToAd(double const* const src, AdType* const adVec, unsigned int size)
 {
 	for (unsigned int i = 0; i < size; ++i)
 		adVec[i].setValue(src[i]);
 }
 
+/**
+ * @brief Copies a vector of sparse AD datatypes (values and derivatives) into a vector of dense AD datatypes
+ * @param [in] sparseVec Source vector of sparse AD datatypes
+ * @param [out] adVec Destination vector of AD datatypes
+ * @param [in] size Size of the vectors
+ * @tparam SparseType Sparse AD datatype (see sparseActive)
+ * @tparam AdType Dense AD datatype
+ */
+template <typename SparseType, typename AdType>
+inline void copyFromSparseAd(SparseType const* const sparseVec, AdType* const adVec, unsigned int size)
+{
+	for (unsigned int i = 0; i < size; ++i)
+	{
+		adVec[i] = static_cast<double>(sparseVec[i]);
+		sparseVec[i].scatterGradient(&adVec[i][0]);
+	}
+}
+
 /**
  * @brief Resets a vector of AD datatypes erasing both its value and its derivatives
  * @param [in,out] adVec Vector of AD datatypes to be reset
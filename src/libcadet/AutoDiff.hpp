@@ -20,6 +20,9 @@
 #include "cadet/cadetCompilerInfo.hpp"
 #include "common/CompilerSpecific.hpp"
 
+#include <algorithm>
+#include <cstddef>
+
 #if defined(ACTIVE_ADOLC)
 
 	#define ADOLC_TAPELESS
@@ -28,6 +31,12 @@
 
 	#define ACTIVE_INIT ADOLC_TAPELESS_UNIQUE_INTERNALS
 
+	// ADOL-C does not provide AD types with a number of directions fixed at compile time
+	#define CADET_FOREACH_FIXED_AD_DIRECTIONS(MACRO, ARG1, ARG2)
+
+	// ADOL-C does not provide an AD type with sparse gradients
+	#define CADET_FOREACH_SPARSE_AD_TYPE(MACRO, ARG1, ARG2)
+
 	namespace cadet
 	{
 
@@ -80,6 +89,10 @@
 			}
 		};
 
+		// Placeholder, never instantiated since CADET_FOREACH_FIXED_AD_DIRECTIONS is empty
+		template <unsigned int N>
+		using fixedActive = active;
+
 		namespace ad
 		{
 			/**
@@ -97,6 +110,8 @@
 			/**
 			 * @brief Sets the current number of AD directions (seed vectors)
 			 * @details The number of AD directions must not exceed the value returned by getMaxDirections().
+			 *          ADOL-C keeps a process-wide number of directions. Hence, simulations with different
+			 *          numbers of directions must not run concurrently.
 			 * 
 			 * @param [in] numDir Number of required AD directions
 			 */
@@ -110,42 +125,91 @@
 
 #elif defined(ACTIVE_SFAD) || defined(ACTIVE_SETFAD)
 
-	#define SFAD_DEFAULT_DIR 80
+	#ifndef SFAD_DEFAULT_DIR
+		#define SFAD_DEFAULT_DIR 80
+	#endif
 
 	#if defined(ACTIVE_SFAD)
 		#include "sfad.hpp"
 	#else
 		#include "setfad.hpp"
 	#endif
+	#include "sparsefad.hpp"
 
 	#define ACTIVE_INIT SFAD_GLOBAL_GRAD_SIZE
 
+	/**
+	 * @brief Expands the given macro for each number of directions of the compile-time sized AD types
+	 * @details The macro is called as @c MACRO(N, ARG1, ARG2) where @c N is the number of directions.
+	 */
+	#define CADET_FOREACH_FIXED_AD_DIRECTIONS(MACRO, ARG1, ARG2) MACRO(8, ARG1, ARG2) MACRO(16, ARG1, ARG2) MACRO(32, ARG1, ARG2) MACRO(64, ARG1, ARG2)
+
+	/**
+	 * @brief Expands the given macro for the AD type with sparse gradients (if there is one)
+	 * @details The macro is called as @c MACRO(TYPE, ARG1, ARG2) where @c TYPE is the AD type.
+	 */
+	#define CADET_FOREACH_SPARSE_AD_TYPE(MACRO, ARG1, ARG2) MACRO(sparseActive, ARG1, ARG2)
+
 	namespace cadet
 	{
 		
+		// The gradient of each active variable is taken from a thread-local pool and sized to the number
+		// of AD directions at its creation. This keeps the AD vectors, which are allocated after the
+		// number of directions has been set, compact.
 		#if defined(ACTIVE_SFAD)
-			typedef sfad::Fwd<double, sfad::StackStorage> active;
+			typedef sfad::Fwd<double, sfad::ArenaStorage> active;
 		#else
-			typedef sfad::FwdET<double, sfad::StackStorage> active;
+			typedef sfad::FwdET<double, sfad::ArenaStorage> active;
 		#endif
 
+		/**
+		 * @brief AD type with a number of directions fixed at compile time
+		 * @details The gradient is embedded in the object and all loops over the directions have a constant
+		 *          trip count. This type is used for computing Jacobians by band compression, which requires
+		 *          only few directions. It is available for the numbers of directions listed in
+		 *          CADET_FOREACH_FIXED_AD_DIRECTIONS (see ad::fixedDirections()).
+		 * @tparam N Number of directions
+		 */
+		#if defined(ACTIVE_SFAD)
+			template <unsigned int N>
+			using fixedActive = sfad::Fwd<double, sfad::FixedSize<N>::template Storage>;
+		#else
+			template <unsigned int N>
+			using fixedActive = sfad::FwdET<double, sfad::FixedSize<N>::template Storage>;
+		#endif
+
+		/**
+		 * @brief AD type that only propagates directions with potentially nonzero derivatives
+		 * @details A bitmask marks the directions that may be nonzero. This type is used for parameter
+		 *          sensitivities, where each residual only depends on a few of the sensitive parameters.
+		 *          Active variables are converted explicitly, the gradient is taken from the same
+		 *          thread-local pool as the one of active.
+		 */
+		typedef sfad::SparseFwd<double, sfad::ArenaStorage> sparseActive;
+
 		namespace ad
 		{
 			/**
 			 * @brief Returns the maximum number of allowed AD directions (seed vectors)
+			 * @details Active variables that live throughout the simulation (e.g., model parameters) are
+			 *          created with this number of directions. The maximum is set at build time.
 			 * @return Maximum number of allowed AD directions
 			 */
 			inline size_t getMaxDirections() CADET_NOEXCEPT { return SFAD_DEFAULT_DIR; }
 
 			/**
-			 * @brief Returns the current number of AD directions (seed vectors)
+			 * @brief Returns the current number of AD directions (seed vectors) of the calling thread
 			 * @return Current number of AD directions
 			 */
 			inline size_t getDirections() CADET_NOEXCEPT { return sfad::getGradientSize(); }
 
 			/**
-			 * @brief Sets the current number of AD directions (seed vectors)
+			 * @brief Sets the current number of AD directions (seed vectors) of the calling thread
 			 * @details The number of AD directions must not exceed the value returned by getMaxDirections().
+			 *          Each thread has its own number of directions, which allows multiple simulations with
+			 *          different numbers of directions to run concurrently. Threads spawned by a simulation
+			 *          (e.g., OpenMP worker threads) have to inherit the number of directions from the thread
+			 *          that owns the simulation before they operate on active variables.
 			 * 
 			 * @param [in] numDir Number of required AD directions
 			 */
@@ -163,5 +227,57 @@
 
 #endif  // #if defined ACTIVE_
 
+namespace cadet
+{
+	namespace ad
+	{
+		/**
+		 * @brief Returns the smallest number of directions of a compile-time sized AD type that covers the given number of directions
+		 * @param [in] numDir Required number of directions
+		 * @return Number of directions @c N of the AD type fixedActive<N>, or @c 0 if there is no suitable type
+		 */
+		inline unsigned int fixedDirections(unsigned int numDir) CADET_NOEXCEPT
+		{
+			#define CADET_FIXED_AD_SELECT(N, ARG1, ARG2) if (numDir <= N) return N;
+			CADET_FOREACH_FIXED_AD_DIRECTIONS(CADET_FIXED_AD_SELECT, , )
+			#undef CADET_FIXED_AD_SELECT
+			return 0;
+		}
+
+		/**
+		 * @brief Returns the size in bytes of the largest compile-time sized AD type
+		 * @return Size of the largest fixedActive type or @c 0 if there are no compile-time sized AD types
+		 */
+		inline std::size_t maxFixedActiveSize() CADET_NOEXCEPT
+		{
+			std::size_t size = 0;
+			#define CADET_FIXED_AD_SIZE(N, ARG1, ARG2) size = std::max(size, sizeof(fixedActive<N>));
+			CADET_FOREACH_FIXED_AD_DIRECTIONS(CADET_FIXED_AD_SIZE, , )
+			#undef CADET_FIXED_AD_SIZE
+			return size;
+		}
+
+		/**
+		 * @brief Sets the number of AD directions of the calling thread for the lifetime of the object
+		 * @details The previous number of directions is restored on destruction.
+		 */
+		class DirectionScope
+		{
+		public:
+			DirectionScope(size_t numDir) : _prevDir(getDirections())
+			{
+				setDirections(numDir);
+			}
+
+			~DirectionScope() CADET_NOEXCEPT
+			{
+				setDirections(_prevDir);
+			}
+
+		private:
+			const size_t _prevDir; //!< Number of directions before the scope was entered
+		};
+	}
+}
 
 #endif  // LIBCADET_AUTODIFF_HPP_
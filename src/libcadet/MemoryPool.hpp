@@ -161,6 +161,20 @@ namespace cadet
 			_numElements = 0;
 		}
 
+		/**
+		 * @brief Returns the currently active array
+		 * @details The array has to be created by create() before and must not have been destroyed.
+		 * 
+		 * @tparam T Type of elements
+		 * @return Pointer to the currently active array
+		 */
+		template <typename T>
+		inline T* const array() const
+		{
+			cadet_assert(_numElements > 0);
+			return reinterpret_cast<T*>(_mem);
+		}
+
 		inline const unsigned int numElements() const { return _numElements; }
 
 	protected:
@@ -33,6 +33,7 @@
 
 	inline int omp_get_max_threads() { return 1; }
 	inline int omp_get_thread_num() { return 0; }
+	inline int omp_get_num_procs() { return 1; }
 
 	typedef unsigned int ompuint_t;
 #endif
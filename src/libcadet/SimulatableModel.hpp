@@ -368,6 +368,71 @@ public:
 	virtual int linearSolve(double t, double timeFactor, double alpha, double tol, double* const rhs, double const* const weight,
 		double const* const y, double const* const yDot, double const* const res) = 0;
 
+	/**
+	 * @brief Computes the solutions of multiple linear systems involving the same system Jacobian
+	 * @details Solves the system of linearSolve() for each of the @p nRhs right hand sides in @p rhs.
+	 *          The Jacobian is factorized (at most) once and its factors are applied to all right
+	 *          hand sides, which is used for solving the state and sensitivity corrections of the
+	 *          simultaneous corrector method in one batch. The solutions are returned in @p rhs.
+	 *
+	 * @param [in] t Current time point
+	 * @param [in] timeFactor Used for time transformation (pre factor of time derivatives) and to compute parameter derivatives with respect to section length
+	 * @param [in] alpha Value of \f$ \alpha \f$ (arises from BDF time discretization)
+	 * @param [in] tol Error tolerance for the solution of the linear system from outer Newton iteration
+	 * @param [in,out] rhs Array with pointers to the right hand sides, on exit the solutions
+	 * @param [in] weight Array with pointers to the error weights of each right hand side
+	 * @param [in] nRhs Number of right hand sides
+	 * @param [in] y Pointer to global state vector at which the Jacobian is evaluated
+	 * @param [in] yDot Pointer to global time derivative state vector at which the Jacobian is evaluated
+	 * @param [in] res Pointer to global residual vector at the point @p y, @p yDot
+	 * @return @c 0 on success, @c -1 on non-recoverable error, and @c +1 on recoverable error
+	 */
+	virtual int linearSolveMultiRhs(double t, double timeFactor, double alpha, double tol, double* const* const rhs, double const* const* const weight,
+		unsigned int nRhs, double const* const y, double const* const yDot, double const* const res) = 0;
+
+	/**
+	 * @brief Computes the residual of the adjoint system
+	 * @details The adjoint system of the DAE @f$ F(t, y, \dot{y}) = 0 @f$ is given by
+	 *          \f[ \left( \frac{\partial F}{\partial \dot{y}} \right)^T \dot{\lambda} - \left( \frac{\partial F}{\partial y} \right)^T \lambda = 0, \f]
+	 *          where the inhomogeneity stemming from the objective function is added by the caller. The
+	 *          Jacobians are updated at the point \f$(y, \dot{y})\f$ of the forward trajectory.
+	 *
+	 * @param [in] t Current time point
+	 * @param [in] secIdx Index of the current section
+	 * @param [in] timeFactor Used for time transformation (pre factor of time derivatives) and to compute parameter derivatives with respect to section length
+	 * @param [in] y Pointer to global state vector of the forward problem
+	 * @param [in] yDot Pointer to global time derivative state vector of the forward problem
+	 * @param [in] yB Pointer to global adjoint state vector @f$ \lambda @f$
+	 * @param [in] yBdot Pointer to global adjoint time derivative state vector @f$ \dot{\lambda} @f$
+	 * @param [out] resB Pointer to global adjoint residual vector
+	 * @param [in,out] adRes Pointer to global residual vector of AD datatypes that can be used for computing the Jacobian (or @c nullptr if AD is disabled)
+	 * @param [in,out] adY Pointer to global state vector of AD datatypes that can be used for computing the Jacobian (or @c nullptr if AD is disabled)
+	 * @param [in] numSensAdDirs Number of AD directions used for parameter sensitivities
+	 * @return @c 0 on success, @c -1 on non-recoverable error, and @c +1 on recoverable error
+	 */
+	virtual int residualAdjoint(const active& t, unsigned int secIdx, const active& timeFactor, double const* const y, double const* const yDot,
+		double const* const yB, double const* const yBdot, double* const resB, active* const adRes, active* const adY, unsigned int numSensAdDirs) = 0;
+
+	/**
+	 * @brief Computes the solution of the linear system involving the transposed system Jacobian
+	 * @details The system \f[ \left( \frac{\partial F}{\partial y} + \alpha \frac{\partial F}{\partial \dot{y}} \right)^T x = b \f]
+	 *          has to be solved, which arises in the time integration of the adjoint system (see residualAdjoint()).
+	 *          The Jacobians are the ones of the last call to residualAdjoint(). The solution is returned in @p rhs.
+	 *
+	 * @param [in] t Current time point
+	 * @param [in] timeFactor Used for time transformation (pre factor of time derivatives) and to compute parameter derivatives with respect to section length
+	 * @param [in] alpha Value of \f$ \alpha \f$ (arises from BDF time discretization)
+	 * @param [in] tol Error tolerance for the solution of the linear system from outer Newton iteration
+	 * @param [in,out] rhs On entry the right hand side of the linear equation system, on exit the solution
+	 * @param [in] weight Vector with error weights
+	 * @param [in] yB Pointer to global adjoint state vector
+	 * @param [in] yBdot Pointer to global adjoint time derivative state vector
+	 * @param [in] resB Pointer to global adjoint residual vector at the point @p yB, @p yBdot
+	 * @return @c 0 on success, @c -1 on non-recoverable error, and @c +1 on recoverable error
+	 */
+	virtual int linearSolveAdjoint(double t, double timeFactor, double alpha, double tol, double* const rhs, double const* const weight,
+		double const* const yB, double const* const yBdot, double const* const resB) = 0;
+
 	/**
 	 * @brief Prepares the AD system vectors by constructing seed vectors
 	 * @details Sets the seed vectors used in AD. Since the slice of the AD vector is fully managed by the model,
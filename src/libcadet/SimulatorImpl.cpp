@@ -12,6 +12,7 @@
 
 #include "cadet/Exceptions.hpp"
 #include "cadet/SolutionRecorder.hpp"
+#include "cadet/QuadratureObjective.hpp"
 #include "cadet/ParameterProvider.hpp"
 #include "SimulatorImpl.hpp"
 #include "SimulatableModel.hpp"
@@ -25,6 +26,8 @@
 
 #include <vector>
 #include <sstream>
+#include <cmath>
+#include <limits>
 
 #include "AutoDiff.hpp"
 #include "LoggingUtils.hpp"
@@ -125,12 +128,37 @@ namespace cadet
 		cadet::Simulator* const sim = static_cast<cadet::Simulator*>(userData);
 		const unsigned int secIdx = sim->getCurrentSection(t);
 		const active timeFactor = sim->timeFactor();
+
+		// When reusing factorizations, the Jacobian is only updated in linearSetupWrapper()
+		if (sim->_reuseFactorizationActive)
+			return sim->_model->residual(static_cast<double>(sim->toRealTime(t)), secIdx, static_cast<double>(timeFactor), NVEC_DATA(y), NVEC_DATA(yDot), NVEC_DATA(res));
+
 		const int retVal = sim->_model->residualWithJacobian(sim->toRealTime(t), secIdx, timeFactor, NVEC_DATA(y), NVEC_DATA(yDot), NVEC_DATA(res), 
 			sim->_vecADres, sim->_vecADy, sim->numSensitivityAdDirections());
 
 		return retVal;
 	}
 
+	/**
+	 * @brief IDAS linear solver setup function
+	 * @details Only used if factorizations are reused. Updates the Jacobian at the predicted state, which
+	 *          is factorized in the next call of linearSolveWrapper(). See section 9.2 of the IDAS manual
+	 *          for details.
+	 */
+	int linearSetupWrapper(IDAMem IDA_mem, N_Vector yPred, N_Vector yDotPred, N_Vector resPred, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3)
+	{
+		cadet::Simulator* const sim = static_cast<cadet::Simulator*>(IDA_mem->ida_lmem);
+		const unsigned int secIdx = sim->getCurrentSection(IDA_mem->ida_tn);
+		const active timeFactor = sim->timeFactor();
+
+		// Residual is already given in resPred, only the Jacobian is of interest here
+		const int retVal = sim->_model->residualWithJacobian(sim->toRealTime(IDA_mem->ida_tn), secIdx, timeFactor, NVEC_DATA(yPred), NVEC_DATA(yDotPred), NVEC_DATA(tmp1), 
+			sim->_vecADres, sim->_vecADy, sim->numSensitivityAdDirections());
+
+		sim->_cjFactorization = IDA_mem->ida_cj;
+		return retVal;
+	}
+
 	int linearSolveWrapper(IDAMem IDA_mem, N_Vector rhs, N_Vector weight, N_Vector y, N_Vector yDot, N_Vector res)
 	{
 		cadet::Simulator* const sim = static_cast<cadet::Simulator*>(IDA_mem->ida_lmem);
@@ -139,7 +167,66 @@ namespace cadet
 		const double tol = IDA_mem->ida_epsNewt;
 		const active timeFactor = sim->timeFactor();
 
-		const int retVal =  sim->_model->linearSolve(t, static_cast<double>(timeFactor), alpha, tol, NVEC_DATA(rhs), NVEC_DATA(weight), NVEC_DATA(y), NVEC_DATA(yDot), NVEC_DATA(res));
+		// In the simultaneous corrector method, IDAS asks for the sensitivity corrections deltaS right
+		// after the state correction, which uses the same Jacobian. They are solved together with the
+		// state correction in a single batch below, so there is nothing left to do here.
+		const bool simultaneous = IDA_mem->ida_sensi && (IDA_mem->ida_ism == IDA_SIMULTANEOUS);
+		if (simultaneous)
+		{
+			for (int is = 0; is < IDA_mem->ida_Ns; ++is)
+			{
+				if (rhs == IDA_mem->ida_deltaS[is])
+					return 0;
+			}
+		}
+
+		// Request a new Jacobian if alpha has changed too much since the last factorization.
+		// IDAS responds to a recoverable failure by calling linearSetupWrapper() and retrying.
+		// Otherwise, always use alpha of the last setup such that factorizations triggered by the model are consistent.
+		double cjRatio = 1.0;
+		double alphaFactorized = alpha;
+		if (sim->_reuseFactorizationActive)
+		{
+			cjRatio = alpha / sim->_cjFactorization;
+			if (cadet_unlikely(!(std::abs(cjRatio - 1.0) <= sim->_cjRatioTol)))
+				return 1;
+
+			alphaFactorized = sim->_cjFactorization;
+		}
+
+		int retVal = 0;
+		if (simultaneous)
+		{
+			// Solve state and sensitivity corrections with the same factorizations
+			const unsigned int nRhs = IDA_mem->ida_Ns + 1;
+			sim->_linSolveRhs.resize(nRhs);
+			sim->_linSolveWeight.resize(nRhs);
+
+			sim->_linSolveRhs[0] = NVEC_DATA(rhs);
+			sim->_linSolveWeight[0] = NVEC_DATA(weight);
+			for (int is = 0; is < IDA_mem->ida_Ns; ++is)
+			{
+				sim->_linSolveRhs[is + 1] = NVEC_DATA(IDA_mem->ida_deltaS[is]);
+				sim->_linSolveWeight[is + 1] = NVEC_DATA(IDA_mem->ida_ewtS[is]);
+			}
+
+			retVal = sim->_model->linearSolveMultiRhs(t, static_cast<double>(timeFactor), alphaFactorized, tol, sim->_linSolveRhs.data(), sim->_linSolveWeight.data(),
+				nRhs, NVEC_DATA(y), NVEC_DATA(yDot), NVEC_DATA(res));
+		}
+		else
+			retVal = sim->_model->linearSolve(t, static_cast<double>(timeFactor), alphaFactorized, tol, NVEC_DATA(rhs), NVEC_DATA(weight), NVEC_DATA(y), NVEC_DATA(yDot), NVEC_DATA(res));
+
+		// Compensate for the outdated alpha in the factorized Jacobian by scaling the correction (as in IDAS' direct linear solvers)
+		if ((retVal == 0) && (cjRatio != 1.0))
+		{
+			NVec_Scale(2.0 / (1.0 + cjRatio), rhs, rhs);
+			if (simultaneous)
+			{
+				for (int is = 0; is < IDA_mem->ida_Ns; ++is)
+					NVec_Scale(2.0 / (1.0 + cjRatio), IDA_mem->ida_deltaS[is], IDA_mem->ida_deltaS[is]);
+			}
+		}
+
 		return retVal;
 	}
 
@@ -154,15 +241,79 @@ namespace cadet
 		const unsigned int secIdx = sim->getCurrentSection(t);
 		const active timeFactor = sim->timeFactor();
 
+		// The sensitivity residuals use the Jacobian at the current state, which has been updated
+		// by the last residual evaluation (factorizations are not reused with forward sensitivities)
 		return sim->_model->residualSensFwd(ns, sim->toRealTime(t), secIdx, timeFactor, NVEC_DATA(y), NVEC_DATA(yDot), NVEC_DATA(res), 
 			sensY, sensYdot, sensRes, sim->_vecADres, NVEC_DATA(tmp1), NVEC_DATA(tmp2), NVEC_DATA(tmp3));
 	}
 
+	int quadratureObjectiveWrapper(double t, N_Vector y, N_Vector yDot, N_Vector rhsQ, void* userData)
+	{
+		cadet::Simulator* const sim = static_cast<cadet::Simulator*>(userData);
+		NVEC_DATA(rhsQ)[0] = sim->_objective->integrand(static_cast<double>(sim->toRealTime(t)), NVEC_DATA(y), NVEC_LENGTH(y));
+		return 0;
+	}
+
+	int residualAdjointWrapper(double t, N_Vector y, N_Vector yDot, N_Vector yB, N_Vector yBdot, N_Vector resB, void* userData)
+	{
+		cadet::Simulator* const sim = static_cast<cadet::Simulator*>(userData);
+		const unsigned int secIdx = sim->getCurrentSection(t);
+		const active timeFactor = sim->timeFactor();
+		const active realT = sim->toRealTime(t);
+
+		const int retVal = sim->_model->residualAdjoint(realT, secIdx, timeFactor, NVEC_DATA(y), NVEC_DATA(yDot), NVEC_DATA(yB), NVEC_DATA(yBdot), NVEC_DATA(resB), 
+			sim->_vecADres, sim->_vecADy, sim->numSensitivityAdDirections());
+		if (retVal != 0)
+			return retVal;
+
+		// Add inhomogeneity dg / dy of the objective function
+		double* const grad = sim->_objectiveGrad.data();
+		double* const ptrResB = NVEC_DATA(resB);
+		sim->_objective->stateGradient(static_cast<double>(realT), NVEC_DATA(y), sim->_objectiveGrad.size(), grad);
+		for (unsigned int i = 0; i < sim->_objectiveGrad.size(); ++i)
+			ptrResB[i] += grad[i];
+
+		return 0;
+	}
+
+	int quadratureAdjointWrapper(double t, N_Vector y, N_Vector yDot, N_Vector yB, N_Vector yBdot, N_Vector rhsQB, void* userData)
+	{
+		cadet::Simulator* const sim = static_cast<cadet::Simulator*>(userData);
+		const unsigned int secIdx = sim->getCurrentSection(t);
+		const active timeFactor = sim->timeFactor();
+
+		// The backward quadrature runs from the end to the beginning of the time domain, which
+		// flips the sign of the gradient integrand -yB^T * dF / dp
+		return sim->_model->residualAdjointParam(sim->numSensitivityAdDirections(), sim->toRealTime(t), secIdx, timeFactor, NVEC_DATA(y), NVEC_DATA(yDot), 
+			NVEC_DATA(yB), NVEC_DATA(rhsQB), sim->_vecADres);
+	}
+
+	/**
+	 * @brief IDAS linear solver function of the adjoint system
+	 * @details The iteration matrix of the adjoint system is the negative transpose of the forward iteration
+	 *          matrix evaluated with @f$ -\alpha @f$ since the backward problem is integrated with negative step sizes.
+	 */
+	int linearSolveAdjointWrapper(IDAMem IDA_mem, N_Vector rhs, N_Vector weight, N_Vector yB, N_Vector yBdot, N_Vector resB)
+	{
+		cadet::Simulator* const sim = static_cast<cadet::Simulator*>(IDA_mem->ida_lmem);
+		const double t = static_cast<double>(sim->toRealTime(IDA_mem->ida_tn));
+		const double alpha = -IDA_mem->ida_cj;
+		const double tol = IDA_mem->ida_epsNewt;
+		const active timeFactor = sim->timeFactor();
+
+		const int retVal = sim->_model->linearSolveAdjoint(t, static_cast<double>(timeFactor), alpha, tol, NVEC_DATA(rhs), NVEC_DATA(weight), NVEC_DATA(yB), NVEC_DATA(yBdot), NVEC_DATA(resB));
+		if (retVal == 0)
+			NVec_Scale(-1.0, rhs, rhs);
+
+		return retVal;
+	}
+
 	Simulator::Simulator() : _model(nullptr), _solRecorder(nullptr), _idaMemBlock(nullptr), _vecStateY(nullptr), 
 		_vecStateYdot(nullptr), _vecFwdYs(nullptr), _vecFwdYsDot(nullptr),
-		_relTolS(1.0e-9), _absTol(1, 1.0e-12), _relTol(1.0e-9), _initStepSize(1, 1.0e-6), _maxSteps(10000), _curSec(0),
+		_relTolS(1.0e-9), _absTol(1, 1.0e-12), _relTol(1.0e-9), _initStepSize(1, 1.0e-6), _maxSteps(10000),
+		_reuseFactorization(false), _reuseFactorizationActive(false), _cjRatioTol(0.4), _cjFactorization(0.0), _sensSimultaneous(false), _curSec(0),
 		_skipConsistencyStateY(false), _skipConsistencySensitivity(false), _consistentInitMode(ConsistentInitialization::Full), 
-		_consistentInitModeSens(ConsistentInitialization::Full), _vecADres(nullptr), _vecADy(nullptr), _lastIntTime(0.0)
+		_consistentInitModeSens(ConsistentInitialization::Full), _vecADres(nullptr), _vecADy(nullptr), _objective(nullptr), _lastIntTime(0.0)
 	{
 #if defined(ACTIVE_ADOLC) || defined(ACTIVE_SFAD) || defined(ACTIVE_SETFAD)
 		LOG(Debug) << "Resetting AD directions from " << ad::getDirections() << " to default " << SFAD_DEFAULT_DIR;
@@ -179,6 +330,8 @@ namespace cadet
 	{
 		delete[] _vecADy;
 		delete[] _vecADres;
+		_vecADy = nullptr;
+		_vecADres = nullptr;
 
 		if ((_sensitiveParams.slices() > 0) && _vecFwdYs)
 		{
@@ -263,18 +416,34 @@ namespace cadet
 		IDAMem IDA_mem = static_cast<IDAMem>(_idaMemBlock);
 
 		IDA_mem->ida_linit          = nullptr;
-		IDA_mem->ida_lsetup         = nullptr;
 		IDA_mem->ida_lsolve         = &linearSolveWrapper;
 		IDA_mem->ida_lperf          = nullptr;
 		IDA_mem->ida_lfree          = nullptr;
-		IDA_mem->ida_setupNonNull   = false;
 		IDA_mem->ida_lmem           = this;
+		updateLinearSolverSetup(false);
+	}
 
-		// Allocate memory for AD if required
-		if (_model->usesAD())
+	void Simulator::updateLinearSolverSetup(bool fwdSensitivities)
+	{
+		// Forward sensitivity residuals require the Jacobian at the current state. Each Jacobian update also
+		// triggers a new factorization in the model, which renders reusing factorizations pointless.
+		_reuseFactorizationActive = _reuseFactorization && !fwdSensitivities;
+
+		if (!_idaMemBlock)
+			return;
+
+		// Without setup function, IDAS never asks for a new Jacobian and the model
+		// updates and factorizes it on every residual evaluation
+		IDAMem IDA_mem = static_cast<IDAMem>(_idaMemBlock);
+		if (_reuseFactorizationActive)
 		{
-			_vecADres = new active[nDOFs];
-			_vecADy = new active[nDOFs];
+			IDA_mem->ida_lsetup       = &linearSetupWrapper;
+			IDA_mem->ida_setupNonNull = true;
+		}
+		else
+		{
+			IDA_mem->ida_lsetup       = nullptr;
+			IDA_mem->ida_setupNonNull = false;
 		}
 	}
 
@@ -314,6 +483,21 @@ namespace cadet
 			IDASStolerances(_idaMemBlock, _relTol, _absTol[0]);		
 	}
 
+	void Simulator::allocateADvectors(bool sensitivities)
+	{
+		delete[] _vecADy;
+		delete[] _vecADres;
+		_vecADy = nullptr;
+		_vecADres = nullptr;
+
+		// Sensitivities require AD for the parameter derivatives of the residual
+		const unsigned int nDOFs = _model->numDofs();
+		if (_model->usesAD() || sensitivities)
+			_vecADres = new active[nDOFs];
+		if (_model->usesAD())
+			_vecADy = new active[nDOFs];
+	}
+
 	void Simulator::preFwdSensInit(unsigned int nSens)
 	{
 		// Turn off solution of sensitivity systems (this will be overridden by a call to IDASensInit below)
@@ -335,17 +519,13 @@ namespace cadet
 		{
 			_vecFwdYs     = NVec_CloneArray(nSens, _vecStateY);
 			_vecFwdYsDot  = NVec_CloneArray(nSens, _vecStateYdot);
-
-			// Allocate memory for AD if not already done
-			if (!_vecADres)
-				_vecADres = new active[_model->numDofs()];
 		}
 	}
 
 	void Simulator::postFwdSensInit(unsigned int nSens)
 	{
 		// Initialize IDA sensitivity computation
-		IDASensInit(_idaMemBlock, nSens, IDA_STAGGERED, &cadet::residualSensWrapper, _vecFwdYs, _vecFwdYsDot);
+		IDASensInit(_idaMemBlock, nSens, _sensSimultaneous ? IDA_SIMULTANEOUS : IDA_STAGGERED, &cadet::residualSensWrapper, _vecFwdYs, _vecFwdYsDot);
 
 		// Set sensitivity integration tolerances
 		IDASensSStolerances(_idaMemBlock, _relTolS, _absTolS.data());
@@ -848,6 +1028,37 @@ namespace cadet
 		return active(-1.0);
 	}
 
+	void Simulator::computeConsistentInitialState(const active& realT, const active& curTimeFactor)
+	{
+		if (!_skipConsistencyStateY && (_consistentInitMode != ConsistentInitialization::None))
+		{
+			if ((_consistentInitMode == ConsistentInitialization::Full) || ((_curSec == 0) && (_consistentInitMode == ConsistentInitialization::FullFirstOnly)))
+			{
+				_model->consistentInitialConditions(static_cast<double>(realT), _curSec, static_cast<double>(curTimeFactor), NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot), 
+					_vecADres, _vecADy, numSensitivityAdDirections(), _algTol);
+
+				const double consPost = _model->residualNorm(static_cast<double>(realT), _curSec, static_cast<double>(curTimeFactor), NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot));
+				LOG(Debug) << " ==========> Consistency error post Full: " << consPost;
+			}
+			else if ((_consistentInitMode == ConsistentInitialization::Lean) || ((_curSec == 0) && (_consistentInitMode == ConsistentInitialization::LeanFirstOnly)))
+			{
+				_model->leanConsistentInitialConditions(static_cast<double>(realT), _curSec, static_cast<double>(curTimeFactor), NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot), 
+					_vecADres, _vecADy, numSensitivityAdDirections(), _algTol);
+
+				const double consPost = _model->residualNorm(static_cast<double>(realT), _curSec, static_cast<double>(curTimeFactor), NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot));
+				LOG(Debug) << " ==========> Consistency error post Lean: " << consPost;
+			}
+			else
+			{
+				LOG(Debug) << " ==========> Consistent initialization NOT performed (mode " << to_string(_consistentInitMode) << ")";
+			}
+
+			LOG(Debug) << "y = " << _vecStateY << ";";
+			LOG(Debug) << "yDot = " << _vecStateYdot << ";";
+		}
+		_skipConsistencyStateY = false;
+	}
+
 	void Simulator::integrate()
 	{
 		// In this function the model is integrated by IDAS from the SUNDIALS package.
@@ -859,12 +1070,12 @@ namespace cadet
 
 		_timerIntegration.start();
 
-		// Set number of AD directions
-		// @todo This is problematic if multiple Simulators are run concurrently!
-#if defined(ACTIVE_ADOLC) || defined(ACTIVE_SFAD) || defined(ACTIVE_SETFAD)
+		// Set number of AD directions of this thread for the duration of the time integration,
+		// which allows other threads to run Simulators with different numbers of directions
 		LOG(Debug) << "Setting AD directions from " << ad::getDirections() << " to " << numSensitivityAdDirections() + _model->requiredADdirs();
-		ad::setDirections(numSensitivityAdDirections() + _model->requiredADdirs());
-#endif
+		ad::DirectionScope adDirScope(numSensitivityAdDirections() + _model->requiredADdirs());
+		allocateADvectors(_sensitiveParams.slices() > 0);
+
 		// Setup AD vectors by model
 		// @todo Check if this is necessary (dirty flag)
 		_model->prepareADvectors(_vecADres, _vecADy, numSensitivityAdDirections());
@@ -875,6 +1086,8 @@ namespace cadet
 		const bool writeAtUserTimes = _solutionTimes.size() > 0;
 		const bool wantSensitivities = _sensitiveParams.slices() > 0;
 
+		updateLinearSolverSetup(wantSensitivities);
+
 		if (_solRecorder)
 		{
 			_solRecorder->notifyIntegrationStart(NVEC_LENGTH(_vecStateY), _sensitiveParams.slices(), _solutionTimes.size());
@@ -944,33 +1157,7 @@ namespace cadet
 			const double consPrev = _model->residualNorm(static_cast<double>(realT), _curSec, static_cast<double>(curTimeFactor), NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot));
 			LOG(Debug) << " ==========> Consistency error prev: " << consPrev;
 
-			if (!_skipConsistencyStateY && (_consistentInitMode != ConsistentInitialization::None))
-			{
-				if ((_consistentInitMode == ConsistentInitialization::Full) || ((_curSec == 0) && (_consistentInitMode == ConsistentInitialization::FullFirstOnly)))
-				{
-					_model->consistentInitialConditions(static_cast<double>(realT), _curSec, static_cast<double>(curTimeFactor), NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot), 
-						_vecADres, _vecADy, numSensitivityAdDirections(), _algTol);
-
-					const double consPost = _model->residualNorm(static_cast<double>(realT), _curSec, static_cast<double>(curTimeFactor), NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot));
-					LOG(Debug) << " ==========> Consistency error post Full: " << consPost;
-				}
-				else if ((_consistentInitMode == ConsistentInitialization::Lean) || ((_curSec == 0) && (_consistentInitMode == ConsistentInitialization::LeanFirstOnly)))
-				{
-					_model->leanConsistentInitialConditions(static_cast<double>(realT), _curSec, static_cast<double>(curTimeFactor), NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot), 
-						_vecADres, _vecADy, numSensitivityAdDirections(), _algTol);
-
-					const double consPost = _model->residualNorm(static_cast<double>(realT), _curSec, static_cast<double>(curTimeFactor), NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot));
-					LOG(Debug) << " ==========> Consistency error post Lean: " << consPost;
-				}
-				else
-				{
-					LOG(Debug) << " ==========> Consistent initialization NOT performed (mode " << to_string(_consistentInitMode) << ")";
-				}
-
-				LOG(Debug) << "y = " << _vecStateY << ";";
-				LOG(Debug) << "yDot = " << _vecStateYdot << ";";
-			}
-			_skipConsistencyStateY = false;
+			computeConsistentInitialState(realT, curTimeFactor);
 
 			if ((_sensitiveParams.slices() > 0) && !_skipConsistencySensitivity && (_consistentInitModeSens != ConsistentInitialization::None))
 			{
@@ -1024,7 +1211,7 @@ namespace cadet
 			// IDAS Step 5.2: Re-initialization of the solver
 			IDAReInit(_idaMemBlock, startTime, _vecStateY, _vecStateYdot);
 			if (numSensParams() > 0)
-				IDASensReInit(_idaMemBlock, IDA_STAGGERED, _vecFwdYs, _vecFwdYsDot);
+				IDASensReInit(_idaMemBlock, _sensSimultaneous ? IDA_SIMULTANEOUS : IDA_STAGGERED, _vecFwdYs, _vecFwdYsDot);
 
 			// Inititalize the IDA solver flag
 			int solverFlag = IDA_SUCCESS;
@@ -1121,6 +1308,220 @@ namespace cadet
 		_lastIntTime = _timerIntegration.stop();
 	}
 
+	double Simulator::integrateAdjoint(IQuadratureObjective& objective, unsigned int numStepsCheckpoint, std::vector<double>& gradient)
+	{
+		// The adjoint system is integrated backwards over each slice of the time domain in which
+		// the time integrator is not restarted. IDAS only keeps checkpoints of the last forward
+		// integration, so all slices except for the last one are integrated forward twice.
+		// At the end of each slice, the adjoint system is initialized consistently (see below).
+
+		_timerIntegration.start();
+
+		const unsigned int nSens = numSensitivityAdDirections();
+		const unsigned int nDOFs = _model->numDofs();
+
+		LOG(Debug) << "Setting AD directions from " << ad::getDirections() << " to " << nSens + _model->requiredADdirs();
+		ad::DirectionScope adDirScope(nSens + _model->requiredADdirs());
+
+		// Forward sensitivity systems are not solved in adjoint mode, but the AD
+		// directions of the sensitive parameters are required for the gradient
+		IDASensToggleOff(_idaMemBlock);
+		updateLinearSolverSetup(false);
+		allocateADvectors(true);
+
+		_model->prepareADvectors(_vecADres, _vecADy, nSens);
+
+		_objective = &objective;
+		_objectiveGrad.resize(nDOFs);
+
+		// Determine slices between restarts of the time integrator
+		std::vector<unsigned int> sliceStart(1, 0);
+		for (unsigned int i = 0; i < _sectionContinuity.size(); ++i)
+		{
+			if (!_sectionContinuity[i])
+				sliceStart.push_back(i + 1);
+		}
+		sliceStart.push_back(_transformedTimes.size() - 1);
+		const unsigned int nSlices = sliceStart.size() - 1;
+
+		// Consistent initial states of all slices
+		std::vector<double> initStates(2 * nSlices * nDOFs, 0.0);
+
+		N_Vector vecQ = NVec_New(1);
+		N_Vector vecQB = NVec_New(nSens);
+		N_Vector vecYB = NVec_New(nDOFs);
+		N_Vector vecYBdot = NVec_New(nDOFs);
+		N_Vector vecIdB = NVec_New(nDOFs);
+		NVec_Const(0.0, vecQ);
+		NVec_Const(0.0, vecYB);
+		NVec_Const(0.0, vecYBdot);
+
+		IDAAdjInit(_idaMemBlock, numStepsCheckpoint, IDA_HERMITE);
+		IDAQuadInit(_idaMemBlock, &quadratureObjectiveWrapper, vecQ);
+
+		double objValue = 0.0;
+		gradient.assign(nSens, 0.0);
+		int solverFlag = IDA_SUCCESS;
+		int nCheck = 0;
+
+		// Forward pass: Integrate model and objective function, store checkpoints of the last slice
+		for (unsigned int slice = 0; (slice < nSlices) && (solverFlag >= 0); ++slice)
+		{
+			_curSec = sliceStart[slice];
+			const double startTime = _transformedTimes[_curSec];
+			const double endTime = _transformedTimes[sliceStart[slice + 1]];
+
+			LOG(Debug) << " ###### ADJOINT FWD SLICE " << slice << " from " << startTime << " to " << endTime;
+
+			const double stepSize = _initStepSize.size() > 1 ? _initStepSize[_curSec] : _initStepSize[0];
+			IDASetInitStep(_idaMemBlock, stepSize);
+			IDASetStopTime(_idaMemBlock, endTime);
+
+			const active realT = toRealTime(startTime, _curSec);
+			_model->notifyDiscontinuousSectionTransition(static_cast<double>(realT), _curSec);
+			computeConsistentInitialState(realT, timeFactor(_curSec));
+
+			std::copy(NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateY) + nDOFs, initStates.data() + 2 * slice * nDOFs);
+			std::copy(NVEC_DATA(_vecStateYdot), NVEC_DATA(_vecStateYdot) + nDOFs, initStates.data() + (2 * slice + 1) * nDOFs);
+
+			IDAReInit(_idaMemBlock, startTime, _vecStateY, _vecStateYdot);
+			IDAQuadReInit(_idaMemBlock, vecQ);
+			if (slice > 0)
+				IDAAdjReInit(_idaMemBlock);
+
+			double tRet = startTime;
+			solverFlag = IDASolveF(_idaMemBlock, endTime, &tRet, _vecStateY, _vecStateYdot, IDA_NORMAL, &nCheck);
+
+			N_Vector vecQslice = NVec_New(1);
+			IDAGetQuad(_idaMemBlock, &tRet, vecQslice);
+			objValue += NVEC_DATA(vecQslice)[0];
+			NVec_Destroy(vecQslice);
+		}
+
+		// Backward pass: Integrate the adjoint system and the gradient quadrature slice by slice
+		int whichB = 0;
+		for (unsigned int slice = nSlices; (slice > 0) && (solverFlag >= 0); --slice)
+		{
+			_curSec = sliceStart[slice - 1];
+			const double startTime = _transformedTimes[_curSec];
+			const double endTime = _transformedTimes[sliceStart[slice]];
+
+			LOG(Debug) << " ###### ADJOINT BWD SLICE " << slice - 1 << " from " << endTime << " to " << startTime;
+
+			// Recompute checkpoints of this slice
+			if (slice < nSlices)
+			{
+				const active realT = toRealTime(startTime, _curSec);
+				_model->notifyDiscontinuousSectionTransition(static_cast<double>(realT), _curSec);
+
+				std::copy(initStates.data() + 2 * (slice - 1) * nDOFs, initStates.data() + (2 * slice - 1) * nDOFs, NVEC_DATA(_vecStateY));
+				std::copy(initStates.data() + (2 * slice - 1) * nDOFs, initStates.data() + 2 * slice * nDOFs, NVEC_DATA(_vecStateYdot));
+
+				const double stepSize = _initStepSize.size() > 1 ? _initStepSize[_curSec] : _initStepSize[0];
+				IDASetInitStep(_idaMemBlock, stepSize);
+				IDASetStopTime(_idaMemBlock, endTime);
+				IDAReInit(_idaMemBlock, startTime, _vecStateY, _vecStateYdot);
+				IDAQuadReInit(_idaMemBlock, vecQ);
+				IDAAdjReInit(_idaMemBlock);
+
+				double tRet = startTime;
+				solverFlag = IDASolveF(_idaMemBlock, endTime, &tRet, _vecStateY, _vecStateYdot, IDA_NORMAL, &nCheck);
+				if (solverFlag < 0)
+					break;
+			}
+
+			NVec_Const(0.0, vecQB);
+			if (slice == nSlices)
+			{
+				// Differential variables of the adjoint system correspond to the equations of the forward
+				// system that contain time derivatives (i.e., nonzero rows of dF / dyDot). The residual is
+				// affine in yDot, so these rows change when the time derivative is perturbed.
+				const unsigned int lastSec = sliceStart[slice] - 1;
+				const double lastTimeFactor = static_cast<double>(timeFactor(lastSec));
+				const double realEndTime = static_cast<double>(toRealTime(endTime, lastSec));
+				std::vector<double> res(nDOFs, 0.0);
+				std::vector<double> resPerturbed(nDOFs, 0.0);
+				std::vector<double> yDotPerturbed(NVEC_DATA(_vecStateYdot), NVEC_DATA(_vecStateYdot) + nDOFs);
+				for (double& v : yDotPerturbed)
+					v += 1.0;
+
+				_model->residual(realEndTime, lastSec, lastTimeFactor, NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot), res.data());
+				_model->residual(realEndTime, lastSec, lastTimeFactor, NVEC_DATA(_vecStateY), yDotPerturbed.data(), resPerturbed.data());
+
+				double* const idB = NVEC_DATA(vecIdB);
+				for (unsigned int i = 0; i < nDOFs; ++i)
+					idB[i] = (res[i] != resPerturbed[i]) ? 1.0 : 0.0;
+
+				IDACreateB(_idaMemBlock, &whichB);
+				IDAInitB(_idaMemBlock, whichB, &residualAdjointWrapper, endTime, vecYB, vecYBdot);
+				IDASStolerancesB(_idaMemBlock, whichB, _relTol, _absTol[0]);
+				IDASetUserDataB(_idaMemBlock, whichB, this);
+				IDASetMaxNumStepsB(_idaMemBlock, whichB, _maxSteps);
+				IDAQuadInitB(_idaMemBlock, whichB, &quadratureAdjointWrapper, vecQB);
+				IDASetIdB(_idaMemBlock, whichB, vecIdB);
+
+				// Attach the transposed linear solver to the backward problem
+				IDAMem IDA_memB = static_cast<IDAMem>(IDAGetAdjIDABmem(_idaMemBlock, whichB));
+				IDA_memB->ida_linit          = nullptr;
+				IDA_memB->ida_lsetup         = nullptr;
+				IDA_memB->ida_setupNonNull   = false;
+				IDA_memB->ida_lsolve         = &linearSolveAdjointWrapper;
+				IDA_memB->ida_lperf          = nullptr;
+				IDA_memB->ida_lfree          = nullptr;
+				IDA_memB->ida_lmem           = this;
+			}
+			else
+			{
+				IDAReInitB(_idaMemBlock, whichB, endTime, vecYB, vecYBdot);
+				IDAQuadReInitB(_idaMemBlock, whichB, vecQB);
+			}
+
+			// Consistent initialization of the adjoint system at the forward state at the end of the slice:
+			// The differential part of the adjoint state is kept, its algebraic part and the time derivative
+			// of its differential part are recomputed. At the end of the time domain, the differential part
+			// vanishes. At discontinuous section transitions, it is continuous, whereas the algebraic part
+			// has to match the (possibly discontinuous) time derivative and algebraic part of the forward state.
+			solverFlag = IDACalcICB(_idaMemBlock, whichB, startTime, _vecStateY, _vecStateYdot);
+			if (solverFlag < 0)
+				break;
+
+			solverFlag = IDASolveB(_idaMemBlock, startTime, IDA_NORMAL);
+			if (solverFlag < 0)
+				break;
+
+			double tRet = startTime;
+			IDAGetB(_idaMemBlock, whichB, &tRet, vecYB, vecYBdot);
+			IDAGetQuadB(_idaMemBlock, whichB, &tRet, vecQB);
+
+			double const* const qB = NVEC_DATA(vecQB);
+			for (unsigned int i = 0; i < nSens; ++i)
+				gradient[i] += qB[i];
+		}
+
+		IDAQuadFree(_idaMemBlock);
+		IDAAdjFree(_idaMemBlock);
+		NVec_Destroy(vecIdB);
+		NVec_Destroy(vecYBdot);
+		NVec_Destroy(vecYB);
+		NVec_Destroy(vecQB);
+		NVec_Destroy(vecQ);
+		_objective = nullptr;
+
+		// Turn forward sensitivities back on if they have been initialized
+		if (_vecFwdYs)
+			IDASensReInit(_idaMemBlock, _sensSimultaneous ? IDA_SIMULTANEOUS : IDA_STAGGERED, _vecFwdYs, _vecFwdYsDot);
+
+		_lastIntTime = _timerIntegration.stop();
+
+		if (solverFlag < 0)
+		{
+			LOG(Error) << "Adjoint integration failed with " << IDAGetReturnFlagName(solverFlag);
+			throw IntegrationException("Error in adjoint integration!");
+		}
+
+		return objValue;
+	}
+
 	double const* Simulator::getLastSolution(unsigned int& len) const
 	{
 		len = NVEC_LENGTH(_vecStateY);
@@ -1190,6 +1591,13 @@ namespace cadet
 		else
 			_relTolS = _relTol;
 
+		if (paramProvider.exists("REUSE_FACTORIZATION"))
+			_reuseFactorization = paramProvider.getInt("REUSE_FACTORIZATION");
+		if (paramProvider.exists("CJRATIO_TOL"))
+			_cjRatioTol = paramProvider.getDouble("CJRATIO_TOL");
+		if (paramProvider.exists("SIMULTANEOUS_SENS_CORRECTOR"))
+			_sensSimultaneous = paramProvider.getInt("SIMULTANEOUS_SENS_CORRECTOR");
+
 		paramProvider.popScope();
 
 #ifdef _OPENMP
@@ -1281,6 +1689,17 @@ namespace cadet
 			IDASetMaxNumSteps(_idaMemBlock, _maxSteps);
 	}
 
+	void Simulator::setJacobianReuse(bool reuse, double cjRatioTol)
+	{
+		_reuseFactorization = reuse;
+		_cjRatioTol = cjRatioTol;
+	}
+
+	void Simulator::setSimultaneousSensitivityCorrector(bool simultaneous)
+	{
+		_sensSimultaneous = simultaneous;
+	}
+
 
 	bool Simulator::reconfigureModel(IParameterProvider& paramProvider)
 	{
@@ -34,12 +34,22 @@ namespace cadet
 
 int residualDaeWrapper(double t, N_Vector y, N_Vector yDot, N_Vector res, void* userData);
 
+int linearSetupWrapper(IDAMem IDA_mem, N_Vector yPred, N_Vector yDotPred, N_Vector resPred, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3);
+
 int linearSolveWrapper(IDAMem IDA_mem, N_Vector rhs, N_Vector weight, N_Vector yCur, N_Vector yDotCur, N_Vector resCur);
 
 int residualSensWrapper(int ns, double t, N_Vector y, N_Vector yDot, N_Vector res, 
 		N_Vector* yS, N_Vector* ySDot, N_Vector* resS,
 		void *userData, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3);
 
+int quadratureObjectiveWrapper(double t, N_Vector y, N_Vector yDot, N_Vector rhsQ, void* userData);
+
+int residualAdjointWrapper(double t, N_Vector y, N_Vector yDot, N_Vector yB, N_Vector yBdot, N_Vector resB, void* userData);
+
+int quadratureAdjointWrapper(double t, N_Vector y, N_Vector yDot, N_Vector yB, N_Vector yBdot, N_Vector rhsQB, void* userData);
+
+int linearSolveAdjointWrapper(IDAMem IDA_mem, N_Vector rhs, N_Vector weight, N_Vector yB, N_Vector yBdot, N_Vector resB);
+
 namespace model
 {
 	class ModelSystem;
@@ -92,6 +102,7 @@ public:
 	virtual void setSolutionRecorder(ISolutionRecorder* recorder);
 
 	virtual void integrate();
+	virtual double integrateAdjoint(IQuadratureObjective& objective, unsigned int numStepsCheckpoint, std::vector<double>& gradient);
 
 	virtual double const* getLastSolution(unsigned int& len) const;
 	virtual double const* getLastSolutionDerivative(unsigned int& len) const;
@@ -113,6 +124,8 @@ public:
 	virtual void setInitialStepSize(const std::vector<double>& stepSize);
 	virtual void setMaximumSteps(unsigned int maxSteps);
 	virtual void setRelativeErrorToleranceSens(double relTol);
+	virtual void setJacobianReuse(bool reuse, double cjRatioTol);
+	virtual void setSimultaneousSensitivityCorrector(bool simultaneous);
 
 	virtual bool reconfigureModel(IParameterProvider& paramProvider);
 	virtual bool reconfigureModel(IParameterProvider& paramProvider, unsigned int unitOpIdx);
@@ -160,6 +173,15 @@ protected:
 	 */
 	unsigned int getCurrentSection(double t) const;
 
+	/**
+	 * @brief Computes consistent initial values of the state vector at the beginning of a section
+	 * @details The mode is determined by _consistentInitMode. Consistent initialization is skipped once
+	 *          if requested by skipConsistentInitialization().
+	 * @param [in] realT Current time point
+	 * @param [in] curTimeFactor Time factor of the current section
+	 */
+	void computeConsistentInitialState(const active& realT, const active& curTimeFactor);
+
 	/**
 	 * @brief Enables or disables sensitivities in IDAS and allocates space for sensitivity state vectors
 	 * @param [in] nSens Number of sensitivities
@@ -218,6 +240,24 @@ protected:
 	 */
 	void updateMainErrorTolerances();
 
+	/**
+	 * @brief Installs or removes the linear solver setup function in IDAS
+	 * @details The setup function is only used if factorizations of the Jacobian are reused.
+	 *          Reuse is disabled while forward sensitivities are integrated. If IDAS has not
+	 *          been initialized yet, only the reuse mode of the next time integration is updated.
+	 * @param [in] fwdSensitivities Determines whether forward sensitivity systems are integrated
+	 */
+	void updateLinearSolverSetup(bool fwdSensitivities);
+
+	/**
+	 * @brief Allocates the AD vectors for the current number of AD directions
+	 * @details The gradients of AD values are sized by the number of directions at the time of their creation.
+	 *          Thus, the vectors are allocated anew at the beginning of each time integration (i.e., inside
+	 *          the ad::DirectionScope of the integration).
+	 * @param [in] sensitivities Determines whether parameter sensitivities are computed
+	 */
+	void allocateADvectors(bool sensitivities);
+
 	const active timeFactor(unsigned int curSec) const;
 	inline const active timeFactor() const { return timeFactor(_curSec); }
 
@@ -230,12 +270,22 @@ protected:
 
 	friend int ::cadet::residualDaeWrapper(double t, N_Vector y, N_Vector yDot, N_Vector res, void* userData);
 
+	friend int ::cadet::linearSetupWrapper(IDAMem IDA_mem, N_Vector yPred, N_Vector yDotPred, N_Vector resPred, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3);
+
 	friend int ::cadet::linearSolveWrapper(IDAMem IDA_mem, N_Vector rhs, N_Vector weight, N_Vector yCur, N_Vector yDotCur, N_Vector resCur);
 
 	friend int ::cadet::residualSensWrapper(int ns, double t, N_Vector y, N_Vector yDot, N_Vector res, 
 			N_Vector* yS, N_Vector* ySDot, N_Vector* resS,
 			void *userData, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3);
 
+	friend int ::cadet::quadratureObjectiveWrapper(double t, N_Vector y, N_Vector yDot, N_Vector rhsQ, void* userData);
+
+	friend int ::cadet::residualAdjointWrapper(double t, N_Vector y, N_Vector yDot, N_Vector yB, N_Vector yBdot, N_Vector resB, void* userData);
+
+	friend int ::cadet::quadratureAdjointWrapper(double t, N_Vector y, N_Vector yDot, N_Vector yB, N_Vector yBdot, N_Vector rhsQB, void* userData);
+
+	friend int ::cadet::linearSolveAdjointWrapper(IDAMem IDA_mem, N_Vector rhs, N_Vector weight, N_Vector yB, N_Vector yBdot, N_Vector resB);
+
 	model::ModelSystem* _model; //!< Simulated model, not owned by the Simulator
 
 	ISolutionRecorder* _solRecorder;
@@ -272,6 +322,14 @@ protected:
 	std::vector<double> _initStepSize; //!< Initial step size for the time integrator
 	unsigned int _maxSteps; //!< Maximum number of time integration steps
 
+	bool _reuseFactorization; //!< Determines whether factorizations of the Jacobian are reused over multiple time steps (modified Newton)
+	bool _reuseFactorizationActive; //!< Determines whether factorizations are reused in the current time integration (not with forward sensitivities)
+	double _cjRatioTol; //!< Maximum deviation of the ratio of current and factorized BDF coefficient from 1 before a new Jacobian is requested
+	double _cjFactorization; //!< BDF coefficient (IDAS' cj) with which the current Jacobian is factorized
+	bool _sensSimultaneous; //!< Determines whether the sensitivity systems are corrected simultaneously with the state (instead of staggered)
+	std::vector<double*> _linSolveRhs; //!< Right hand sides of the batched linear solves in the simultaneous corrector method
+	std::vector<double const*> _linSolveWeight; //!< Error weights of the batched linear solves in the simultaneous corrector method
+
 	SectionIdx _curSec; //!< Index of the current section
 
 	bool _skipConsistencyStateY; //!< Flag that determines whether the consistent initialization is skipped
@@ -283,6 +341,9 @@ protected:
 	active* _vecADres; //!< Vector of AD datatypes for holding the residual
 	active* _vecADy; //!< Vector of AD datatypes for holding the state vector
 
+	IQuadratureObjective* _objective; //!< Objective function of the current adjoint integration, not owned by the Simulator
+	std::vector<double> _objectiveGrad; //!< Gradient of the objective integrand with respect to the state vector
+
 	Timer _timerIntegration; //!< Timer measuring the duration of the call to integrate()
 	double _lastIntTime; //!< Last simulation duration
 };
@@ -48,5 +48,6 @@
 #endif
 
 #define NVec_Const N_VConst
+#define NVec_Scale N_VScale
 
 #endif  // LIBCADET_SUNDIALSVECTOR_HPP_
@@ -20,7 +20,7 @@
 
 #include "AutoDiff.hpp"
 #include "MathUtil.hpp"
-#include "MemoryPool.hpp"
+#include "Stencil.hpp"
 #include "common/CompilerSpecific.hpp"
 #include "cadet/Exceptions.hpp"
 
@@ -55,7 +55,7 @@ public:
 	/**
 	 * @brief Creates the WENO scheme
 	 */
-	Weno() : _order(maxOrder()), _boundaryTreatment(BoundaryTreatment::ReduceOrder), _intermediateValues(3 * maxOrder() * sizeof(active)) { }
+	Weno() : _order(maxOrder()), _boundaryTreatment(BoundaryTreatment::ReduceOrder) { }
 
 	/**
 	 * @brief Returns the maximum order \f$ r \f$ of the implemented schemes
@@ -156,8 +156,10 @@ public:
 			return order;
 		}
 
-		// Allocate memory for intermediate values: beta, alpha (= omega), and vr
-		StateType* const work = _intermediateValues.create<StateType>(3 * order);
+		// Memory for intermediate values: beta, alpha (= omega), and vr
+		// Local storage (instead of a member) allows concurrent reconstructions with the same object
+		StateType work[3 * 3];
+		cadet_assert(order <= static_cast<int>(maxOrder()));
 		StateType* const beta  = work;
 		StateType* const alpha = work + order;
 		StateType* const omega = work + order;
@@ -266,7 +268,61 @@ public:
 					Dvm[order - 1 + j - r] += static_cast<double>(omega[r]) * c[r + order * j];
 		}
 
-		_intermediateValues.destroy<StateType>();
+		return order;
+	}
+
+	/**
+	 * @brief Reconstructs the cell face values of multiple components from volume averages
+	 * @details The volume averages of all components are expected in cell-major ordering, that is, the components
+	 *          of a cell are stored contiguously and cells are @p nComp elements apart. In interior cells, where the
+	 *          full stencil is available and no boundary treatment applies, all components are processed in a
+	 *          single loop that works on consecutive memory locations and is amenable to vectorization by the compiler.
+	 *          Boundary cells fall back to reconstruct() for each component.
+	 * @param [in] epsilon \f$ \varepsilon \f$ of the WENO emthod (prevents division by zero in the weights) 
+	 * @param [in] cellIdx Index of the current cell
+	 * @param [in] numCells Number of cells
+	 * @param [in] w Pointer to the volume average of the first component in the current cell
+	 * @param [in] nComp Number of components
+	 * @param [out] result Array with reconstructed cell face values of all components
+	 * @param [out] Dvm Gradients of the reconstructed cell face values (each of size \f$ 2r-1\f$ where \f$ r \f$ is the WENO order)
+	 * @param [in] strideDvm Distance between the gradients of two consecutive components in @p Dvm
+	 * @tparam StateType Type of the state variables
+	 * @tparam wantJac Determines if the gradient is computed (@c true) or not (@c false)
+	 * @return Order of the WENO scheme that was used in the computation
+	 */
+	template <typename StateType, bool wantJac>
+	int reconstructBatch(double epsilon, unsigned int cellIdx, unsigned int numCells, StateType const* const w, unsigned int nComp, 
+		StateType* const result, double* const Dvm, unsigned int strideDvm)
+	{
+		// Fast path for interior cells
+		if (cadet_likely((static_cast<int>(cellIdx) + 1 >= _order) && (static_cast<int>(cellIdx) + _order <= static_cast<int>(numCells))))
+		{
+			switch (_order)
+			{
+				case 1:
+					for (unsigned int comp = 0; comp < nComp; ++comp)
+					{
+						result[comp] = w[comp];
+						if (wantJac)
+							Dvm[comp * strideDvm] = 1.0;
+					}
+					return 1;
+				case 2:
+					reconstructInterior<StateType, wantJac, 2>(epsilon, w, nComp, result, Dvm, strideDvm, _wenoD2, _wenoC2, _wenoJbvv2);
+					return 2;
+				case 3:
+					reconstructInterior<StateType, wantJac, 3>(epsilon, w, nComp, result, Dvm, strideDvm, _wenoD3, _wenoC3, _wenoJbvv3);
+					return 3;
+			}
+		}
+
+		// Boundary cells
+		int order = 0;
+		for (unsigned int comp = 0; comp < nComp; ++comp)
+		{
+			const StridedStencil<StateType> stencil(w + comp, nComp);
+			order = reconstruct<StateType, StridedStencil<StateType>, wantJac>(epsilon, cellIdx, numCells, stencil, result[comp], Dvm + comp * strideDvm);
+		}
 		return order;
 	}
 
@@ -343,9 +399,118 @@ public:
 
 private:
 
+	/**
+	 * @brief Reconstructs the cell face values of multiple components in an interior cell
+	 * @details Performs the same computations as reconstruct() without boundary treatment. All intermediate
+	 *          values are kept in local variables and the stencil accesses of consecutive components are
+	 *          contiguous in memory (cell-major ordering).
+	 * @param [in] epsilon \f$ \varepsilon \f$ of the WENO emthod (prevents division by zero in the weights) 
+	 * @param [in] w Pointer to the volume average of the first component in the current cell
+	 * @param [in] nComp Number of components
+	 * @param [out] result Array with reconstructed cell face values of all components
+	 * @param [out] Dvm Gradients of the reconstructed cell face values
+	 * @param [in] strideDvm Distance between the gradients of two consecutive components in @p Dvm
+	 * @param [in] d Optimal weights of the substencils
+	 * @param [in] c Reconstruction coefficients of the substencils
+	 * @param [in] Jbvv Coefficients of the derivative of the smoothness indicators
+	 * @tparam StateType Type of the state variables
+	 * @tparam wantJac Determines if the gradient is computed (@c true) or not (@c false)
+	 * @tparam order WENO order
+	 */
+	template <typename StateType, bool wantJac, int order>
+	static void reconstructInterior(double epsilon, StateType const* const w, unsigned int nComp, StateType* const result,
+		double* const Dvm, unsigned int strideDvm, const double* const d, const double* const c, const double* const Jbvv)
+	{
+#if defined(ACTIVE_SETFAD) || defined(ACTIVE_SFAD)
+		using cadet::sqr;
+		using sfad::sqr;
+#elif defined(ACTIVE_ADOLC)
+		using cadet::sqr;
+#endif
+
+		// Total stencil size
+		const int sl = 2 * order - 1;
+		const int s = static_cast<int>(nComp);
+
+		for (unsigned int comp = 0; comp < nComp; ++comp)
+		{
+			// Stencil of the current component, index 0 is the current cell
+			StateType const* const v = w + comp;
+
+			// Smoothness measures
+			StateType beta[order];
+			if (order == 2)
+			{
+				beta[0] = sqr(v[s] - v[0]) + epsilon;
+				beta[1] = sqr(v[0] - v[-s]) + epsilon;
+			}
+			else
+			{
+				beta[0] = 13.0/12.0 * sqr(v[   0] - 2.0 * v[ s] + v[2*s]) + 0.25 * sqr(3.0 * v[   0] - 4.0 * v[ s] +       v[2*s]) + epsilon;
+				beta[1] = 13.0/12.0 * sqr(v[  -s] - 2.0 * v[ 0] + v[  s]) + 0.25 * sqr(      v[  -s] -       v[ s]               ) + epsilon;
+				beta[2] = 13.0/12.0 * sqr(v[-2*s] - 2.0 * v[-s] + v[  0]) + 0.25 * sqr(      v[-2*s] - 4.0 * v[-s] + 3.0 * v[  0]) + epsilon;
+			}
+
+			// Weights
+			StateType omega[order];
+			for (int r = 0; r < order; ++r)
+				omega[r] = d[r] / sqr(beta[r]);
+
+			StateType alpha_sum = omega[0];
+			for (int r = 1; r < order; ++r)
+				alpha_sum += omega[r];
+			for (int r = 0; r < order; ++r)
+				omega[r] /= alpha_sum;
+
+			// Reconstructed values and weighted sum
+			StateType vr[order];
+			StateType res = 0.0;
+			for (int r = 0; r < order; ++r)
+			{
+				vr[r] = 0.0;
+				for (int j = 0; j < order; ++j)
+					vr[r] += c[r + order * j] * v[(j - r) * s];
+				res += vr[r] * omega[r];
+			}
+			result[comp] = res;
+
+			if (!wantJac)
+				continue;
+
+			// Jacobian, see reconstruct() for details
+			double* const D = Dvm + comp * strideDvm;
+
+			double dot = 0.0;
+			for (int r = 0; r < order; ++r)
+				dot += static_cast<double>(vr[r]) * static_cast<double>(omega[r]);
+
+			double dRes[order];
+			for (int r = 0; r < order; ++r)
+			{
+				const double b = static_cast<double>(beta[r]);
+				dRes[r] = (static_cast<double>(vr[r]) - dot) / static_cast<double>(alpha_sum) * (-2.0 * d[r] / (b * b * b));
+			}
+
+			for (int j = 0; j < sl; ++j)
+			{
+				D[j] = 0.0;
+				for (int r = 0; r < order; ++r)
+				{
+					dot = 0.0;
+					for (int i = 0; i < sl; ++i)
+						dot += Jbvv[r + order * j + order * sl * i] * static_cast<double>(v[(i - order + 1) * s]);
+					D[j] += dRes[r] * dot;
+				}
+			}
+
+			for (int r = 0; r < order; ++r)
+				for (int j = 0; j < order; ++j)
+					D[order - 1 + j - r] += static_cast<double>(omega[r]) * c[r + order * j];
+		}
+	}
+
 	int _order; //!< Selected WENO order
 	BoundaryTreatment _boundaryTreatment; //!< Controls how to treat boundary cells
-	ArrayPool _intermediateValues; //!< Buffer for intermediate and temporary values
 
 	static const double _wenoD2[2];
 	static const double _wenoC2[2*2];
@@ -27,7 +27,7 @@ namespace
 {
 
 void bandMatrixVectorMultiplication(unsigned int rows, unsigned int upperBand, unsigned int lowerBand, unsigned int stride,
-	double const* const data, double alpha, double beta, double const* const x, double* const y)
+	double const* const data, double alpha, double beta, double const* const x, double* const y, unsigned int vecStride, bool transposed = false)
 {
 	// Since LAPACK uses column-major storage and we use row-major,
 	// we actually have constructed the transposed matrix. Thus,
@@ -36,11 +36,14 @@ void bandMatrixVectorMultiplication(unsigned int rows, unsigned int upperBand, u
 	lapackInt_t kl = upperBand;
 	lapackInt_t ku = lowerBand;
 	lapackInt_t ldab = stride;
-	lapackInt_t inc = 1; // Stride in vectors (here, elements are continuous without intermediate space)
+	lapackInt_t inc = vecStride; // Stride in vectors (distance between consecutive elements)
 
 	// For LAPACK the matrix looks like it's transposed. We, thus,
 	// multiply with the transposed matrix, which in the end uses the original matrix.
+	// Conversely, the transposed product uses LAPACK's non-transposed operation.
 	char trans[] = "T";
+	if (transposed)
+		trans[0] = 'N';
 
 	// LAPACK computes y <- alpha * A * x + beta * y
 	LapackMultiplyDenseBanded(trans, &n, &n, &kl, &ku, &alpha, const_cast<double*>(data), &ldab, const_cast<double*>(x), &inc, &beta, const_cast<double*>(y), &inc);
@@ -94,7 +97,52 @@ void bandMatrixToSparseString(std::ostream& out, const MatrixType& mt)
 
 void BandMatrix::multiplyVector(const double* const x, double alpha, double beta, double* const y) const
 {
-	bandMatrixVectorMultiplication(_rows, _upperBand, _lowerBand, stride(), _data, alpha, beta, x, y);
+	bandMatrixVectorMultiplication(_rows, _upperBand, _lowerBand, stride(), _data, alpha, beta, x, y, 1);
+}
+
+void BandMatrix::multiplyVector(const double* const x, double alpha, double beta, double* const y, unsigned int inc) const
+{
+	bandMatrixVectorMultiplication(_rows, _upperBand, _lowerBand, stride(), _data, alpha, beta, x, y, inc);
+}
+
+void BandMatrix::multiplyMultiVector(const double* const x, double alpha, double beta, double* const y, unsigned int nVec, unsigned int inc) const
+{
+	const int lowerBand = static_cast<int>(_lowerBand);
+	const int upperBand = static_cast<int>(_upperBand);
+	const unsigned int rowStride = inc * nVec;
+
+	for (unsigned int r = 0; r < _rows; ++r)
+	{
+		double* const yRow = y + r * rowStride;
+
+		// Scale old result, do not read y if beta is zero (like LAPACK)
+		if (beta == 0.0)
+			std::fill(yRow, yRow + nVec, 0.0);
+		else if (beta != 1.0)
+		{
+			for (unsigned int v = 0; v < nVec; ++v)
+				yRow[v] *= beta;
+		}
+
+		const int lower = std::max(-lowerBand, -static_cast<int>(r));
+		const int upper = std::min(upperBand, static_cast<int>(_rows - r) - 1);
+		double const* const rowData = _data + r * stride() + _lowerBand;
+
+		for (int diag = lower; diag <= upper; ++diag)
+		{
+			const double a = alpha * rowData[diag];
+			double const* const xCol = x + (static_cast<int>(r) + diag) * static_cast<int>(rowStride);
+
+			// All vectors share the matrix element, lanes are contiguous
+			for (unsigned int v = 0; v < nVec; ++v)
+				yRow[v] += a * xCol[v];
+		}
+	}
+}
+
+void BandMatrix::transposedMultiplyVector(const double* const x, double alpha, double beta, double* const y, unsigned int inc) const
+{
+	bandMatrixVectorMultiplication(_rows, _upperBand, _lowerBand, stride(), _data, alpha, beta, x, y, inc, true);
 }
 
 void BandMatrix::submatrixMultiplyVector(const double* const x, unsigned int startRow, int startDiag, 
@@ -163,12 +211,12 @@ void BandMatrix::submatrixMultiplyVector(const double* const x, unsigned int sta
 
 void FactorizableBandMatrix::multiplyVector(const double* const x, double* const y) const
 {
-	bandMatrixVectorMultiplication(_rows, _upperBand, _lowerBand, stride(), _data + _upperBand, 1.0, 0.0, x, y);
+	bandMatrixVectorMultiplication(_rows, _upperBand, _lowerBand, stride(), _data + _upperBand, 1.0, 0.0, x, y, 1);
 }
 
 void FactorizableBandMatrix::multiplyVector(const double* const x, double alpha, double beta, double* const y) const
 {
-	bandMatrixVectorMultiplication(_rows, _upperBand, _lowerBand, stride(), _data + _upperBand, alpha, beta, x, y);
+	bandMatrixVectorMultiplication(_rows, _upperBand, _lowerBand, stride(), _data + _upperBand, alpha, beta, x, y, 1);
 }
 
 bool FactorizableBandMatrix::factorize()
@@ -211,6 +259,24 @@ bool FactorizableBandMatrix::solve(double* rhs) const
 	return flag == 0;
 }
 
+bool FactorizableBandMatrix::solve(double* rhs, unsigned int nRhs, unsigned int ldRhs) const
+{
+	// See solve(double*) for the interchanged bands and transposition
+	lapackInt_t n = _rows;
+	lapackInt_t kl = _upperBand;
+	lapackInt_t ku = _lowerBand;
+	lapackInt_t nrhs = nRhs;
+	lapackInt_t ldab = stride();
+	lapackInt_t ldb = ldRhs;
+	lapackInt_t flag = 0;
+	char trans[] = "T";
+
+	LapackSolveDenseBanded(trans, &n, &kl, &ku, &nrhs, const_cast<double*>(_data), &ldab, const_cast<lapackInt_t*>(_pivot), rhs, &ldb, &flag);
+
+	// If the flag is -i (for i > 0), the ith argument is invalid
+	return flag == 0;
+}
+
 std::ostream& operator<<(std::ostream& out, const BandMatrix& bm)
 {
 	bandMatrixToSparseString(out, bm);
@@ -583,6 +583,72 @@ public:
 	 */
 	void multiplyVector(const double* const x, double alpha, double beta, double* const y) const;
 
+	/**
+	 * @brief Multiplies the matrix @f$ A @f$ with a given strided vector @f$ x @f$ and adds it to another strided vector using LAPACK
+	 * @details Computes @f$ y = \alpha Ax + \beta y@f$, where @f$ A @f$ is this matrix and @f$ x @f$ is given.
+	 *          The elements of both vectors @f$ x @f$ and @f$ y @f$ are separated by @p inc entries.
+	 * @param [in] x Vector this matrix is multiplied with
+	 * @param [in] alpha Factor @f$ \alpha @f$ in front of @f$ Ax @f$
+	 * @param [in] beta Factor @f$ \beta @f$ in front of @f$ y @f$
+	 * @param [out] y Result of the matrix-vector multiplication
+	 * @param [in] inc Distance between consecutive elements in @p x and @p y
+	 */
+	void multiplyVector(const double* const x, double alpha, double beta, double* const y, unsigned int inc) const;
+
+	/**
+	 * @brief Multiplies the matrix @f$ A @f$ with a set of interleaved vectors and adds it to another set of interleaved vectors
+	 * @details Computes @f$ Y = \alpha AX + \beta Y @f$, where @f$ A @f$ is this matrix and the columns of @f$ X @f$
+	 *          and @f$ Y @f$ are @p nVec vectors. The vectors are stored interleaved, that is, element @c i of
+	 *          vector @c v is located at <tt>x[i * inc * nVec + v]</tt>. Each matrix element is loaded only
+	 *          once and applied to all vectors in the innermost (vectorizable) loop.
+	 * @param [in] x Interleaved vectors this matrix is multiplied with
+	 * @param [in] alpha Factor @f$ \alpha @f$ in front of @f$ AX @f$
+	 * @param [in] beta Factor @f$ \beta @f$ in front of @f$ Y @f$
+	 * @param [in,out] y Interleaved vectors that store the result of the matrix-multivector multiplication
+	 * @param [in] nVec Number of vectors
+	 * @param [in] inc Distance between consecutive elements of a vector in units of @p nVec
+	 */
+	void multiplyMultiVector(const double* const x, double alpha, double beta, double* const y, unsigned int nVec, unsigned int inc) const;
+
+	/**
+	 * @brief Multiplies the matrix @f$ A @f$ with a set of interleaved vectors and adds it to another set of interleaved vectors
+	 * @details Computes @f$ Y = \alpha AX + \beta Y @f$ with contiguous interleaved vectors (see multiplyMultiVector()).
+	 * @param [in] x Interleaved vectors this matrix is multiplied with
+	 * @param [in] alpha Factor @f$ \alpha @f$ in front of @f$ AX @f$
+	 * @param [in] beta Factor @f$ \beta @f$ in front of @f$ Y @f$
+	 * @param [in,out] y Interleaved vectors that store the result of the matrix-multivector multiplication
+	 * @param [in] nVec Number of vectors
+	 */
+	inline void multiplyMultiVector(const double* const x, double alpha, double beta, double* const y, unsigned int nVec) const
+	{
+		multiplyMultiVector(x, alpha, beta, y, nVec, 1);
+	}
+
+	/**
+	 * @brief Multiplies the transposed matrix @f$ A^T @f$ with a given strided vector @f$ x @f$ and adds it to another strided vector using LAPACK
+	 * @details Computes @f$ y = \alpha A^T x + \beta y@f$, where @f$ A @f$ is this matrix and @f$ x @f$ is given.
+	 *          The elements of both vectors @f$ x @f$ and @f$ y @f$ are separated by @p inc entries.
+	 * @param [in] x Vector the transposed matrix is multiplied with
+	 * @param [in] alpha Factor @f$ \alpha @f$ in front of @f$ A^T x @f$
+	 * @param [in] beta Factor @f$ \beta @f$ in front of @f$ y @f$
+	 * @param [out] y Result of the matrix-vector multiplication
+	 * @param [in] inc Distance between consecutive elements in @p x and @p y
+	 */
+	void transposedMultiplyVector(const double* const x, double alpha, double beta, double* const y, unsigned int inc) const;
+
+	/**
+	 * @brief Multiplies the transposed matrix @f$ A^T @f$ with a given vector @f$ x @f$ and adds it to another vector using LAPACK
+	 * @details Computes @f$ y = \alpha A^T x + \beta y@f$, where @f$ A @f$ is this matrix and @f$ x @f$ is given.
+	 * @param [in] x Vector the transposed matrix is multiplied with
+	 * @param [in] alpha Factor @f$ \alpha @f$ in front of @f$ A^T x @f$
+	 * @param [in] beta Factor @f$ \beta @f$ in front of @f$ y @f$
+	 * @param [out] y Result of the matrix-vector multiplication
+	 */
+	inline void transposedMultiplyVector(const double* const x, double alpha, double beta, double* const y) const
+	{
+		transposedMultiplyVector(x, alpha, beta, y, 1);
+	}
+
 protected:
 	double* _data; //!< Pointer to the array in which the matrix is stored
 	unsigned int _lowerBand; //!< Lower bandwidth excluding main diagonal
@@ -932,6 +998,17 @@ public:
 	 */
 	bool solve(double* rhs) const;
 
+	/**
+	 * @brief Uses the factorized matrix to solve the equation @f$ AX = B @f$ with multiple right hand sides with LAPACK
+	 * @details Before the equation can be solved, the matrix has to be factorized first by calling factorize().
+	 *          The right hand sides are stored one after another (column-major) and solved in a single LAPACK call.
+	 * @param [in,out] rhs On entry pointer to the right hand sides @f$ B @f$ of the equation, on exit the solutions @f$ X @f$
+	 * @param [in] nRhs Number of right hand sides
+	 * @param [in] ldRhs Offset between two consecutive right hand sides in @p rhs (at least the number of rows)
+	 * @return @c true if the solution process was successful, otherwise @c false
+	 */
+	bool solve(double* rhs, unsigned int nRhs, unsigned int ldRhs) const;
+
 protected:
 	double* _data; //!< Pointer to the array in which the matrix is stored
 	unsigned int _lowerBand; //!< Lower bandwidth excluding main diagonal
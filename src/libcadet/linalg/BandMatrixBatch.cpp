@@ -0,0 +1,134 @@
+// =============================================================================
+//  CADET - The Chromatography Analysis and Design Toolkit
+//
+//  Copyright © 2008-2016: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+#include "linalg/BandMatrixBatch.hpp"
+
+#include <algorithm>
+
+namespace cadet
+{
+
+namespace linalg
+{
+
+void FactorizedBandMatrixBatch::resize(unsigned int numMatrices, unsigned int rows, unsigned int lowerBand, unsigned int upperBand)
+{
+	_numMatrices = numMatrices;
+	_rows = rows;
+	_lowerBand = lowerBand;
+	_upperBand = upperBand;
+
+	delete[] _factors;
+	_factors = new double[stride() * _rows * _numMatrices];
+	std::fill(_factors, _factors + stride() * _rows * _numMatrices, 0.0);
+
+	delete[] _pivot;
+	_pivot = new lapackInt_t[_rows * _numMatrices];
+}
+
+void FactorizedBandMatrixBatch::pack(unsigned int idx, const FactorizableBandMatrix& fbm)
+{
+	cadet_assert(idx < _numMatrices);
+	cadet_assert(fbm.rows() == _rows);
+	cadet_assert(fbm.lowerBandwidth() == _lowerBand);
+	cadet_assert(fbm.upperBandwidth() == _upperBand);
+
+	double const* const src = fbm.data();
+	for (unsigned int i = 0; i < stride() * _rows; ++i)
+		_factors[i * _numMatrices + idx] = src[i];
+
+	lapackInt_t const* const srcPivot = fbm.pivot();
+	for (unsigned int i = 0; i < _rows; ++i)
+		_pivot[i * _numMatrices + idx] = srcPivot[i];
+}
+
+void FactorizedBandMatrixBatch::solve(double* const rhs, unsigned int rhsStride, unsigned int first, unsigned int count, double* const work) const
+{
+	cadet_assert(first + count <= _numMatrices);
+
+	// Since LAPACK uses column-major storage and we use row-major,
+	// we actually have factorized the transposed matrix A^T = P * L * U.
+	// Thus, upper and lower diagonals interchange and we solve
+	// A x = U^T * L^T * P^T x = b (see dgbtrs with TRANS = 'T').
+	const unsigned int n = _rows;
+	const unsigned int kl = _upperBand;
+	const unsigned int diag = _upperBand + _lowerBand;
+	const unsigned int N = _numMatrices;
+	const unsigned int colStride = stride() * N;
+
+	// Gather right hand sides into interleaved layout
+	for (unsigned int b = 0; b < count; ++b)
+	{
+		double const* const src = rhs + b * rhsStride;
+		for (unsigned int j = 0; j < n; ++j)
+			work[j * count + b] = src[j];
+	}
+
+	// Solve U^T * y = b by forward substitution
+	for (unsigned int j = 0; j < n; ++j)
+	{
+		double* const xj = work + j * count;
+		double const* const col = _factors + j * colStride + first;
+
+		for (unsigned int i = (j > diag) ? j - diag : 0; i < j; ++i)
+		{
+			double const* const u = col + (diag + i - j) * N;
+			double const* const xi = work + i * count;
+			for (unsigned int b = 0; b < count; ++b)
+				xj[b] -= u[b] * xi[b];
+		}
+
+		double const* const d = col + diag * N;
+		for (unsigned int b = 0; b < count; ++b)
+			xj[b] /= d[b];
+	}
+
+	// Solve L^T * P^T * x = y by backward substitution with row interchanges
+	if (kl > 0)
+	{
+		for (int j = static_cast<int>(n) - 2; j >= 0; --j)
+		{
+			double* const xj = work + j * count;
+			double const* const col = _factors + j * colStride + first;
+
+			const unsigned int lm = std::min(kl, n - 1 - j);
+			for (unsigned int k = 1; k <= lm; ++k)
+			{
+				double const* const l = col + (diag + k) * N;
+				double const* const xk = xj + k * count;
+				for (unsigned int b = 0; b < count; ++b)
+					xj[b] -= l[b] * xk[b];
+			}
+
+			// Pivots are 1-based
+			lapackInt_t const* const piv = _pivot + j * N + first;
+			for (unsigned int b = 0; b < count; ++b)
+			{
+				const int p = static_cast<int>(piv[b]) - 1;
+				if (p != j)
+					std::swap(xj[b], work[p * count + b]);
+			}
+		}
+	}
+
+	// Scatter solution back
+	for (unsigned int b = 0; b < count; ++b)
+	{
+		double* const dest = rhs + b * rhsStride;
+		for (unsigned int j = 0; j < n; ++j)
+			dest[j] = work[j * count + b];
+	}
+}
+
+} // namespace linalg
+
+} // namespace cadet
@@ -0,0 +1,137 @@
+// =============================================================================
+//  CADET - The Chromatography Analysis and Design Toolkit
+//
+//  Copyright © 2008-2016: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+/**
+ * @file
+ * Defines a batch of factorized band matrices of identical structure that are solved simultaneously
+ */
+
+#ifndef LIBCADET_BANDMATRIXBATCH_HPP_
+#define LIBCADET_BANDMATRIXBATCH_HPP_
+
+#include "cadet/cadetCompilerInfo.hpp"
+#include "common/CompilerSpecific.hpp"
+#include "LapackInterface.hpp"
+#include "linalg/BandMatrix.hpp"
+
+namespace cadet
+{
+
+namespace linalg
+{
+
+/**
+ * @brief Batch of LU factorized band matrices with identical size and bandwidths
+ * @details The LU factors and pivots of FactorizableBandMatrix objects (as computed by LAPACK's dgbtrf)
+ *          are stored in an interleaved layout, that is, the same element of all matrices in the batch
+ *          is stored contiguously. The forward and backward substitutions (as in LAPACK's dgbtrs) are
+ *          implemented by hand and process multiple matrices at once. The innermost loops run over the
+ *          matrices of the batch, which makes them amenable to vectorization by the compiler and avoids
+ *          the overhead of calling LAPACK for each (small) matrix.
+ *
+ *          The matrices are packed from factorized FactorizableBandMatrix objects by pack().
+ */
+class FactorizedBandMatrixBatch
+{
+public:
+
+	/**
+	 * @brief Creates an empty batch
+	 * @details No memory is allocated. Users have to call resize() first.
+	 */
+	FactorizedBandMatrixBatch() CADET_NOEXCEPT : _factors(nullptr), _pivot(nullptr), _numMatrices(0), _rows(0), _lowerBand(0), _upperBand(0) { }
+	~FactorizedBandMatrixBatch() CADET_NOEXCEPT
+	{
+		delete[] _factors;
+		delete[] _pivot;
+	}
+
+	FactorizedBandMatrixBatch(const FactorizedBandMatrixBatch& cpy) = delete;
+	FactorizedBandMatrixBatch& operator=(const FactorizedBandMatrixBatch& cpy) = delete;
+
+	/**
+	 * @brief Resizes the batch
+	 * @details All data is lost in this operation.
+	 *
+	 * @param [in] numMatrices Number of matrices in the batch
+	 * @param [in] rows Number of rows of each matrix
+	 * @param [in] lowerBand Number of lower diagonals (excluding the main diagonal)
+	 * @param [in] upperBand Number of upper diagonals (excluding the main diagonal)
+	 */
+	void resize(unsigned int numMatrices, unsigned int rows, unsigned int lowerBand, unsigned int upperBand);
+
+	/**
+	 * @brief Copies the LU factorization of the given matrix into the batch
+	 * @details The given matrix has to be factorized (see FactorizableBandMatrix::factorize()) and
+	 *          must have the size and bandwidths of the batch. Different matrices can be packed concurrently.
+	 * @param [in] idx Index of the matrix in the batch
+	 * @param [in] fbm Factorized band matrix
+	 */
+	void pack(unsigned int idx, const FactorizableBandMatrix& fbm);
+
+	/**
+	 * @brief Solves the equations @f$ A_i x_i = b_i @f$ for a contiguous range of matrices @f$ A_i @f$ in the batch
+	 * @details The right hand side of matrix @f$ i @f$ starts at @p rhs + (@p i - @p first) * @p rhsStride and
+	 *          its elements are contiguous. Disjoint ranges of matrices can be solved concurrently.
+	 * @param [in,out] rhs On entry pointer to the right hand side vector @f$ b_{first} @f$ of the first equation,
+	 *                     on exit all right hand sides are overwritten by the solutions
+	 * @param [in] rhsStride Distance between the right hand sides of two consecutive matrices
+	 * @param [in] first Index of the first matrix in the batch
+	 * @param [in] count Number of matrices to solve
+	 * @param [out] work Workspace of size @p count times rows()
+	 */
+	void solve(double* const rhs, unsigned int rhsStride, unsigned int first, unsigned int count, double* const work) const;
+
+	/**
+	 * @brief Returns the number of matrices in the batch
+	 * @return Number of matrices in the batch
+	 */
+	inline unsigned int numMatrices() const CADET_NOEXCEPT { return _numMatrices; }
+
+	/**
+	 * @brief Returns the number of rows of each matrix
+	 * @return Number of rows
+	 */
+	inline unsigned int rows() const CADET_NOEXCEPT { return _rows; }
+
+	/**
+	 * @brief Returns the lower bandwidth
+	 * @return Number of diagonals below the main diagonal
+	 */
+	inline unsigned int lowerBandwidth() const CADET_NOEXCEPT { return _lowerBand; }
+
+	/**
+	 * @brief Returns the upper bandwidth
+	 * @return Number of diagonals above the main diagonal
+	 */
+	inline unsigned int upperBandwidth() const CADET_NOEXCEPT { return _upperBand; }
+
+protected:
+	double* _factors; //!< Interleaved LU factors of all matrices in LAPACK band storage
+	lapackInt_t* _pivot; //!< Interleaved pivot indices of all matrices
+	unsigned int _numMatrices; //!< Number of matrices in the batch
+	unsigned int _rows; //!< Number of rows of each matrix
+	unsigned int _lowerBand; //!< Lower bandwidth excluding main diagonal
+	unsigned int _upperBand; //!< Upper bandwidth excluding main diagonal
+
+	/**
+	 * @brief Returns the total number of elements in a row including additional storage for factorization
+	 * @return Total number of elements in a row, see FactorizableBandMatrix::stride()
+	 */
+	inline unsigned int stride() const CADET_NOEXCEPT { return _lowerBand + 2 * _upperBand + 1; }
+};
+
+} // namespace linalg
+
+} // namespace cadet
+
+#endif  // LIBCADET_BANDMATRIXBATCH_HPP_
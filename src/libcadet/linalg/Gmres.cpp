@@ -17,6 +17,8 @@
 #include "SundialsVector.hpp"
 
 #include <type_traits>
+#include <algorithm>
+#include <cmath>
 
 namespace cadet
 {
@@ -32,7 +34,16 @@ int gmresCallback(void* userData, N_Vector v, N_Vector z)
 	return callback(g->userData(), NVEC_DATA(v), NVEC_DATA(z));
 }
 
-Gmres::Gmres() CADET_NOEXCEPT : _mem(nullptr), _ortho(Orthogonalization::ModifiedGramSchmidt), _maxRestarts(0), _matrixSize(0), _matVecMul(nullptr), _userData(nullptr)
+// Wrapper function that calls the user preconditioner with the supplied user data
+int gmresPrecondCallback(void* userData, N_Vector r, N_Vector z, int lr)
+{
+	Gmres* const g = static_cast<Gmres*>(userData);
+	Gmres::PreconditionerFun callback = g->preconditioner();
+	return callback(g->userData(), NVEC_DATA(r), NVEC_DATA(z));
+}
+
+Gmres::Gmres() CADET_NOEXCEPT : _mem(nullptr), _ortho(Orthogonalization::ModifiedGramSchmidt), _maxRestarts(0), _matrixSize(0), _maxKrylov(0), _matVecMul(nullptr), _matPanelMul(nullptr), _precond(nullptr), _userData(nullptr),
+	_numSolves(0), _numIter(0), _lastNumIter(0), _numPrecondSolves(0)
 {
 }
 
@@ -50,8 +61,11 @@ void Gmres::initialize(unsigned int matrixSize, unsigned int maxKrylov)
 void Gmres::initialize(unsigned int matrixSize, unsigned int maxKrylov, Orthogonalization om, unsigned int maxRestarts)
 {
 	_matrixSize = matrixSize;
+	_ortho = om;
+	_maxRestarts = maxRestarts;
 	if (maxKrylov == 0)
 		maxKrylov = _matrixSize;
+	_maxKrylov = maxKrylov;
 
 	// Create a template vector for the malloc routine of SPGMR
 	N_Vector NV_tmpl = NVec_New(matrixSize);
@@ -84,11 +98,17 @@ int Gmres::solve(double tolerance, double const* weight, double const* rhs, doub
 	int nPrecondSolve = 0;
 	double res_norm = -1.0;
 
+	// The preconditioner is applied from the right, which leaves the residual norm unchanged
 	const int flag = SpgmrSolve(_mem, this, NV_sol, NV_rhs,
-			PREC_NONE, gsType, tolerance, _maxRestarts, NULL,
-			NV_weight, NV_weight, &gmresCallback, NULL, 
+			_precond ? PREC_RIGHT : PREC_NONE, gsType, tolerance, _maxRestarts, this,
+			NV_weight, NV_weight, &gmresCallback, _precond ? &gmresPrecondCallback : NULL, 
 			&res_norm, &nIter, &nPrecondSolve);
 
+	++_numSolves;
+	_lastNumIter = nIter;
+	_numIter += nIter;
+	_numPrecondSolves += nPrecondSolve;
+
 	// Free NVector memory space
 	NVec_Destroy(NV_rhs);
 	NVec_Destroy(NV_weight);
@@ -97,6 +117,317 @@ int Gmres::solve(double tolerance, double const* weight, double const* rhs, doub
 	return flag;
 }
 
+int Gmres::solve(double tolerance, double const* const* weight, double const* const* rhs, double* const* sol, unsigned int nRhs)
+{
+	const unsigned int n = _matrixSize;
+	const unsigned int m = _maxKrylov;
+	const unsigned int strideKrylov = (m + 1) * n;
+	const unsigned int strideHess = (m + 1) * m;
+	const bool mgs = (_ortho == Orthogonalization::ModifiedGramSchmidt);
+
+	_krylov.resize(nRhs * strideKrylov);
+	_hessenberg.resize(nRhs * strideHess);
+	_givens.resize(nRhs * 2 * m);
+	_resVec.resize(nRhs * (m + 1));
+	// The panel buffers also hold two vectors when the solutions are updated
+	_panelX.resize(std::max(nRhs, 2u) * n);
+	_panelZ.resize(nRhs * n);
+	_panelSys.resize(nRhs);
+	_sysState.resize(nRhs);
+
+	for (unsigned int s = 0; s < nRhs; ++s)
+	{
+		_sysState[s].flag = 2; // SPGMR_CONV_FAIL
+		_sysState[s].resNormInit = 0.0;
+	}
+
+	unsigned int maxIter = 0;
+	for (unsigned int cycle = 0; cycle <= _maxRestarts; ++cycle)
+	{
+		// Compute the weighted residuals r = W * (b - A * x) of all unconverged systems
+		unsigned int nPanel = 0;
+		for (unsigned int s = 0; s < nRhs; ++s)
+		{
+			_sysState[s].running = false;
+			_sysState[s].dim = 0;
+			if (_sysState[s].flag == 0)
+				continue;
+
+			std::copy(sol[s], sol[s] + n, _panelX.data() + nPanel * n);
+			_panelSys[nPanel] = s;
+			++nPanel;
+		}
+
+		if (nPanel == 0)
+			break;
+
+		int flag = multiplyPanel(nPanel);
+		if (flag != 0)
+			return flag;
+
+		for (unsigned int p = 0; p < nPanel; ++p)
+		{
+			const unsigned int s = _panelSys[p];
+			SystemState& state = _sysState[s];
+			double* const v = _krylov.data() + s * strideKrylov;
+			double const* const z = _panelZ.data() + p * n;
+
+			double norm = 0.0;
+			for (unsigned int i = 0; i < n; ++i)
+			{
+				v[i] = weight[s][i] * (rhs[s][i] - z[i]);
+				norm += v[i] * v[i];
+			}
+			norm = std::sqrt(norm);
+
+			if (cycle == 0)
+				state.resNormInit = norm;
+			state.resNorm = norm;
+
+			if (norm <= tolerance)
+			{
+				state.flag = 0;
+				continue;
+			}
+
+			for (unsigned int i = 0; i < n; ++i)
+				v[i] /= norm;
+
+			double* const g = _resVec.data() + s * (m + 1);
+			std::fill(g, g + m + 1, 0.0);
+			g[0] = norm;
+			state.running = true;
+		}
+
+		// Arnoldi process of all running systems in lockstep
+		for (unsigned int j = 0; j < m; ++j)
+		{
+			// Assemble panel of preconditioned and unweighted Krylov vectors P^{-1} * W^{-1} * v_j
+			nPanel = 0;
+			for (unsigned int s = 0; s < nRhs; ++s)
+			{
+				if (!_sysState[s].running)
+					continue;
+
+				double const* const vj = _krylov.data() + s * strideKrylov + j * n;
+				flag = applyPreconditioner(weight[s], vj, _panelZ.data() + nPanel * n, _panelX.data() + nPanel * n);
+				if (flag != 0)
+					return flag;
+
+				_panelSys[nPanel] = s;
+				++nPanel;
+			}
+
+			if (nPanel == 0)
+				break;
+
+			flag = multiplyPanel(nPanel);
+			if (flag != 0)
+				return flag;
+
+			for (unsigned int p = 0; p < nPanel; ++p)
+			{
+				const unsigned int s = _panelSys[p];
+				SystemState& state = _sysState[s];
+				double const* const z = _panelZ.data() + p * n;
+				double* const V = _krylov.data() + s * strideKrylov;
+				double* const w = V + (j + 1) * n;
+				double* const h = _hessenberg.data() + s * strideHess + j * (m + 1);
+				double* const cs = _givens.data() + s * 2 * m;
+				double* const g = _resVec.data() + s * (m + 1);
+
+				for (unsigned int i = 0; i < n; ++i)
+					w[i] = weight[s][i] * z[i];
+
+				// Orthogonalize against previous Krylov vectors
+				for (unsigned int k = 0; k <= j; ++k)
+				{
+					double const* const vk = V + k * n;
+					double dot = 0.0;
+					for (unsigned int i = 0; i < n; ++i)
+						dot += w[i] * vk[i];
+					h[k] = dot;
+
+					if (mgs)
+					{
+						for (unsigned int i = 0; i < n; ++i)
+							w[i] -= dot * vk[i];
+					}
+				}
+
+				if (!mgs)
+				{
+					for (unsigned int k = 0; k <= j; ++k)
+					{
+						double const* const vk = V + k * n;
+						for (unsigned int i = 0; i < n; ++i)
+							w[i] -= h[k] * vk[i];
+					}
+				}
+
+				double norm = 0.0;
+				for (unsigned int i = 0; i < n; ++i)
+					norm += w[i] * w[i];
+				norm = std::sqrt(norm);
+				h[j + 1] = norm;
+
+				if (norm > 0.0)
+				{
+					for (unsigned int i = 0; i < n; ++i)
+						w[i] /= norm;
+				}
+
+				// Apply previous Givens rotations to the new column
+				for (unsigned int k = 0; k < j; ++k)
+				{
+					const double c = cs[2 * k];
+					const double sn = cs[2 * k + 1];
+					const double hk = h[k];
+					h[k] = c * hk + sn * h[k + 1];
+					h[k + 1] = -sn * hk + c * h[k + 1];
+				}
+
+				// Compute new rotation that eliminates the subdiagonal element
+				const double denom = std::hypot(h[j], h[j + 1]);
+				if (denom == 0.0)
+				{
+					// Singular Hessenberg matrix, discard this direction
+					state.flag = 3; // SPGMR_QRFACT_FAIL
+					state.running = false;
+					continue;
+				}
+
+				const double c = h[j] / denom;
+				const double sn = h[j + 1] / denom;
+				cs[2 * j] = c;
+				cs[2 * j + 1] = sn;
+				h[j] = denom;
+				h[j + 1] = 0.0;
+				g[j + 1] = -sn * g[j];
+				g[j] = c * g[j];
+
+				state.dim = j + 1;
+				state.resNorm = std::abs(g[j + 1]);
+				maxIter = std::max(maxIter, state.dim);
+				++_numIter;
+
+				// Stop on convergence or if an invariant subspace has been found (lucky breakdown)
+				if ((state.resNorm <= tolerance) || (norm == 0.0))
+					state.running = false;
+			}
+		}
+
+		// Update solutions x = x + P^{-1} * W^{-1} * V * y with the least squares solution y
+		for (unsigned int s = 0; s < nRhs; ++s)
+		{
+			SystemState& state = _sysState[s];
+			const unsigned int dim = state.dim;
+			if (dim == 0)
+				continue;
+
+			double const* const H = _hessenberg.data() + s * strideHess;
+			double* const g = _resVec.data() + s * (m + 1);
+
+			// Back substitution with upper triangular part of H, solution overwrites g
+			for (int k = static_cast<int>(dim) - 1; k >= 0; --k)
+			{
+				for (unsigned int l = k + 1; l < dim; ++l)
+					g[k] -= H[l * (m + 1) + k] * g[l];
+				g[k] /= H[k * (m + 1) + k];
+			}
+
+			double* const u = _panelX.data();
+			std::fill(u, u + n, 0.0);
+			double const* const V = _krylov.data() + s * strideKrylov;
+			for (unsigned int k = 0; k < dim; ++k)
+			{
+				for (unsigned int i = 0; i < n; ++i)
+					u[i] += g[k] * V[k * n + i];
+			}
+
+			double* const corr = _panelX.data() + n;
+			flag = applyPreconditioner(weight[s], u, _panelZ.data(), corr);
+			if (flag != 0)
+				return flag;
+
+			for (unsigned int i = 0; i < n; ++i)
+				sol[s][i] += corr[i];
+
+			if (state.resNorm <= tolerance)
+				state.flag = 0;
+		}
+	}
+
+	_numSolves += nRhs;
+	_lastNumIter = maxIter;
+
+	// Report the worst outcome of all systems
+	int result = 0;
+	for (unsigned int s = 0; s < nRhs; ++s)
+	{
+		SystemState& state = _sysState[s];
+		if ((state.flag == 2) && (state.resNorm < state.resNormInit))
+			state.flag = 1; // SPGMR_RES_REDUCED
+
+		result = std::max(result, state.flag);
+	}
+
+	return result;
+}
+
+/**
+ * @brief Multiplies the matrix with the first @p nVec vectors of the panel
+ * @details Computes @c _panelZ from @c _panelX using the matrix-panel multiplication function if available.
+ * @param [in] nVec Number of vectors in the panel
+ * @return @c 0 on success, otherwise a SPGMR return flag
+ */
+int Gmres::multiplyPanel(unsigned int nVec)
+{
+	int flag = 0;
+	if (_matPanelMul)
+		flag = _matPanelMul(_userData, _panelX.data(), _panelZ.data(), nVec);
+	else
+	{
+		for (unsigned int p = 0; (p < nVec) && (flag == 0); ++p)
+			flag = _matVecMul(_userData, _panelX.data() + p * _matrixSize, _panelZ.data() + p * _matrixSize);
+	}
+
+	if (flag == 0)
+		return 0;
+
+	// SPGMR_ATIMES_FAIL_REC or SPGMR_ATIMES_FAIL_UNREC
+	return (flag > 0) ? 5 : -2;
+}
+
+/**
+ * @brief Computes @f$ z = P^{-1} W^{-1} v @f$ with weight matrix @f$ W @f$ and preconditioner @f$ P @f$
+ * @param [in] weight Diagonal of the weight matrix @f$ W @f$
+ * @param [in] v Vector @f$ v @f$
+ * @param [out] tmp Workspace of the size of @p v
+ * @param [out] z Result @f$ z @f$
+ * @return @c 0 on success, otherwise a SPGMR return flag
+ */
+int Gmres::applyPreconditioner(double const* weight, double const* v, double* tmp, double* z)
+{
+	if (!_precond)
+	{
+		for (unsigned int i = 0; i < _matrixSize; ++i)
+			z[i] = v[i] / weight[i];
+		return 0;
+	}
+
+	for (unsigned int i = 0; i < _matrixSize; ++i)
+		tmp[i] = v[i] / weight[i];
+
+	++_numPrecondSolves;
+	const int flag = _precond(_userData, tmp, z);
+	if (flag == 0)
+		return 0;
+
+	// SPGMR_PSOLVE_FAIL_REC or SPGMR_PSOLVE_FAIL_UNREC
+	return (flag > 0) ? 4 : -3;
+}
+
 const char* Gmres::getReturnFlagName(int flag) const CADET_NOEXCEPT
 {
 	switch (flag)
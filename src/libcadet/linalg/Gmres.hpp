@@ -21,6 +21,8 @@
 #include "cadet/cadetCompilerInfo.hpp"
 #include "cadet/Exceptions.hpp"
 
+#include <vector>
+
 // Forward declare SUNDIALS types
 typedef struct _SpgmrMemRec SpgmrMemRec;
 
@@ -75,6 +77,31 @@ public:
  	 */
 	typedef int (*MatrixVectorMultFun)(void* userData, double const* x, double* z);
 
+ 	/**
+ 	 * @brief Prototype of preconditioner function provided to GMRES algorithm
+ 	 * @details Solves the system @f$ Pz = r @f$ with the preconditioner @f$ P \approx A @f$.
+ 	 *          The preconditioner is applied from the right.
+ 	 * 
+ 	 * @param [in] userData User data
+ 	 * @param [in] r Right hand side of the preconditioner system
+ 	 * @param [out] z Solution of the preconditioner system (memory is provided by the caller)
+ 	 * @return @c 0 if successful, a positive value on recoverable failure, and a negative value otherwise
+ 	 */
+	typedef int (*PreconditionerFun)(void* userData, double const* r, double* z);
+
+ 	/**
+ 	 * @brief Prototype of matrix-panel multiplication function provided to the multi-RHS GMRES algorithm
+ 	 * @details Performs the matrix vector multiplications @f$ z_i = Ax_i @f$ for a panel of vectors. The
+ 	 *          vectors are stored one after another (column-major), each of them having the size of the matrix.
+ 	 * 
+ 	 * @param [in] userData User data
+ 	 * @param [in] x Panel of vectors the matrix is multiplied with
+ 	 * @param [out] z Panel of results of the multiplications (memory is provided by the caller)
+ 	 * @param [in] nVec Number of vectors in the panel
+ 	 * @return @c 0 if successful, any other value in case of failure
+ 	 */
+	typedef int (*MatrixPanelMultFun)(void* userData, double const* x, double* z, unsigned int nVec);
+
 	Gmres() CADET_NOEXCEPT;
 	~Gmres() CADET_NOEXCEPT;
 
@@ -111,6 +138,25 @@ public:
 	 */
 	int solve(double tolerance, double const* weight, double const* rhs, double* sol);
 
+	/**
+	 * @brief Solves multiple linear equation systems @f$ Ax_i = b_i @f$ with the same matrix simultaneously
+	 * @details Runs one restarted GMRES iteration for each right hand side, but advances all of them in
+	 *          lockstep. Thus, each Arnoldi step requires only one call of the matrix-panel multiplication
+	 *          function (see matrixPanelMultiplier()) for all unconverged systems. If no such function is
+	 *          set, the matrix-vector multiplication function is called for each vector in the panel.
+	 *          Each system is terminated as soon as it has converged. Orthogonalization method, number
+	 *          of restarts, and preconditioner are the same as in solve().
+	 * 
+	 * @param tolerance Threshold on the weighted l^2 norm of the residual which terminates the iteration
+	 * @param weight Array with pointers to the weight vectors used in the error norm of each system
+	 * @param rhs Array with pointers to the right hand side vectors @f$ b_i @f$
+	 * @param sol Array with pointers to the solution vectors, on entry the initial guesses, on exit the solutions if the method has converged
+	 * @param nRhs Number of right hand sides
+	 * @return @c 0 if all systems have converged, a positive value on recoverable error, and a negative value on
+	 *         critical failure (use getReturnFlagName() to convert the return flag to a string)
+	 */
+	int solve(double tolerance, double const* const* weight, double const* const* rhs, double* const* sol, unsigned int nRhs);
+
 	/**
 	 * @brief Returns the orthogonalization method used by GMRES
 	 * @return Orthogonalization method used by GMRES
@@ -154,6 +200,31 @@ public:
 		_userData = ud;
 	}
 
+	/**
+	 * @brief Returns the matrix-panel multiplication function
+	 * @return Matrix-panel multiplication function or @c nullptr if panels are multiplied vector by vector
+	 */
+	inline MatrixPanelMultFun matrixPanelMultiplier() const CADET_NOEXCEPT { return _matPanelMul; }
+	/**
+	 * @brief Sets the matrix-panel multiplication function used by the multi-RHS solve()
+	 * @details The function receives the same user data as the matrix-vector multiplication function.
+	 * @param [in] mpm Matrix-panel multiplication function or @c nullptr to multiply vector by vector
+	 */
+	inline void matrixPanelMultiplier(MatrixPanelMultFun mpm) CADET_NOEXCEPT { _matPanelMul = mpm; }
+
+	/**
+	 * @brief Returns the preconditioner function
+	 * @return Preconditioner function or @c nullptr if no preconditioner is used
+	 */
+	inline PreconditionerFun preconditioner() const CADET_NOEXCEPT { return _precond; }
+
+	/**
+	 * @brief Sets the preconditioner function
+	 * @details The preconditioner receives the same user data as the matrix-vector multiplication function.
+	 * @param [in] pc Preconditioner function or @c nullptr to disable preconditioning
+	 */
+	inline void preconditioner(PreconditionerFun pc) CADET_NOEXCEPT { _precond = pc; }
+
 	/**
 	 * @brief Returns the user data passed to the matrix-vector multiplication function
 	 * @return User data
@@ -172,13 +243,81 @@ public:
 	 */
 	const char* getReturnFlagName(int flag) const CADET_NOEXCEPT;
 
+	/**
+	 * @brief Returns the number of calls to solve() since the last reset of the statistics
+	 * @return Number of solves
+	 */
+	inline unsigned int numSolves() const CADET_NOEXCEPT { return _numSolves; }
+
+	/**
+	 * @brief Returns the total number of GMRES iterations since the last reset of the statistics
+	 * @return Number of iterations
+	 */
+	inline unsigned int numIterations() const CADET_NOEXCEPT { return _numIter; }
+
+	/**
+	 * @brief Returns the number of GMRES iterations of the last call to solve()
+	 * @return Number of iterations of the last solve
+	 */
+	inline unsigned int lastNumIterations() const CADET_NOEXCEPT { return _lastNumIter; }
+
+	/**
+	 * @brief Returns the total number of preconditioner applications since the last reset of the statistics
+	 * @return Number of preconditioner applications
+	 */
+	inline unsigned int numPreconditionerSolves() const CADET_NOEXCEPT { return _numPrecondSolves; }
+
+	/**
+	 * @brief Resets the solver statistics
+	 */
+	inline void resetStatistics() CADET_NOEXCEPT
+	{
+		_numSolves = 0;
+		_numIter = 0;
+		_lastNumIter = 0;
+		_numPrecondSolves = 0;
+	}
+
 protected:
+
+	/**
+	 * @brief State of a single system in the multi-RHS solve()
+	 */
+	struct SystemState
+	{
+		double resNormInit; //!< Weighted norm of the initial residual
+		double resNorm; //!< Weighted norm of the current residual
+		unsigned int dim; //!< Dimension of the Krylov subspace in the current cycle
+		int flag; //!< Return flag
+		bool running; //!< Determines whether the Arnoldi process of the current cycle continues
+	};
+
+	int multiplyPanel(unsigned int nVec);
+	int applyPreconditioner(double const* weight, double const* v, double* tmp, double* z);
+
 	SpgmrMemRec* _mem; //!< SUNDIALS memory
 	Orthogonalization _ortho; //!< Orthogonalization method
 	unsigned int _maxRestarts; //!< Maximum number of restarts
 	unsigned int _matrixSize; //!< Size of the square matrix
+	unsigned int _maxKrylov; //!< Maximum number of stored Krylov vectors
 	MatrixVectorMultFun _matVecMul; //!< Matrix-vector multiplication function required for GMRES algorithm
+	MatrixPanelMultFun _matPanelMul; //!< Optional matrix-panel multiplication function used by the multi-RHS solve()
+	PreconditionerFun _precond; //!< Optional (right) preconditioner function
 	void* _userData; //!< User data for matrix-vector multiplication function
+
+	unsigned int _numSolves; //!< Number of calls to solve()
+	unsigned int _numIter; //!< Total number of GMRES iterations
+	unsigned int _lastNumIter; //!< Number of GMRES iterations of the last call to solve()
+	unsigned int _numPrecondSolves; //!< Total number of preconditioner applications
+
+	std::vector<double> _krylov; //!< Krylov bases of all systems in the multi-RHS solve()
+	std::vector<double> _hessenberg; //!< Upper Hessenberg matrices (column-major) of all systems, triangularized by Givens rotations
+	std::vector<double> _givens; //!< Cosines and sines of the Givens rotations of all systems
+	std::vector<double> _resVec; //!< Rotated right hand sides of the least squares problems of all systems
+	std::vector<double> _panelX; //!< Panel of vectors passed to the matrix-panel multiplication
+	std::vector<double> _panelZ; //!< Panel of results of the matrix-panel multiplication
+	std::vector<unsigned int> _panelSys; //!< Indices of the systems in the current panel
+	std::vector<SystemState> _sysState; //!< States of all systems in the multi-RHS solve()
 };
 
 } // namespace linalg
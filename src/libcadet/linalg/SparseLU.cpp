@@ -0,0 +1,349 @@
+// =============================================================================
+//  CADET - The Chromatography Analysis and Design Toolkit
+//
+//  Copyright © 2008-2016: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+#include "linalg/SparseLU.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace cadet
+{
+
+namespace linalg
+{
+
+void FactorizableSparseMatrix::analyzePattern(unsigned int rows, const std::vector<unsigned int>& rowStart, const std::vector<unsigned int>& colIdx)
+{
+	cadet_assert(rowStart.size() == rows + 1);
+
+	_rows = rows;
+	_isFactorized = false;
+	_numPerturbedPivots = 0;
+	_needsRefinement = false;
+
+	_rowStart.clear();
+	_colIdx.clear();
+	_diagIdx.clear();
+	_rowStart.reserve(rows + 1);
+	_colIdx.reserve(colIdx.size());
+	_diagIdx.resize(rows);
+
+	// The pattern of each row is kept in a sorted linked list of column indices,
+	// where rows denotes the end of the list. The marker array flags columns
+	// that are already present in the list of the current row.
+	std::vector<unsigned int> next(rows + 1);
+	std::vector<unsigned int> marker(rows, rows);
+	std::vector<unsigned int> sortedCols;
+
+	_rowStart.push_back(0);
+	for (unsigned int i = 0; i < rows; ++i)
+	{
+		// Insert pattern of row i of the matrix and its diagonal element
+		sortedCols.assign(colIdx.begin() + rowStart[i], colIdx.begin() + rowStart[i + 1]);
+		sortedCols.push_back(i);
+		std::sort(sortedCols.begin(), sortedCols.end());
+
+		unsigned int tail = rows;
+		for (unsigned int c : sortedCols)
+		{
+			cadet_assert(c < rows);
+			if (marker[c] == i)
+				continue;
+
+			marker[c] = i;
+			next[tail] = c;
+			tail = c;
+		}
+		next[tail] = rows;
+
+		// Eliminate the lower part: Row i receives the fill of all upper rows k < i in its pattern.
+		// Since the fill of row k only consists of columns j > k and the list is sorted, the
+		// columns of row k are merged into the list after k.
+		for (unsigned int k = next[rows]; k < i; k = next[k])
+		{
+			unsigned int pos = k;
+			for (unsigned int idx = _diagIdx[k] + 1; idx < _rowStart[k + 1]; ++idx)
+			{
+				const unsigned int j = _colIdx[idx];
+				if (marker[j] == i)
+					continue;
+
+				while (next[pos] < j)
+					pos = next[pos];
+
+				marker[j] = i;
+				next[j] = next[pos];
+				next[pos] = j;
+				pos = j;
+			}
+		}
+
+		// Store pattern of the factors
+		for (unsigned int c = next[rows]; c < rows; c = next[c])
+		{
+			if (c == i)
+				_diagIdx[i] = _colIdx.size();
+			_colIdx.push_back(c);
+		}
+		_rowStart.push_back(_colIdx.size());
+	}
+
+	_values.resize(_colIdx.size());
+	std::fill(_values.begin(), _values.end(), 0.0);
+	_workPos.resize(rows);
+	std::fill(_workPos.begin(), _workPos.end(), -1);
+}
+
+void FactorizableSparseMatrix::setAll(double val)
+{
+	std::fill(_values.begin(), _values.end(), val);
+	_isFactorized = false;
+	_numPerturbedPivots = 0;
+	_needsRefinement = false;
+}
+
+unsigned int FactorizableSparseMatrix::findElement(unsigned int row, unsigned int col) const
+{
+	cadet_assert(row < _rows);
+	cadet_assert(col < _rows);
+
+	std::vector<unsigned int>::const_iterator first = _colIdx.begin() + _rowStart[row];
+	std::vector<unsigned int>::const_iterator last = _colIdx.begin() + _rowStart[row + 1];
+	std::vector<unsigned int>::const_iterator it = std::lower_bound(first, last, col);
+
+	cadet_assert((it != last) && (*it == col));
+	return it - _colIdx.begin();
+}
+
+double& FactorizableSparseMatrix::operator()(unsigned int row, unsigned int col)
+{
+	return _values[findElement(row, col)];
+}
+
+const double FactorizableSparseMatrix::operator()(unsigned int row, unsigned int col) const
+{
+	return _values[findElement(row, col)];
+}
+
+bool FactorizableSparseMatrix::factorize()
+{
+	_isFactorized = false;
+	_numPerturbedPivots = 0;
+	_needsRefinement = false;
+
+	// Keep the matrix for iterative refinement
+	_matrixValues = _values;
+
+	const double eps = std::numeric_limits<double>::epsilon();
+	const double pivotThreshold = std::sqrt(eps);
+	double maxElemA = 0.0;
+	double maxElemU = 0.0;
+
+	// Row-wise elimination (IKJ variant): Row i is updated by all rows k < i in its lower pattern.
+	// The pattern of the factors contains all fill-in, so every update hits an existing element.
+	for (unsigned int i = 0; i < _rows; ++i)
+	{
+		const unsigned int rowEnd = _rowStart[i + 1];
+
+		// Row i has not been touched by the elimination so far
+		double rowMax = 0.0;
+		for (unsigned int idx = _rowStart[i]; idx < rowEnd; ++idx)
+		{
+			_workPos[_colIdx[idx]] = idx;
+			rowMax = std::max(rowMax, std::abs(_values[idx]));
+		}
+		maxElemA = std::max(maxElemA, rowMax);
+
+		for (unsigned int idx = _rowStart[i]; idx < _diagIdx[i]; ++idx)
+		{
+			const unsigned int k = _colIdx[idx];
+			const double lik = _values[idx] / _values[_diagIdx[k]];
+			_values[idx] = lik;
+
+			for (unsigned int kIdx = _diagIdx[k] + 1; kIdx < _rowStart[k + 1]; ++kIdx)
+			{
+				cadet_assert(_workPos[_colIdx[kIdx]] >= 0);
+				_values[_workPos[_colIdx[kIdx]]] -= lik * _values[kIdx];
+			}
+		}
+
+		for (unsigned int idx = _rowStart[i]; idx < rowEnd; ++idx)
+			_workPos[_colIdx[idx]] = -1;
+
+		double& pivot = _values[_diagIdx[i]];
+		if (cadet_unlikely((rowMax == 0.0) || !std::isfinite(pivot)))
+			return false;
+
+		// Static pivoting: Replace a pivot that vanishes compared to the row of the original matrix
+		if (cadet_unlikely(std::abs(pivot) <= eps * rowMax))
+		{
+			pivot = (pivot < 0.0) ? -pivotThreshold * rowMax : pivotThreshold * rowMax;
+			++_numPerturbedPivots;
+		}
+
+		for (unsigned int idx = _diagIdx[i]; idx < rowEnd; ++idx)
+			maxElemU = std::max(maxElemU, std::abs(_values[idx]));
+	}
+
+	// Refine solutions if the factors belong to a perturbed matrix or if their elements have grown
+	// so much that the substitutions may have lost accuracy
+	_needsRefinement = (_numPerturbedPivots > 0) || (maxElemU * pivotThreshold > maxElemA);
+
+	_isFactorized = true;
+	return true;
+}
+
+bool FactorizableSparseMatrix::solve(double* rhs) const
+{
+	if (cadet_unlikely(!_isFactorized))
+		return false;
+
+	if (cadet_likely(!_needsRefinement))
+	{
+		substitute(rhs);
+		return true;
+	}
+
+	_refineRhs.assign(rhs, rhs + _rows);
+	substitute(rhs);
+	return refine(rhs, false);
+}
+
+bool FactorizableSparseMatrix::solveTransposed(double* rhs) const
+{
+	if (cadet_unlikely(!_isFactorized))
+		return false;
+
+	if (cadet_likely(!_needsRefinement))
+	{
+		substituteTransposed(rhs);
+		return true;
+	}
+
+	_refineRhs.assign(rhs, rhs + _rows);
+	substituteTransposed(rhs);
+	return refine(rhs, true);
+}
+
+void FactorizableSparseMatrix::substitute(double* rhs) const
+{
+	// Solve L * y = b by forward substitution (L has unit diagonal)
+	for (unsigned int i = 0; i < _rows; ++i)
+	{
+		double sum = rhs[i];
+		for (unsigned int idx = _rowStart[i]; idx < _diagIdx[i]; ++idx)
+			sum -= _values[idx] * rhs[_colIdx[idx]];
+		rhs[i] = sum;
+	}
+
+	// Solve U * x = y by backward substitution
+	for (unsigned int i = _rows; i > 0; --i)
+	{
+		const unsigned int row = i - 1;
+		double sum = rhs[row];
+		for (unsigned int idx = _diagIdx[row] + 1; idx < _rowStart[row + 1]; ++idx)
+			sum -= _values[idx] * rhs[_colIdx[idx]];
+		rhs[row] = sum / _values[_diagIdx[row]];
+	}
+}
+
+void FactorizableSparseMatrix::substituteTransposed(double* rhs) const
+{
+	// Solve U^T * y = b by forward substitution (row i of U is column i of U^T)
+	for (unsigned int i = 0; i < _rows; ++i)
+	{
+		const double yi = rhs[i] / _values[_diagIdx[i]];
+		rhs[i] = yi;
+		for (unsigned int idx = _diagIdx[i] + 1; idx < _rowStart[i + 1]; ++idx)
+			rhs[_colIdx[idx]] -= _values[idx] * yi;
+	}
+
+	// Solve L^T * x = y by backward substitution (L has unit diagonal)
+	for (unsigned int i = _rows; i > 0; --i)
+	{
+		const unsigned int row = i - 1;
+		const double xi = rhs[row];
+		for (unsigned int idx = _rowStart[row]; idx < _diagIdx[row]; ++idx)
+			rhs[_colIdx[idx]] -= _values[idx] * xi;
+	}
+}
+
+/**
+ * @brief Improves the solution by iterative refinement
+ * @details The residual @f$ r = b - Ax @f$ with respect to the original matrix is computed and the
+ *          correction @f$ \Delta x @f$ is obtained from the (perturbed) factors. The iteration stops
+ *          when the correction is at round-off level or stagnates. The right hand side @f$ b @f$
+ *          is expected in @c _refineRhs.
+ * @param [in,out] sol On entry the solution obtained from the factors, on exit the refined solution
+ * @param [in] transposed Determines whether the transposed system @f$ A^T x = b @f$ is solved
+ * @return @c true if the refinement has converged, otherwise @c false
+ */
+bool FactorizableSparseMatrix::refine(double* sol, bool transposed) const
+{
+	const unsigned int maxIter = 10;
+	const double eps = std::numeric_limits<double>::epsilon();
+	const double tol = std::sqrt(eps);
+
+	double prevNormCorr = std::numeric_limits<double>::infinity();
+	double normCorr = 0.0;
+	double normSol = 0.0;
+	for (unsigned int iter = 0; iter < maxIter; ++iter)
+	{
+		// Compute residual r = b - A * x (or b - A^T * x) with the original matrix
+		_refineCorr = _refineRhs;
+		if (transposed)
+		{
+			for (unsigned int i = 0; i < _rows; ++i)
+			{
+				for (unsigned int idx = _rowStart[i]; idx < _rowStart[i + 1]; ++idx)
+					_refineCorr[_colIdx[idx]] -= _matrixValues[idx] * sol[i];
+			}
+			substituteTransposed(_refineCorr.data());
+		}
+		else
+		{
+			for (unsigned int i = 0; i < _rows; ++i)
+			{
+				double sum = 0.0;
+				for (unsigned int idx = _rowStart[i]; idx < _rowStart[i + 1]; ++idx)
+					sum += _matrixValues[idx] * sol[_colIdx[idx]];
+				_refineCorr[i] -= sum;
+			}
+			substitute(_refineCorr.data());
+		}
+
+		normCorr = 0.0;
+		normSol = 0.0;
+		for (unsigned int i = 0; i < _rows; ++i)
+		{
+			sol[i] += _refineCorr[i];
+			normCorr = std::max(normCorr, std::abs(_refineCorr[i]));
+			normSol = std::max(normSol, std::abs(sol[i]));
+		}
+
+		if (!std::isfinite(normSol))
+			return false;
+
+		// Stop if the correction is at round-off level or does not decrease sufficiently
+		if ((normCorr <= eps * normSol) || (normCorr > 0.5 * prevNormCorr))
+			break;
+
+		prevNormCorr = normCorr;
+	}
+
+	return normCorr <= tol * normSol;
+}
+
+} // namespace linalg
+
+} // namespace cadet
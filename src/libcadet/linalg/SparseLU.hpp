@@ -0,0 +1,186 @@
+// =============================================================================
+//  CADET - The Chromatography Analysis and Design Toolkit
+//
+//  Copyright © 2008-2016: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+/**
+ * @file
+ * Defines a sparse matrix in compressed row storage that can be LU factorized in place
+ */
+
+#ifndef LIBCADET_SPARSELU_HPP_
+#define LIBCADET_SPARSELU_HPP_
+
+#include "cadet/cadetCompilerInfo.hpp"
+#include "common/CompilerSpecific.hpp"
+
+#include <vector>
+
+namespace cadet
+{
+
+namespace linalg
+{
+
+/**
+ * @brief Square sparse matrix in compressed row storage (CSR) that can be LU factorized in place
+ * @details The factorization is split into a symbolic and a numeric phase. The symbolic phase
+ *          (analyzePattern()) computes the sparsity pattern of the LU factors including fill-in
+ *          and allocates the storage. It has to be performed only once for a given sparsity pattern.
+ *          The numeric phase (factorize()) computes the LU factors of the values set in the matrix
+ *          and can be repeated as often as the values change, which makes it cheap to refactorize
+ *          Jacobians with fixed structure.
+ *
+ *          The matrix entries are assembled directly into the storage of the factors, which also
+ *          holds the fill-in positions (set to @c 0 by setAll()). The elements of the original pattern
+ *          are accessed by operator()() or addElement(). Accessing an element that is not part of
+ *          the pattern of the factors is an error.
+ *
+ *          The factorization uses the natural ordering, which keeps the pattern of the factors fixed.
+ *          Instead of exchanging rows, static pivoting is applied: A pivot that vanishes compared to the
+ *          largest element of its row in the original matrix, @f$ |u_{ii}| \leq \varepsilon \max_j |a_{ij}| @f$,
+ *          is replaced by @f$ \sqrt{\varepsilon} \max_j |a_{ij}| @f$. Such pivots occur, for example, in
+ *          algebraic equations without diagonal element (e.g., quasi-stationary binding with vanishing
+ *          desorption rate) if the elimination does not create a pivot by fill-in. Small pivots that
+ *          are not perturbed can cause growth of the elements of the factors, which is monitored.
+ *
+ *          If pivots have been perturbed or the elements of the factors have grown by more than
+ *          @f$ 1 / \sqrt{\varepsilon} @f$ compared to the matrix, solve() and solveTransposed() improve the
+ *          solution by iterative refinement with respect to the original matrix. A refinement that does
+ *          not converge (e.g., for nearly singular matrices) is reported as failed solution. Hence, the
+ *          solver is suited for matrices whose natural ordering is stable (e.g., (block) diagonally dominant
+ *          matrices as they arise from the time discretization of the model equations) and detects, but
+ *          does not cure, unstable orderings.
+ */
+class FactorizableSparseMatrix
+{
+public:
+
+	/**
+	 * @brief Creates an empty matrix
+	 * @details No memory is allocated. Users have to call analyzePattern() first.
+	 */
+	FactorizableSparseMatrix() CADET_NOEXCEPT : _rows(0), _numPerturbedPivots(0), _needsRefinement(false), _isFactorized(false) { }
+
+	/**
+	 * @brief Computes the sparsity pattern of the LU factors and allocates memory
+	 * @details The given pattern is in compressed row storage, that is, the column indices of row @c i
+	 *          are stored in @p colIdx at positions @p rowStart[i] to @p rowStart[i+1] - 1. The column
+	 *          indices of a row may be unsorted and contain duplicates. Diagonal elements are always
+	 *          added to the pattern. All values are set to @c 0.
+	 *
+	 * @param [in] rows Number of rows (and columns) of the matrix
+	 * @param [in] rowStart Start index of each row in @p colIdx with an additional last element marking the end
+	 * @param [in] colIdx Column indices of the non-zero elements
+	 */
+	void analyzePattern(unsigned int rows, const std::vector<unsigned int>& rowStart, const std::vector<unsigned int>& colIdx);
+
+	/**
+	 * @brief Sets all elements (including fill-in) to the given value
+	 * @param [in] val Value of all elements
+	 */
+	void setAll(double val);
+
+	/**
+	 * @brief Accesses an element of the pattern
+	 * @details The element has to be part of the pattern passed to analyzePattern().
+	 * @param [in] row Row index
+	 * @param [in] col Column index
+	 * @return Matrix element at the given position
+	 */
+	double& operator()(unsigned int row, unsigned int col);
+	const double operator()(unsigned int row, unsigned int col) const;
+
+	/**
+	 * @brief Adds the given value to an element of the pattern
+	 * @param [in] row Row index
+	 * @param [in] col Column index
+	 * @param [in] val Value that is added to the element
+	 */
+	inline void addElement(unsigned int row, unsigned int col, double val) { (*this)(row, col) += val; }
+
+	/**
+	 * @brief Factorizes the matrix in place using LU decomposition with static pivoting
+	 * @details The unit lower triangular factor @f$ L @f$ and the upper triangular factor @f$ U @f$
+	 *          overwrite the matrix elements. A copy of the matrix is kept for iterative refinement.
+	 *          Small pivots are perturbed as described in the class documentation.
+	 * @return @c true if the factorization was successful, otherwise @c false (e.g., a row is zero or a non-finite value was encountered)
+	 */
+	bool factorize();
+
+	/**
+	 * @brief Uses the factorized matrix to solve the equation @f$ Ax = b @f$ with forward and backward substitution
+	 * @details The matrix has to be factorized first by calling factorize(). If pivots have been
+	 *          perturbed or the factors have grown, the solution is improved by iterative refinement.
+	 * @param [in,out] rhs On entry pointer to the right hand side vector @f$ b @f$, on exit the solution @f$ x @f$
+	 * @return @c true if the solution process was successful, otherwise @c false (e.g., the refinement did not converge)
+	 */
+	bool solve(double* rhs) const;
+
+	/**
+	 * @brief Uses the factorized matrix to solve the transposed equation @f$ A^T x = b @f$
+	 * @details The matrix has to be factorized first by calling factorize(). Since @f$ A^T = U^T L^T @f$,
+	 *          a forward substitution with @f$ U^T @f$ is followed by a backward substitution with the
+	 *          unit upper triangular @f$ L^T @f$. Both are performed column-wise on the row storage.
+	 *          If pivots have been perturbed or the factors have grown, the solution is improved by iterative refinement.
+	 * @param [in,out] rhs On entry pointer to the right hand side vector @f$ b @f$, on exit the solution @f$ x @f$
+	 * @return @c true if the solution process was successful, otherwise @c false (e.g., the refinement did not converge)
+	 */
+	bool solveTransposed(double* rhs) const;
+
+	/**
+	 * @brief Returns the number of rows (and columns)
+	 * @return Number of rows
+	 */
+	inline unsigned int rows() const CADET_NOEXCEPT { return _rows; }
+
+	/**
+	 * @brief Returns the number of structurally non-zero elements of the factors (including fill-in)
+	 * @return Number of non-zero elements of the factors
+	 */
+	inline unsigned int numNonZero() const CADET_NOEXCEPT { return _values.size(); }
+
+	/**
+	 * @brief Returns whether the matrix is factorized
+	 * @return @c true if the matrix holds LU factors, otherwise @c false
+	 */
+	inline bool isFactorized() const CADET_NOEXCEPT { return _isFactorized; }
+
+	/**
+	 * @brief Returns the number of pivots that have been perturbed in the last factorization
+	 * @return Number of perturbed pivots
+	 */
+	inline unsigned int numPerturbedPivots() const CADET_NOEXCEPT { return _numPerturbedPivots; }
+
+protected:
+	unsigned int _rows; //!< Number of rows (and columns)
+	std::vector<unsigned int> _rowStart; //!< Start index of each row in @c _colIdx and @c _values
+	std::vector<unsigned int> _colIdx; //!< Sorted column indices of each row of the factors
+	std::vector<unsigned int> _diagIdx; //!< Index of the diagonal element of each row in @c _values
+	std::vector<double> _values; //!< Values of the matrix or of its LU factors
+	std::vector<double> _matrixValues; //!< Values of the matrix before factorization (used for iterative refinement)
+	std::vector<int> _workPos; //!< Maps column indices to positions in @c _values of the current row during factorization
+	mutable std::vector<double> _refineRhs; //!< Right hand side of the system during iterative refinement
+	mutable std::vector<double> _refineCorr; //!< Residual and correction of the solution during iterative refinement
+	unsigned int _numPerturbedPivots; //!< Number of pivots perturbed in the last factorization
+	bool _needsRefinement; //!< Determines whether solutions are improved by iterative refinement
+	bool _isFactorized; //!< Determines whether the matrix holds LU factors
+
+	unsigned int findElement(unsigned int row, unsigned int col) const;
+	void substitute(double* rhs) const;
+	void substituteTransposed(double* rhs) const;
+	bool refine(double* sol, bool transposed) const;
+};
+
+} // namespace linalg
+
+} // namespace cadet
+
+#endif  // LIBCADET_SPARSELU_HPP_
@@ -14,6 +14,7 @@
 
 #include <sstream>
 #include <ostream>
+#include <algorithm>
 
 namespace cadet
 {
@@ -63,6 +64,113 @@ std::ostream& operator<<(std::ostream& out, const SparseMatrix& sm)
 	return out;
 }
 
+void CompressedSparseMatrix::assignPattern(const SparseMatrix& sm)
+{
+	const std::vector<unsigned int>& spRows = sm.rows();
+	const std::vector<unsigned int>& spCols = sm.cols();
+	const std::vector<double>& spVals = sm.values();
+
+	// Sort elements by row and column
+	std::vector<unsigned int> order(sm.numNonZero());
+	for (unsigned int i = 0; i < order.size(); ++i)
+		order[i] = i;
+
+	std::sort(order.begin(), order.end(), [&](unsigned int a, unsigned int b) -> bool
+		{
+			return (spRows[a] < spRows[b]) || ((spRows[a] == spRows[b]) && (spCols[a] < spCols[b]));
+		});
+
+	_rowIdx.clear();
+	_rowStart.clear();
+	_colIdx.clear();
+	_colIdx.reserve(order.size());
+	_values.clear();
+	_values.reserve(order.size());
+
+	for (unsigned int i = 0; i < order.size(); ++i)
+	{
+		const unsigned int idx = order[i];
+		const bool newRow = _rowIdx.empty() || (_rowIdx.back() != spRows[idx]);
+
+		// Merge duplicates
+		if (!newRow && (_colIdx.back() == spCols[idx]))
+		{
+			_values.back() += spVals[idx];
+			continue;
+		}
+
+		if (newRow)
+		{
+			_rowIdx.push_back(spRows[idx]);
+			_rowStart.push_back(_colIdx.size());
+		}
+
+		_colIdx.push_back(spCols[idx]);
+		_values.push_back(spVals[idx]);
+	}
+	_rowStart.push_back(_colIdx.size());
+}
+
+unsigned int CompressedSparseMatrix::findElement(unsigned int row, unsigned int col) const
+{
+	std::vector<unsigned int>::const_iterator itRow = std::lower_bound(_rowIdx.begin(), _rowIdx.end(), row);
+	cadet_assert((itRow != _rowIdx.end()) && (*itRow == row));
+	const unsigned int r = itRow - _rowIdx.begin();
+
+	std::vector<unsigned int>::const_iterator first = _colIdx.begin() + _rowStart[r];
+	std::vector<unsigned int>::const_iterator last = _colIdx.begin() + _rowStart[r + 1];
+	std::vector<unsigned int>::const_iterator it = std::lower_bound(first, last, col);
+
+	cadet_assert((it != last) && (*it == col));
+	return it - _colIdx.begin();
+}
+
+std::ostream& operator<<(std::ostream& out, const CompressedSparseMatrix& sm)
+{
+	std::ostringstream cols;
+	std::ostringstream rows;
+	std::ostringstream elems;
+
+	cols.copyfmt(out);
+	rows.copyfmt(out);
+	elems.copyfmt(out);
+
+	cols << "cols = [";
+	rows << "rows = [";
+	elems << "elems = [";
+
+	const std::vector<unsigned int>& spRowIdx = sm.rowIndex();
+	const std::vector<unsigned int>& spRowStart = sm.rowStart();
+	const std::vector<unsigned int>& spCols = sm.columns();
+	const std::vector<double>& spVals = sm.values();
+
+	for (unsigned int r = 0; r < sm.numNonEmptyRows(); ++r)
+	{
+		for (unsigned int i = spRowStart[r]; i < spRowStart[r + 1]; ++i)
+		{
+			if (i > 0)
+			{
+				cols << ", ";
+				rows << ", ";
+				elems << ", ";
+			}
+
+			cols << spCols[i] + 1;
+			rows << spRowIdx[r] + 1;
+			elems << spVals[i];
+		}
+	}
+
+	cols << "];";
+	rows << "];";
+	elems << "];";
+
+	out << cols.str() << "\n";
+	out << rows.str() << "\n";
+	out << elems.str();
+	return out;
+}
+
 
 }  // namespace linalg
 
@@ -20,9 +20,11 @@
 
 #include <vector>
 #include <ostream>
+#include <algorithm>
 
 #include "cadet/cadetCompilerInfo.hpp"
 #include "common/CompilerSpecific.hpp"
+#include "OpenMPSupport.hpp"
 
 namespace cadet
 {
@@ -238,12 +240,78 @@ private:
 std::ostream& operator<<(std::ostream& out, const SparseMatrix& sm);
 
 
+/**
+ * @brief Represents a sparse matrix in compressed row storage (CSR) with a fixed sparsity pattern
+ * @details The sparsity pattern is set once by assignPattern() from a SparseMatrix (which serves as
+ *          construction format) and is frozen afterwards. Only the values of the elements in the pattern
+ *          can be changed, which avoids rebuilding the matrix if just its values change. Elements are
+ *          looked up by binary search in their row.
+ *
+ *          Only non-empty rows are stored (i.e., their indices are kept in a list). This keeps the
+ *          matrix-vector products cheap for blocks that only touch a few rows of a large vector. As
+ *          with SparseMatrix, empty rows are not touched by the matrix-vector products.
+ *
+ *          The rows are processed independently in the matrix-vector products, which makes them amenable
+ *          to OpenMP parallelization (for large matrices) and vectorization of the inner loop over a row.
+ */
 class CompressedSparseMatrix
 {
 public:
-	CompressedSparseMatrix() CADET_NOEXCEPT : _values(nullptr) { }
+	/**
+	 * @brief Creates an empty CompressedSparseMatrix
+	 * @details Users have to call assignPattern() prior to populating the matrix.
+	 */
+	CompressedSparseMatrix() CADET_NOEXCEPT { }
 
+	/**
+	 * @brief Sets the sparsity pattern and the values of the matrix
+	 * @details The pattern consists of the elements of the given SparseMatrix. Duplicate
+	 *          elements are merged and their values are added.
+	 * 
+	 * @param [in] sm Matrix in coordinate list format whose pattern and values are copied
+	 */
+	void assignPattern(const SparseMatrix& sm);
 
+	/**
+	 * @brief Sets all elements of the pattern to the given value
+	 * @param [in] val Value of all elements
+	 */
+	inline void setAll(double val)
+	{
+		std::fill(_values.begin(), _values.end(), val);
+	}
+
+	/**
+	 * @brief Accesses an element of the pattern
+	 * @details The element has to be part of the pattern set by assignPattern().
+	 * @param [in] row Row index
+	 * @param [in] col Column index
+	 * @return Matrix element at the given position
+	 */
+	inline double& operator()(unsigned int row, unsigned int col)
+	{
+		return _values[findElement(row, col)];
+	}
+
+	inline const double operator()(unsigned int row, unsigned int col) const
+	{
+		return _values[findElement(row, col)];
+	}
+
+	/**
+	 * @brief Multiplies this sparse matrix with a vector and adds another vector to it
+	 * @details Computes the matrix vector operation \f$y = \alpha Ax + \beta y. \f$
+	 * @param [in] x Vector @f$ x @f$ to multiply with
+	 * @param [in] alpha Factor @f$ \alpha @f$ in front of @f$ Ax @f$
+	 * @param [in] beta Factor @f$ \beta @f$ in front of @f$ y @f$
+	 * @param [in,out] out Vector @f$ y @f$ to write to
+	 */
+	inline void multiplyVector(double const* const x, double alpha, double beta, double* const out) const
+	{
+		#pragma omp parallel for schedule(static) if (_values.size() >= parallelThreshold)
+		for (ompuint_t r = 0; r < static_cast<ompuint_t>(_rowIdx.size()); ++r)
+			out[_rowIdx[r]] = alpha * rowTimesVector(r, x) + beta * out[_rowIdx[r]];
+	}
 
 	/**
 	 * @brief Multiplies this sparse matrix with a vector and adds the result to another vector
@@ -253,9 +321,11 @@ public:
 	 * @param [in] x Vector to multiply with
 	 * @param [in,out] out Vector to add the matrix-vector product to
 	 */
-	inline void multiplyAdd(double const* const x, double* const out)
+	inline void multiplyAdd(double const* const x, double* const out) const
 	{
-
+		#pragma omp parallel for schedule(static) if (_values.size() >= parallelThreshold)
+		for (ompuint_t r = 0; r < static_cast<ompuint_t>(_rowIdx.size()); ++r)
+			out[_rowIdx[r]] += rowTimesVector(r, x);
 	}
 
 	/**
@@ -267,9 +337,38 @@ public:
 	 * @param [in] x Vector to multiply with
 	 * @param [in,out] out Vector to add the matrix-vector product to
 	 */
-	inline void multiplyAdd(double alpha, double const* const x, double* const out)
+	inline void multiplyAdd(double alpha, double const* const x, double* const out) const
 	{
+		#pragma omp parallel for schedule(static) if (_values.size() >= parallelThreshold)
+		for (ompuint_t r = 0; r < static_cast<ompuint_t>(_rowIdx.size()); ++r)
+			out[_rowIdx[r]] += alpha * rowTimesVector(r, x);
+	}
 
+	/**
+	 * @brief Multiplies this sparse matrix with a set of interleaved vectors and adds the scaled result to other interleaved vectors
+	 * @details Computes the matrix operation \f$ B + \alpha AX \f$, where the product is added to @p out,
+	 *          which is \f$ B \f$. The @p nVec vectors are stored interleaved, that is, element @c i of
+	 *          vector @c v is located at <tt>x[i * nVec + v]</tt>.
+	 *
+	 * @param [in] alpha Scaling factor
+	 * @param [in] x Interleaved vectors to multiply with
+	 * @param [in,out] out Interleaved vectors to add the matrix-multivector product to
+	 * @param [in] nVec Number of vectors
+	 */
+	inline void multiplyAddMultiVector(double alpha, double const* const x, double* const out, unsigned int nVec) const
+	{
+		#pragma omp parallel for schedule(static) if (_values.size() * nVec >= parallelThreshold)
+		for (ompuint_t r = 0; r < static_cast<ompuint_t>(_rowIdx.size()); ++r)
+		{
+			double* const outRow = out + _rowIdx[r] * nVec;
+			for (unsigned int i = _rowStart[r]; i < _rowStart[r + 1]; ++i)
+			{
+				const double a = alpha * _values[i];
+				double const* const xCol = x + _colIdx[i] * nVec;
+				for (unsigned int v = 0; v < nVec; ++v)
+					outRow[v] += a * xCol[v];
+			}
+		}
 	}
 
 	/**
@@ -280,15 +379,90 @@ public:
 	 * @param [in] x Vector to multiply with
 	 * @param [in,out] out Vector to subtract the matrix-vector product from
 	 */
-	inline void multiplySubtract(double const* const x, double* const out)
+	inline void multiplySubtract(double const* const x, double* const out) const
 	{
+		#pragma omp parallel for schedule(static) if (_values.size() >= parallelThreshold)
+		for (ompuint_t r = 0; r < static_cast<ompuint_t>(_rowIdx.size()); ++r)
+			out[_rowIdx[r]] -= rowTimesVector(r, x);
+	}
 
+	/**
+	 * @brief Calls the given function for each element of the pattern
+	 * @details The elements are visited row by row in order of increasing column index.
+	 * @param [in] func Function with signature @c void(unsigned int row, unsigned int col, double val)
+	 * @tparam func_t Type of the function
+	 */
+	template <typename func_t>
+	inline void forEachElement(func_t func) const
+	{
+		for (unsigned int r = 0; r < _rowIdx.size(); ++r)
+		{
+			for (unsigned int i = _rowStart[r]; i < _rowStart[r + 1]; ++i)
+				func(_rowIdx[r], _colIdx[i], _values[i]);
+		}
 	}
 
+	/**
+	 * @brief Returns the number of stored (i.e., non-empty) rows
+	 * @return Number of non-empty rows
+	 */
+	inline unsigned int numNonEmptyRows() const CADET_NOEXCEPT { return _rowIdx.size(); }
+
+	/**
+	 * @brief Returns the number of (structurally) non-zero elements in the matrix
+	 * @return Number of (structurally) non-zero elements in the matrix
+	 */
+	inline unsigned int numNonZero() const CADET_NOEXCEPT { return _values.size(); }
+
+	/**
+	 * @brief Returns a vector with the (sorted) indices of the non-empty rows
+	 * @return Vector with row indices
+	 */
+	inline const std::vector<unsigned int>& rowIndex() const CADET_NOEXCEPT { return _rowIdx; }
+
+	/**
+	 * @brief Returns a vector with the start index of each non-empty row in columns() and values()
+	 * @details The vector has numNonEmptyRows() + 1 elements, the last one is numNonZero().
+	 * @return Vector with start index of each non-empty row
+	 */
+	inline const std::vector<unsigned int>& rowStart() const CADET_NOEXCEPT { return _rowStart; }
+
+	/**
+	 * @brief Returns a vector with the (sorted) column indices of all rows
+	 * @return Vector with column indices
+	 */
+	inline const std::vector<unsigned int>& columns() const CADET_NOEXCEPT { return _colIdx; }
+
+	/**
+	 * @brief Returns a vector with element values
+	 * @return Vector with element values
+	 */
+	inline const std::vector<double>& values() const CADET_NOEXCEPT { return _values; }
+
+	/**
+	 * @brief Minimum number of non-zero elements for which matrix-vector products are performed in parallel
+	 */
+	static const unsigned int parallelThreshold = 4096;
+
 protected:
-	double* _values;
+	std::vector<unsigned int> _rowIdx; //!< Sorted indices of the non-empty rows
+	std::vector<unsigned int> _rowStart; //!< Start index of each non-empty row in @c _colIdx and @c _values
+	std::vector<unsigned int> _colIdx; //!< Sorted column indices of each row
+	std::vector<double> _values; //!< Values of the elements
+
+	inline double rowTimesVector(unsigned int r, double const* const x) const
+	{
+		double sum = 0.0;
+		for (unsigned int i = _rowStart[r]; i < _rowStart[r + 1]; ++i)
+			sum += _values[i] * x[_colIdx[i]];
+		return sum;
+	}
+
+	unsigned int findElement(unsigned int row, unsigned int col) const;
 };
 
+std::ostream& operator<<(std::ostream& out, const CompressedSparseMatrix& sm);
+
 } // namespace linalg
 
 } // namespace cadet
@@ -24,6 +24,7 @@
 #include "cadet/ParameterId.hpp"
 #include "linalg/DenseMatrix.hpp"
 #include "linalg/BandMatrix.hpp"
+#include "nonlin/Solver.hpp"
 #include "AutoDiff.hpp"
 
 namespace cadet
@@ -35,6 +36,43 @@ class IExternalFunction;
 namespace model
 {
 
+/**
+ * @brief Warm start data and statistics of the consistent initialization of one particle shell
+ * @details Consecutive consistent initializations (e.g., at section transitions) usually start very close
+ *          to the solution of the previous one. The last Jacobian of the algebraic equations is kept
+ *          (and factorized on first reuse) in order to attempt a cheap simplified Newton iteration before
+ *          a full nonlinear solve is started. The state of the nonlinear solver (e.g., its trust-region
+ *          radius) is kept as well.
+ *          
+ *          The owner of this object has to allocate @c jacobian with as many rows and columns as there are
+ *          bound states. All counters are accumulated until resetStatistics() is called.
+ */
+struct BindingWarmStart
+{
+	BindingWarmStart() : hasJacobian(false), isFactorized(false), numSolves(0), numReused(0), numResidualEvals(0), numJacobianEvals(0) { }
+
+	/**
+	 * @brief Resets all counters
+	 */
+	inline void resetStatistics()
+	{
+		solverState.numIterations = 0;
+		numSolves = 0;
+		numReused = 0;
+		numResidualEvals = 0;
+		numJacobianEvals = 0;
+	}
+
+	linalg::DenseMatrix jacobian; //!< Last Jacobian of the algebraic equations
+	bool hasJacobian; //!< Determines whether @c jacobian holds a Jacobian
+	bool isFactorized; //!< Determines whether @c jacobian has already been factorized
+	nonlin::SolverState solverState; //!< State of the nonlinear solver and number of its iterations
+	unsigned int numSolves; //!< Number of consistent initializations
+	unsigned int numReused; //!< Number of consistent initializations completed with the stored Jacobian
+	unsigned int numResidualEvals; //!< Number of residual evaluations
+	unsigned int numJacobianEvals; //!< Number of Jacobian evaluations
+};
+
 /**
  * @brief Defines an internal BindingModel interface
  * @details The binding model is responsible for handling bound states and their residuals.
@@ -181,6 +219,15 @@ public:
 	 */
 	virtual bool hasAlgebraicEquations() const CADET_NOEXCEPT = 0;
 
+	/**
+	 * @brief Returns whether the Jacobian of this binding model is independent of state, time, and position
+	 * @details A state-independent Jacobian only depends on the model parameters, which may still change
+	 *          from section to section. In this case, the Jacobian is the same at every spatial position
+	 *          and the unit operation may share factorizations of the corresponding Jacobian blocks.
+	 * @return @c true if the Jacobian is independent of state, time, and position, otherwise @c false
+	 */
+	virtual bool hasStateIndependentJacobian() const CADET_NOEXCEPT = 0;
+
 	/**
 	 * @brief Returns the size of the required workspace (number of doubles) for consistent initialization
 	 * @details The additional memory is required by the nonlinear solver.
@@ -216,10 +263,11 @@ public:
 	 * @param [in,out] workingMemory Working memory for nonlinear equation solvers
 	 * @param [in,out] workingMat Working matrix for nonlinear equation solvers with at least as 
 	 *                 many rows and columns as number of bound states
+	 * @param [in,out] warmStart Warm start data and statistics of the current shell or @c nullptr
 	 */
 	virtual void consistentInitialState(double t, double z, double r, unsigned int secIdx, double* const vecStateY, double errorTol, active* const adRes, active* const adY,
 		unsigned int adEqOffset, unsigned int adOffset, unsigned int diagDir, unsigned int lowerBandwidth, unsigned int upperBandwidth, double* const workingMemory,
-		linalg::detail::DenseMatrixBase& workingMat) const = 0;
+		linalg::detail::DenseMatrixBase& workingMat, BindingWarmStart* const warmStart) const = 0;
 
 	/**
 	 * @brief Evaluates the residual for one particle shell
@@ -253,6 +301,35 @@ public:
 	virtual int residual(double t, double z, double r, unsigned int secIdx, double timeFactor, double const* y,
 		double const* yDot, double* res) const = 0;
 
+	/**
+	 * @brief Evaluates the residual for one particle shell using compile-time sized AD datatypes
+	 * @details Used by unit operations that compute their Jacobian via AD with a fixed number of directions
+	 *          (see fixedActive). There is one overload for each size in CADET_FOREACH_FIXED_AD_DIRECTIONS.
+	 *          Parameters are treated as constants (i.e., parameter sensitivities are not computed).
+	 *          See residual() above for a description of the arguments.
+	 */
+#define CADET_BINDINGMODEL_FIXED_AD_RESIDUAL_INTERFACE(N, UNUSED1, UNUSED2)                                         \
+	virtual int residual(double t, double z, double r, unsigned int secIdx, double timeFactor, fixedActive<N> const* y, \
+		double const* yDot, fixedActive<N>* res) const = 0;
+
+	CADET_FOREACH_FIXED_AD_DIRECTIONS(CADET_BINDINGMODEL_FIXED_AD_RESIDUAL_INTERFACE, , )
+
+#undef CADET_BINDINGMODEL_FIXED_AD_RESIDUAL_INTERFACE
+
+	/**
+	 * @brief Evaluates the residual for one particle shell using the sparse AD datatype for parameter sensitivities
+	 * @details Used by unit operations that compute parameter sensitivities with the sparse AD datatype
+	 *          (see sparseActive). The state is treated as constant.
+	 *          See residual() above for a description of the arguments.
+	 */
+#define CADET_BINDINGMODEL_SPARSE_AD_RESIDUAL_INTERFACE(TYPE, UNUSED1, UNUSED2)                                       \
+	virtual int residual(const TYPE& t, double z, double r, unsigned int secIdx, const TYPE& timeFactor, double const* y, \
+		double const* yDot, TYPE* res) const = 0;
+
+	CADET_FOREACH_SPARSE_AD_TYPE(CADET_BINDINGMODEL_SPARSE_AD_RESIDUAL_INTERFACE, , )
+
+#undef CADET_BINDINGMODEL_SPARSE_AD_RESIDUAL_INTERFACE
+
 	/**
 	 * @brief Evaluates the Jacobian of the bound states for one particle shell analytically
 	 * @details The binding model is responsible for implementing the complete bound state equations,
@@ -270,6 +347,84 @@ public:
 	 */
 	virtual void analyticJacobian(double t, double z, double r, unsigned int secIdx, double const* y, linalg::BandMatrix::RowIterator jac) const = 0;
 
+	/**
+	 * @brief Returns whether the binding model provides a native implementation of residualBatch() and analyticJacobianBatch()
+	 * @details Models without native implementation still provide the batch functions, but they simply call residual()
+	 *          and analyticJacobian() for each shell. Unit operations only use the batch functions if this function
+	 *          returns @c true.
+	 * @return @c true if batched evaluation is faster than evaluating each shell separately, otherwise @c false
+	 */
+	virtual bool supportsBatchEvaluation() const CADET_NOEXCEPT = 0;
+
+	/**
+	 * @brief Evaluates the residual for a contiguous set of particle shells
+	 * @details Computes the same values as calling residual() for each shell. The state of shell @c i starts
+	 *          at @p y + @c i * @p stride and is preceded by the liquid phase of the shell (see residual()).
+	 *          The same layout applies to @p yDot and @p res.
+	 *
+	 *          This function is called simultaneously from multiple threads.
+	 *
+	 * @param [in] t Current time point
+	 * @param [in] z Axial position in normalized coordinates (column inlet = 0, column outlet = 1)
+	 * @param [in] r Array with radial position in normalized coordinates of each shell
+	 * @param [in] secIdx Index of the current section
+	 * @param [in] timeFactor Used to compute parameter derivatives with respect to section length,
+	 *             originates from time transformation and is premultiplied to time derivatives
+	 * @param [in] nShells Number of particle shells
+	 * @param [in] stride Distance between two consecutive shells in @p y, @p yDot, and @p res
+	 * @param [in] y Pointer to first bound state of the first component in the first particle shell
+	 * @param [in] yDot Pointer to first bound state time derivative of the first component in the first particle shell
+	 *             or @c nullptr if time derivatives shall be left out
+	 * @param [out] res Pointer to residual equation of first bound state of the first component in the first particle shell
+	 * @return @c 0 on success, @c -1 on non-recoverable error, and @c +1 on recoverable error
+	 */
+	virtual int residualBatch(double t, double z, double const* r, unsigned int secIdx, double timeFactor, unsigned int nShells,
+		unsigned int stride, double const* y, double const* yDot, double* res) const = 0;
+
+	/**
+	 * @brief Evaluates the Jacobian of the bound states for a contiguous set of particle shells analytically
+	 * @details Computes the same values as calling analyticJacobian() for each shell. The rows of shell @c i
+	 *          start at @p jac + @c i * @p stride.
+	 *
+	 *          This function is called simultaneously from multiple threads.
+	 *
+	 * @param [in] t Current time point
+	 * @param [in] z Axial position in normalized coordinates (column inlet = 0, column outlet = 1)
+	 * @param [in] r Array with radial position in normalized coordinates of each shell
+	 * @param [in] secIdx Index of the current section
+	 * @param [in] nShells Number of particle shells
+	 * @param [in] stride Distance between two consecutive shells in @p y and in the rows of @p jac
+	 * @param [in] y Pointer to first bound state of the first component in the first particle shell
+	 * @param [in,out] jac Row iterator pointing to the first bound states row of the first shell in the underlying BandMatrix
+	 */
+	virtual void analyticJacobianBatch(double t, double z, double const* r, unsigned int secIdx, unsigned int nShells,
+		unsigned int stride, double const* y, linalg::BandMatrix::RowIterator jac) const = 0;
+
+	/**
+	 * @brief Evaluates the residual and the analytic Jacobian of the bound states for a contiguous set of particle shells
+	 * @details Computes the same values as calling residualBatch() followed by analyticJacobianBatch(). Models
+	 *          may fuse both evaluations in order to share intermediate results (e.g., powers of concentrations).
+	 *
+	 *          This function is called simultaneously from multiple threads.
+	 *
+	 * @param [in] t Current time point
+	 * @param [in] z Axial position in normalized coordinates (column inlet = 0, column outlet = 1)
+	 * @param [in] r Array with radial position in normalized coordinates of each shell
+	 * @param [in] secIdx Index of the current section
+	 * @param [in] timeFactor Used to compute parameter derivatives with respect to section length,
+	 *             originates from time transformation and is premultiplied to time derivatives
+	 * @param [in] nShells Number of particle shells
+	 * @param [in] stride Distance between two consecutive shells in @p y, @p yDot, @p res, and in the rows of @p jac
+	 * @param [in] y Pointer to first bound state of the first component in the first particle shell
+	 * @param [in] yDot Pointer to first bound state time derivative of the first component in the first particle shell
+	 *             or @c nullptr if time derivatives shall be left out
+	 * @param [out] res Pointer to residual equation of first bound state of the first component in the first particle shell
+	 * @param [in,out] jac Row iterator pointing to the first bound states row of the first shell in the underlying BandMatrix
+	 * @return @c 0 on success, @c -1 on non-recoverable error, and @c +1 on recoverable error
+	 */
+	virtual int residualWithJacobianBatch(double t, double z, double const* r, unsigned int secIdx, double timeFactor, unsigned int nShells,
+		unsigned int stride, double const* y, double const* yDot, double* res, linalg::BandMatrix::RowIterator jac) const = 0;
+
 	/**
 	 * @brief Adds the time-discretized part of the Jacobian to the current Jacobian of the bound phase equations in one particle shell
 	 * @details The added time derivatives in jacobian() have to be added to the Jacobian of the original equations in order to get
@@ -293,6 +448,36 @@ public:
 	 * @param [in] timeFactor Factor of the time derivatives that comes from time transformation
 	 */
 	virtual void multiplyWithDerivativeJacobian(double const* yDotS, double* const res, double timeFactor) const = 0;
+
+	/**
+	 * @brief Returns whether the derivative of the residual with respect to the given parameter is available analytically
+	 * @details Unit operations may compute parameter sensitivities by analyticParamDerivative() instead of AD
+	 *          if this function returns @c true for all sensitive parameters of the binding model.
+	 * @param [in] pId Parameter Id of the sensitive parameter
+	 * @return @c true if analyticParamDerivative() supports the parameter, otherwise @c false
+	 */
+	virtual bool hasAnalyticParamDerivative(const ParameterId& pId) const = 0;
+
+	/**
+	 * @brief Adds the derivative of the residual with respect to a parameter for one particle shell
+	 * @details Computes @f$ \frac{\partial f}{\partial p}(t, y, \dot{y}, p) @f$, multiplies it with @p factor,
+	 *          and adds the result to @p dRes. Only the entries that actually depend on the parameter are
+	 *          touched. This function is only called for parameters supported by hasAnalyticParamDerivative().
+	 *
+	 *          This function is called simultaneously from multiple threads.
+	 *
+	 * @param [in] pId Parameter Id of the sensitive parameter
+	 * @param [in] factor Factor the derivative is multiplied with (e.g., the AD seed of the parameter)
+	 * @param [in] t Current time point
+	 * @param [in] z Axial position in normalized coordinates (column inlet = 0, column outlet = 1)
+	 * @param [in] r Radial position in normalized coordinates (outer shell = 1, inner center = 0)
+	 * @param [in] secIdx Index of the current section
+	 * @param [in] y Pointer to first bound state of the first component in the current particle shell
+	 * @param [in,out] dRes Pointer to the derivative of the residual equation of the first bound state of the first
+	 *                 component in the current particle shell
+	 */
+	virtual void analyticParamDerivative(const ParameterId& pId, double factor, double t, double z, double r, unsigned int secIdx,
+		double const* y, double* const dRes) const = 0;
 protected:
 };
 
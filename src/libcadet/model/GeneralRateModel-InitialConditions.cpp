@@ -162,10 +162,17 @@ void GeneralRateModel::consistentInitialState(double t, unsigned int secIdx, dou
 	{
 		// Required memory (number of doubles) for nonlinear solvers
 		const unsigned int requiredMem = _binding->consistentInitializationWorkspaceSize();
+		const std::size_t numADdirs = ad::getDirections();
+
+		for (unsigned int i = 0; i < _bindingWarmStart.size(); ++i)
+			_bindingWarmStart[i].resetStatistics();
 
 		BENCH_START(_timerConsistentInitPar);
 		#pragma omp parallel
 		{
+			// Worker threads use the number of AD directions of the calling thread
+			ad::setDirections(numADdirs);
+
 			// Get memory block for this thread
 			double* tmp = nullptr;
 			bool allocatedNewMemory = false;
@@ -197,10 +204,11 @@ void GeneralRateModel::consistentInitialState(double t, unsigned int secIdx, dou
 					double* const qShell = vecStateY + localOffsetToParticle + localOffsetInParticle;
 					active* const localAdRes = adRes ? adRes + localOffsetToParticle : nullptr;
 					active* const localAdY = adY ? adY + localOffsetToParticle : nullptr;
+					BindingWarmStart* const warmStart = _bindingWarmStart.empty() ? nullptr : &_bindingWarmStart[pblk * _disc.nPar + shell];
 			
 					// Solve algebraic variables
 					_binding->consistentInitialState(t, z, _parCenterRadius[shell], secIdx, qShell, errorTol, localAdRes, localAdY,
-						localOffsetInParticle, numSensAdDirs, _jacP[0].lowerBandwidth(), _jacP[0].lowerBandwidth(), _jacP[0].upperBandwidth(), tmp, jacobianMatrix);
+						localOffsetInParticle, numSensAdDirs, _jacP[0].lowerBandwidth(), _jacP[0].lowerBandwidth(), _jacP[0].upperBandwidth(), tmp, jacobianMatrix, warmStart);
 				}
 			}
 
@@ -212,6 +220,9 @@ void GeneralRateModel::consistentInitialState(double t, unsigned int secIdx, dou
 		// We need to assemble and factorize the discretized Jacobian again since we have 
 		// used the matrices for temporary storage here
 		_factorizeJacobian = true;
+
+		if (!_bindingWarmStart.empty())
+			reportWarmStartStatistics();
 	}
 
 	// Step 1b: Compute fluxes j_f
@@ -223,6 +234,36 @@ void GeneralRateModel::consistentInitialState(double t, unsigned int secIdx, dou
 	solveForFluxes(vecStateY, idxr);
 }
 
+/**
+ * @brief Reports the statistics of the last warm started consistent initialization of the binding model
+ * @details A summary is logged on debug level and the statistics of each particle shell on trace level.
+ */
+void GeneralRateModel::reportWarmStartStatistics() const
+{
+	unsigned int numSolves = 0;
+	unsigned int numReused = 0;
+	unsigned int numIter = 0;
+	unsigned int maxIter = 0;
+	unsigned int numResidualEvals = 0;
+	unsigned int numJacobianEvals = 0;
+	for (unsigned int i = 0; i < _bindingWarmStart.size(); ++i)
+	{
+		const BindingWarmStart& ws = _bindingWarmStart[i];
+		numSolves += ws.numSolves;
+		numReused += ws.numReused;
+		numIter += ws.solverState.numIterations;
+		maxIter = std::max(maxIter, ws.solverState.numIterations);
+		numResidualEvals += ws.numResidualEvals;
+		numJacobianEvals += ws.numJacobianEvals;
+
+		LOG(Trace) << "Consistent init of cell " << i / _disc.nPar << " shell " << i % _disc.nPar << ": " << (ws.numReused > 0 ? "reused Jacobian, " : "")
+			<< ws.solverState.numIterations << " iterations, " << ws.numResidualEvals << " residual and " << ws.numJacobianEvals << " Jacobian evaluations";
+	}
+
+	LOG(Debug) << "Consistent init (warm start): " << numReused << " of " << numSolves << " shells reused the previous Jacobian, "
+		<< numIter << " iterations (max. " << maxIter << " per shell), " << numResidualEvals << " residual and " << numJacobianEvals << " Jacobian evaluations";
+}
+
 /**
  * @brief Computes consistent initial time derivatives
  * @details Given the DAE \f[ F(t, y, \dot{y}) = 0, \f] the initial values \f$ y_0 \f$ and \f$ \dot{y}_0 \f$ have
@@ -302,7 +343,7 @@ void GeneralRateModel::consistentInitialTimeDerivative(double t, double timeFact
 			}
 
 			// Solve
-			const bool result2 = fbm.solve(vecStateYdot + comp * idxr.strideColComp());
+			const bool result2 = solveBulkBlock(comp, vecStateYdot);
 			if (!result2)
 			{
 				LOG(Error) << "Solve() failed for comp " << comp;
@@ -613,7 +654,7 @@ void GeneralRateModel::leanConsistentInitialTimeDerivative(double t, double time
 		}
 
 		// Solve
-		const bool result2 = fbm.solve(resSlice);
+		const bool result2 = solveBulkBlock(comp, res);
 		if (!result2)
 		{
 			LOG(Error) << "Solve() failed for comp " << comp;
@@ -622,8 +663,8 @@ void GeneralRateModel::leanConsistentInitialTimeDerivative(double t, double time
 		// Note that we have solved with the *positive* residual as right hand side
 		// instead of the *negative* one. Fortunately, we are dealing with linear systems,
 		// which means that we can just negate the solution.
-		for (unsigned int i = 0; i < idxr.strideColComp(); ++i)
-			yDotSlice[i] = -resSlice[i];
+		for (unsigned int i = 0; i < _disc.nCol; ++i)
+			yDotSlice[i * idxr.strideColCell()] = -resSlice[i * idxr.strideColCell()];
 	}
 	BENCH_STOP(_timerConsistentInitPar);
 
@@ -902,7 +943,7 @@ void GeneralRateModel::consistentIntialSensitivity(const active& t, unsigned int
 				}
 
 				// Solve
-				const bool result2 = fbm.solve(sensYdot + comp * idxr.strideColComp());
+				const bool result2 = solveBulkBlock(comp, sensYdot);
 				if (!result2)
 				{
 					LOG(Error) << "Solve() failed for comp " << comp;
@@ -1116,7 +1157,7 @@ void GeneralRateModel::leanConsistentIntialSensitivity(const active& t, unsigned
 			}
 
 			// Solve
-			const bool result2 = fbm.solve(sensYdot + comp * idxr.strideColComp());
+			const bool result2 = solveBulkBlock(comp, sensYdot);
 			if (!result2)
 			{
 				LOG(Error) << "Solve() failed for comp " << comp;
@@ -31,6 +31,30 @@
 	#include <limits>
 #endif
 
+namespace
+{
+	/**
+	 * @brief Determines whether a GMRES return flag indicates a usable solution
+	 * @details A reduced (but not converged) residual is accepted, the outer Newton iteration takes care of the remainder.
+	 * @param [in] flag SPGMR return flag
+	 * @return @c true if the solution can be used, otherwise @c false
+	 */
+	inline bool isGmresSuccess(int flag)
+	{
+		return (flag == 0) || (flag == 1); // SPGMR_SUCCESS, SPGMR_RES_REDUCED
+	}
+
+	/**
+	 * @brief Converts a failed GMRES return flag into an error code of the linear solver
+	 * @param [in] flag SPGMR return flag
+	 * @return @c -1 on non-recoverable error (negative flag) and @c +1 on recoverable error
+	 */
+	inline int gmresErrorCode(int flag)
+	{
+		return (flag < 0) ? -1 : 1;
+	}
+}
+
 namespace cadet
 {
 
@@ -98,6 +122,8 @@ namespace model
  *              -# Solve the rest of the @f$ U x = y @f$ system by backward substitution. To be more precise, compute
  *                 @f[ x_i = y_i - J_i^{-1} J_{i,f} y_f. @f]
  *
+ *          If the sparse direct solver is selected, the full Jacobian is factorized instead and the block
+ *          decomposition is not used (see linearSolveSparseDirect()).
  *
  * @param [in] t Current time point
  * @param [in] timeFactor Factor which is premultiplied to the time derivatives originating from time transformation
@@ -124,8 +150,189 @@ int GeneralRateModel::linearSolve(double t, double timeFactor, double alpha, dou
 
 	Indexer idxr(_disc);
 
+	if (_globalDirectSolve)
+		return linearSolveSparseDirect(timeFactor, alpha, rhs, idxr);
+
+	// ==== Step 1: Factorize diagonal Jacobian blocks
+	factorizeDiagonalBlocks(timeFactor, alpha, idxr);
+
+	BENCH_START(_timerLinearSolve);
+
+	// ==== Step 2: Solve diagonal Jacobian blocks J_i to get y_i = J_i^{-1} b_i
+	// The result is stored in rhs (in-place solution)
+
+	BENCH_START(_timerLinearSolvePar);
+
+	// The particle blocks are solved in batches
+	const unsigned int numParBatches = numParticleBatches();
+
+	#pragma omp parallel
+	{
+		// Threads that are done with solving the bulk column blocks can proceed
+		// to solving the particle blocks
+		#pragma omp for schedule(static) nowait
+		for (ompuint_t comp = 0; comp < _disc.nComp; ++comp)
+		{
+			const bool result = solveBulkBlock(comp, rhs);
+			if (cadet_unlikely(!result))
+			{
+				#pragma omp critical
+				{
+					LOG(Error) << "Solve() failed for comp " << comp;
+				}
+			}
+		}
+
+		#pragma omp for schedule(static)
+		for (ompuint_t batch = 0; batch < numParBatches; ++batch)
+		{
+			unsigned int first = 0;
+			unsigned int count = 0;
+			particleBatchRange(batch, numParBatches, first, count);
+
+			solveParticleBatch(first, count, rhs);
+		}
+	}
+
+	BENCH_STOP(_timerLinearSolvePar);
+
+#ifdef GRM_WRITE_DEBUG_OUTPUT
+	LOG(Debug) << std::setprecision(std::numeric_limits<double>::digits10 + 1)
+	           << "solveFirst = " << log::VectorPtr<double>(rhs, numDofs());
+#endif
+
+	subtractFluxCoupling(rhs, idxr);
+
+	// ==== Step 3: Solve Schur-complement to get x_f = S^{-1} y_f
+	const int schurResult = solveSchurComplement(outerTol, rhs, weight, idxr);
+	if (cadet_unlikely(schurResult != 0))
+	{
+		BENCH_STOP(_timerLinearSolve);
+		return schurResult;
+	}
+
+	// ==== Step 4: Solve U * x = y by backward substitution
+	backSubstitute(rhs, idxr);
+
+	BENCH_STOP(_timerLinearSolve);
+
+#ifdef GRM_WRITE_DEBUG_OUTPUT
+	LOG(Debug) << std::setprecision(std::numeric_limits<double>::digits10 + 1)
+	           << "rhsFinal = " << log::VectorPtr<double>(rhs, numDofs());
+#endif
+
+	// The full solution is now stored in rhs
+	return 0;
+}
+
+/**
+ * @brief Computes the solutions of multiple linear systems involving the same system Jacobian
+ * @details Proceeds like linearSolve() for each right hand side, but factorizes the diagonal blocks only
+ *          once and solves the bulk blocks @f$ J_0 @f$ for all right hand sides in a single LAPACK call.
+ *          The Schur-complements of all right hand sides are solved together by a multi-RHS GMRES
+ *          (see solveSchurComplementMultiRhs()).
+ *
+ * @param [in] t Current time point
+ * @param [in] timeFactor Factor which is premultiplied to the time derivatives originating from time transformation
+ * @param [in] alpha Value of \f$ \alpha \f$ (arises from BDF time discretization)
+ * @param [in] outerTol Error tolerance for the solution of the linear system from outer Newton iteration
+ * @param [in,out] rhs Array with pointers to the right hand sides, on exit the solutions
+ * @param [in] weight Array with pointers to the error weights of each right hand side
+ * @param [in] nRhs Number of right hand sides
+ * @param [in] y Pointer to global state vector at which the Jacobian is evaluated
+ * @param [in] yDot Pointer to global time derivative state vector at which the Jacobian is evaluated
+ * @param [in] res Pointer to global residual vector at the point @p y, @p yDot
+ * @return @c 0 on success, @c -1 on non-recoverable error, and @c +1 on recoverable error
+ */
+int GeneralRateModel::linearSolveMultiRhs(double t, double timeFactor, double alpha, double outerTol, double* const* const rhs, double const* const* const weight,
+	unsigned int nRhs, double const* const y, double const* const yDot, double const* const res)
+{
+	Indexer idxr(_disc);
+
+	if (_globalDirectSolve)
+	{
+		// The global Jacobian is factorized in the first call only
+		for (unsigned int r = 0; r < nRhs; ++r)
+		{
+			const int result = linearSolveSparseDirect(timeFactor, alpha, rhs[r], idxr);
+			if (result != 0)
+				return result;
+		}
+		return 0;
+	}
+
 	// ==== Step 1: Factorize diagonal Jacobian blocks
+	factorizeDiagonalBlocks(timeFactor, alpha, idxr);
+
+	BENCH_START(_timerLinearSolve);
+
+	// ==== Step 2: Solve diagonal Jacobian blocks J_i to get y_i = J_i^{-1} b_i for all right hand sides
+
+	BENCH_START(_timerLinearSolvePar);
+
+	const unsigned int numParBatches = numParticleBatches();
+	_multiRhsScratch.resize(_disc.nComp * _disc.nCol * nRhs);
+
+	#pragma omp parallel
+	{
+		#pragma omp for schedule(static) nowait
+		for (ompuint_t comp = 0; comp < _disc.nComp; ++comp)
+		{
+			const bool result = solveBulkBlockMultiRhs(comp, rhs, nRhs);
+			if (cadet_unlikely(!result))
+			{
+				#pragma omp critical
+				{
+					LOG(Error) << "Solve() failed for comp " << comp;
+				}
+			}
+		}
+
+		#pragma omp for schedule(static)
+		for (ompuint_t batch = 0; batch < numParBatches; ++batch)
+		{
+			unsigned int first = 0;
+			unsigned int count = 0;
+			particleBatchRange(batch, numParBatches, first, count);
+
+			for (unsigned int r = 0; r < nRhs; ++r)
+				solveParticleBatch(first, count, rhs[r]);
+		}
+	}
+
+	BENCH_STOP(_timerLinearSolvePar);
+
+	for (unsigned int r = 0; r < nRhs; ++r)
+		subtractFluxCoupling(rhs[r], idxr);
+
+	// ==== Step 3: Solve Schur-complements of all right hand sides together
+	const int schurResult = solveSchurComplementMultiRhs(outerTol, rhs, weight, nRhs, idxr);
+	if (cadet_unlikely(schurResult != 0))
+	{
+		BENCH_STOP(_timerLinearSolve);
+		return schurResult;
+	}
+
+	// ==== Step 4: Solve U * x = y by backward substitution
+	for (unsigned int r = 0; r < nRhs; ++r)
+		backSubstitute(rhs[r], idxr);
+
+	BENCH_STOP(_timerLinearSolve);
+
+	return 0;
+}
 
+/**
+ * @brief Assembles and factorizes the diagonal blocks of the time-discretized Jacobian
+ * @details Performs step 1 of the solution procedure described in linearSolve(). The blocks are only
+ *          factorized if the Jacobian has changed since the last factorization.
+ *
+ * @param [in] timeFactor Factor which is premultiplied to the time derivatives originating from time transformation
+ * @param [in] alpha Value of \f$ \alpha \f$ (arises from BDF time discretization)
+ * @param [in] idxr Indexer
+ */
+void GeneralRateModel::factorizeDiagonalBlocks(double timeFactor, double alpha, const Indexer& idxr)
+{
 	// Factorize partial Jacobians only if required
 	if (_factorizeJacobian)
 	{
@@ -136,6 +343,10 @@ int GeneralRateModel::linearSolve(double t, double timeFactor, double alpha, dou
 
 		BENCH_START(_timerFactorizePar);
 
+		// If the binding model's Jacobian is independent of state, time, and position,
+		// all particle blocks are identical and a single factorization is shared among them
+		const bool shareParticleFactorization = _binding->hasStateIndependentJacobian();
+
 		// Assemble and factorize discretized system Jacobians
 		#pragma omp parallel
 		{
@@ -146,6 +357,13 @@ int GeneralRateModel::linearSolve(double t, double timeFactor, double alpha, dou
 				// Assemble
 				assembleDiscretizedJacobianColumnBlock(comp, alpha, idxr, timeFactor);
 
+				// Save inverse diagonal for the Schur-complement preconditioner before it is overwritten by the factorization
+				if (_schurPrecond)
+				{
+					for (unsigned int i = 0; i < _disc.nCol; ++i)
+						_schurPrecBulk[i * idxr.strideColCell() + comp * idxr.strideColComp()] = 1.0 / _jacCdisc[comp].centered(i, 0);
+				}
+
 				// Factorize
 				const bool result = _jacCdisc[comp].factorize();
 				if (cadet_unlikely(!result))
@@ -158,22 +376,53 @@ int GeneralRateModel::linearSolve(double t, double timeFactor, double alpha, dou
 			}
 
 			// Process the particle blocks
-			#pragma omp for schedule(static)
-			for (ompuint_t pblk = 0; pblk < _disc.nCol; ++pblk)
+			if (shareParticleFactorization)
 			{
-				// Assemble
-				assembleDiscretizedJacobianParticleBlock(pblk, alpha, idxr, timeFactor);
+				#pragma omp single
+				{
+					// Assemble and factorize the first block only
+					assembleDiscretizedJacobianParticleBlock(0, alpha, idxr, timeFactor);
 
-				// Factorize
-				const bool result = _jacPdisc[pblk].factorize();
-				if (cadet_unlikely(!result))
+					const bool result = _jacPdisc[0].factorize();
+					if (cadet_unlikely(!result))
+					{
+						LOG(Error) << "Factorize() failed for shared par block";
+					}
+				}
+
+				// Store factors of the first block for all blocks of the batched solution
+				#pragma omp for schedule(static)
+				for (ompuint_t pblk = 0; pblk < _disc.nCol; ++pblk)
+					_jacPdiscBatch.pack(pblk, _jacPdisc[0]);
+			}
+			else
+			{
+				#pragma omp for schedule(static)
+				for (ompuint_t pblk = 0; pblk < _disc.nCol; ++pblk)
 				{
-					#pragma omp critical
+					// Assemble
+					assembleDiscretizedJacobianParticleBlock(pblk, alpha, idxr, timeFactor);
+
+					// Factorize
+					const bool result = _jacPdisc[pblk].factorize();
+					if (cadet_unlikely(!result))
 					{
-						LOG(Error) << "Factorize() failed for par block " << pblk;
+						#pragma omp critical
+						{
+							LOG(Error) << "Factorize() failed for par block " << pblk;
+						}
 					}
+
+					// Store factors for batched solution
+					_jacPdiscBatch.pack(pblk, _jacPdisc[pblk]);
 				}
 			}
+
+			// All diagonal blocks are factorized at this point (implicit barrier)
+			if (_schurDirectSolve)
+				assembleSchurComplementDirect(idxr);
+			else if (_schurPrecond)
+				assembleSchurComplementPreconditioner(idxr);
 		}
 
 		BENCH_STOP(_timerFactorizePar);
@@ -219,52 +468,17 @@ int GeneralRateModel::linearSolve(double t, double timeFactor, double alpha, dou
 
 	std::cout << "\n";
 #endif
+}
 
-	BENCH_START(_timerLinearSolve);
-
-	// ==== Step 2: Solve diagonal Jacobian blocks J_i to get y_i = J_i^{-1} b_i
-	// The result is stored in rhs (in-place solution)
-
-	BENCH_START(_timerLinearSolvePar);
-
-	#pragma omp parallel
-	{
-		// Threads that are done with solving the bulk column blocks can proceed
-		// to solving the particle blocks
-		#pragma omp for schedule(static) nowait
-		for (ompuint_t comp = 0; comp < _disc.nComp; ++comp)
-		{
-			const bool result = _jacCdisc[comp].solve(rhs + comp * idxr.strideColComp());
-			if (cadet_unlikely(!result))
-			{
-				#pragma omp critical
-				{
-					LOG(Error) << "Solve() failed for comp " << comp;
-				}
-			}
-		}
-
-		#pragma omp for schedule(static)
-		for (ompuint_t pblk = 0; pblk < _disc.nCol; ++pblk)
-		{
-			const bool result = _jacPdisc[pblk].solve(rhs + idxr.offsetCp(pblk));
-			if (cadet_unlikely(!result))
-			{
-				#pragma omp critical
-				{
-					LOG(Error) << "Solve() failed for par block " << pblk;
-				}
-			}
-		}
-	}
-
-	BENCH_STOP(_timerLinearSolvePar);
-
-#ifdef GRM_WRITE_DEBUG_OUTPUT
-	LOG(Debug) << std::setprecision(std::numeric_limits<double>::digits10 + 1)
-	           << "solveFirst = " << log::VectorPtr<double>(rhs, numDofs());
-#endif
-
+/**
+ * @brief Computes the flux part of the intermediate solution @f$ y = L^{-1} b @f$
+ * @details Solves the last row of @f$ L @f$ (see linearSolve()) on a right hand side whose diagonal blocks
+ *          have already been solved (step 2).
+ * @param [in,out] rhs On entry the intermediate solution of step 2, on exit the full intermediate solution @f$ y @f$
+ * @param [in] idxr Indexer
+ */
+void GeneralRateModel::subtractFluxCoupling(double* const rhs, const Indexer& idxr)
+{
 	// Solve last row of L with backwards substitution: y_f = b_f - \sum_{i=0}^{N_z} J_{f,i} y_i
 	// Note that we cannot easily parallelize this loop since the results of the sparse
 	// matrix-vector multiplications are added in-place to rhs. We would need one copy of rhs
@@ -286,40 +500,140 @@ int GeneralRateModel::linearSolve(double t, double timeFactor, double alpha, dou
 	LOG(Debug) << std::setprecision(std::numeric_limits<double>::digits10 + 1)
 	           << "rhsPreGMRES = " << log::VectorPtr<double>(rhs, numDofs());
 #endif
+}
 
-	// Initialize temporary storage by copying over the fluxes
-	// Note that the rest of _tempState is zeroed out in schurComplementMatrixVector()
-	std::copy(rhs + idxr.offsetJf(), rhs + numDofs(), _tempState + idxr.offsetJf());
-
-	// ==== Step 3: Solve Schur-complement to get x_f = S^{-1} y_f
+/**
+ * @brief Solves the Schur-complement @f$ S x_f = y_f @f$
+ * @details Performs step 3 of the solution procedure described in linearSolve().
+ * @param [in] outerTol Error tolerance for the solution of the linear system from outer Newton iteration
+ * @param [in,out] rhs On entry the intermediate solution @f$ y @f$, on exit the fluxes are replaced by @f$ x_f @f$
+ * @param [in] weight Vector with error weights
+ * @param [in] idxr Indexer
+ * @return @c 0 on success, @c -1 on non-recoverable error, and @c +1 on recoverable error (i.e., the solution of the Schur-complement failed)
+ */
+int GeneralRateModel::solveSchurComplement(double outerTol, double* const rhs, double const* const weight, const Indexer& idxr)
+{
 	// Column and particle parts remain unchanged.
 	// The only thing to be done is the iterative (and approximate)
 	// solution of the Schur complement system:
 	//     S * x_f = y_f
+	// If the Schur-complement has been assembled and factorized explicitly
+	// (see assembleSchurComplementDirect()), it is solved directly instead.
 
-	// Note that rhs is updated in-place with the solution of the Schur-complement
-	// The temporary storage is only needed to hold the right hand side of the Schur-complement
-	const double tolerance = std::sqrt(static_cast<double>(numDofs())) * outerTol * _schurSafety;
+	BENCH_START(_timerGmres);
+	if (_schurDirectSolve)
+	{
+		const bool result = _schurMatrix.solve(rhs + idxr.offsetJf());
+		if (cadet_unlikely(!result))
+		{
+			LOG(Error) << "Solve() failed for Schur-complement";
+			BENCH_STOP(_timerGmres);
+			return 1;
+		}
+	}
+	else
+	{
+		// Initialize temporary storage by copying over the fluxes
+		// Note that the rest of _tempState is zeroed out in schurComplementMatrixVector()
+		std::copy(rhs + idxr.offsetJf(), rhs + numDofs(), _tempState + idxr.offsetJf());
+
+		// Note that rhs is updated in-place with the solution of the Schur-complement
+		// The temporary storage is only needed to hold the right hand side of the Schur-complement
+		const double tolerance = std::sqrt(static_cast<double>(numDofs())) * outerTol * _schurSafety;
 
 #ifdef GRM_WRITE_DEBUG_OUTPUT
-	LOG(Debug) << std::setprecision(std::numeric_limits<double>::digits10 + 1)
-	           << "tol = " << tolerance << "\n"
-	           << "weight = " << log::VectorPtr<double>(weight + idxr.offsetJf(), _disc.nCol * _disc.nComp) << "\n"
-	           << "init = " << log::VectorPtr<double>(_tempState + idxr.offsetJf(), _disc.nCol * _disc.nComp) << "\n"
-	           << "rhs = " << log::VectorPtr<double>(rhs + idxr.offsetJf(), _disc.nCol * _disc.nComp);
+		LOG(Debug) << std::setprecision(std::numeric_limits<double>::digits10 + 1)
+		           << "tol = " << tolerance << "\n"
+		           << "weight = " << log::VectorPtr<double>(weight + idxr.offsetJf(), _disc.nCol * _disc.nComp) << "\n"
+		           << "init = " << log::VectorPtr<double>(_tempState + idxr.offsetJf(), _disc.nCol * _disc.nComp) << "\n"
+		           << "rhs = " << log::VectorPtr<double>(rhs + idxr.offsetJf(), _disc.nCol * _disc.nComp);
 #endif
 
+		const int gmresResult = _gmres.solve(tolerance, weight + idxr.offsetJf(), _tempState + idxr.offsetJf(), rhs + idxr.offsetJf());
+		if (cadet_unlikely(!isGmresSuccess(gmresResult)))
+		{
+			LOG(Debug) << "GMRES failed for Schur-complement: " << _gmres.getReturnFlagName(gmresResult);
+			BENCH_STOP(_timerGmres);
+			return gmresErrorCode(gmresResult);
+		}
+	}
+	BENCH_STOP(_timerGmres);
+	return 0;
+}
+
+/**
+ * @brief Solves the Schur-complements @f$ S x_{f,i} = y_{f,i} @f$ of multiple right hand sides
+ * @details Performs step 3 of the solution procedure described in linearSolve() for all right hand sides.
+ *          GMRES advances all systems in lockstep such that each iteration multiplies the Schur-complement
+ *          with a panel of vectors (see schurComplementMatrixPanel()), which solves the bulk blocks of all
+ *          vectors at once. A directly factorized Schur-complement is applied to each right hand side.
+ * @param [in] outerTol Error tolerance for the solution of the linear system from outer Newton iteration
+ * @param [in,out] rhs Array with pointers to the intermediate solutions @f$ y_i @f$, on exit the fluxes are replaced by @f$ x_{f,i} @f$
+ * @param [in] weight Array with pointers to the error weights of each right hand side
+ * @param [in] nRhs Number of right hand sides
+ * @param [in] idxr Indexer
+ * @return @c 0 on success, @c -1 on non-recoverable error, and @c +1 on recoverable error (i.e., the solution of a Schur-complement failed)
+ */
+int GeneralRateModel::solveSchurComplementMultiRhs(double outerTol, double* const* const rhs, double const* const* const weight, unsigned int nRhs, const Indexer& idxr)
+{
+	if (_schurDirectSolve || (nRhs == 1))
+	{
+		for (unsigned int r = 0; r < nRhs; ++r)
+		{
+			const int result = solveSchurComplement(outerTol, rhs[r], weight[r], idxr);
+			if (cadet_unlikely(result != 0))
+				return result;
+		}
+		return 0;
+	}
+
 	BENCH_START(_timerGmres);
-	const int gmresResult = _gmres.solve(tolerance, weight + idxr.offsetJf(), _tempState + idxr.offsetJf(), rhs + idxr.offsetJf());
+
+	// Copy the fluxes to obtain the right hand sides of the Schur-complements, the
+	// fluxes in rhs serve as initial guesses and are updated in-place with the solutions
+	const unsigned int nFlux = _disc.nCol * _disc.nComp;
+	_multiRhsFlux.resize(nRhs * nFlux);
+	_multiRhsTempState.resize(nRhs * idxr.offsetJf());
+
+	std::vector<double const*> schurRhs(nRhs);
+	std::vector<double*> schurSol(nRhs);
+	std::vector<double const*> schurWeight(nRhs);
+	for (unsigned int r = 0; r < nRhs; ++r)
+	{
+		double* const flux = _multiRhsFlux.data() + r * nFlux;
+		std::copy(rhs[r] + idxr.offsetJf(), rhs[r] + numDofs(), flux);
+		schurRhs[r] = flux;
+		schurSol[r] = rhs[r] + idxr.offsetJf();
+		schurWeight[r] = weight[r] + idxr.offsetJf();
+	}
+
+	const double tolerance = std::sqrt(static_cast<double>(numDofs())) * outerTol * _schurSafety;
+	const int gmresResult = _gmres.solve(tolerance, schurWeight.data(), schurRhs.data(), schurSol.data(), nRhs);
+
 	BENCH_STOP(_timerGmres);
-//  std::cout << "GMRES = " << _gmres.getReturnFlagName(gmresResult) << std::endl;
 
-	// Remove temporary results that are leftovers from schurComplementMatrixVector()
-	std::fill(_tempState, _tempState + idxr.offsetJf(), 0.0);
+	if (cadet_unlikely(!isGmresSuccess(gmresResult)))
+	{
+		LOG(Debug) << "GMRES failed for Schur-complements: " << _gmres.getReturnFlagName(gmresResult);
+		return gmresErrorCode(gmresResult);
+	}
+	return 0;
+}
 
-	// At this point, rhs contains the intermediate solution [y_0, ..., y_{N_z}, x_f]
+/**
+ * @brief Solves @f$ U x = y @f$ by backward substitution
+ * @details Performs step 4 of the solution procedure described in linearSolve().
+ * @param [in,out] rhs On entry the intermediate solution @f$ [y_0, \dots, y_{N_z}, x_f] @f$, on exit the solution
+ * @param [in] idxr Indexer
+ */
+void GeneralRateModel::backSubstitute(double* const rhs, const Indexer& idxr)
+{
+	const unsigned int numParBatches = numParticleBatches();
+
+	// Remove temporary results that are leftovers from schurComplementMatrixVector(),
+	// assembleSchurComplementDirect(), and previous backward substitutions
+	std::fill(_tempState, _tempState + idxr.offsetJf(), 0.0);
 
-	// ==== Step 4: Solve U * x = y by backward substitution
 	// The fluxes are already solved and remain unchanged
 
 #ifdef GRM_WRITE_DEBUG_OUTPUT
@@ -342,7 +656,7 @@ int GeneralRateModel::linearSolve(double t, double timeFactor, double alpha, dou
 			double* const rhsCol = rhs + comp * idxr.strideColComp();
 
 			// Apply J_0^{-1} to tempState_0
-			const bool result = _jacCdisc[comp].solve(localCol);
+			const bool result = solveBulkBlock(comp, _tempState);
 			if (cadet_unlikely(!result))
 			{
 				#pragma omp critical
@@ -353,44 +667,308 @@ int GeneralRateModel::linearSolve(double t, double timeFactor, double alpha, dou
 
 			// Compute rhs_0 = y_0 - J_0^{-1} * J_{0,f} * y_f = y_0 - tempState_0
 			for (unsigned int i = 0; i < _disc.nCol; ++i)
-				rhsCol[i] -= localCol[i];
+				rhsCol[i * idxr.strideColCell()] -= localCol[i * idxr.strideColCell()];
 		}
 
 		#pragma omp for schedule(static)
-		for (ompuint_t pblk = 0; pblk < _disc.nCol; ++pblk)
+		for (ompuint_t batch = 0; batch < numParBatches; ++batch)
 		{
-			double* const localPar = _tempState + idxr.offsetCp(pblk);
-			double* const rhsPar = rhs + idxr.offsetCp(pblk);
+			unsigned int first = 0;
+			unsigned int count = 0;
+			particleBatchRange(batch, numParBatches, first, count);
 
 			// Compute tempState_i = J_{i,f} * y_f
-			_jacPF[pblk].multiplyAdd(rhs + idxr.offsetJf(), localPar);
+			for (unsigned int pblk = first; pblk < first + count; ++pblk)
+				_jacPF[pblk].multiplyAdd(rhs + idxr.offsetJf(), _tempState + idxr.offsetCp(pblk));
+
 			// Apply J_i^{-1} to tempState_i
-			const bool result = _jacPdisc[pblk].solve(localPar);
-			if (cadet_unlikely(!result))
-			{
-				#pragma omp critical
-				{
-					LOG(Error) << "Solve() failed for par block " << pblk;
-				}
-			}
+			solveParticleBatch(first, count, _tempState);
 
 			// Compute rhs_i = y_i - J_i^{-1} * J_{i,f} * y_f = y_i - tempState_i
-			for (int i = 0; i < idxr.strideParBlock(); ++i)
+			double const* const localPar = _tempState + idxr.offsetCp(first);
+			double* const rhsPar = rhs + idxr.offsetCp(first);
+			for (int i = 0; i < static_cast<int>(count) * idxr.strideParBlock(); ++i)
 				rhsPar[i] -= localPar[i];
 		}
 	}
 	BENCH_STOP(_timerLinearSolvePar);
+}
+
+/**
+ * @brief Solves the linear system with the full Jacobian using a sparse direct solver
+ * @details The diagonal blocks @f$ J_0, \dots, J_{N_z} @f$ of the time-discretized Jacobian are assembled as in
+ *          linearSolve() and, together with the off-diagonal blocks and the identity @f$ J_f @f$, copied into a
+ *          single sparse matrix in compressed row storage. This matrix is LU factorized as a whole. The symbolic
+ *          factorization (sparsity pattern of the factors) is computed once at the first factorization after
+ *          configuration since the pattern of the Jacobian does not change. Each Jacobian update only requires a
+ *          numeric refactorization.
+ *
+ *          The factorization keeps the natural ordering and uses static pivoting (see linalg::FactorizableSparseMatrix),
+ *          that is, vanishing pivots are perturbed and the solution is recovered by iterative refinement, which is also
+ *          applied if the elements of the factors have grown. This is valid for the (block) diagonally dominant Jacobians
+ *          that arise from the time discretization and handles algebraic equations without diagonal element, such as
+ *          quasi-stationary binding with vanishing desorption rate. If the refinement fails, a recoverable error is
+ *          returned. Unlike the iterative solution of the Schur-complement, the solver does not depend on the convergence
+ *          of GMRES and serves as a reference for the block decomposition approach. However, it requires more memory due
+ *          to fill-in.
+ *
+ * @param [in] timeFactor Factor which is premultiplied to the time derivatives originating from time transformation
+ * @param [in] alpha Value of \f$ \alpha \f$ (arises from BDF time discretization)
+ * @param [in,out] rhs On entry the right hand side of the linear equation system, on exit the solution
+ * @param [in] idxr Indexer
+ * @return @c 0 on success, @c -1 on non-recoverable error, and @c +1 on recoverable error
+ */
+int GeneralRateModel::linearSolveSparseDirect(double timeFactor, double alpha, double* const rhs, const Indexer& idxr)
+{
+	if (_factorizeJacobian)
+	{
+		BENCH_SCOPE(_timerFactorize);
+
+		// Do not factorize again at next call without changed Jacobians
+		_factorizeJacobian = false;
+
+		// The global matrix no longer holds the factors required by linearSolveAdjoint()
+		_factorizeJacobianAdj = true;
+
+		assembleGlobalJacobian(timeFactor, alpha, idxr);
+
+		const bool result = _jacGlobal.factorize();
+		if (cadet_unlikely(!result))
+		{
+			LOG(Error) << "Factorize() failed for global Jacobian";
+
+			// Try again with next Jacobian
+			_factorizeJacobian = true;
+			return 1;
+		}
+
+		if (_jacGlobal.numPerturbedPivots() > 0)
+			LOG(Debug) << "Perturbed " << _jacGlobal.numPerturbedPivots() << " pivots of global Jacobian";
+	}
+
+	BENCH_START(_timerLinearSolve);
+	const bool result = _jacGlobal.solve(rhs);
 	BENCH_STOP(_timerLinearSolve);
 
-#ifdef GRM_WRITE_DEBUG_OUTPUT
-	LOG(Debug) << std::setprecision(std::numeric_limits<double>::digits10 + 1)
-	           << "rhsFinal = " << log::VectorPtr<double>(rhs, numDofs());
-#endif
+	if (cadet_unlikely(!result))
+	{
+		LOG(Error) << "Solve() failed for global Jacobian";
+		return 1;
+	}
 
-	// The full solution is now stored in rhs
 	return 0;
 }
 
+/**
+ * @brief Assembles the full time-discretized Jacobian into the global sparse matrix
+ * @details The diagonal blocks @f$ J_0, \dots, J_{N_z} @f$ are assembled as in linearSolve() (which
+ *          overwrites their factorizations) and copied into the global matrix together with the
+ *          off-diagonal blocks and the identity @f$ J_f @f$. The sparsity pattern is analyzed on first use.
+ * @param [in] timeFactor Factor which is premultiplied to the time derivatives originating from time transformation
+ * @param [in] alpha Value of \f$ \alpha \f$ (arises from BDF time discretization)
+ * @param [in] idxr Indexer
+ */
+void GeneralRateModel::assembleGlobalJacobian(double timeFactor, double alpha, const Indexer& idxr)
+{
+	if (cadet_unlikely(_jacGlobal.rows() == 0))
+		analyzeGlobalJacobianPattern(idxr);
+
+	_jacGlobal.setAll(0.0);
+
+	BENCH_START(_timerFactorizePar);
+
+	// Assemble discretized diagonal blocks and copy them into the global matrix
+	// Different blocks occupy different rows and are hence copied concurrently
+	#pragma omp parallel
+	{
+		#pragma omp for schedule(static) nowait
+		for (ompuint_t comp = 0; comp < _disc.nComp; ++comp)
+		{
+			assembleDiscretizedJacobianColumnBlock(comp, alpha, idxr, timeFactor);
+
+			const linalg::FactorizableBandMatrix& fbm = _jacCdisc[comp];
+			const int lower = fbm.lowerBandwidth();
+			const int upper = fbm.upperBandwidth();
+			for (int i = 0; i < static_cast<int>(_disc.nCol); ++i)
+			{
+				const unsigned int row = idxr.offsetC() + i * idxr.strideColCell() + comp * idxr.strideColComp();
+				for (int diag = std::max(-lower, -i); diag <= std::min(upper, static_cast<int>(_disc.nCol) - i - 1); ++diag)
+					_jacGlobal(row, row + diag * idxr.strideColCell()) = fbm.centered(i, diag);
+			}
+		}
+
+		#pragma omp for schedule(static)
+		for (ompuint_t pblk = 0; pblk < _disc.nCol; ++pblk)
+		{
+			assembleDiscretizedJacobianParticleBlock(pblk, alpha, idxr, timeFactor);
+
+			const linalg::FactorizableBandMatrix& fbm = _jacPdisc[pblk];
+			const int lower = fbm.lowerBandwidth();
+			const int upper = fbm.upperBandwidth();
+			const int nRows = fbm.rows();
+			const unsigned int offset = idxr.offsetCp(pblk);
+			for (int i = 0; i < nRows; ++i)
+			{
+				for (int diag = std::max(-lower, -i); diag <= std::min(upper, nRows - i - 1); ++diag)
+					_jacGlobal(offset + i, offset + i + diag) = fbm.centered(i, diag);
+			}
+		}
+	}
+
+	BENCH_STOP(_timerFactorizePar);
+
+	assembleGlobalJacobianOffdiag(idxr);
+}
+
+/**
+ * @brief Solves the linear system with the transposed full Jacobian using a sparse direct solver
+ * @details Solves @f$ \left( J + \alpha \frac{\partial F}{\partial \dot{y}} \right)^T x = b @f$ as required by the
+ *          time integration of the adjoint system. The full Jacobian is assembled as in linearSolveSparseDirect()
+ *          and its LU factors are reused for a transposed solve, @f$ A^T = U^T L^T @f$. Transposing the block
+ *          structure of the Schur-complement approach would require transposed solves with all batched particle
+ *          blocks and a separate Krylov space, which does not pay off for the few solves in the backward pass.
+ *          Since the assembly overwrites the block factorizations used in linearSolve(), those are recomputed
+ *          on the next forward solve.
+ *
+ * @param [in] t Current time point
+ * @param [in] timeFactor Factor which is premultiplied to the time derivatives originating from time transformation
+ * @param [in] alpha Value of \f$ \alpha \f$ (arises from BDF time discretization)
+ * @param [in] outerTol Error tolerance for the solution of the linear system from outer Newton iteration
+ * @param [in,out] rhs On entry the right hand side of the linear equation system, on exit the solution
+ * @param [in] weight Vector with error weights
+ * @param [in] yB Pointer to global adjoint state vector
+ * @param [in] yBdot Pointer to global adjoint time derivative state vector
+ * @param [in] resB Pointer to global adjoint residual vector at the point @p yB, @p yBdot
+ * @return @c 0 on success, @c -1 on non-recoverable error, and @c +1 on recoverable error
+ */
+int GeneralRateModel::linearSolveAdjoint(double t, double timeFactor, double alpha, double outerTol, double* const rhs, double const* const weight,
+	double const* const yB, double const* const yBdot, double const* const resB)
+{
+	Indexer idxr(_disc);
+
+	if (_factorizeJacobianAdj)
+	{
+		BENCH_SCOPE(_timerFactorize);
+
+		// Do not factorize again at next call without changed Jacobians
+		_factorizeJacobianAdj = false;
+
+		// Assembly overwrites the factorizations used by linearSolve()
+		_factorizeJacobian = true;
+
+		assembleGlobalJacobian(timeFactor, alpha, idxr);
+
+		const bool result = _jacGlobal.factorize();
+		if (cadet_unlikely(!result))
+		{
+			LOG(Error) << "Factorize() failed for transposed global Jacobian";
+
+			// Try again with next Jacobian
+			_factorizeJacobianAdj = true;
+			return 1;
+		}
+
+		if (_jacGlobal.numPerturbedPivots() > 0)
+			LOG(Debug) << "Perturbed " << _jacGlobal.numPerturbedPivots() << " pivots of global Jacobian";
+	}
+
+	BENCH_START(_timerLinearSolve);
+	const bool result = _jacGlobal.solveTransposed(rhs);
+	BENCH_STOP(_timerLinearSolve);
+
+	if (cadet_unlikely(!result))
+	{
+		LOG(Error) << "SolveTransposed() failed for global Jacobian";
+		return 1;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Computes the sparsity pattern of the full Jacobian and its LU factors
+ * @details The pattern consists of the bands of the diagonal blocks, the (fixed) off-diagonal
+ *          coupling blocks as assembled by assembleOffdiagJac(), and the identity @f$ J_f @f$.
+ * @param [in] idxr Indexer
+ */
+void GeneralRateModel::analyzeGlobalJacobianPattern(const Indexer& idxr)
+{
+	std::vector<std::vector<unsigned int>> pattern(numDofs());
+
+	// Bulk blocks J_0
+	for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
+	{
+		const int lower = _jacCdisc[comp].lowerBandwidth();
+		const int upper = _jacCdisc[comp].upperBandwidth();
+		for (int i = 0; i < static_cast<int>(_disc.nCol); ++i)
+		{
+			const unsigned int row = idxr.offsetC() + i * idxr.strideColCell() + comp * idxr.strideColComp();
+			for (int diag = std::max(-lower, -i); diag <= std::min(upper, static_cast<int>(_disc.nCol) - i - 1); ++diag)
+				pattern[row].push_back(row + diag * idxr.strideColCell());
+		}
+	}
+
+	// Particle blocks J_p
+	for (unsigned int pblk = 0; pblk < _disc.nCol; ++pblk)
+	{
+		const int lower = _jacPdisc[pblk].lowerBandwidth();
+		const int upper = _jacPdisc[pblk].upperBandwidth();
+		const int nRows = _jacPdisc[pblk].rows();
+		const unsigned int offset = idxr.offsetCp(pblk);
+		for (int i = 0; i < nRows; ++i)
+		{
+			for (int diag = std::max(-lower, -i); diag <= std::min(upper, nRows - i - 1); ++diag)
+				pattern[offset + i].push_back(offset + i + diag);
+		}
+	}
+
+	// Off-diagonal blocks J_{0,f}, J_{f,0}, J_{p,f}, J_{f,p}
+	_jacCF.forEachElement([&](unsigned int row, unsigned int col, double val) { pattern[idxr.offsetC() + row].push_back(idxr.offsetJf() + col); });
+	_jacFC.forEachElement([&](unsigned int row, unsigned int col, double val) { pattern[idxr.offsetJf() + row].push_back(idxr.offsetC() + col); });
+
+	for (unsigned int pblk = 0; pblk < _disc.nCol; ++pblk)
+	{
+		const unsigned int offset = idxr.offsetCp(pblk);
+		_jacPF[pblk].forEachElement([&](unsigned int row, unsigned int col, double val) { pattern[offset + row].push_back(idxr.offsetJf() + col); });
+		_jacFP[pblk].forEachElement([&](unsigned int row, unsigned int col, double val) { pattern[idxr.offsetJf() + row].push_back(offset + col); });
+	}
+
+	// Flux block J_f is the identity matrix, whose diagonal is always part of the pattern
+
+	// Convert to compressed row storage
+	std::vector<unsigned int> rowStart(numDofs() + 1, 0);
+	std::vector<unsigned int> colIdx;
+	for (unsigned int row = 0; row < numDofs(); ++row)
+	{
+		colIdx.insert(colIdx.end(), pattern[row].begin(), pattern[row].end());
+		rowStart[row + 1] = colIdx.size();
+	}
+
+	_jacGlobal.analyzePattern(numDofs(), rowStart, colIdx);
+
+	LOG(Debug) << "Global Jacobian has " << colIdx.size() << " non-zeros, factors have " << _jacGlobal.numNonZero() << " non-zeros";
+}
+
+/**
+ * @brief Adds the off-diagonal blocks and the identity @f$ J_f @f$ to the full Jacobian
+ * @param [in] idxr Indexer
+ */
+void GeneralRateModel::assembleGlobalJacobianOffdiag(const Indexer& idxr)
+{
+	_jacCF.forEachElement([&](unsigned int row, unsigned int col, double val) { _jacGlobal.addElement(idxr.offsetC() + row, idxr.offsetJf() + col, val); });
+	_jacFC.forEachElement([&](unsigned int row, unsigned int col, double val) { _jacGlobal.addElement(idxr.offsetJf() + row, idxr.offsetC() + col, val); });
+
+	for (unsigned int pblk = 0; pblk < _disc.nCol; ++pblk)
+	{
+		const unsigned int offset = idxr.offsetCp(pblk);
+		_jacPF[pblk].forEachElement([&](unsigned int row, unsigned int col, double val) { _jacGlobal.addElement(offset + row, idxr.offsetJf() + col, val); });
+		_jacFP[pblk].forEachElement([&](unsigned int row, unsigned int col, double val) { _jacGlobal.addElement(idxr.offsetJf() + row, offset + col, val); });
+	}
+
+	for (unsigned int i = 0; i < _disc.nCol * _disc.nComp; ++i)
+		_jacGlobal.addElement(idxr.offsetJf() + i, idxr.offsetJf() + i, 1.0);
+}
+
 /**
  * @brief Performs the matrix-vector product @f$ z = Sx @f$ with the Schur-complement @f$ S @f$ from the Jacobian
  * @details The Schur-complement @f$ S @f$ is given by
@@ -431,13 +1009,15 @@ int GeneralRateModel::schurComplementMatrixVector(double const* x, double* z) co
 
 	BENCH_START(_timerMatVecPar);
 
+	const unsigned int numParBatches = numParticleBatches();
+
 	#pragma omp parallel
 	{
 		#pragma omp for schedule(static) nowait
 		for (ompuint_t comp = 0; comp < _disc.nComp; ++comp)
 		{
 			// Apply J_0^{-1} of each component
-			const bool result = _jacCdisc[comp].solve(_tempState + comp * idxr.strideColComp());
+			const bool result = solveBulkBlock(comp, _tempState);
 			if (cadet_unlikely(!result))
 			{
 				#pragma omp critical
@@ -447,24 +1027,20 @@ int GeneralRateModel::schurComplementMatrixVector(double const* x, double* z) co
 			}
 		}
 
-		// Handle particle blocks
+		// Handle particle blocks in batches
 		#pragma omp for schedule(static)
-		for (ompuint_t pblk = 0; pblk < _disc.nCol; ++pblk)
+		for (ompuint_t batch = 0; batch < numParBatches; ++batch)
 		{
-			// Get this thread's temporary memory block
-			double* const tmp = _tempState + idxr.offsetCp(pblk);
+			unsigned int first = 0;
+			unsigned int count = 0;
+			particleBatchRange(batch, numParBatches, first, count);
 
 			// Apply J_{i,f}
-			_jacPF[pblk].multiplyAdd(x, tmp);
+			for (unsigned int pblk = first; pblk < first + count; ++pblk)
+				_jacPF[pblk].multiplyAdd(x, _tempState + idxr.offsetCp(pblk));
+
 			// Apply J_{i}^{-1}
-			const bool result = _jacPdisc[pblk].solve(tmp);
-			if (cadet_unlikely(!result))
-			{
-				#pragma omp critical
-				{
-					LOG(Error) << "Solve() failed for par block " << pblk;
-				}
-			}
+			solveParticleBatch(first, count, _tempState);
 		}
 	}
 
@@ -491,6 +1067,428 @@ int GeneralRateModel::schurComplementMatrixVector(double const* x, double* z) co
 	return 0;
 }
 
+/**
+ * @brief Performs the matrix-vector products @f$ z_i = Sx_i @f$ with the Schur-complement @f$ S @f$ for a panel of vectors
+ * @details Proceeds like schurComplementMatrixVector() for each vector, but solves the bulk blocks
+ *          @f$ J_0 @f$ of all vectors in a single LAPACK call per component. The particle blocks of
+ *          all vectors are solved by the same thread to reuse the batched factors in cache. The
+ *          intermediate states of the vectors are stored in @c _multiRhsTempState.
+ *
+ * @param [in] x Panel of vectors @f$ x_i @f$ the matrix @f$ S @f$ is multiplied with (stored one after another)
+ * @param [out] z Panel of results of the matrix-vector multiplications
+ * @param [in] nVec Number of vectors in the panel
+ * @return @c 0 if successful, any other value in case of failure
+ */
+int GeneralRateModel::schurComplementMatrixPanel(double const* x, double* z, unsigned int nVec)
+{
+	BENCH_SCOPE(_timerMatVec);
+
+	Indexer idxr(_disc);
+	const unsigned int nFlux = _disc.nCol * _disc.nComp;
+	const unsigned int strideTemp = idxr.offsetJf();
+	double* const temp = _multiRhsTempState.data();
+
+	// Copy x over to result z, which corresponds to the application of the identity matrix
+	std::copy(x, x + nVec * nFlux, z);
+	std::fill(temp, temp + nVec * strideTemp, 0.0);
+
+	// Apply J_{0,f}
+	std::vector<double*> tempPtr(nVec);
+	for (unsigned int v = 0; v < nVec; ++v)
+	{
+		tempPtr[v] = temp + v * strideTemp;
+		_jacCF.multiplyAdd(x + v * nFlux, tempPtr[v]);
+	}
+
+	BENCH_START(_timerMatVecPar);
+
+	const unsigned int numParBatches = numParticleBatches();
+
+	#pragma omp parallel
+	{
+		#pragma omp for schedule(static) nowait
+		for (ompuint_t comp = 0; comp < _disc.nComp; ++comp)
+		{
+			// Apply J_0^{-1} of each component to all vectors
+			const bool result = solveBulkBlockMultiRhs(comp, tempPtr.data(), nVec);
+			if (cadet_unlikely(!result))
+			{
+				#pragma omp critical
+				{
+					LOG(Error) << "Solve() failed for comp " << comp;
+				}
+			}
+		}
+
+		// Handle particle blocks in batches
+		#pragma omp for schedule(static)
+		for (ompuint_t batch = 0; batch < numParBatches; ++batch)
+		{
+			unsigned int first = 0;
+			unsigned int count = 0;
+			particleBatchRange(batch, numParBatches, first, count);
+
+			for (unsigned int v = 0; v < nVec; ++v)
+			{
+				// Apply J_{i,f}
+				for (unsigned int pblk = first; pblk < first + count; ++pblk)
+					_jacPF[pblk].multiplyAdd(x + v * nFlux, tempPtr[v] + idxr.offsetCp(pblk));
+
+				// Apply J_{i}^{-1}
+				solveParticleBatch(first, count, tempPtr[v]);
+			}
+		}
+	}
+
+	BENCH_STOP(_timerMatVecPar);
+
+	for (unsigned int v = 0; v < nVec; ++v)
+	{
+		// Apply J_{f,0} and J_{f,i} and subtract results from z
+		_jacFC.multiplySubtract(tempPtr[v], z + v * nFlux);
+
+		for (unsigned int pblk = 0; pblk < _disc.nCol; ++pblk)
+			_jacFP[pblk].multiplySubtract(tempPtr[v] + idxr.offsetCp(pblk), z + v * nFlux);
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Computes the particle part of the Schur-complement
+ * @details The particle part @f$ J_{f,p} \, J_p^{-1} \, J_{p,f} @f$ of the Schur-complement @f$ S @f$
+ *          (see schurComplementMatrixVector()) only couples the fluxes of cell @f$ p @f$. It is computed
+ *          exactly, column by column, using one batched particle solve per component. The resulting
+ *          @f$ N_c \times N_c @f$ blocks are stored row-major in @c _schurPrecBlocks.
+ *
+ *          This function has to be called by all threads of a parallel region after the particle blocks
+ *          have been factorized. The particle part of @c _tempState is used as workspace.
+ * @param [in] idxr Indexer
+ */
+void GeneralRateModel::assembleParticleFluxCoupling(const Indexer& idxr)
+{
+	const unsigned int nComp = _disc.nComp;
+	const unsigned int blockSize = nComp * nComp;
+	const unsigned int numParBatches = numParticleBatches();
+
+	#pragma omp for schedule(static)
+	for (ompuint_t batch = 0; batch < numParBatches; ++batch)
+	{
+		unsigned int first = 0;
+		unsigned int count = 0;
+		particleBatchRange(batch, numParBatches, first, count);
+
+		std::fill(_schurPrecBlocks + first * blockSize, _schurPrecBlocks + (first + count) * blockSize, 0.0);
+
+		for (unsigned int comp = 0; comp < nComp; ++comp)
+		{
+			// Extract the column of J_{p,f} that belongs to the flux of component comp in cell p
+			std::fill(_tempState + idxr.offsetCp(first), _tempState + idxr.offsetCp(first + count), 0.0);
+			for (unsigned int pblk = first; pblk < first + count; ++pblk)
+			{
+				const unsigned int fluxIdx = pblk * idxr.strideFluxCell() + comp * idxr.strideFluxComp();
+				double* const local = _tempState + idxr.offsetCp(pblk);
+				_jacPF[pblk].forEachElement([=](unsigned int row, unsigned int col, double val)
+					{
+						if (col == fluxIdx)
+							local[row] += val;
+					});
+			}
+
+			// Apply J_p^{-1}
+			solveParticleBatch(first, count, _tempState);
+
+			// Apply J_{f,p} and store result in column comp of the block
+			for (unsigned int pblk = first; pblk < first + count; ++pblk)
+			{
+				double const* const local = _tempState + idxr.offsetCp(pblk);
+				double* const block = _schurPrecBlocks + pblk * blockSize;
+				_jacFP[pblk].forEachElement([&](unsigned int row, unsigned int col, double val)
+					{
+						const unsigned int blockRow = (row / idxr.strideFluxComp()) % nComp;
+						block[blockRow * nComp + comp] += val * local[col];
+					});
+			}
+		}
+	}
+}
+
+/**
+ * @brief Assembles and factorizes the block-Jacobi preconditioner of the Schur-complement
+ * @details The preconditioner consists of the diagonal @f$ N_c \times N_c @f$ blocks of an approximation of the
+ *          Schur-complement @f$ S @f$ (see schurComplementMatrixVector()), one block for each axial cell.
+ *          The particle part is computed exactly by assembleParticleFluxCoupling(). The bulk part
+ *          @f$ J_{f,0} \, J_0^{-1} \, J_{0,f} @f$ couples all cells but not the components. It is approximated
+ *          by replacing @f$ J_0^{-1} @f$ with the inverse of its diagonal, which is expected in @c _schurPrecBulk.
+ *
+ *          This function has to be called by all threads of a parallel region after the diagonal blocks
+ *          have been factorized.
+ * @param [in] idxr Indexer
+ */
+void GeneralRateModel::assembleSchurComplementPreconditioner(const Indexer& idxr)
+{
+	const unsigned int nComp = _disc.nComp;
+	const unsigned int blockSize = nComp * nComp;
+
+	assembleParticleFluxCoupling(idxr);
+
+	// Add J_{f,0} * diag(J_0)^{-1} * J_{0,f}, where J_{0,f} is diagonal (see assembleOffdiagJac())
+	#pragma omp single
+	{
+		_jacCF.forEachElement([=](unsigned int row, unsigned int col, double val) { _schurPrecBulk[row] *= val; });
+
+		_jacFC.forEachElement([&](unsigned int row, unsigned int col, double val)
+			{
+				const unsigned int cell = (row / idxr.strideFluxCell()) % _disc.nCol;
+				if (cell != (col / idxr.strideColCell()) % _disc.nCol)
+					return;
+
+				const unsigned int blockRow = (row / idxr.strideFluxComp()) % nComp;
+				const unsigned int blockCol = (col / idxr.strideColComp()) % nComp;
+				_schurPrecBlocks[cell * blockSize + blockRow * nComp + blockCol] += val * _schurPrecBulk[col];
+			});
+	}
+
+	// Form I - sum of couplings and factorize
+	#pragma omp for schedule(static)
+	for (ompuint_t cell = 0; cell < _disc.nCol; ++cell)
+	{
+		double* const block = _schurPrecBlocks + cell * blockSize;
+		for (unsigned int i = 0; i < blockSize; ++i)
+			block[i] = -block[i];
+		for (unsigned int i = 0; i < nComp; ++i)
+			block[i * nComp + i] += 1.0;
+
+		linalg::DenseMatrixView precBlock(block, _schurPrecPivot + cell * nComp, nComp, nComp);
+		const bool result = precBlock.factorize();
+		if (cadet_unlikely(!result))
+		{
+			#pragma omp critical
+			{
+				LOG(Error) << "Factorize() failed for Schur-complement preconditioner block " << cell;
+			}
+		}
+	}
+}
+
+/**
+ * @brief Assembles and factorizes the Schur-complement explicitly
+ * @details The Schur-complement @f$ S @f$ (see schurComplementMatrixVector()) is assembled as dense matrix
+ *          and LU factorized, which replaces the GMRES iterations in linearSolve() by a single solve.
+ *          The particle part is block-diagonal with respect to the cells and computed by
+ *          assembleParticleFluxCoupling(). The bulk part @f$ J_{f,0} \, J_0^{-1} \, J_{0,f} @f$ does not
+ *          couple different components, but all cells. It is computed from the columns of @f$ J_0^{-1} @f$
+ *          using the fact that @f$ J_{f,0} @f$ and @f$ J_{0,f} @f$ are diagonal (see assembleOffdiagJac()).
+ *
+ *          This function has to be called by all threads of a parallel region after the diagonal blocks
+ *          have been factorized.
+ * @param [in] idxr Indexer
+ */
+void GeneralRateModel::assembleSchurComplementDirect(const Indexer& idxr)
+{
+	const unsigned int nComp = _disc.nComp;
+	const unsigned int nFlux = _disc.nCol * nComp;
+	double* const diagFC = _schurDirectScratch;
+	double* const diagCF = _schurDirectScratch + nFlux;
+
+	assembleParticleFluxCoupling(idxr);
+
+	#pragma omp single
+	{
+		// S = I - sum_p J_{f,p} * J_p^{-1} * J_{p,f}
+		_schurMatrix.setAll(0.0);
+		for (unsigned int cell = 0; cell < _disc.nCol; ++cell)
+		{
+			double const* const block = _schurPrecBlocks + cell * nComp * nComp;
+			for (unsigned int row = 0; row < nComp; ++row)
+			{
+				const unsigned int fRow = cell * idxr.strideFluxCell() + row * idxr.strideFluxComp();
+				for (unsigned int col = 0; col < nComp; ++col)
+					_schurMatrix.native(fRow, cell * idxr.strideFluxCell() + col * idxr.strideFluxComp()) = -block[row * nComp + col];
+
+				_schurMatrix.native(fRow, fRow) += 1.0;
+			}
+		}
+
+		// Extract diagonals of J_{f,0} and J_{0,f}
+		std::fill(diagFC, diagFC + 2 * nFlux, 0.0);
+		_jacFC.forEachElement([=](unsigned int row, unsigned int col, double val)
+			{
+				cadet_assert(row == col);
+				diagFC[row] += val;
+			});
+		_jacCF.forEachElement([=](unsigned int row, unsigned int col, double val)
+			{
+				cadet_assert(row == col);
+				diagCF[col] += val;
+			});
+	}
+
+	// Subtract J_{f,0} * J_0^{-1} * J_{0,f} for each component
+	#pragma omp for schedule(static)
+	for (ompuint_t comp = 0; comp < nComp; ++comp)
+	{
+		double* const colInv = _schurDirectScratch + 2 * nFlux + comp * _disc.nCol;
+		for (unsigned int j = 0; j < _disc.nCol; ++j)
+		{
+			// Compute column j of J_0^{-1}
+			std::fill(colInv, colInv + _disc.nCol, 0.0);
+			colInv[j] = 1.0;
+			_jacCdisc[comp].solve(colInv);
+
+			const unsigned int fCol = j * idxr.strideFluxCell() + comp * idxr.strideFluxComp();
+			for (unsigned int i = 0; i < _disc.nCol; ++i)
+			{
+				const unsigned int fRow = i * idxr.strideFluxCell() + comp * idxr.strideFluxComp();
+				_schurMatrix.native(fRow, fCol) -= diagFC[fRow] * colInv[i] * diagCF[fCol];
+			}
+		}
+	}
+
+	#pragma omp single
+	{
+		const bool result = _schurMatrix.factorize();
+		if (cadet_unlikely(!result))
+		{
+			LOG(Error) << "Factorize() failed for Schur-complement";
+		}
+	}
+}
+
+/**
+ * @brief Applies the block-Jacobi preconditioner of the Schur-complement, that is, solves @f$ Pz = r @f$
+ * @details See assembleSchurComplementPreconditioner() for the construction of the preconditioner @f$ P @f$.
+ * @param [in] r Right hand side @f$ r @f$
+ * @param [out] z Solution @f$ z @f$
+ * @return @c 0 if successful, any other value in case of failure
+ */
+int GeneralRateModel::applySchurComplementPreconditioner(double const* r, double* z) const
+{
+	Indexer idxr(_disc);
+	const unsigned int nComp = _disc.nComp;
+	bool success = true;
+
+	#pragma omp parallel for schedule(static) reduction(&&:success)
+	for (ompuint_t cell = 0; cell < _disc.nCol; ++cell)
+	{
+		// Gather the fluxes of the cell, which are strided in component-major ordering
+		double* const local = _schurPrecBulk + cell * nComp;
+		for (unsigned int comp = 0; comp < nComp; ++comp)
+			local[comp] = r[cell * idxr.strideFluxCell() + comp * idxr.strideFluxComp()];
+
+		linalg::DenseMatrixView precBlock(_schurPrecBlocks + cell * nComp * nComp, _schurPrecPivot + cell * nComp, nComp, nComp);
+		success = precBlock.solve(local) && success;
+
+		for (unsigned int comp = 0; comp < nComp; ++comp)
+			z[cell * idxr.strideFluxCell() + comp * idxr.strideFluxComp()] = local[comp];
+	}
+
+	return success ? 0 : 1;
+}
+
+/**
+ * @brief Returns the number of batches the particle blocks are divided into for batched solution
+ * @details There is at least one batch per thread (if there are enough particle blocks). The batch size
+ *          is limited in order to keep the workspace of a batch in cache.
+ * @return Number of particle block batches
+ */
+unsigned int GeneralRateModel::numParticleBatches() const
+{
+	const unsigned int maxBatchSize = 64;
+	const unsigned int numThreads = static_cast<unsigned int>(omp_get_max_threads());
+	return std::min(_disc.nCol, std::max(numThreads, (_disc.nCol + maxBatchSize - 1) / maxBatchSize));
+}
+
+/**
+ * @brief Computes the range of particle blocks of a batch
+ * @param [in] batch Index of the batch
+ * @param [in] numBatches Total number of batches, see numParticleBatches()
+ * @param [out] first Index of the first particle block in the batch
+ * @param [out] count Number of particle blocks in the batch
+ */
+void GeneralRateModel::particleBatchRange(unsigned int batch, unsigned int numBatches, unsigned int& first, unsigned int& count) const CADET_NOEXCEPT
+{
+	first = (batch * _disc.nCol) / numBatches;
+	count = ((batch + 1) * _disc.nCol) / numBatches - first;
+}
+
+/**
+ * @brief Solves the linear systems with the factorized particle Jacobian blocks of a batch
+ * @details The particle blocks of @p vec are overwritten by the solutions. Disjoint batches use
+ *          disjoint parts of the workspace, which allows solving them in parallel.
+ * @param [in] first Index of the first particle block
+ * @param [in] count Number of particle blocks
+ * @param [in,out] vec Pointer to the global vector
+ */
+void GeneralRateModel::solveParticleBatch(unsigned int first, unsigned int count, double* const vec) const
+{
+	Indexer idxr(_disc);
+	_jacPdiscBatch.solve(vec + idxr.offsetCp(first), idxr.strideParBlock(), first, count, _parBatchScratch + first * idxr.strideParBlock());
+}
+
+/**
+ * @brief Solves the linear system with the factorized column void Jacobian block of a single component
+ * @details The bulk part of @p vec is overwritten by the solution for the given component only. In
+ *          component-major ordering, the component's states are contiguous and solved in-place. In
+ *          cell-major ordering, they are gathered into a contiguous buffer, solved, and scattered back.
+ *          Different components use disjoint parts of the buffer, which allows solving them in parallel.
+ * @param [in] comp Index of the component
+ * @param [in,out] vec Pointer to the global vector (i.e., beginning of the bulk block)
+ * @return @c true if the solution was successful, otherwise @c false
+ */
+bool GeneralRateModel::solveBulkBlock(unsigned int comp, double* const vec) const
+{
+	Indexer idxr(_disc);
+	double* const local = idxr.c(vec) + comp * idxr.strideColComp();
+
+	if (!_disc.cellMajorBulk)
+		return _jacCdisc[comp].solve(local);
+
+	double* const buffer = _bulkScratch + comp * _disc.nCol;
+	for (unsigned int i = 0; i < _disc.nCol; ++i)
+		buffer[i] = local[i * idxr.strideColCell()];
+
+	const bool result = _jacCdisc[comp].solve(buffer);
+
+	for (unsigned int i = 0; i < _disc.nCol; ++i)
+		local[i * idxr.strideColCell()] = buffer[i];
+
+	return result;
+}
+
+/**
+ * @brief Solves the linear systems with the factorized column void Jacobian block of a single component for multiple vectors
+ * @details The bulk states of the given component are gathered from all vectors into consecutive columns of
+ *          a buffer, solved in a single LAPACK call, and scattered back. Different components use disjoint
+ *          parts of the buffer, which allows solving them in parallel.
+ * @param [in] comp Index of the component
+ * @param [in,out] vec Array with pointers to the global vectors (i.e., beginning of the bulk block)
+ * @param [in] nVec Number of vectors
+ * @return @c true if the solution was successful, otherwise @c false
+ */
+bool GeneralRateModel::solveBulkBlockMultiRhs(unsigned int comp, double* const* const vec, unsigned int nVec)
+{
+	Indexer idxr(_disc);
+	double* const buffer = _multiRhsScratch.data() + comp * _disc.nCol * nVec;
+	for (unsigned int r = 0; r < nVec; ++r)
+	{
+		double const* const local = idxr.c(vec[r]) + comp * idxr.strideColComp();
+		for (unsigned int i = 0; i < _disc.nCol; ++i)
+			buffer[r * _disc.nCol + i] = local[i * idxr.strideColCell()];
+	}
+
+	const bool result = _jacCdisc[comp].solve(buffer, nVec, _disc.nCol);
+
+	for (unsigned int r = 0; r < nVec; ++r)
+	{
+		double* const local = idxr.c(vec[r]) + comp * idxr.strideColComp();
+		for (unsigned int i = 0; i < _disc.nCol; ++i)
+			local[i * idxr.strideColCell()] = buffer[r * _disc.nCol + i];
+	}
+
+	return result;
+}
+
 /**
  * @brief Assembles the column void Jacobian block @f$ J_0 @f$ of the time-discretized equations
  * @details The system \f[ \left( \frac{\partial F}{\partial y} + \alpha \frac{\partial F}{\partial \dot{y}} \right) x = b \f]
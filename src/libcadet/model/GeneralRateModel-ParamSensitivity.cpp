@@ -0,0 +1,348 @@
+// =============================================================================
+//  CADET - The Chromatography Analysis and Design Toolkit
+//
+//  Copyright © 2008-2016: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+#include "model/GeneralRateModel.hpp"
+#include "model/BindingModel.hpp"
+#include "ParamReaderHelper.hpp"
+#include "Stencil.hpp"
+#include "Weno.hpp"
+#include "AdUtils.hpp"
+
+#include <algorithm>
+
+#include "LoggingUtils.hpp"
+#include "Logging.hpp"
+
+#include "OpenMPSupport.hpp"
+
+namespace cadet
+{
+
+namespace model
+{
+
+namespace
+{
+	/**
+	 * @brief Adds a value to a directional derivative of an AD value
+	 * @param [in,out] a AD value
+	 * @param [in] dir AD direction
+	 * @param [in] val Value added to the directional derivative
+	 */
+	inline void addADValue(active& a, unsigned int dir, double val)
+	{
+		a.setADValue(dir, a.getADValue(dir) + val);
+	}
+
+	/**
+	 * @brief Returns the index of a parameter in an array slice
+	 * @param [in] param Parameter
+	 * @param [in] slice Array slice
+	 * @param [in] n Number of elements in the slice
+	 * @return Index of the parameter in the slice or @c -1 if the parameter is not part of the slice
+	 */
+	inline int indexInSlice(active const* param, active const* slice, unsigned int n)
+	{
+		if ((param >= slice) && (param < slice + n))
+			return static_cast<int>(param - slice);
+		return -1;
+	}
+}
+
+/**
+ * @brief Determines whether the residual derivative with respect to the given parameter is implemented analytically
+ * @details The particle radius and porosity enter almost all terms of the particle equations and are left to AD.
+ * @param [in] pId Parameter ID of a parameter of this unit operation
+ * @return @c true if analyticParamSensitivity() supports the parameter, otherwise @c false
+ */
+bool GeneralRateModel::hasAnalyticParamDerivative(const ParameterId& pId) const
+{
+	return (pId.name == hashString("COL_DISPERSION")) || (pId.name == hashString("VELOCITY")) || (pId.name == hashString("COL_LENGTH"))
+		|| (pId.name == hashString("COL_POROSITY")) || (pId.name == hashString("FILM_DIFFUSION")) || (pId.name == hashString("PAR_DIFFUSION"))
+		|| (pId.name == hashString("PAR_SURFDIFFUSION"));
+}
+
+/**
+ * @brief Computes the parameter derivatives of the residual by hand-coded expressions
+ * @details The residual has to be evaluated into @c _tempState before calling this function, which
+ *          is then used as buffer. Only the directions of the sensitive parameters are touched, each
+ *          residual entry is assigned its derivatives with respect to all sensitive parameters that
+ *          it depends on. The derivatives with respect to binding model parameters are provided by
+ *          IBindingModel::analyticParamDerivative().
+ *
+ *          The dependence on section times is taken into account by the time transformation
+ *          @p timeFactor whose derivatives multiply the time derivative terms of the residual.
+ * @param [in] t Current time point
+ * @param [in] secIdx Index of the current section
+ * @param [in] timeFactor Used for time transformation (pre factor of time derivatives)
+ * @param [in] y Pointer to state vector
+ * @param [in] yDot Pointer to time derivative state vector
+ * @param [out] adRes Pointer to residual vector of AD datatypes
+ * @return @c 0 on success, @c -1 on non-recoverable error, and @c +1 on recoverable error
+ */
+int GeneralRateModel::analyticParamSensitivity(const active& t, unsigned int secIdx, const active& timeFactor, double const* const y, double const* const yDot, active* const adRes)
+{
+	Indexer idxr(_disc);
+	const unsigned int nDofs = numDofs();
+	const std::size_t numADdirs = ad::getDirections();
+
+	// Assigning the residual values also resets the directional derivatives
+	for (unsigned int i = 0; i < nDofs; ++i)
+		adRes[i] = _tempState[i];
+
+	// From here on _tempState is used as buffer
+
+	// ==== Time transformation
+
+	if (yDot)
+	{
+		bool timeFactorSens = false;
+		for (std::size_t dir = 0; dir < numADdirs; ++dir)
+			timeFactorSens = timeFactorSens || (timeFactor.getADValue(dir) != 0.0);
+
+		if (timeFactorSens)
+		{
+			// The residual is linear in the timeFactor
+			multiplyWithDerivativeJacobian(yDot, _tempState, 1.0);
+			for (std::size_t dir = 0; dir < numADdirs; ++dir)
+			{
+				const double tfDir = timeFactor.getADValue(dir);
+				if (tfDir == 0.0)
+					continue;
+
+				for (unsigned int i = 0; i < nDofs; ++i)
+					addADValue(adRes[i], dir, tfDir * _tempState[i]);
+			}
+		}
+	}
+
+	// ==== Transport parameters
+
+	active const* const u = &getSectionDependentScalar(_velocity, secIdx);
+	active const* const d_c = &getSectionDependentScalar(_colDispersion, secIdx);
+	active const* const filmDiff = getSectionDependentSlice(_filmDiffusion, _disc.nComp, secIdx);
+	active const* const parDiff = getSectionDependentSlice(_parDiffusion, _disc.nComp, secIdx);
+	active const* const parSurfDiff = getSectionDependentSlice(_parSurfDiffusion, _disc.strideBound, secIdx);
+
+	bool bulkSens = false;
+	for (const SensitiveParameter& sp : _sensParamList)
+		bulkSens = bulkSens || (!sp.binding && ((sp.param == u) || (sp.param == d_c) || (sp.param == &_colLength)));
+
+	if (bulkSens)
+	{
+		// Dispersion stencil of each bulk cell is stored in the bulk part of _tempState and
+		// difference of reconstructed face values in the flux part of _tempState
+		typedef CachingStencil<double, ArrayPool> StencilType;
+		for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
+		{
+			StencilType stencil(std::max(_weno.stencilSize(), 3u), _stencilMemory[0], std::max(_weno.order() - 1, 1));
+
+			for (int i = -std::max(_weno.order(), 2) + 1; i < 0; ++i)
+				stencil[i] = 0.0;
+			for (int i = 0; i < std::max(_weno.order(), 2); ++i)
+				stencil[i] = idxr.c<double>(y, static_cast<unsigned int>(i), comp);
+
+			double vm = 0.0;
+			for (unsigned int col = 0; col < _disc.nCol; ++col)
+			{
+				double& diff = idxr.c<double>(_tempState, col, comp);
+				double& conv = idxr.jf<double>(_tempState, col, comp);
+
+				diff = 0.0;
+				conv = 0.0;
+				if (cadet_likely(col < _disc.nCol - 1))
+					diff += stencil[1] - stencil[0];
+				if (cadet_likely(col > 0))
+				{
+					diff += stencil[-1] - stencil[0];
+					conv -= vm;
+				}
+
+				_weno.reconstruct<double, StencilType, false>(_wenoEpsilon, col, _disc.nCol, stencil, vm, _wenoDerivatives);
+				conv += vm;
+
+				stencil.advance(idxr.c<double>(y, col + std::max(_weno.order(), 2), comp));
+			}
+		}
+	}
+
+	const double colLength = static_cast<double>(_colLength);
+	const double h = colLength / static_cast<double>(_disc.nCol);
+	const double h2 = h * h;
+	const double radius = static_cast<double>(_parRadius);
+	const double epsC = static_cast<double>(_colPorosity);
+	const double epsP = static_cast<double>(_parPorosity);
+	const double invBetaP = 1.0 / epsP - 1.0;
+	const double relOuterShellHalfRadius = 0.5 * _parCellSize[0];
+
+	for (const SensitiveParameter& sp : _sensParamList)
+	{
+		if (sp.binding)
+			continue;
+
+		const unsigned int dir = sp.adDirection;
+
+		// Bulk: -D_ax / h^2 * D[c] + u / h * C[c]
+		if ((sp.param == d_c) || (sp.param == u) || (sp.param == &_colLength))
+		{
+			double dDisp = 0.0;
+			double dConv = 0.0;
+			if (sp.param == d_c)
+				dDisp -= 1.0 / h2;
+			if (sp.param == u)
+				dConv += 1.0 / h;
+			if (sp.param == &_colLength)
+			{
+				dDisp += 2.0 * static_cast<double>(*d_c) / (h2 * colLength);
+				dConv -= static_cast<double>(*u) / (h * colLength);
+			}
+
+			for (unsigned int col = 0; col < _disc.nCol; ++col)
+			{
+				for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
+				{
+					const double val = dDisp * idxr.c<double>(_tempState, col, comp) + dConv * idxr.jf<double>(_tempState, col, comp);
+					addADValue(idxr.c<active>(adRes, col, comp), dir, sp.adValue * val);
+				}
+			}
+		}
+
+		// Bulk: (1 / eps_c - 1) * 3 / r_p * j_f
+		if (sp.param == &_colPorosity)
+		{
+			const double factor = -3.0 / (radius * epsC * epsC);
+			for (unsigned int col = 0; col < _disc.nCol; ++col)
+			{
+				for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
+					addADValue(idxr.c<active>(adRes, col, comp), dir, sp.adValue * factor * idxr.jf<double>(y, col, comp));
+			}
+		}
+
+		// Flux: j_f - k_{f,FV} * (c - c_p) with k_{f,FV} = 1 / (r_p * dr / (eps_p * D_p) + 1 / k_f)
+		const int compFilm = indexInSlice(sp.param, filmDiff, _disc.nComp);
+		const int compParDiff = indexInSlice(sp.param, parDiff, _disc.nComp);
+		const int comp = std::max(compFilm, compParDiff);
+		if (comp >= 0)
+		{
+			const double kf = static_cast<double>(filmDiff[comp]);
+			const double dp = static_cast<double>(parDiff[comp]);
+			const double a = radius * relOuterShellHalfRadius / epsP;
+			const double kfFV = 1.0 / (a / dp + 1.0 / kf);
+
+			double dKfFV = 0.0;
+			if (compFilm >= 0)
+				dKfFV += kfFV * kfFV / (kf * kf);
+			if (compParDiff >= 0)
+				dKfFV += kfFV * kfFV * a / (dp * dp);
+
+			for (unsigned int col = 0; col < _disc.nCol; ++col)
+			{
+				const double val = dKfFV * (idxr.cp<double>(y, col, 0, comp) - idxr.c<double>(y, col, comp));
+				addADValue(idxr.jf<active>(adRes, col, comp), dir, sp.adValue * val);
+			}
+		}
+
+		// Particle: diffusion of mobile phase (D_p) or bound phase (D_s) between shells
+		const int bndSurfDiff = indexInSlice(sp.param, parSurfDiff, _disc.strideBound);
+		if ((compParDiff < 0) && (bndSurfDiff < 0))
+			continue;
+
+		unsigned int eqComp = 0;
+		int stateOffset = 0;
+		double factor = 1.0;
+		if (compParDiff >= 0)
+		{
+			eqComp = compParDiff;
+			stateOffset = compParDiff;
+		}
+		else
+		{
+			// Find component of the bound state
+			while (idxr.offsetBoundComp(eqComp) + _disc.nBound[eqComp] <= static_cast<unsigned int>(bndSurfDiff))
+				++eqComp;
+			stateOffset = idxr.strideParLiquid() + bndSurfDiff;
+			factor = invBetaP;
+		}
+
+		for (unsigned int col = 0; col < _disc.nCol; ++col)
+		{
+			double const* const yPar = y + idxr.offsetCp(col) + stateOffset;
+			for (unsigned int par = 0; par < _disc.nPar; ++par)
+			{
+				double const* const yShell = yPar + par * idxr.strideParShell();
+				double val = 0.0;
+
+				if (cadet_likely(par != 0))
+				{
+					const double dr = (_parCenterRadius[par - 1] - _parCenterRadius[par]) * radius;
+					val -= _parOuterSurfAreaPerVolume[par] / radius * (yShell[-idxr.strideParShell()] - yShell[0]) / dr;
+				}
+
+				if (cadet_likely(par != _disc.nPar - 1))
+				{
+					const double dr = (_parCenterRadius[par] - _parCenterRadius[par + 1]) * radius;
+					val += _parInnerSurfAreaPerVolume[par] / radius * (yShell[0] - yShell[idxr.strideParShell()]) / dr;
+				}
+
+				addADValue(idxr.cp<active>(adRes, col, par, eqComp), dir, sp.adValue * factor * val);
+			}
+		}
+	}
+
+	// ==== Binding model parameters
+
+	bool bindingSens = false;
+	for (const SensitiveParameter& sp : _sensParamList)
+		bindingSens = bindingSens || sp.binding;
+
+	if (bindingSens)
+	{
+		#pragma omp parallel
+		{
+			ad::setDirections(numADdirs);
+
+			#pragma omp for schedule(static)
+			for (ompuint_t col = 0; col < _disc.nCol; ++col)
+			{
+				// Midpoint of current column cell (z coordinate) - needed in externally dependent adsorption kinetic
+				const double z = 1.0 / static_cast<double>(_disc.nCol) * (0.5 + col);
+
+				for (unsigned int par = 0; par < _disc.nPar; ++par)
+				{
+					const unsigned int offset = idxr.offsetCp(col) + par * idxr.strideParShell() + idxr.strideParLiquid();
+					double* const buffer = _tempState + offset;
+
+					for (const SensitiveParameter& sp : _sensParamList)
+					{
+						if (!sp.binding)
+							continue;
+
+						std::fill(buffer, buffer + _disc.strideBound, 0.0);
+						_binding->analyticParamDerivative(sp.id, sp.adValue, static_cast<double>(t), z, _parCenterRadius[par], secIdx, y + offset, buffer);
+
+						for (unsigned int i = 0; i < _disc.strideBound; ++i)
+						{
+							if (buffer[i] != 0.0)
+								addADValue(adRes[offset + i], sp.adDirection, buffer[i]);
+						}
+					}
+				}
+			}
+		}
+	}
+
+	return 0;
+}
+
+}  // namespace model
+
+}  // namespace cadet
@@ -31,6 +31,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <type_traits>
 
 #include "OpenMPSupport.hpp"
 
@@ -48,6 +49,56 @@ namespace
 	{
 		return set.find(item) != set.end();
 	}
+
+	/**
+	 * @brief Evaluates the binding model residual on a contiguous set of particle shells in one call
+	 * @details Batched evaluation is only available for plain double states and residuals.
+	 *          This generic variant handles all AD types. It is never called, since AD types
+	 *          are evaluated shell by shell, and only keeps the generic code path compilable.
+	 * @return @c -1 since batched evaluation is not available
+	 */
+	template <typename StateType, typename ResidualType, typename ParamType>
+	inline int bindingResidualBatch(const cadet::model::IBindingModel& binding, const ParamType& t, double z, double const* r, unsigned int secIdx,
+		const ParamType& timeFactor, unsigned int nShells, unsigned int stride, StateType const* y, double const* yDot, ResidualType* res)
+	{
+		return -1;
+	}
+
+	/**
+	 * @brief Evaluates the binding model residual on a contiguous set of particle shells in one call
+	 * @return Return code of IBindingModel::residualBatch()
+	 */
+	inline int bindingResidualBatch(const cadet::model::IBindingModel& binding, double t, double z, double const* r, unsigned int secIdx,
+		double timeFactor, unsigned int nShells, unsigned int stride, double const* y, double const* yDot, double* res)
+	{
+		return binding.residualBatch(t, z, r, secIdx, timeFactor, nShells, stride, y, yDot, res);
+	}
+
+	/**
+	 * @brief Evaluates the binding model residual and its analytic Jacobian on a contiguous set of particle shells in one call
+	 * @details Batched evaluation is only available for plain double states and residuals.
+	 *          This generic variant handles all AD types. It is never called, since AD types
+	 *          are evaluated shell by shell, and only keeps the generic code path compilable.
+	 * @return @c -1 since batched evaluation is not available
+	 */
+	template <typename StateType, typename ResidualType, typename ParamType>
+	inline int bindingResidualWithJacobianBatch(const cadet::model::IBindingModel& binding, const ParamType& t, double z, double const* r, unsigned int secIdx,
+		const ParamType& timeFactor, unsigned int nShells, unsigned int stride, StateType const* y, double const* yDot, ResidualType* res,
+		cadet::linalg::BandMatrix::RowIterator jac)
+	{
+		return -1;
+	}
+
+	/**
+	 * @brief Evaluates the binding model residual and its analytic Jacobian on a contiguous set of particle shells in one call
+	 * @return Return code of IBindingModel::residualWithJacobianBatch()
+	 */
+	inline int bindingResidualWithJacobianBatch(const cadet::model::IBindingModel& binding, double t, double z, double const* r, unsigned int secIdx,
+		double timeFactor, unsigned int nShells, unsigned int stride, double const* y, double const* yDot, double* res,
+		cadet::linalg::BandMatrix::RowIterator jac)
+	{
+		return binding.residualWithJacobianBatch(t, z, r, secIdx, timeFactor, nShells, stride, y, yDot, res, jac);
+	}
 }
 
 namespace cadet
@@ -62,11 +113,24 @@ int schurComplementMultiplier(void* userData, double const* x, double* z)
 	return grm->schurComplementMatrixVector(x, z);
 }
 
+int schurComplementPanelMultiplier(void* userData, double const* x, double* z, unsigned int nVec)
+{
+	GeneralRateModel* const grm = static_cast<GeneralRateModel*>(userData);
+	return grm->schurComplementMatrixPanel(x, z, nVec);
+}
+
+int schurComplementPreconditioner(void* userData, double const* r, double* z)
+{
+	GeneralRateModel* const grm = static_cast<GeneralRateModel*>(userData);
+	return grm->applySchurComplementPreconditioner(r, z);
+}
+
 
 GeneralRateModel::GeneralRateModel(UnitOpIdx unitOpIdx) : _unitOpIdx(unitOpIdx), _binding(nullptr),
 	_jacC(nullptr), _jacP(nullptr), _jacPF(nullptr), _jacFP(nullptr), _jacCdisc(nullptr), _jacPdisc(nullptr),
-	_analyticJac(true), _stencilMemory(sizeof(active) * Weno::maxStencilSize()), _wenoDerivatives(new double[Weno::maxStencilSize()]),
-	_weno(), _jacobianAdDirs(0), _factorizeJacobian(false), _tempState(nullptr)
+	_analyticJac(true), _stencilMemory(nullptr), _wenoDerivatives(nullptr),
+	_weno(), _analyticParamSens(false), _sensParamsAnalytic(true), _jacobianAdDirs(0), _fixedAdDirs(0), _factorizeJacobian(false), _factorizeJacobianAdj(false), _tempState(nullptr), _schurPrecond(false), _schurPrecBlocks(nullptr), _schurPrecPivot(nullptr), _schurPrecBulk(nullptr), _schurDirectSolve(false), _schurDirectScratch(nullptr), _globalDirectSolve(false),
+	_bulkScratch(nullptr), _parBatchScratch(nullptr)
 {
 
 }
@@ -74,8 +138,15 @@ GeneralRateModel::GeneralRateModel(UnitOpIdx unitOpIdx) : _unitOpIdx(unitOpIdx),
 GeneralRateModel::~GeneralRateModel() CADET_NOEXCEPT
 {
 	delete[] _tempState;
+	delete[] _schurPrecBlocks;
+	delete[] _schurPrecPivot;
+	delete[] _schurPrecBulk;
+	delete[] _schurDirectScratch;
+	delete[] _bulkScratch;
+	delete[] _parBatchScratch;
 
 	delete[] _wenoDerivatives;
+	delete[] _stencilMemory;
 
 	delete[] _jacPF;
 	delete[] _jacFP;
@@ -86,6 +157,8 @@ GeneralRateModel::~GeneralRateModel() CADET_NOEXCEPT
 	delete[] _jacP;
 	delete[] _jacPdisc;
 
+	releaseFixedAdVectors();
+
 	delete _binding;
 
 	delete[] _disc.nBound;
@@ -107,8 +180,9 @@ bool GeneralRateModel::usesAD() const CADET_NOEXCEPT
 	// We always need AD if we want to check the analytical Jacobian
 	return true;
 #else
-	// We only need AD if we are not computing the Jacobian analytically
-	return !_analyticJac;
+	// We only need AD vectors if we are not computing the Jacobian analytically
+	// and do not use the compile-time sized AD datatypes (which have their own vectors)
+	return !_analyticJac && (_fixedAdDirs == 0);
 #endif
 }
 
@@ -152,6 +226,17 @@ bool GeneralRateModel::configure(IParameterProvider& paramProvider, IConfigHelpe
 	else // Handle parDiscType == "EQUIDISTANT_PAR" and default
 		setEquidistantRadialDisc();
 
+	// Read ordering of bulk and flux states (component-major is default)
+	_disc.cellMajorBulk = false;
+	if (paramProvider.exists("BULK_ORDERING"))
+	{
+		const std::string bulkOrdering = paramProvider.getString("BULK_ORDERING");
+		if (bulkOrdering == "CELL_MAJOR")
+			_disc.cellMajorBulk = true;
+		else if (bulkOrdering != "COMPONENT_MAJOR")
+			throw InvalidParameterException("Unknown bulk ordering " + bulkOrdering);
+	}
+
 	// Read WENO settings and apply them
 	paramProvider.pushScope("weno");
 	_weno.order(paramProvider.getInt("WENO_ORDER"));
@@ -167,11 +252,45 @@ bool GeneralRateModel::configure(IParameterProvider& paramProvider, IConfigHelpe
 	const bool analyticJac = false;
 #endif
 
+	// Parameter derivatives of the residual are optionally computed by hand-coded expressions instead of AD
+	_analyticParamSens = paramProvider.exists("USE_ANALYTIC_PARAM_SENS") && paramProvider.getInt("USE_ANALYTIC_PARAM_SENS");
+
+	// Consistent initialization of quasi-stationary binding optionally reuses information of its previous run
+	const bool warmStartConsistentInit = paramProvider.exists("CONSISTENT_INIT_WARM_START") && paramProvider.getInt("CONSISTENT_INIT_WARM_START");
+
 	// Initialize and configure GMRES for solving the Schur-complement
 	_gmres.initialize(_disc.nCol * _disc.nComp, paramProvider.getInt("MAX_KRYLOV"), linalg::toOrthogonalization(paramProvider.getInt("GS_TYPE")), paramProvider.getInt("MAX_RESTARTS"));
 	_gmres.matrixVectorMultiplier(&schurComplementMultiplier, this);
+	_gmres.matrixPanelMultiplier(&schurComplementPanelMultiplier);
 	_schurSafety = paramProvider.getDouble("SCHUR_SAFETY");
 
+	// Optional block-Jacobi preconditioner for the Schur-complement
+	_schurPrecond = false;
+	if (paramProvider.exists("SCHUR_PRECONDITIONER"))
+	{
+		const std::string precond = paramProvider.getString("SCHUR_PRECONDITIONER");
+		if (precond == "BLOCK_JACOBI")
+			_schurPrecond = true;
+		else if (precond != "NONE")
+			throw InvalidParameterException("Unknown Schur-complement preconditioner " + precond);
+	}
+	_gmres.preconditioner(_schurPrecond ? &schurComplementPreconditioner : nullptr);
+
+	// The Schur-complement is either solved iteratively by GMRES or assembled and factorized explicitly.
+	// Alternatively, the full Jacobian is factorized by a sparse direct solver.
+	_schurDirectSolve = false;
+	_globalDirectSolve = false;
+	if (paramProvider.exists("LINEAR_SOLVER"))
+	{
+		const std::string solver = paramProvider.getString("LINEAR_SOLVER");
+		if (solver == "SCHUR_DIRECT")
+			_schurDirectSolve = true;
+		else if (solver == "SPARSE_DIRECT")
+			_globalDirectSolve = true;
+		else if (solver != "SCHUR_GMRES")
+			throw InvalidParameterException("Unknown linear solver " + solver);
+	}
+
 	paramProvider.popScope();
 
 	// ==== Read model parameters
@@ -200,20 +319,76 @@ bool GeneralRateModel::configure(IParameterProvider& paramProvider, IConfigHelpe
 		_jacP[i].resize(_disc.nPar * (_disc.nComp + _disc.strideBound), _disc.nComp + _disc.strideBound, _disc.nComp + 2 * _disc.strideBound);
 	}
 
-	_jacPF = new linalg::SparseMatrix[_disc.nCol];
-	_jacFP = new linalg::SparseMatrix[_disc.nCol];
-	for (unsigned int i = 0; i < _disc.nCol; ++i)
+	// The factorized particle blocks are also kept in a batch that solves multiple blocks at once
+	_jacPdiscBatch.resize(_disc.nCol, _disc.nPar * (_disc.nComp + _disc.strideBound), _disc.nComp + _disc.strideBound, _disc.nComp + 2 * _disc.strideBound);
+	delete[] _parBatchScratch;
+	_parBatchScratch = new double[_disc.nCol * _disc.nPar * (_disc.nComp + _disc.strideBound)];
+
+	_jacPF = new linalg::CompressedSparseMatrix[_disc.nCol];
+	_jacFP = new linalg::CompressedSparseMatrix[_disc.nCol];
+	setOffdiagJacPattern();
+
+	// Parameter sensitivities are computed with sparse AD datatypes, which also hold the discretized film diffusion
+	std::size_t paramTypeSize = sizeof(active);
+#define CADET_GRM_SPARSE_AD_MEMORY(TYPE, UNUSED1, UNUSED2)       \
+	_sparseAdMemory.resize(sizeof(TYPE) * numDofs());            \
+	paramTypeSize = std::max(paramTypeSize, sizeof(TYPE));
+
+	CADET_FOREACH_SPARSE_AD_TYPE(CADET_GRM_SPARSE_AD_MEMORY, , )
+
+#undef CADET_GRM_SPARSE_AD_MEMORY
+
+	_discParFlux.resize(paramTypeSize * _disc.nComp);
+
+	_tempState = new double[numDofs()];
+
+	_bindingWarmStart.clear();
+	if (warmStartConsistentInit && (_disc.strideBound > 0))
+	{
+		_bindingWarmStart.resize(_disc.nCol * _disc.nPar);
+		for (unsigned int i = 0; i < _bindingWarmStart.size(); ++i)
+			_bindingWarmStart[i].jacobian.resize(_disc.strideBound, _disc.strideBound);
+	}
+
+	if (_schurPrecond || _schurDirectSolve)
+	{
+		delete[] _schurPrecBlocks;
+		delete[] _schurPrecPivot;
+		delete[] _schurPrecBulk;
+		_schurPrecBlocks = new double[_disc.nCol * _disc.nComp * _disc.nComp];
+		_schurPrecPivot = new lapackInt_t[_disc.nCol * _disc.nComp];
+		_schurPrecBulk = new double[_disc.nCol * _disc.nComp];
+	}
+
+	if (_schurDirectSolve)
 	{
-		_jacPF[i].resize(_disc.nComp);
-		_jacFP[i].resize(_disc.nComp);
+		_schurMatrix.resize(_disc.nCol * _disc.nComp, _disc.nCol * _disc.nComp);
+		delete[] _schurDirectScratch;
+		_schurDirectScratch = new double[3 * _disc.nCol * _disc.nComp];
 	}
 
-	_jacCF.resize(_disc.nComp * _disc.nCol);
-	_jacFC.resize(_disc.nComp * _disc.nCol);
+	// Each bulk work item has its own stencil memory and WENO derivatives so that they can be processed
+	// concurrently. The cell-major bulk sweep holds the WENO stencils and derivatives of all components
+	// at once, and the column blocks are solved on gathered (contiguous) copies of the strided components.
+	// The stencils also have to hold the compile-time sized AD datatypes.
+	const unsigned int stencilElemSize = std::max(sizeof(active), ad::maxFixedActiveSize());
+	delete[] _stencilMemory;
+	_stencilMemory = new ArrayPool[numBulkWorkItems()];
+	for (unsigned int i = 0; i < numBulkWorkItems(); ++i)
+	{
+		if (_disc.cellMajorBulk)
+			_stencilMemory[i].resize(stencilElemSize * (Weno::maxStencilSize() + 1) * _disc.nComp);
+		else
+			_stencilMemory[i].resize(stencilElemSize * Weno::maxStencilSize());
+	}
 
-	_discParFlux.resize(sizeof(active) * _disc.nComp);
+	delete[] _wenoDerivatives;
+	_wenoDerivatives = new double[Weno::maxStencilSize() * _disc.nComp];
 
-	_tempState = new double[numDofs()];
+	delete[] _bulkScratch;
+	_bulkScratch = nullptr;
+	if (_disc.cellMajorBulk)
+		_bulkScratch = new double[_disc.nCol * _disc.nComp];
 
 	// Set whether analytic Jacobian is used
 	useAnalyticJacobian(analyticJac);
@@ -397,6 +572,9 @@ bool GeneralRateModel::setSensitiveParameter(const ParameterId& pId, unsigned in
 		// Register parameter and set AD seed / direction
 		_sensParams.insert(paramHandle->second);
 		paramHandle->second->setADValue(adDirection, adValue);
+
+		_sensParamList.push_back(SensitiveParameter{pId, paramHandle->second, adDirection, adValue, false});
+		_sensParamsAnalytic = _sensParamsAnalytic && hasAnalyticParamDerivative(pId);
 		return true;
 	}
 
@@ -411,6 +589,9 @@ bool GeneralRateModel::setSensitiveParameter(const ParameterId& pId, unsigned in
 			// Register parameter and set AD seed / direction
 			_sensParams.insert(paramBinding);
 			paramBinding->setADValue(adDirection, adValue);
+
+			_sensParamList.push_back(SensitiveParameter{pId, paramBinding, adDirection, adValue, true});
+			_sensParamsAnalytic = _sensParamsAnalytic && _binding->hasAnalyticParamDerivative(pId);
 			return true;
 		}
 	}
@@ -425,17 +606,45 @@ void GeneralRateModel::clearSensParams()
 		sp->setADValue(0.0);
 
 	_sensParams.clear();
+	_sensParamList.clear();
+	_sensParamsAnalytic = true;
 }
 
 void GeneralRateModel::useAnalyticJacobian(const bool analyticJac)
 {
 #ifndef CADET_CHECK_ANALYTIC_JACOBIAN
+	releaseFixedAdVectors();
+
 	_analyticJac = analyticJac;
+	_fixedAdDirs = 0;
 	if (!_analyticJac)
+	{
 		// We need as many directions as the highest bandwidth of the diagonal blocks:
 		// The bandwidth of the column block depends on the size of the WENO stencil, whereas
 		// the bandwidth of the particle blocks are given by the number of components and bound states.
 		_jacobianAdDirs = std::max(_jacC[0].stride(), _jacP[0].stride());
+
+		// Prefer a compile-time sized AD datatype for the Jacobian if there is one with enough directions.
+		// Then the global AD vectors only carry the parameter sensitivity directions.
+		// The AD vectors are kept alive and seeded only once, each residual evaluation just refreshes their values.
+		_fixedAdDirs = ad::fixedDirections(_jacobianAdDirs);
+		if (_fixedAdDirs > 0)
+		{
+			switch (_fixedAdDirs)
+			{
+#define CADET_GRM_FIXED_AD_MEMORY(N, UNUSED1, UNUSED2)                                             \
+				case N:                                                                              \
+					_fixedAdMemory.resize(2 * numDofs() * sizeof(fixedActive<N>));                 \
+					seedJacobianAdDirections(_fixedAdMemory.create<fixedActive<N>>(2 * numDofs()), 0); \
+					break;
+
+				CADET_FOREACH_FIXED_AD_DIRECTIONS(CADET_GRM_FIXED_AD_MEMORY, , )
+
+#undef CADET_GRM_FIXED_AD_MEMORY
+			}
+			_jacobianAdDirs = 0;
+		}
+	}
 	else
 		_jacobianAdDirs = 0;
 #else
@@ -447,6 +656,25 @@ void GeneralRateModel::useAnalyticJacobian(const bool analyticJac)
 #endif
 }
 
+/**
+ * @brief Destroys the persistent AD vectors of the compile-time sized AD datatype
+ * @details The vectors are created and seeded in useAnalyticJacobian() and used by residualWithFixedAdJacobian().
+ */
+void GeneralRateModel::releaseFixedAdVectors()
+{
+	switch (_fixedAdDirs)
+	{
+#define CADET_GRM_FIXED_AD_RELEASE(N, UNUSED1, UNUSED2)    \
+		case N:                                              \
+			_fixedAdMemory.destroy<fixedActive<N>>(); \
+			break;
+
+		CADET_FOREACH_FIXED_AD_DIRECTIONS(CADET_GRM_FIXED_AD_RELEASE, , )
+
+#undef CADET_GRM_FIXED_AD_RELEASE
+	}
+}
+
 void GeneralRateModel::notifyDiscontinuousSectionTransition(double t, unsigned int secIdx)
 {
 	// Setup flux Jacobian blocks at the beginning of the simulation
@@ -456,6 +684,15 @@ void GeneralRateModel::notifyDiscontinuousSectionTransition(double t, unsigned i
 	// Flux Jacobian blocks only change for section dependent film or particle diffusion coefficients
 	if ((_filmDiffusion.size() > _disc.nComp) || (_parDiffusion.size() > _disc.nComp))
 		assembleOffdiagJac(t, secIdx);
+
+	// Report and reset statistics of the Schur-complement solver
+	if (_gmres.numSolves() > 0)
+	{
+		LOG(Debug) << "GMRES (Schur-complement): " << _gmres.numSolves() << " solves, " << _gmres.numIterations() << " iterations ("
+			<< static_cast<double>(_gmres.numIterations()) / _gmres.numSolves() << " per solve), "
+			<< _gmres.numPreconditionerSolves() << " preconditioner applications";
+	}
+	_gmres.resetStatistics();
 }
 
 void GeneralRateModel::reportSolution(ISolutionRecorder& recorder, double const* const solution) const
@@ -488,6 +725,25 @@ void GeneralRateModel::prepareADvectors(active* const adRes, active* const adY,
 	if (!adY)
 		return;
 
+	// The Jacobian does not need directions in the global AD vectors if it is computed analytically
+	// or by compile-time sized AD datatypes (their seed vectors are set on each evaluation).
+	// Since the AD vectors only have room for the parameter sensitivity directions in this case,
+	// seeding would write past their gradients.
+	if (_jacobianAdDirs == 0)
+		return;
+
+	seedJacobianAdDirections(adY, numSensAdDirs);
+}
+
+/**
+ * @brief Sets the band compressed seed vectors for computing the system Jacobian
+ * @param [in,out] adY State vector of AD datatypes
+ * @param [in] numSensAdDirs Number of AD directions used for parameter sensitivities
+ * @tparam AdType AD datatype
+ */
+template <typename AdType>
+void GeneralRateModel::seedJacobianAdDirections(AdType* const adY, unsigned int numSensAdDirs) const
+{
 	Indexer idxr(_disc);
 
 	// Get bandwidths of blocks
@@ -499,7 +755,7 @@ void GeneralRateModel::prepareADvectors(active* const adRes, active* const adY,
 	// Column block	
 	for (int comp = 0; comp < static_cast<int>(_disc.nComp); ++comp)
 	{
-		ad::prepareAdVectorSeedsForBandMatrix(adY + comp * idxr.strideColComp(), numSensAdDirs, _disc.nCol, lowerColBandwidth, upperColBandwidth, lowerColBandwidth);
+		ad::prepareAdVectorSeedsForBandMatrix(adY + comp * idxr.strideColComp(), numSensAdDirs, _disc.nCol, lowerColBandwidth, upperColBandwidth, lowerColBandwidth, idxr.strideColCell());
 	}
 
 	// Particle blocks
@@ -513,14 +769,16 @@ void GeneralRateModel::prepareADvectors(active* const adRes, active* const adY,
  * @brief Extracts the system Jacobian from band compressed AD seed vectors
  * @param [in] adRes Residual vector of AD datatypes with band compressed seed vectors
  * @param [in] numSensAdDirs Number of AD directions used for parameter sensitivities
+ * @tparam AdType AD datatype
  */
-void GeneralRateModel::extractJacobianFromAD(active const* const adRes, unsigned int numSensAdDirs)
+template <typename AdType>
+void GeneralRateModel::extractJacobianFromAD(AdType const* const adRes, unsigned int numSensAdDirs)
 {
 	Indexer idxr(_disc);
 
 	// Column
 	for (int comp = 0; comp < static_cast<int>(_disc.nComp); ++comp)
-		ad::extractBandedJacobianFromAd(adRes + comp * idxr.strideColComp(), numSensAdDirs, _jacC[comp].lowerBandwidth(), _jacC[comp]);
+		ad::extractBandedJacobianFromAd(adRes + comp * idxr.strideColComp(), numSensAdDirs, _jacC[comp].lowerBandwidth(), _jacC[comp], idxr.strideColCell());
 
 	// Particles
 	for (unsigned int pblk = 0; pblk < _disc.nCol; ++pblk)
@@ -547,7 +805,7 @@ void GeneralRateModel::checkAnalyticJacobianAgainstAd(active const* const adRes,
 	// Column
 	for (int comp = 0; comp < static_cast<int>(_disc.nComp); ++comp)
 	{
-		const double localDiff = ad::compareBandedJacobianWithAd(adRes + comp * idxr.strideColComp(), numSensAdDirs, _jacC[comp].lowerBandwidth(), _jacC[comp]);
+		const double localDiff = ad::compareBandedJacobianWithAd(adRes + comp * idxr.strideColComp(), numSensAdDirs, _jacC[comp].lowerBandwidth(), _jacC[comp], idxr.strideColCell());
 		LOG(Debug) << "-> Col block diff " << comp << ": " << localDiff;
 		maxDiffCol = std::max(maxDiffCol, localDiff);
 	}
@@ -587,13 +845,14 @@ int GeneralRateModel::residual(const active& t, unsigned int secIdx, const activ
 	if (updateJacobian)
 	{
 		_factorizeJacobian = true;
+		_factorizeJacobianAdj = true;
 
 #ifndef CADET_CHECK_ANALYTIC_JACOBIAN
 		if (_analyticJac)
 		{
 			if (paramSensitivity)
 			{
-				const int retCode = residualImpl<double, active, active, true>(t, secIdx, timeFactor, y, yDot, adRes);
+				const int retCode = residualParamSensitivity<true>(t, secIdx, timeFactor, y, yDot, adRes);
 
 				// Copy AD residuals to original residuals vector
 				if (res)
@@ -604,19 +863,40 @@ int GeneralRateModel::residual(const active& t, unsigned int secIdx, const activ
 			else
 				return residualImpl<double, double, double, true>(static_cast<double>(t), secIdx, static_cast<double>(timeFactor), y, yDot, res);
 		}
+		else if (_fixedAdDirs > 0)
+		{
+			// Compute Jacobian via compile-time sized AD datatypes
+			int retCode = 0;
+			switch (_fixedAdDirs)
+			{
+#define CADET_GRM_FIXED_AD_RESIDUAL(N, UNUSED1, UNUSED2)                                                                                      \
+				case N:                                                                                                                         \
+					retCode = residualWithFixedAdJacobian<N>(static_cast<double>(t), secIdx, static_cast<double>(timeFactor), y, yDot, res); \
+					break;
+
+				CADET_FOREACH_FIXED_AD_DIRECTIONS(CADET_GRM_FIXED_AD_RESIDUAL, , )
+
+#undef CADET_GRM_FIXED_AD_RESIDUAL
+			}
+
+			if (!paramSensitivity || (retCode != 0))
+				return retCode;
+
+			// Parameter derivatives are computed separately using the AD vectors that only carry sensitivity directions
+			return residualParamSensitivity<false>(t, secIdx, timeFactor, y, yDot, adRes);
+		}
 		else
 		{
 			// Compute Jacobian via AD
 
-			// Copy over state vector to AD state vector (without changing directional values to keep seed vectors)
-			// and initalize residuals with zero (also resetting directional values)
+			// Copy over state vector to AD state vector (without changing directional values to keep seed vectors).
+			// The residuals are not reset since residualImpl() assigns (values and directions of) every element
+			// before accumulating into it.
 			ad::copyToAd(y, adY, numDofs());
-			// @todo Check if this is necessary
-			ad::resetAd(adRes, numDofs());
 
 			// Evaluate with AD enabled
 			int retCode = 0;
-			if (paramSensitivity)
+			if (paramSensitivity && !(_analyticParamSens && _sensParamsAnalytic))
 				retCode = residualImpl<active, active, active, false>(t, secIdx, timeFactor, adY, yDot, adRes);
 			else
 				retCode = residualImpl<active, active, double, false>(static_cast<double>(t), secIdx, static_cast<double>(timeFactor), adY, yDot, adRes);
@@ -628,16 +908,18 @@ int GeneralRateModel::residual(const active& t, unsigned int secIdx, const activ
 			// Extract Jacobian
 			extractJacobianFromAD(adRes, numSensAdDirs);
 
+			// Analytic parameter derivatives overwrite the AD residuals used for the Jacobian
+			if (paramSensitivity && (retCode == 0) && _analyticParamSens && _sensParamsAnalytic)
+				retCode = residualParamSensitivity<false>(t, secIdx, timeFactor, y, yDot, adRes);
+
 			return retCode;
 		}
 #else
 		// Compute Jacobian via AD
 
-		// Copy over state vector to AD state vector (without changing directional values to keep seed vectors)
-		// and initalize residuals with zero (also resetting directional values)
+		// Copy over state vector to AD state vector (without changing directional values to keep seed vectors).
+		// The residuals are not reset since residualImpl() assigns every element before accumulating into it.
 		ad::copyToAd(y, adY, numDofs());
-		// @todo Check if this is necessary
-		ad::resetAd(adRes, numDofs());
 
 		// Evaluate with AD enabled
 		int retCode = 0;
@@ -666,11 +948,7 @@ int GeneralRateModel::residual(const active& t, unsigned int secIdx, const activ
 	{
 		if (paramSensitivity)
 		{
-			// Initalize residuals with zero
-			// @todo Check if this is necessary
-			ad::resetAd(adRes, numDofs());
-
-			const int retCode = residualImpl<double, active, active, false>(t, secIdx, timeFactor, y, yDot, adRes);
+			const int retCode = residualParamSensitivity<false>(t, secIdx, timeFactor, y, yDot, adRes);
 
 			// Copy AD residuals to original residuals vector
 			if (res)
@@ -683,6 +961,100 @@ int GeneralRateModel::residual(const active& t, unsigned int secIdx, const activ
 	}
 }
 
+/**
+ * @brief Evaluates the residual and its derivatives with respect to the sensitive parameters
+ * @details If enabled and available for all sensitive parameters, the derivatives are computed by
+ *          analyticParamSensitivity(). Otherwise, they are computed with the sparse AD datatype (see sparseActive)
+ *          if available, which only propagates the directions of the parameters each quantity actually depends on.
+ *          The results are stored in the (dense) AD residual vector @p adRes.
+ * @param [in] t Current time point
+ * @param [in] secIdx Index of the current section
+ * @param [in] timeFactor Used for time transformation (pre factor of time derivatives)
+ * @param [in] y Pointer to state vector
+ * @param [in] yDot Pointer to time derivative state vector
+ * @param [out] adRes Pointer to residual vector of AD datatypes
+ * @return @c 0 on success, @c -1 on non-recoverable error, and @c +1 on recoverable error
+ * @tparam wantJac Determines whether the analytic Jacobian is assembled
+ */
+template <bool wantJac>
+int GeneralRateModel::residualParamSensitivity(const active& t, unsigned int secIdx, const active& timeFactor, double const* const y, double const* const yDot, active* const adRes)
+{
+	if (_analyticParamSens && _sensParamsAnalytic)
+	{
+		// Evaluate the residual without AD and add hand-coded parameter derivatives
+		const int retCode = residualImpl<double, double, double, wantJac>(static_cast<double>(t), secIdx, static_cast<double>(timeFactor), y, yDot, _tempState);
+		if (retCode != 0)
+			return retCode;
+
+		return analyticParamSensitivity(t, secIdx, timeFactor, y, yDot, adRes);
+	}
+
+#define CADET_GRM_SPARSE_AD_RESIDUAL(TYPE, UNUSED1, UNUSED2) \
+	return residualWithSparseAd<TYPE, wantJac>(t, secIdx, timeFactor, y, yDot, adRes);
+
+	CADET_FOREACH_SPARSE_AD_TYPE(CADET_GRM_SPARSE_AD_RESIDUAL, , )
+
+#undef CADET_GRM_SPARSE_AD_RESIDUAL
+
+	// Residuals are not reset since every element is assigned in residualImpl()
+	return residualImpl<double, active, active, wantJac>(t, secIdx, timeFactor, y, yDot, adRes);
+}
+
+/**
+ * @brief Evaluates the residual and its parameter derivatives using sparse AD datatypes
+ * @details See residualParamSensitivity().
+ * @tparam SparseType Sparse AD datatype
+ * @tparam wantJac Determines whether the analytic Jacobian is assembled
+ */
+template <typename SparseType, bool wantJac>
+int GeneralRateModel::residualWithSparseAd(const active& t, unsigned int secIdx, const active& timeFactor, double const* const y, double const* const yDot, active* const adRes)
+{
+	// Creating the vector resets values and directional derivatives
+	SparseType* const sparseRes = _sparseAdMemory.create<SparseType>(numDofs());
+
+	const int retCode = residualImpl<double, SparseType, SparseType, wantJac>(SparseType(t), secIdx, SparseType(timeFactor), y, yDot, sparseRes);
+
+	ad::copyFromSparseAd(sparseRes, adRes, numDofs());
+
+	_sparseAdMemory.destroy<SparseType>();
+	return retCode;
+}
+
+/**
+ * @brief Evaluates the residual and computes the Jacobian using compile-time sized AD datatypes
+ * @details The number of directions @p N is chosen by ad::fixedDirections() to hold the band compressed
+ *          seed vectors of the diagonal blocks. Since the size of the gradients is known at compile time,
+ *          the compiler can unroll and vectorize the derivative loops. The AD vectors and their seed
+ *          vectors persist between calls (see useAnalyticJacobian()), only the state values are refreshed.
+ * @param [in] t Current time point
+ * @param [in] secIdx Index of the current section
+ * @param [in] timeFactor Used for time transformation (pre factor of time derivatives)
+ * @param [in] y Pointer to state vector
+ * @param [in] yDot Pointer to time derivative state vector
+ * @param [out] res Pointer to residual vector (may be @c nullptr)
+ * @return @c 0 on success, @c -1 on non-recoverable error, and @c +1 on recoverable error
+ * @tparam N Number of AD directions
+ */
+template <unsigned int N>
+int GeneralRateModel::residualWithFixedAdJacobian(double t, unsigned int secIdx, double timeFactor, double const* const y, double const* const yDot, double* const res)
+{
+	// Seed vectors are kept, residuals are completely overwritten by residualImpl()
+	fixedActive<N>* const adY = _fixedAdMemory.array<fixedActive<N>>();
+	fixedActive<N>* const adRes = adY + numDofs();
+
+	ad::copyToAd(y, adY, numDofs());
+
+	const int retCode = residualImpl<fixedActive<N>, fixedActive<N>, double, false>(t, secIdx, timeFactor, adY, yDot, adRes);
+
+	// Copy AD residuals to original residuals vector
+	if (res)
+		ad::copyFromAd(adRes, res, numDofs());
+
+	extractJacobianFromAD(adRes, 0);
+
+	return retCode;
+}
+
 double GeneralRateModel::residualNorm(double t, unsigned int secIdx, double timeFactor, double const* const y, double const* const yDot)
 {
 	// We use the _tempState vector to store the residual
@@ -701,25 +1073,77 @@ int GeneralRateModel::residualImpl(const ParamType& t, unsigned int secIdx, cons
 
 	BENCH_START(_timerResidualPar);
 
-	#pragma omp parallel for schedule(static)
-	for (ompuint_t pblk = 0; pblk <= _disc.nCol; ++pblk)
+	// Discretized film diffusion kf for finite volumes, shared by all threads in residualFlux()
+	ParamType* const kf_FV = _discParFlux.create<ParamType>(_disc.nComp);
+	discretizedFilmDiffusion<ParamType>(secIdx, kf_FV);
+
+	// Work items are the bulk components (whole bulk in cell-major ordering) followed by the particle blocks.
+	// The expensive bulk items come first and are handed out one by one so that the remaining threads
+	// process the particle blocks in the meantime.
+	const unsigned int numBulkItems = numBulkWorkItems();
+	const std::size_t numADdirs = ad::getDirections();
+	int retCode = 0;
+
+	#pragma omp parallel
 	{
-		if (cadet_unlikely(pblk == 0))
-			residualBulk<StateType, ResidualType, ParamType, wantJac>(t, secIdx, timeFactor, y, yDot, res);
-		else
-			residualParticle<StateType, ResidualType, ParamType, wantJac>(t, pblk-1, secIdx, timeFactor, y, yDot, res);
+		// Worker threads use the number of AD directions of the calling thread
+		ad::setDirections(numADdirs);
+
+		#pragma omp for schedule(dynamic, 1)
+		for (ompuint_t item = 0; item < numBulkItems + _disc.nCol; ++item)
+		{
+			int result = 0;
+			if (item < numBulkItems)
+				result = residualBulk<StateType, ResidualType, ParamType, wantJac>(t, secIdx, timeFactor, y, yDot, res, item);
+			else
+				result = residualParticle<StateType, ResidualType, ParamType, wantJac>(t, item - numBulkItems, secIdx, timeFactor, y, yDot, res);
+
+			if (cadet_unlikely(result != 0))
+			{
+				#pragma omp critical
+				{
+					// Non-recoverable errors take precedence over recoverable ones
+					if ((retCode == 0) || (result < 0))
+						retCode = result;
+				}
+			}
+		}
+
+		// The flux contributions are added to the complete bulk and particle residuals (implicit barrier above)
+		residualFlux<StateType, ResidualType, ParamType>(t, secIdx, kf_FV, y, yDot, res);
 	}
 
+	_discParFlux.destroy<ParamType>();
+
 	BENCH_STOP(_timerResidualPar);
 
-	residualFlux<StateType, ResidualType, ParamType>(t, secIdx, y, yDot, res);
+	return retCode;
+}
 
-	return 0;
+/**
+ * @brief Returns the number of independent work items of the bulk residual
+ * @details In component-major ordering, each component is a work item. In cell-major ordering,
+ *          the whole bulk is treated in a single sweep.
+ * @return Number of bulk work items
+ */
+unsigned int GeneralRateModel::numBulkWorkItems() const CADET_NOEXCEPT
+{
+	return _disc.cellMajorBulk ? 1 : _disc.nComp;
 }
 
+/**
+ * @brief Computes the bulk residual of one work item
+ * @details Each work item uses its own stencil memory and WENO derivative buffer, and writes
+ *          only to its own part of the residual and its own Jacobian blocks. Hence, different
+ *          work items can be computed concurrently.
+ * @param [in] item Index of the work item (component index in component-major ordering), see numBulkWorkItems()
+ */
 template <typename StateType, typename ResidualType, typename ParamType, bool wantJac>
-int GeneralRateModel::residualBulk(const ParamType& t, unsigned int secIdx, const ParamType& timeFactor, StateType const* y, double const* yDot, ResidualType* res)
+int GeneralRateModel::residualBulk(const ParamType& t, unsigned int secIdx, const ParamType& timeFactor, StateType const* y, double const* yDot, ResidualType* res, unsigned int item)
 {
+	if (_disc.cellMajorBulk)
+		return residualBulkCellMajor<StateType, ResidualType, ParamType, wantJac>(t, secIdx, timeFactor, y, yDot, res);
+
 	const ParamType u = static_cast<ParamType>(getSectionDependentScalar(_velocity, secIdx));
 	const ParamType d_c = static_cast<ParamType>(getSectionDependentScalar(_colDispersion, secIdx));
 	const ParamType h = static_cast<ParamType>(_colLength) / static_cast<double>(_disc.nCol);
@@ -729,55 +1153,208 @@ int GeneralRateModel::residualBulk(const ParamType& t, unsigned int secIdx, cons
 
 	// The stencil caches parts of the state vector for better spatial coherence
 	typedef CachingStencil<StateType, ArrayPool> StencilType;
-	StencilType stencil(std::max(_weno.stencilSize(), 3u), _stencilMemory, std::max(_weno.order() - 1, 1));
+	StencilType stencil(std::max(_weno.stencilSize(), 3u), _stencilMemory[item], std::max(_weno.order() - 1, 1));
 
-	for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
+	// Buffer for WENO derivatives of this work item
+	double* const wenoDerivatives = _wenoDerivatives + item * Weno::maxStencilSize();
+
+	const unsigned int comp = item;
+
+	// Reset Jacobian
+	if (wantJac)
+		_jacC[comp].setAll(0.0);
+
+	// The RowIterator is always centered on the main diagonal.
+	// This means that jac[0] is the main diagonal, jac[-1] is the first lower diagonal,
+	// and jac[1] is the first upper diagonal. We can also access the rows from left to
+	// right beginning with the last lower diagonal moving towards the main diagonal and
+	// continuing to the last upper diagonal by using the native() method.
+	linalg::BandMatrix::RowIterator jac = _jacC[comp].row(0);
+
+	// Add time derivative to each cell
+	if (yDot)
 	{
-		// Reset Jacobian
-		if (wantJac)
-			_jacC[comp].setAll(0.0);
+		for (unsigned int col = 0; col < _disc.nCol; ++col)
+			idxr.c<ResidualType>(res, col, comp) = timeFactor * idxr.c<double>(yDot, col, comp);
+	}
+	else
+	{
+		for (unsigned int col = 0; col < _disc.nCol; ++col)
+			idxr.c<ResidualType>(res, col, comp) = 0.0;
+	}
+
+	// Fill stencil (left side with zeros, right side with states)
+	for (int i = -std::max(_weno.order(), 2) + 1; i < 0; ++i)
+		stencil[i] = 0.0;
+	for (int i = 0; i < std::max(_weno.order(), 2); ++i)
+		stencil[i] = idxr.c<StateType>(y, static_cast<unsigned int>(i), comp);
 
-		// The RowIterator is always centered on the main diagonal.
-		// This means that jac[0] is the main diagonal, jac[-1] is the first lower diagonal,
-		// and jac[1] is the first upper diagonal. We can also access the rows from left to
-		// right beginning with the last lower diagonal moving towards the main diagonal and
-		// continuing to the last upper diagonal by using the native() method.
-		linalg::BandMatrix::RowIterator jac = _jacC[comp].row(0);
+	// Reset WENO output
+	StateType vm(0.0); // reconstructed value
+	for (unsigned int i = 0; i < _weno.stencilSize(); ++i)
+		wenoDerivatives[i] = 0.0;
+
+	int wenoOrder = 0;
+
+	// Iterate over all cells
+	for (unsigned int col = 0; col < _disc.nCol; ++col)
+	{
+		// ------------------- Dispersion -------------------
 
-		// Add time derivative to each cell
-		if (yDot)
+		// Right side, leave out if we're in the last cell (boundary condition)
+		if (cadet_likely(col < _disc.nCol - 1))
 		{
-			for (unsigned int col = 0; col < _disc.nCol; ++col)
-				idxr.c<ResidualType>(res, col, comp) = timeFactor * idxr.c<double>(yDot, col, comp);
+			idxr.c<ResidualType>(res, col, comp) -= d_c / h2 * (stencil[1] - stencil[0]);
+			// Jacobian entries
+			if (wantJac)
+			{
+				jac[0] += static_cast<double>(d_c) / static_cast<double>(h2);
+				jac[1] -= static_cast<double>(d_c) / static_cast<double>(h2);
+			}
+		}
+
+		// Left side, leave out if we're in the first cell (boundary condition)
+		if (cadet_likely(col > 0))
+		{
+			idxr.c<ResidualType>(res, col, comp) -= d_c / h2 * (stencil[-1] - stencil[0]);
+			// Jacobian entries
+			if (wantJac)
+			{
+				jac[0]  += static_cast<double>(d_c) / static_cast<double>(h2);
+				jac[-1] -= static_cast<double>(d_c) / static_cast<double>(h2);
+			}
+		}
+
+		// ------------------- Convection -------------------
+
+		// Add convection through this cell's left face
+		if (cadet_likely(col > 0))
+		{
+			// Remember that vm still contains the reconstructed value of the previous 
+			// cell's *right* face, which is identical to this cell's *left* face!
+			idxr.c<ResidualType>(res, col, comp) -= u / h * vm;
+
+			// Jacobian entries
+			if (wantJac)
+			{
+				for (int i = 0; i < 2 * wenoOrder - 1; ++i)
+					// Note that we have an offset of -1 here (compared to the right cell face below), since
+					// the reconstructed value depends on the previous stencil (which has now been moved by one cell)
+					jac[i - wenoOrder] -= static_cast<double>(u) / static_cast<double>(h) * wenoDerivatives[i];
+			}
 		}
 		else
 		{
-			for (unsigned int col = 0; col < _disc.nCol; ++col)
-				idxr.c<ResidualType>(res, col, comp) = 0.0;
+			// In the first cell we need to apply the boundary condition: inflow concentration
+//			idxr.c<ResidualType>(res, col, comp) -= u / h * inlet[comp];
 		}
 
-		// Fill stencil (left side with zeros, right side with states)
-		for (int i = -std::max(_weno.order(), 2) + 1; i < 0; ++i)
-			stencil[i] = 0.0;
-		for (int i = 0; i < std::max(_weno.order(), 2); ++i)
-			stencil[i] = idxr.c<StateType>(y, static_cast<unsigned int>(i), comp);
+		// Reconstruct concentration on this cell's right face
+		wenoOrder = _weno.reconstruct<StateType, StencilType, wantJac>(_wenoEpsilon, col, _disc.nCol, stencil, vm, wenoDerivatives);
 
-		// Reset WENO output
-		StateType vm(0.0); // reconstructed value
-		for (unsigned int i = 0; i < _weno.stencilSize(); ++i)
-			_wenoDerivatives[i] = 0.0;
+		// Right side
+		idxr.c<ResidualType>(res, col, comp) += u / h * vm;
+		// Jacobian entries
+		if (wantJac)
+		{
+			for (int i = 0; i < 2 * wenoOrder - 1; ++i)
+				jac[i - wenoOrder + 1] += static_cast<double>(u) / static_cast<double>(h) * wenoDerivatives[i];
+		}
+
+		// Update stencil
+		stencil.advance(idxr.c<StateType>(y, col + std::max(_weno.order(), 2), comp));
+		++jac;
+	}
 
-		int wenoOrder = 0;
 
-		// Iterate over all cells
-		for (unsigned int col = 0; col < _disc.nCol; ++col)
+	// Film diffusion with flux into beads is added in residualFlux() function
+
+	return 0;
+}
+
+/**
+ * @brief Computes the bulk residual for cell-major ordering of the bulk states
+ * @details All components of a column cell are contiguous in the state vector. Instead of sweeping over the
+ *          column once per component, the column is traversed a single time. A window holding the stencils of
+ *          all components is moved along the column and the face values of all components of a cell are
+ *          reconstructed at once by Weno::reconstructBatch().
+ *          The Jacobian is still assembled into the per-component band matrices @c _jacC.
+ */
+template <typename StateType, typename ResidualType, typename ParamType, bool wantJac>
+int GeneralRateModel::residualBulkCellMajor(const ParamType& t, unsigned int secIdx, const ParamType& timeFactor, StateType const* y, double const* yDot, ResidualType* res)
+{
+	const ParamType u = static_cast<ParamType>(getSectionDependentScalar(_velocity, secIdx));
+	const ParamType d_c = static_cast<ParamType>(getSectionDependentScalar(_colDispersion, secIdx));
+	const ParamType h = static_cast<ParamType>(_colLength) / static_cast<double>(_disc.nCol);
+	const ParamType h2 = h * h;
+
+	Indexer idxr(_disc);
+
+	const unsigned int nComp = _disc.nComp;
+	const int nCol = static_cast<int>(_disc.nCol);
+
+	// Number of cells on each side of the current cell held in the window
+	const int halfWidth = std::max(_weno.order(), 2) - 1;
+	const int windowCells = 2 * halfWidth + 1;
+
+	// The window stores the stencils of all components (cell-major), followed by the reconstructed
+	// face values vm of all components
+	StateType* const window = _stencilMemory[0].create<StateType>((windowCells + 1) * nComp);
+	StateType* const vm = window + windowCells * nComp;
+	StateType const* const center = window + halfWidth * nComp;
+
+	// Fill window (left side and cells beyond the column outlet with zeros, rest with states)
+	for (int i = -halfWidth; i <= halfWidth; ++i)
+	{
+		StateType* const cell = window + (i + halfWidth) * nComp;
+		if ((i >= 0) && (i < nCol))
+			std::copy(idxr.c<StateType>(y) + i * idxr.strideColCell(), idxr.c<StateType>(y) + i * idxr.strideColCell() + nComp, cell);
+		else
+			std::fill(cell, cell + nComp, StateType(0.0));
+	}
+
+	// Reset WENO output
+	std::fill(_wenoDerivatives, _wenoDerivatives + Weno::maxStencilSize() * nComp, 0.0);
+
+	// Add time derivative to each cell
+	ResidualType* const resBulk = idxr.c<ResidualType>(res);
+	if (yDot)
+	{
+		double const* const yDotBulk = idxr.c<double>(yDot);
+		for (unsigned int i = 0; i < _disc.nCol * nComp; ++i)
+			resBulk[i] = timeFactor * yDotBulk[i];
+	}
+	else
+		std::fill(resBulk, resBulk + _disc.nCol * nComp, ResidualType(0.0));
+
+	if (wantJac)
+	{
+		for (unsigned int comp = 0; comp < nComp; ++comp)
+			_jacC[comp].setAll(0.0);
+	}
+
+	// WENO order used in the previous cell (i.e., for this cell's left face)
+	int prevWenoOrder = 0;
+
+	// Iterate over all cells
+	for (int col = 0; col < nCol; ++col)
+	{
+		ResidualType* const resCell = resBulk + col * idxr.strideColCell();
+
+		for (unsigned int comp = 0; comp < nComp; ++comp)
 		{
+			StateType const* const stencil = center + comp;
+			double const* const wenoDerivatives = _wenoDerivatives + comp * Weno::maxStencilSize();
+
+			// The RowIterator is always centered on the main diagonal (see residualBulk())
+			linalg::BandMatrix::RowIterator jac = _jacC[comp].row(col);
+
 			// ------------------- Dispersion -------------------
 
 			// Right side, leave out if we're in the last cell (boundary condition)
-			if (cadet_likely(col < _disc.nCol - 1))
+			if (cadet_likely(col < nCol - 1))
 			{
-				idxr.c<ResidualType>(res, col, comp) -= d_c / h2 * (stencil[1] - stencil[0]);
+				resCell[comp] -= d_c / h2 * (stencil[nComp] - stencil[0]);
 				// Jacobian entries
 				if (wantJac)
 				{
@@ -789,7 +1366,7 @@ int GeneralRateModel::residualBulk(const ParamType& t, unsigned int secIdx, cons
 			// Left side, leave out if we're in the first cell (boundary condition)
 			if (cadet_likely(col > 0))
 			{
-				idxr.c<ResidualType>(res, col, comp) -= d_c / h2 * (stencil[-1] - stencil[0]);
+				resCell[comp] -= d_c / h2 * (stencil[-static_cast<int>(nComp)] - stencil[0]);
 				// Jacobian entries
 				if (wantJac)
 				{
@@ -803,43 +1380,53 @@ int GeneralRateModel::residualBulk(const ParamType& t, unsigned int secIdx, cons
 			// Add convection through this cell's left face
 			if (cadet_likely(col > 0))
 			{
-				// Remember that vm still contains the reconstructed value of the previous 
-				// cell's *right* face, which is identical to this cell's *left* face!
-				idxr.c<ResidualType>(res, col, comp) -= u / h * vm;
+				// vm still contains the reconstructed value of the previous cell's right face
+				resCell[comp] -= u / h * vm[comp];
 
 				// Jacobian entries
 				if (wantJac)
 				{
-					for (int i = 0; i < 2 * wenoOrder - 1; ++i)
-						// Note that we have an offset of -1 here (compared to the right cell face below), since
-						// the reconstructed value depends on the previous stencil (which has now been moved by one cell)
-						jac[i - wenoOrder] -= static_cast<double>(u) / static_cast<double>(h) * static_cast<double>(_wenoDerivatives[i]);
+					for (int i = 0; i < 2 * prevWenoOrder - 1; ++i)
+						jac[i - prevWenoOrder] -= static_cast<double>(u) / static_cast<double>(h) * wenoDerivatives[i];
 				}
 			}
-			else
-			{
-				// In the first cell we need to apply the boundary condition: inflow concentration
-//				idxr.c<ResidualType>(res, col, comp) -= u / h * inlet[comp];
-			}
+		}
 
-			// Reconstruct concentration on this cell's right face
-			wenoOrder = _weno.reconstruct<StateType, StencilType, wantJac>(_wenoEpsilon, col, _disc.nCol, stencil, vm, _wenoDerivatives);
+		// Reconstruct concentrations of all components on this cell's right face
+		const int wenoOrder = _weno.reconstructBatch<StateType, wantJac>(_wenoEpsilon, col, _disc.nCol, center, nComp, vm, _wenoDerivatives, Weno::maxStencilSize());
+
+		// Right side
+		for (unsigned int comp = 0; comp < nComp; ++comp)
+		{
+			resCell[comp] += u / h * vm[comp];
 
-			// Right side
-			idxr.c<ResidualType>(res, col, comp) += u / h * vm;
 			// Jacobian entries
 			if (wantJac)
 			{
+				linalg::BandMatrix::RowIterator jac = _jacC[comp].row(col);
+				double const* const wenoDerivatives = _wenoDerivatives + comp * Weno::maxStencilSize();
 				for (int i = 0; i < 2 * wenoOrder - 1; ++i)
-					jac[i - wenoOrder + 1] += static_cast<double>(u) / static_cast<double>(h) * _wenoDerivatives[i];
+					jac[i - wenoOrder + 1] += static_cast<double>(u) / static_cast<double>(h) * wenoDerivatives[i];
 			}
+		}
+
+		prevWenoOrder = wenoOrder;
+
+		// Move window to next cell
+		std::copy(window + nComp, window + windowCells * nComp, window);
 
-			// Update stencil
-			stencil.advance(idxr.c<StateType>(y, col + std::max(_weno.order(), 2), comp));
-			++jac;
+		StateType* const lastCell = window + (windowCells - 1) * nComp;
+		if (col + halfWidth + 1 < nCol)
+		{
+			StateType const* const src = idxr.c<StateType>(y) + (col + halfWidth + 1) * idxr.strideColCell();
+			std::copy(src, src + nComp, lastCell);
 		}
+		else
+			std::fill(lastCell, lastCell + nComp, StateType(0.0));
 	}
 
+	_stencilMemory[0].destroy<StateType>();
+
 	// Film diffusion with flux into beads is added in residualFlux() function
 
 	return 0;
@@ -879,6 +1466,9 @@ int GeneralRateModel::residualParticle(const ParamType& t, unsigned int colCell,
 	// continuing to the last upper diagonal by using the native() method.
 	linalg::BandMatrix::RowIterator jac = _jacP[colCell].row(0);
 
+	// Cheap binding models evaluate all shells in one call after the transport terms (not available for AD types)
+	const bool batchBinding = std::is_same<StateType, double>::value && std::is_same<ResidualType, double>::value && _binding->supportsBatchEvaluation();
+
 	// Loop over particle cells
 	for (unsigned int par = 0; par < _disc.nPar; ++par)
 	{
@@ -1000,11 +1590,17 @@ int GeneralRateModel::residualParticle(const ParamType& t, unsigned int colCell,
 		if (!yDotBase)
 			yDot = nullptr;
 
-		_binding->residual(t, z, _parCenterRadius[par], secIdx, timeFactor, y, yDot, res);
-		if (wantJac)
+		if (!batchBinding)
 		{
-			// static_cast should be sufficient here, but this statement is also analyzed when wantJac = false
-			_binding->analyticJacobian(static_cast<double>(t), z, _parCenterRadius[par], secIdx, reinterpret_cast<double const*>(y), jac);
+			const int retCode = _binding->residual(t, z, _parCenterRadius[par], secIdx, timeFactor, y, yDot, res);
+			if (cadet_unlikely(retCode != 0))
+				return retCode;
+
+			if (wantJac)
+			{
+				// static_cast should be sufficient here, but this statement is also analyzed when wantJac = false
+				_binding->analyticJacobian(static_cast<double>(t), z, _parCenterRadius[par], secIdx, reinterpret_cast<double const*>(y), jac);
+			}
 		}
 
 		// Advance pointers over all bound states
@@ -1013,15 +1609,33 @@ int GeneralRateModel::residualParticle(const ParamType& t, unsigned int colCell,
 		res += idxr.strideParBound();
 		jac += idxr.strideParBound();
 	}
+
+	if (batchBinding)
+	{
+		// Bound phases of all shells, the first bound state of each shell is strideParShell() apart.
+		// The batch is confined to the column cell, which is the work item of the calling thread.
+		const unsigned int offsetBound = idxr.offsetCp(colCell) + idxr.strideParLiquid();
+		if (wantJac)
+		{
+			// Residual and Jacobian are evaluated together, which allows sharing intermediate results
+			return bindingResidualWithJacobianBatch(*_binding, t, z, _parCenterRadius.data(), secIdx, timeFactor, _disc.nPar, idxr.strideParShell(),
+				yBase + offsetBound, yDotBase ? yDotBase + offsetBound : nullptr, resBase + offsetBound, _jacP[colCell].row(idxr.strideParLiquid()));
+		}
+
+		return bindingResidualBatch(*_binding, t, z, _parCenterRadius.data(), secIdx, timeFactor, _disc.nPar, idxr.strideParShell(),
+			yBase + offsetBound, yDotBase ? yDotBase + offsetBound : nullptr, resBase + offsetBound);
+	}
 	return 0;
 }
 
-template <typename StateType, typename ResidualType, typename ParamType>
-int GeneralRateModel::residualFlux(const ParamType& t, unsigned int secIdx, StateType const* yBase, double const* yDotBase, ResidualType* resBase)
+/**
+ * @brief Computes the discretized film diffusion coefficients @f$ k_{f,FV} @f$ for finite volumes
+ * @param [in] secIdx Index of the current section
+ * @param [out] kf_FV Array with discretized film diffusion coefficient of each component
+ */
+template <typename ParamType>
+void GeneralRateModel::discretizedFilmDiffusion(unsigned int secIdx, ParamType* const kf_FV) const
 {
-	Indexer idxr(_disc);
-
-	const ParamType invBetaC = 1.0 / static_cast<ParamType>(_colPorosity) - 1.0;
 	const ParamType epsP = static_cast<ParamType>(_parPorosity);
 	const ParamType radius = static_cast<ParamType>(_parRadius);
 
@@ -1030,20 +1644,33 @@ int GeneralRateModel::residualFlux(const ParamType& t, unsigned int secIdx, Stat
 	// bnd0comp0, bnd0comp1, bnd0comp2, bnd1comp0, bnd1comp1, bnd1comp2
 	active const* const parDiff = getSectionDependentSlice(_parDiffusion, _disc.nComp, secIdx);
 
-	const ParamType surfaceToVolumeRatio = 3.0 / radius;
-	const ParamType outerAreaPerVolume = _parOuterSurfAreaPerVolume[0] / radius;
-
-	const ParamType jacCF_val = invBetaC * surfaceToVolumeRatio;
-	const ParamType jacPF_val = -outerAreaPerVolume / epsP;
-
-	// Discretized film diffusion kf for finite volumes
-	ParamType* const kf_FV = _discParFlux.create<ParamType>(_disc.nComp);
-
 	const double relOuterShellHalfRadius = 0.5 * _parCellSize[0];
 	for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
 	{
 		kf_FV[comp] = 1.0 / (radius * relOuterShellHalfRadius / epsP / static_cast<ParamType>(parDiff[comp]) + 1.0 / static_cast<ParamType>(filmDiff[comp]));
 	}
+}
+
+/**
+ * @brief Computes the residual of the flux equations and adds the film diffusion to the bulk and particle residuals
+ * @details The column cells are distributed among the threads of the enclosing parallel region, if any.
+ *          Thus, this function has to be called by all threads of the region.
+ * @param [in] kf_FV Discretized film diffusion coefficients, see discretizedFilmDiffusion()
+ */
+template <typename StateType, typename ResidualType, typename ParamType>
+int GeneralRateModel::residualFlux(const ParamType& t, unsigned int secIdx, ParamType const* const kf_FV, StateType const* yBase, double const* yDotBase, ResidualType* resBase)
+{
+	Indexer idxr(_disc);
+
+	const ParamType invBetaC = 1.0 / static_cast<ParamType>(_colPorosity) - 1.0;
+	const ParamType epsP = static_cast<ParamType>(_parPorosity);
+	const ParamType radius = static_cast<ParamType>(_parRadius);
+
+	const ParamType surfaceToVolumeRatio = 3.0 / radius;
+	const ParamType outerAreaPerVolume = _parOuterSurfAreaPerVolume[0] / radius;
+
+	const ParamType jacCF_val = invBetaC * surfaceToVolumeRatio;
+	const ParamType jacPF_val = -outerAreaPerVolume / epsP;
 
 	// Get offsets
 	ResidualType* const resCol = resBase;
@@ -1054,66 +1681,79 @@ int GeneralRateModel::residualFlux(const ParamType& t, unsigned int secIdx, Stat
 	StateType const* const yPar = yBase + idxr.offsetCp();
 	StateType const* const yFlux = yBase + idxr.offsetJf();
 
-	// J_f block (identity matrix), adds flux state to flux equation
-	for (unsigned int i = 0; i < _disc.nComp * _disc.nCol; ++i)
-		resFlux[i] = yFlux[i];
-
-	// J_{0,f} block, adds flux to column void / bulk volume equations
-	for (unsigned int i = 0; i < _disc.nCol * _disc.nComp; ++i)
-		resCol[i] += jacCF_val * yFlux[i];
-
-	// J_{f,0} block, adds bulk volume state c_i to flux equation
-	for (unsigned int bnd = 0; bnd < _disc.nCol; ++bnd)
+	#pragma omp for schedule(static)
+	for (ompuint_t col = 0; col < _disc.nCol; ++col)
 	{
 		for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
 		{
-			const unsigned int eq = bnd * idxr.strideColCell() + comp * idxr.strideColComp();
+			const unsigned int eq = col * idxr.strideColCell() + comp * idxr.strideColComp();
+
+			// J_f block (identity matrix), adds flux state to flux equation
+			resFlux[eq] = yFlux[eq];
+
+			// J_{0,f} block, adds flux to column void / bulk volume equations
+			resCol[eq] += jacCF_val * yFlux[eq];
+
+			// J_{f,0} block, adds bulk volume state c_i to flux equation
 			resFlux[eq] -= kf_FV[comp] * yCol[eq];
+
+			// J_{p,f} block, implements bead boundary condition in outer bead shell equation
+			resPar[col * idxr.strideParBlock() + comp] += jacPF_val * yFlux[eq];
+
+			// J_{f,p} block, adds outer bead shell state c_{p,i} to flux equation
+			resFlux[eq] += kf_FV[comp] * yPar[comp + col * idxr.strideParBlock()];
 		}
 	}
 
-	// J_{p,f} block, implements bead boundary condition in outer bead shell equation
+	return 0;
+}
+
+/**
+ * @brief Sets the sparsity pattern of the off diagonal Jacobian blocks
+ * @details The pattern of the blocks @f$ J_{0,f}, \dots, J_{N_p,f} @f$ and @f$ J_{f,0}, \dots, J_{f, N_p} @f$
+ *          does not change during the simulation. Only their values are updated by assembleOffdiagJac().
+ */
+void GeneralRateModel::setOffdiagJacPattern()
+{
+	Indexer idxr(_disc);
+
+	// J_{0,f} and J_{f,0} blocks are diagonal
+	linalg::SparseMatrix pattern(_disc.nCol * _disc.nComp);
+	for (unsigned int eq = 0; eq < _disc.nCol * _disc.nComp; ++eq)
+		pattern.addElement(eq, eq, 0.0);
+
+	_jacCF.assignPattern(pattern);
+	_jacFC.assignPattern(pattern);
+
+	// J_{p,f} block couples outer bead shell to flux, J_{f,p} block couples flux to outer bead shell
+	linalg::SparseMatrix patternPF(_disc.nComp);
+	linalg::SparseMatrix patternFP(_disc.nComp);
 	for (unsigned int pblk = 0; pblk < _disc.nCol; ++pblk)
 	{
+		patternPF.clear();
+		patternFP.clear();
 		for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
 		{
 			const unsigned int eq = pblk * idxr.strideColCell() + comp * idxr.strideColComp();
-			resPar[pblk * idxr.strideParBlock() + comp] += jacPF_val * yFlux[eq];
+			patternPF.addElement(comp, eq, 0.0);
+			patternFP.addElement(eq, comp, 0.0);
 		}
-	}
 
-	// J_{f,p} block, adds outer bead shell state c_{p,i} to flux equation
-	for (unsigned int pblk = 0; pblk < _disc.nCol; pblk++)
-	{
-		for (unsigned int comp = 0; comp < _disc.nComp; comp++)
-		{
-			const unsigned int eq = pblk * idxr.strideColCell() + comp * idxr.strideColComp();
-			resFlux[eq] += kf_FV[comp] * yPar[comp + pblk * idxr.strideParBlock()];
-		}
+		_jacPF[pblk].assignPattern(patternPF);
+		_jacFP[pblk].assignPattern(patternFP);
 	}
-
-	_discParFlux.destroy<ParamType>();
-	return 0;
 }
 
 /**
  * @brief Assembles off diagonal Jacobian blocks
  * @details Assembles the fixed blocks @f$ J_{0,f}, \dots, J_{N_p,f} @f$ and @f$ J_{f,0}, \dots, J_{f, N_p}. @f$
- *          The blocks are fixed for each section.
+ *          The blocks are fixed for each section. Their sparsity pattern is set by setOffdiagJacPattern()
+ *          and only the values are updated here.
  * @param [in] t Current time
  * @param [in] secIdx Index of the current section
  */
 void GeneralRateModel::assembleOffdiagJac(double t, unsigned int secIdx)
 {
-	// Clear matrices for new assembly
-	_jacCF.clear();
-	_jacFC.clear();
-	for (unsigned int pblk = 0; pblk < _disc.nCol; ++pblk)
-	{
-		_jacPF[pblk].clear();
-		_jacFP[pblk].clear();
-	}
-
 	Indexer idxr(_disc);
 
 	const double invBetaC = 1.0 / static_cast<double>(_colPorosity) - 1.0;
@@ -1143,7 +1783,7 @@ void GeneralRateModel::assembleOffdiagJac(double t, unsigned int secIdx)
 	for (unsigned int eq = 0; eq < _disc.nCol * _disc.nComp; ++eq)
 	{
 		// Main diagonal corresponds to j_{f,i} (flux) state variable
-		_jacCF.addElement(eq, eq, jacCF_val);
+		_jacCF(eq, eq) = jacCF_val;
 	}
 
 	// J_{f,0} block, adds bulk volume state c_i to flux equation
@@ -1153,7 +1793,7 @@ void GeneralRateModel::assembleOffdiagJac(double t, unsigned int secIdx)
 		{
 			// Main diagonal corresponds to c_i state variable in each column cell
 			const unsigned int eq = bnd * idxr.strideColCell() + comp * idxr.strideColComp();
-			_jacFC.addElement(eq, eq, -kf_FV[comp]);
+			_jacFC(eq, eq) = -kf_FV[comp];
 		}
 	}
 
@@ -1163,7 +1803,7 @@ void GeneralRateModel::assembleOffdiagJac(double t, unsigned int secIdx)
 		for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
 		{
 			const unsigned int eq = pblk * idxr.strideColCell() + comp * idxr.strideColComp();
-			_jacPF[pblk].addElement(comp, eq, jacPF_val);
+			_jacPF[pblk](comp, eq) = jacPF_val;
 		}
 	}
 
@@ -1173,7 +1813,7 @@ void GeneralRateModel::assembleOffdiagJac(double t, unsigned int secIdx)
 		for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
 		{
 			const unsigned int eq = pblk * idxr.strideColCell() + comp * idxr.strideColComp();
-			_jacFP[pblk].addElement(eq, comp, kf_FV[comp]);
+			_jacFP[pblk](eq, comp) = kf_FV[comp];
 		}
 	}
 
@@ -1186,7 +1826,7 @@ void GeneralRateModel::residualSensFwdNorm(unsigned int nSens, const active& t,
 		active* const adRes, double* const tmp)
 {
 	// Evaluate residual for all parameters using AD in vector mode
-	residualImpl<double, active, active, false>(t, secIdx, timeFactor, y, yDot, adRes);
+	residualParamSensitivity<false>(t, secIdx, timeFactor, y, yDot, adRes);
 
 	for (unsigned int param = 0; param < yS.size(); param++)
 	{
@@ -1235,7 +1875,7 @@ int GeneralRateModel::residualSensFwdAdOnly(const active& t, unsigned int secIdx
 	BENCH_SCOPE(_timerResidualSens);
 
 	// Evaluate residual for all parameters using AD in vector mode
-	return residualImpl<double, active, active, false>(t, secIdx, timeFactor, y, yDot, adRes); 
+	return residualParamSensitivity<false>(t, secIdx, timeFactor, y, yDot, adRes);
 }
 
 int GeneralRateModel::residualSensFwdCombine(const active& timeFactor, const std::vector<const double*>& yS, const std::vector<const double*>& ySdot,
@@ -1248,14 +1888,33 @@ int GeneralRateModel::residualSensFwdCombine(const active& timeFactor, const std
 
 	BENCH_SCOPE(_timerResidualSens);
 
-	// tmp1 stores result of (dF / dy) * s
-	// tmp2 stores result of (dF / dyDot) * sDot
+	// The directional derivatives (dF / dy) * s of all sensitivities are computed in one
+	// sweep over the Jacobian blocks. To this end, the sensitivities are interleaved such
+	// that each matrix element is applied to all of them in a contiguous inner loop.
+	// tmp2 stores result of (dF / dyDot) * sDot, which is matrix-free and applied per vector
 
-	for (unsigned int param = 0; param < yS.size(); param++)
+	const unsigned int nSens = yS.size();
+	const unsigned int nDof = numDofs();
+	_sensMultiVec.resize(2 * nDof * nSens);
+	double* const sensIn = _sensMultiVec.data();
+	double* const sensOut = sensIn + nDof * nSens;
+
+	BENCH_START(_timerResidualSensPar);
+
+	#pragma omp parallel for schedule(static)
+	for (ompuint_t i = 0; i < nDof; ++i)
 	{
-		// Directional derivative (dF / dy) * s
-		multiplyWithJacobian(yS[param], tmp1);
+		for (unsigned int param = 0; param < nSens; ++param)
+			sensIn[i * nSens + param] = yS[param][i];
+	}
+
+	BENCH_STOP(_timerResidualSensPar);
+
+	// Directional derivatives (dF / dy) * s
+	multiplyWithJacobianMultiVector(sensIn, 1.0, 0.0, sensOut, nSens);
 
+	for (unsigned int param = 0; param < nSens; param++)
+	{
 		// Directional derivative (dF / dyDot) * sDot
 		multiplyWithDerivativeJacobian(ySdot[param], tmp2, static_cast<double>(timeFactor));
 
@@ -1265,14 +1924,13 @@ int GeneralRateModel::residualSensFwdCombine(const active& timeFactor, const std
 
 		// Complete sens residual is the sum:
 		#pragma omp parallel for schedule(static)
-		for (ompuint_t i = 0; i < numDofs(); i++)
-			ptrResS[i] = tmp1[i] + tmp2[i] + adRes[i].getADValue(param);
+		for (ompuint_t i = 0; i < nDof; i++)
+			ptrResS[i] = sensOut[i * nSens + param] + tmp2[i] + adRes[i].getADValue(param);
 
 		BENCH_STOP(_timerResidualSensPar);
 
 /*
-		LOG(Debug) << "tmp1 = " << cadet::log::VectorPtr<double>(tmp1, numDofs()) << "\n"
-		           << "tmp2 = " << cadet::log::VectorPtr<double>(tmp2, numDofs()) << "\n"
+		LOG(Debug) << "tmp2 = " << cadet::log::VectorPtr<double>(tmp2, numDofs()) << "\n"
 		           << "adRes = " << cadet::log::VectorPtr<active>(adRes, numDofs()) << "\n"
 		           << "sensRes = " << cadet::log::VectorPtr<double>(ptrResS, numDofs());
 */
@@ -1296,6 +1954,23 @@ int GeneralRateModel::residualSensFwd(unsigned int nSens, const active& t, unsig
 	return 0;
 }
 
+int GeneralRateModel::residualAdjoint(const active& t, unsigned int secIdx, const active& timeFactor, double const* const y, double const* const yDot,
+	double const* const yB, double const* const yBdot, double* const resB, active* const adRes, active* const adY, unsigned int numSensAdDirs)
+{
+	// Update the Jacobian at the forward state, resB serves as scratch memory for the (unused) residual
+	const int retCode = residual(t, secIdx, timeFactor, y, yDot, resB, adRes, adY, numSensAdDirs, true, false);
+	if (cadet_unlikely(retCode != 0))
+		return retCode;
+
+	BENCH_SCOPE(_timerResidualSens);
+
+	// Adjoint residual is (dF / dyDot)^T * yBdot - (dF / dy)^T * yB
+	multiplyWithDerivativeJacobianTransposed(yBdot, resB, static_cast<double>(timeFactor));
+	multiplyWithJacobianTransposed(yB, -1.0, 1.0, resB);
+
+	return 0;
+}
+
 /**
  * @brief Multiplies the given vector with the system Jacobian (i.e., @f$ \frac{\partial F}{\partial y} @f$)
  * @details Actually, the operation @f$ z = \alpha \frac{\partial F}{\partial y} x + \beta z @f$ is performed.
@@ -1322,7 +1997,7 @@ void GeneralRateModel::multiplyWithJacobian(double const* yS, double alpha, doub
 		#pragma omp for schedule(static) nowait
 		for (int comp = 0; comp < static_cast<int>(_disc.nComp); ++comp)
 		{
-			_jacC[comp].multiplyVector(yS + comp * idxr.strideColComp(), alpha, beta, ret + comp * idxr.strideColComp());
+			_jacC[comp].multiplyVector(yS + comp * idxr.strideColComp(), alpha, beta, ret + comp * idxr.strideColComp(), idxr.strideColCell());
 		}
 
 		#pragma omp for schedule(static)
@@ -1347,6 +2022,71 @@ void GeneralRateModel::multiplyWithJacobian(double const* yS, double alpha, doub
 		_jacFP[pblk].multiplyVector(yS + idxr.offsetCp(pblk), alpha, 1.0, retJf);
 }
 
+/**
+ * @brief Multiplies a set of interleaved vectors with the system Jacobian (i.e., @f$ \frac{\partial F}{\partial y} @f$)
+ * @details Actually, the operation @f$ Z = \alpha \frac{\partial F}{\partial y} X + \beta Z @f$ is performed,
+ *          where the columns of @f$ X @f$ and @f$ Z @f$ are @p nVec vectors stored interleaved (i.e., element
+ *          @c i of vector @c v is located at <tt>yS[i * nVec + v]</tt>). In contrast to calling multiplyWithJacobian()
+ *          for each vector, every Jacobian block is traversed only once.
+ * @param [in] yS Interleaved vectors @f$ X @f$ that are transformed by the Jacobian @f$ \frac{\partial F}{\partial y} @f$
+ * @param [in] alpha Factor @f$ \alpha @f$ in front of @f$ \frac{\partial F}{\partial y} @f$
+ * @param [in] beta Factor @f$ \beta @f$ in front of @f$ Z @f$
+ * @param [in,out] ret Interleaved vectors @f$ Z @f$ which store the result of the operation
+ * @param [in] nVec Number of vectors
+ */
+void GeneralRateModel::multiplyWithJacobianMultiVector(double const* yS, double alpha, double beta, double* ret, unsigned int nVec)
+{
+	Indexer idxr(_disc);
+
+	// Set fluxes(ret) = fluxes(yS)
+	// This applies the identity matrix in the bottom right corner of the Jaocbian (flux equation)
+	// The result is not read if beta is zero
+	if (beta == 0.0)
+	{
+		for (unsigned int i = idxr.offsetJf() * nVec; i < numDofs() * nVec; ++i)
+			ret[i] = alpha * yS[i];
+	}
+	else
+	{
+		for (unsigned int i = idxr.offsetJf() * nVec; i < numDofs() * nVec; ++i)
+			ret[i] = alpha * yS[i] + beta * ret[i];
+	}
+
+	BENCH_START(_timerResidualSensPar);
+
+	#pragma omp parallel
+	{
+		// Threads that are done with multiplying with the bulk column blocks can proceed
+		// to the particle blocks
+		#pragma omp for schedule(static) nowait
+		for (int comp = 0; comp < static_cast<int>(_disc.nComp); ++comp)
+		{
+			const unsigned int offset = comp * idxr.strideColComp() * nVec;
+			_jacC[comp].multiplyMultiVector(yS + offset, alpha, beta, ret + offset, nVec, idxr.strideColCell());
+		}
+
+		#pragma omp for schedule(static)
+		for (ompuint_t pblk = 0; pblk < _disc.nCol; ++pblk)
+		{
+			const unsigned int localOffset = idxr.offsetCp(pblk) * nVec;
+			_jacP[pblk].multiplyMultiVector(yS + localOffset, alpha, beta, ret + localOffset, nVec);
+			_jacPF[pblk].multiplyAddMultiVector(alpha, yS + idxr.offsetJf() * nVec, ret + localOffset, nVec);
+		}
+	}
+
+	BENCH_STOP(_timerResidualSensPar);
+
+	// Multiply with the flux block in the column equation
+	_jacCF.multiplyAddMultiVector(alpha, yS + idxr.offsetJf() * nVec, ret, nVec);
+
+	// Handle flux equation
+	double* const retJf = ret + idxr.offsetJf() * nVec;
+	_jacFC.multiplyAddMultiVector(alpha, yS, retJf, nVec);
+
+	for (unsigned int pblk = 0; pblk < _disc.nCol; ++pblk)
+		_jacFP[pblk].multiplyAddMultiVector(alpha, yS + idxr.offsetCp(pblk) * nVec, retJf, nVec);
+}
+
 /**
  * @brief Multiplies the time derivative Jacobian @f$ \frac{\partial F}{\partial \dot{y}} @f$ with a given vector
  * @details The operation @f$ z = \frac{\partial F}{\partial \dot{y}} x @f$ is performed.
@@ -1409,6 +2149,117 @@ void GeneralRateModel::multiplyWithDerivativeJacobian(double const* sDot, double
 	std::fill(dFdyDot, dFdyDot + _disc.nCol * _disc.nComp, 0.0);
 }
 
+/**
+ * @brief Multiplies the given vector with the transposed system Jacobian (i.e., @f$ \left(\frac{\partial F}{\partial y}\right)^T @f$)
+ * @details Actually, the operation @f$ z = \alpha \left(\frac{\partial F}{\partial y}\right)^T x + \beta z @f$ is performed.
+ *          The diagonal blocks are multiplied in transposed mode and the roles of the off-diagonal blocks
+ *          @f$ J_{i,f} @f$ and @f$ J_{f,i} @f$ are swapped (see multiplyWithJacobian()).
+ * @param [in] yB Vector @f$ x @f$ that is transformed by the transposed Jacobian
+ * @param [in] alpha Factor @f$ \alpha @f$ in front of @f$ \left(\frac{\partial F}{\partial y}\right)^T @f$
+ * @param [in] beta Factor @f$ \beta @f$ in front of @f$ z @f$
+ * @param [in,out] ret Vector @f$ z @f$ which stores the result of the operation
+ */
+void GeneralRateModel::multiplyWithJacobianTransposed(double const* yB, double alpha, double beta, double* ret)
+{
+	Indexer idxr(_disc);
+
+	// Identity matrix in the bottom right corner of the Jacobian (flux equation)
+	for (unsigned int i = idxr.offsetJf(); i < numDofs(); ++i)
+		ret[i] = alpha * yB[i] + beta * ret[i];
+
+	BENCH_START(_timerResidualSensPar);
+
+	#pragma omp parallel
+	{
+		#pragma omp for schedule(static) nowait
+		for (int comp = 0; comp < static_cast<int>(_disc.nComp); ++comp)
+		{
+			_jacC[comp].transposedMultiplyVector(yB + comp * idxr.strideColComp(), alpha, beta, ret + comp * idxr.strideColComp(), idxr.strideColCell());
+		}
+
+		#pragma omp for schedule(static)
+		for (ompuint_t pblk = 0; pblk < _disc.nCol; ++pblk)
+		{
+			const int localOffset = idxr.offsetCp(pblk);
+			_jacP[pblk].transposedMultiplyVector(yB + localOffset, alpha, beta, ret + localOffset);
+		}
+	}
+
+	BENCH_STOP(_timerResidualSensPar);
+
+	// Transposed off-diagonal blocks: J_{f,i}^T maps the flux equations to the states of block i
+	// and J_{i,f}^T maps the equations of block i to the fluxes
+	double const* const yBf = yB + idxr.offsetJf();
+	double* const retJf = ret + idxr.offsetJf();
+
+	_jacFC.forEachElement([&](unsigned int row, unsigned int col, double val) { ret[idxr.offsetC() + col] += alpha * val * yBf[row]; });
+	_jacCF.forEachElement([&](unsigned int row, unsigned int col, double val) { retJf[col] += alpha * val * yB[idxr.offsetC() + row]; });
+
+	for (unsigned int pblk = 0; pblk < _disc.nCol; ++pblk)
+	{
+		const unsigned int offset = idxr.offsetCp(pblk);
+		_jacFP[pblk].forEachElement([&](unsigned int row, unsigned int col, double val) { ret[offset + col] += alpha * val * yBf[row]; });
+		_jacPF[pblk].forEachElement([&](unsigned int row, unsigned int col, double val) { retJf[col] += alpha * val * yB[offset + row]; });
+	}
+}
+
+/**
+ * @brief Multiplies the transposed time derivative Jacobian @f$ \left(\frac{\partial F}{\partial \dot{y}}\right)^T @f$ with a given vector
+ * @details The operation @f$ z = \left(\frac{\partial F}{\partial \dot{y}}\right)^T x @f$ is performed matrix-free.
+ *          The binding model contributes a diagonal block, so only the coupling of the mobile phase
+ *          equations to the bound states is actually transposed.
+ * @param [in] yBdot Vector @f$ x @f$ that is transformed by the transposed Jacobian
+ * @param [out] ret Vector @f$ z @f$ which stores the result of the operation
+ * @param [in] timeFactor Factor which is premultiplied to the time derivatives originating from time transformation
+ */
+void GeneralRateModel::multiplyWithDerivativeJacobianTransposed(double const* yBdot, double* ret, double timeFactor)
+{
+	Indexer idxr(_disc);
+	const double invBetaP = (1.0 / static_cast<double>(_parPorosity) - 1.0) * timeFactor;
+
+	BENCH_START(_timerResidualSensPar);
+
+	#pragma omp parallel for schedule(static)
+	for (int pblk = -1; pblk < static_cast<int>(_disc.nCol); ++pblk)
+	{
+		if (cadet_unlikely(pblk == -1))
+		{
+			// Column
+			for (int i = 0; i < idxr.offsetCp(0); ++i)
+				ret[i] = timeFactor * yBdot[i];
+		}
+		else
+		{
+			// Particle
+			for (unsigned int shell = 0; shell < _disc.nPar; ++shell)
+			{
+				double const* const localYBdot = yBdot + idxr.offsetCp(pblk) + shell * idxr.strideParShell();
+				double* const localRet = ret + idxr.offsetCp(pblk) + shell * idxr.strideParShell();
+
+				// Mobile phase
+				for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
+					localRet[comp] = timeFactor * localYBdot[comp];
+
+				// Solid phase (diagonal)
+				_binding->multiplyWithDerivativeJacobian(localYBdot + _disc.nComp, localRet + _disc.nComp, timeFactor);
+
+				// Transposed coupling of the mobile phase equations to dq / dt
+				for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
+				{
+					for (unsigned int i = 0; i < _disc.nBound[comp]; ++i)
+						localRet[_disc.nComp + _disc.boundOffset[comp] + i] += invBetaP * localYBdot[comp];
+				}
+			}
+		}
+	}
+
+	BENCH_STOP(_timerResidualSensPar);
+
+	// Fluxes are algebraic
+	double* const dFdyDot = ret + idxr.offsetJf();
+	std::fill(dFdyDot, dFdyDot + _disc.nCol * _disc.nComp, 0.0);
+}
+
 void GeneralRateModel::setExternalFunctions(IExternalFunction** extFuns, unsigned int size)
 {
 	if (_binding)
@@ -1429,7 +2280,7 @@ double GeneralRateModel::inletConnectionFactor(unsigned int compIdx, unsigned in
 
 unsigned int GeneralRateModel::localOutletComponentIndex() const CADET_NOEXCEPT
 {
-	return _disc.nCol - 1;
+	return (_disc.nCol - 1) * Indexer(_disc).strideColCell();
 }
 
 unsigned int GeneralRateModel::localInletComponentIndex() const CADET_NOEXCEPT
@@ -1439,12 +2290,12 @@ unsigned int GeneralRateModel::localInletComponentIndex() const CADET_NOEXCEPT
 
 unsigned int GeneralRateModel::localOutletComponentStride() const CADET_NOEXCEPT
 {
-	return _disc.nCol;
+	return Indexer(_disc).strideColComp();
 }
 
 unsigned int GeneralRateModel::localInletComponentStride() const CADET_NOEXCEPT
 {
-	return _disc.nCol;
+	return Indexer(_disc).strideColComp();
 }
 
 void GeneralRateModel::expandErrorTol(double const* errorSpec, unsigned int errorSpecSize, double* expandOut)
@@ -23,6 +23,9 @@
 #include "cadet/SolutionExporter.hpp"
 #include "AutoDiff.hpp"
 #include "linalg/SparseMatrix.hpp"
+#include "linalg/BandMatrixBatch.hpp"
+#include "linalg/DenseMatrix.hpp"
+#include "linalg/SparseLU.hpp"
 #include "linalg/Gmres.hpp"
 #include "MemoryPool.hpp"
 #include "ParamIdUtil.hpp"
@@ -133,6 +136,13 @@ public:
 
 	virtual int linearSolve(double t, double timeFactor, double alpha, double tol, double* const rhs, double const* const weight,
 		double const* const y, double const* const yDot, double const* const res);
+	virtual int linearSolveMultiRhs(double t, double timeFactor, double alpha, double tol, double* const* const rhs, double const* const* const weight,
+		unsigned int nRhs, double const* const y, double const* const yDot, double const* const res);
+
+	virtual int residualAdjoint(const active& t, unsigned int secIdx, const active& timeFactor, double const* const y, double const* const yDot,
+		double const* const yB, double const* const yBdot, double* const resB, active* const adRes, active* const adY, unsigned int numSensAdDirs);
+	virtual int linearSolveAdjoint(double t, double timeFactor, double alpha, double tol, double* const rhs, double const* const weight,
+		double const* const yB, double const* const yBdot, double const* const resB);
 
 	virtual void prepareADvectors(active* const adRes, active* const adY, unsigned int numSensAdDirs) const;
 
@@ -222,22 +232,67 @@ protected:
 
 	int residual(const active& t, unsigned int secIdx, const active& timeFactor, double const* const y, double const* const yDot, double* const res, active* const adRes, active* const adY, unsigned int numSensAdDirs, bool updateJacobian, bool paramSensitivity);
 
+	template <bool wantJac>
+	int residualParamSensitivity(const active& t, unsigned int secIdx, const active& timeFactor, double const* const y, double const* const yDot, active* const adRes);
+
+	template <typename SparseType, bool wantJac>
+	int residualWithSparseAd(const active& t, unsigned int secIdx, const active& timeFactor, double const* const y, double const* const yDot, active* const adRes);
+
+	int analyticParamSensitivity(const active& t, unsigned int secIdx, const active& timeFactor, double const* const y, double const* const yDot, active* const adRes);
+	bool hasAnalyticParamDerivative(const ParameterId& pId) const;
+
+	template <unsigned int N>
+	int residualWithFixedAdJacobian(double t, unsigned int secIdx, double timeFactor, double const* const y, double const* const yDot, double* const res);
+	void releaseFixedAdVectors();
+
 	template <typename StateType, typename ResidualType, typename ParamType, bool wantJac>
 	int residualImpl(const ParamType& t, unsigned int secIdx, const ParamType& timeFactor, StateType const* const y, double const* const yDot, ResidualType* const res);
 
 	template <typename StateType, typename ResidualType, typename ParamType, bool wantJac>
-	int residualBulk(const ParamType& t, unsigned int secIdx, const ParamType& timeFactor, StateType const* y, double const* yDot, ResidualType* res);
+	int residualBulk(const ParamType& t, unsigned int secIdx, const ParamType& timeFactor, StateType const* y, double const* yDot, ResidualType* res, unsigned int item);
+
+	template <typename StateType, typename ResidualType, typename ParamType, bool wantJac>
+	int residualBulkCellMajor(const ParamType& t, unsigned int secIdx, const ParamType& timeFactor, StateType const* y, double const* yDot, ResidualType* res);
 
 	template <typename StateType, typename ResidualType, typename ParamType, bool wantJac>
 	int residualParticle(const ParamType& t, unsigned int colCell, unsigned int secIdx, const ParamType& timeFactor, StateType const* y, double const* yDot, ResidualType* res);
 
 	template <typename StateType, typename ResidualType, typename ParamType>
-	int residualFlux(const ParamType& t, unsigned int secIdx, StateType const* y, double const* yDot, ResidualType* res);
+	int residualFlux(const ParamType& t, unsigned int secIdx, ParamType const* const kf_FV, StateType const* y, double const* yDot, ResidualType* res);
 
+	template <typename ParamType>
+	void discretizedFilmDiffusion(unsigned int secIdx, ParamType* const kf_FV) const;
+
+	unsigned int numBulkWorkItems() const CADET_NOEXCEPT;
+
+	void setOffdiagJacPattern();
 	void assembleOffdiagJac(double t, unsigned int secIdx);
-	void extractJacobianFromAD(active const* const adRes, unsigned int numSensAdDirs);
+	template <typename AdType>
+	void seedJacobianAdDirections(AdType* const adY, unsigned int numSensAdDirs) const;
+	template <typename AdType>
+	void extractJacobianFromAD(AdType const* const adRes, unsigned int numSensAdDirs);
 
 	int schurComplementMatrixVector(double const* x, double* z) const;
+	int schurComplementMatrixPanel(double const* x, double* z, unsigned int nVec);
+	int applySchurComplementPreconditioner(double const* r, double* z) const;
+	void assembleSchurComplementPreconditioner(const Indexer& idxr);
+	void assembleSchurComplementDirect(const Indexer& idxr);
+	void assembleParticleFluxCoupling(const Indexer& idxr);
+
+	int linearSolveSparseDirect(double timeFactor, double alpha, double* const rhs, const Indexer& idxr);
+	void assembleGlobalJacobian(double timeFactor, double alpha, const Indexer& idxr);
+	void analyzeGlobalJacobianPattern(const Indexer& idxr);
+	void assembleGlobalJacobianOffdiag(const Indexer& idxr);
+	void factorizeDiagonalBlocks(double timeFactor, double alpha, const Indexer& idxr);
+	void subtractFluxCoupling(double* const rhs, const Indexer& idxr);
+	int solveSchurComplement(double outerTol, double* const rhs, double const* const weight, const Indexer& idxr);
+	int solveSchurComplementMultiRhs(double outerTol, double* const* const rhs, double const* const* const weight, unsigned int nRhs, const Indexer& idxr);
+	void backSubstitute(double* const rhs, const Indexer& idxr);
+	bool solveBulkBlock(unsigned int comp, double* const vec) const;
+	bool solveBulkBlockMultiRhs(unsigned int comp, double* const* const vec, unsigned int nVec);
+	unsigned int numParticleBatches() const;
+	void particleBatchRange(unsigned int batch, unsigned int numBatches, unsigned int& first, unsigned int& count) const CADET_NOEXCEPT;
+	void solveParticleBatch(unsigned int first, unsigned int count, double* const vec) const;
 	void assembleDiscretizedJacobianColumnBlock(unsigned int comp, double alpha, const Indexer& idxr, double timeFactor);
 	void assembleDiscretizedJacobianParticleBlock(unsigned int pblk, double alpha, const Indexer& idxr, double timeFactor);
 
@@ -247,10 +302,14 @@ protected:
 
 	void addTimeDerivativeToJacobianColumnBlock(linalg::FactorizableBandMatrix& fbm, const Indexer& idxr, double alpha, double timeFactor);
 	void addMobilePhaseTimeDerivativeToJacobianParticleBlock(linalg::FactorizableBandMatrix::RowIterator& jac, const Indexer& idxr, double alpha, double invBetaP, double timeFactor);
+	void reportWarmStartStatistics() const;
 	void solveForFluxes(double* const vecState, const Indexer& idxr);
 
 	void multiplyWithJacobian(double const* yS, double alpha, double beta, double* ret);
+	void multiplyWithJacobianMultiVector(double const* yS, double alpha, double beta, double* ret, unsigned int nVec);
 	void multiplyWithDerivativeJacobian(double const* sDot, double* ret, double timeFactor);
+	void multiplyWithJacobianTransposed(double const* yB, double alpha, double beta, double* ret);
+	void multiplyWithDerivativeJacobianTransposed(double const* yBdot, double* ret, double timeFactor);
 	inline void multiplyWithJacobian(double const* yS, double* ret)
 	{
 		multiplyWithJacobian(yS, 1.0, 0.0, ret);
@@ -268,6 +327,16 @@ protected:
 		unsigned int* nBound; //!< Array with number of bound states for each component
 		unsigned int* boundOffset; //!< Array with offset to the first bound state of each component in the solid phase
 		unsigned int strideBound; //!< Total number of bound states
+		bool cellMajorBulk; //!< Determines whether bulk and flux states of one column cell are stored contiguously (cell-major) instead of component-major
+	};
+
+	struct SensitiveParameter
+	{
+		ParameterId id; //!< Parameter id
+		active const* param; //!< Parameter in this unit operation or its binding model
+		unsigned int adDirection; //!< AD direction of the parameter
+		double adValue; //!< Seed value of the AD direction
+		bool binding; //!< Determines whether the parameter belongs to the binding model
 	};
 
 	UnitOpIdx _unitOpIdx; //!< Unit operation index
@@ -278,13 +347,14 @@ protected:
 	linalg::BandMatrix* _jacC; //!< Interstitial jacobian diagonal block
 	linalg::BandMatrix* _jacP; //!< Particle jacobian diagonal blocks (all of them)
 
-	linalg::SparseMatrix _jacCF; //!< Jacobian block connecting interstitial states and fluxes (interstitial transport equation)
-	linalg::SparseMatrix _jacFC; //!< Jacobian block connecting fluxes and interstitial states (flux equation)
-	linalg::SparseMatrix* _jacPF; //!< Jacobian blocks connecting particle states and fluxes (particle transport boundary condition)
-	linalg::SparseMatrix* _jacFP; //!< Jacobian blocks connecting fluxes and particle states (flux equation)
+	linalg::CompressedSparseMatrix _jacCF; //!< Jacobian block connecting interstitial states and fluxes (interstitial transport equation)
+	linalg::CompressedSparseMatrix _jacFC; //!< Jacobian block connecting fluxes and interstitial states (flux equation)
+	linalg::CompressedSparseMatrix* _jacPF; //!< Jacobian blocks connecting particle states and fluxes (particle transport boundary condition)
+	linalg::CompressedSparseMatrix* _jacFP; //!< Jacobian blocks connecting fluxes and particle states (flux equation)
 
 	linalg::FactorizableBandMatrix* _jacCdisc; //!< Interstitial jacobian diagonal block with time derivatives from BDF method
 	linalg::FactorizableBandMatrix* _jacPdisc; //!< Particle jacobian diagonal blocks (all of them) with time derivatives from BDF method
+	linalg::FactorizedBandMatrixBatch _jacPdiscBatch; //!< LU factors of all particle blocks in @c _jacPdisc for batched solution
 
 	active _colLength; //!< Column length \f$ L \f$
 	active _colPorosity; //!< Column porosity (external porosity) \f$ \varepsilon_c \f$
@@ -303,13 +373,19 @@ protected:
 	std::unordered_map<ParameterId, active*> _parameters; //!< Provides access to all parameters
 	bool _analyticJac; //!< Determines whether AD or analytic Jacobians are used
 
-	ArrayPool _stencilMemory; //!< Provides memory for the stencil
-	double* _wenoDerivatives; //!< Holds derivatives of the WENO scheme
+	ArrayPool* _stencilMemory; //!< Provides memory for the stencils (one pool per bulk work item)
+	double* _wenoDerivatives; //!< Holds derivatives of the WENO scheme (one block of maximum stencil size per component)
 	Weno _weno; //!< The WENO scheme implementation
 	double _wenoEpsilon; //!< The @f$ \varepsilon @f$ of the WENO scheme (prevents division by zero)
 
 	std::unordered_set<active*> _sensParams; //!< Holds all parameters with activated AD directions
+	std::vector<SensitiveParameter> _sensParamList; //!< Holds all sensitive parameters along with their AD directions
+	bool _analyticParamSens; //!< Determines whether parameter derivatives are computed analytically instead of by AD (if possible)
+	bool _sensParamsAnalytic; //!< Determines whether analytic derivatives are available for all sensitive parameters
 	unsigned int _jacobianAdDirs; //!< Number of AD seed vectors required for Jacobian computation
+	unsigned int _fixedAdDirs; //!< Number of directions of the compile-time sized AD datatype used for the Jacobian or @c 0 if none is used
+	ArrayPool _fixedAdMemory; //!< Persistent (seeded) state and residual vectors of compile-time sized AD datatypes
+	ArrayPool _sparseAdMemory; //!< Storage for the residual vector of sparse AD datatypes used for parameter sensitivities
 
 	std::vector<double> _parCellSize; //!< Particle cell / shell size
 	std::vector<double> _parCenterRadius; //!< Particle cell-centered position for each particle cell
@@ -319,9 +395,26 @@ protected:
 	ArrayPool _discParFlux; //!< Storage for discretized @f$ k_f @f$ value
 
 	bool _factorizeJacobian; //!< Determines whether the Jacobian needs to be factorized
+	bool _factorizeJacobianAdj; //!< Determines whether the global Jacobian needs to be factorized for transposed solves
 	double* _tempState; //!< Temporary storage with the size of the state vector
 	linalg::Gmres _gmres; //!< GMRES algorithm for the Schur-complement in linearSolve()
 	double _schurSafety; //!< Safety factor for Schur-complement solution
+	bool _schurPrecond; //!< Determines whether the block-Jacobi preconditioner is used for the Schur-complement
+	double* _schurPrecBlocks; //!< LU factors of the per-cell nComp x nComp diagonal blocks of the approximate Schur-complement
+	lapackInt_t* _schurPrecPivot; //!< Pivot indices of the LU factors in @c _schurPrecBlocks
+	double* _schurPrecBulk; //!< Inverse diagonal of the column bulk blocks, also used as buffer for applying the preconditioner
+	bool _schurDirectSolve; //!< Determines whether the Schur-complement is assembled and factorized instead of solved by GMRES
+	linalg::DenseMatrix _schurMatrix; //!< Explicitly assembled and LU factorized Schur-complement
+	double* _schurDirectScratch; //!< Diagonals of the bulk-flux coupling blocks and buffers for columns of the bulk block inverses
+	bool _globalDirectSolve; //!< Determines whether the full Jacobian is assembled and solved by a sparse direct solver
+	linalg::FactorizableSparseMatrix _jacGlobal; //!< Full discretized system Jacobian in compressed row storage
+	double* _bulkScratch; //!< Buffer for gathering strided bulk components in cell-major ordering (one column slice per component)
+	double* _parBatchScratch; //!< Workspace for batched particle block solves (size of all particle blocks)
+	std::vector<double> _multiRhsScratch; //!< Buffer for gathering the bulk components of all right hand sides in linearSolveMultiRhs()
+	std::vector<double> _multiRhsFlux; //!< Right hand sides of the Schur-complements in solveSchurComplementMultiRhs()
+	std::vector<double> _multiRhsTempState; //!< Intermediate states of all vectors in schurComplementMatrixPanel()
+	std::vector<double> _sensMultiVec; //!< Interleaved sensitivities and their Jacobian products in residualSensFwdCombine()
+	std::vector<BindingWarmStart> _bindingWarmStart; //!< Warm start data of the consistent initialization for each particle shell (empty if disabled)
 
 	BENCH_TIMER(_timerResidual)
 	BENCH_TIMER(_timerResidualPar)
@@ -339,6 +432,8 @@ protected:
 
 	// Wrapper for calling the corresponding function in GeneralRateModel class
 	friend int schurComplementMultiplier(void* userData, double const* x, double* z);
+	friend int schurComplementPanelMultiplier(void* userData, double const* x, double* z, unsigned int nVec);
+	friend int schurComplementPreconditioner(void* userData, double const* r, double* z);
 
 	class Indexer
 	{
@@ -346,8 +441,8 @@ protected:
 		Indexer(const Discretization& disc) : _disc(disc) { }
 
 		// Strides
-		inline const int strideColCell() const CADET_NOEXCEPT { return 1; }
-		inline const int strideColComp() const CADET_NOEXCEPT { return static_cast<int>(_disc.nCol); }
+		inline const int strideColCell() const CADET_NOEXCEPT { return _disc.cellMajorBulk ? static_cast<int>(_disc.nComp) : 1; }
+		inline const int strideColComp() const CADET_NOEXCEPT { return _disc.cellMajorBulk ? 1 : static_cast<int>(_disc.nCol); }
 
 		inline const int strideParComp() const CADET_NOEXCEPT { return 1; }
 		inline const int strideParLiquid() const CADET_NOEXCEPT { return static_cast<int>(_disc.nComp); }
@@ -355,8 +450,8 @@ protected:
 		inline const int strideParShell() const CADET_NOEXCEPT { return strideParLiquid() + strideParBound(); }
 		inline const int strideParBlock() const CADET_NOEXCEPT { return static_cast<int>(_disc.nPar) * strideParShell(); }
 
-		inline const int strideFluxCell() const CADET_NOEXCEPT { return 1; }
-		inline const int strideFluxComp() const CADET_NOEXCEPT { return static_cast<int>(_disc.nCol); }
+		inline const int strideFluxCell() const CADET_NOEXCEPT { return strideColCell(); }
+		inline const int strideFluxComp() const CADET_NOEXCEPT { return strideColComp(); }
 
 		// Offsets
 		inline const int offsetC() const CADET_NOEXCEPT { return 0; }
@@ -379,8 +474,8 @@ protected:
 		template <typename real_t> inline real_t const* jf(real_t const* const data) const { return data + offsetJf(); }
 
 		// Return specific variable in state vector
-		template <typename real_t> inline real_t& c(real_t* const data, unsigned int col, unsigned int comp) const { return data[offsetC() + comp * strideColComp() + col]; }
-		template <typename real_t> inline const real_t& c(real_t const* const data, unsigned int col, unsigned int comp) const { return data[offsetC() + comp * strideColComp() + col]; }
+		template <typename real_t> inline real_t& c(real_t* const data, unsigned int col, unsigned int comp) const { return data[offsetC() + comp * strideColComp() + col * strideColCell()]; }
+		template <typename real_t> inline const real_t& c(real_t const* const data, unsigned int col, unsigned int comp) const { return data[offsetC() + comp * strideColComp() + col * strideColCell()]; }
 
 		
 		template <typename real_t> inline real_t& cp(real_t* const data, unsigned int col, unsigned int par, unsigned int comp) const
@@ -403,8 +498,8 @@ protected:
 		}
 
 
-		template <typename real_t> real_t& jf(real_t* const data, unsigned int col, unsigned int comp) const { return data[offsetJf() + col * strideFluxComp() + comp]; }
-		template <typename real_t> const real_t& jf(real_t const* const data, unsigned int col, unsigned int comp) const { return data[offsetJf() + col * strideFluxComp() + comp]; }
+		template <typename real_t> real_t& jf(real_t* const data, unsigned int col, unsigned int comp) const { return data[offsetJf() + comp * strideFluxComp() + col * strideFluxCell()]; }
+		template <typename real_t> const real_t& jf(real_t const* const data, unsigned int col, unsigned int comp) const { return data[offsetJf() + comp * strideFluxComp() + col * strideFluxCell()]; }
 
 		// Iterator-like access
 		template <typename real_t> inline real_t& cNextComp(real_t* data) const { return *(data + strideColComp()); }
@@ -444,7 +539,9 @@ protected:
 	{
 	public:
 
-		Exporter(const Discretization& disc, double const* data) : _disc(disc), _idx(disc), _data(data) { }
+		Exporter(const Discretization& disc, double const* data) : _disc(disc), _idx(disc), _data(data),
+			_concentrationOrdering(disc.cellMajorBulk ? _cellMajorOrdering : _componentMajorOrdering),
+			_fluxOrdering(disc.cellMajorBulk ? _cellMajorOrdering : _componentMajorOrdering) { }
 		Exporter(const Discretization&& disc, double const* data) = delete;
 
 		virtual bool hasMultipleBoundStates() const CADET_NOEXCEPT { return cadet::model::hasMultipleBoundStates(_disc.nBound, _disc.nComp); }
@@ -514,10 +611,13 @@ protected:
 		const Indexer _idx;
 		double const* const _data;
 
-		const std::array<StateOrdering, 2> _concentrationOrdering = { { StateOrdering::Component, StateOrdering::AxialCell } };
+		const std::array<StateOrdering, 2> _componentMajorOrdering = { { StateOrdering::Component, StateOrdering::AxialCell } };
+		const std::array<StateOrdering, 2> _cellMajorOrdering = { { StateOrdering::AxialCell, StateOrdering::Component } };
+
+		const std::array<StateOrdering, 2>& _concentrationOrdering; //!< Ordering of the bulk states, depends on Discretization::cellMajorBulk
 		const std::array<StateOrdering, 4> _particleOrdering = { { StateOrdering::AxialCell, StateOrdering::RadialCell, StateOrdering::Phase, StateOrdering::Component } };
 		const std::array<StateOrdering, 2> _solidOrdering = { { StateOrdering::Component, StateOrdering::Phase } };
-		const std::array<StateOrdering, 2> _fluxOrdering = { { StateOrdering::Component, StateOrdering::AxialCell } };
+		const std::array<StateOrdering, 2>& _fluxOrdering; //!< Ordering of the flux states, depends on Discretization::cellMajorBulk
 	};
 };
 
@@ -106,6 +106,13 @@ public:
 
 	virtual int linearSolve(double t, double timeFactor, double alpha, double tol, double* const rhs, double const* const weight,
 		double const* const y, double const* const yDot, double const* const res) { return 0; }
+	virtual int linearSolveMultiRhs(double t, double timeFactor, double alpha, double tol, double* const* const rhs, double const* const* const weight,
+		unsigned int nRhs, double const* const y, double const* const yDot, double const* const res) { return 0; }
+
+	virtual int residualAdjoint(const active& t, unsigned int secIdx, const active& timeFactor, double const* const y, double const* const yDot,
+		double const* const yB, double const* const yBdot, double* const resB, active* const adRes, active* const adY, unsigned int numSensAdDirs) { return 0; }
+	virtual int linearSolveAdjoint(double t, double timeFactor, double alpha, double tol, double* const rhs, double const* const weight,
+		double const* const yB, double const* const yBdot, double const* const resB) { return 0; }
 
 	virtual void prepareADvectors(active* const adRes, active* const adY, unsigned int numSensAdDirs) const;
 
@@ -1059,6 +1059,133 @@ int ModelSystem::linearSolve(double t, double timeFactor, double alpha, double o
 	return result;
 }
 
+int ModelSystem::linearSolveMultiRhs(double t, double timeFactor, double alpha, double outerTol, double* const* const rhs, double const* const* const weight,
+	unsigned int nRhs, double const* const y, double const* const yDot, double const* const res)
+{
+	BENCH_START(_timerLinearSolve);
+
+	// Unit operations are only coupled via their inlets, so each one solves its part of all right hand sides
+	_rhsPtr.resize(nRhs);
+	_weightPtr.resize(nRhs);
+
+	int result = 0;
+	for (unsigned int i = 0; i < _models.size(); ++i)
+	{
+		IUnitOperation* const m = _models[i];
+		const unsigned int offset = _dofOffset[i];
+		for (unsigned int r = 0; r < nRhs; ++r)
+		{
+			_rhsPtr[r] = rhs[r] + offset;
+			_weightPtr[r] = weight[r] + offset;
+		}
+
+		const int intermediateRes = m->linearSolveMultiRhs(t, timeFactor, alpha, outerTol, _rhsPtr.data(), _weightPtr.data(), nRhs, y + offset, yDot + offset, res + offset);
+
+		// If result is already -1 (non-recoverable error), then we stick to it
+		// If result is ok or recoverable and intermediate result is recoverable, then we take intermediate result
+		if ((result >= 0) && (intermediateRes > 0))
+		{
+			result = intermediateRes;
+		}
+	}
+
+	BENCH_STOP(_timerLinearSolve);
+	return result;
+}
+
+int ModelSystem::residualAdjoint(const active& t, unsigned int secIdx, const active& timeFactor, double const* const y, double const* const yDot,
+	double const* const yB, double const* const yBdot, double* const resB, active* const adRes, active* const adY, unsigned int numSensAdDirs)
+{
+	BENCH_START(_timerResidual);
+
+	int result = 0;
+
+	// Unit operations are only coupled via their inlets, which do not depend on states of other units.
+	// Hence, the transposed Jacobian is block diagonal and each unit operation is handled separately.
+	for (unsigned int i = 0; i < _models.size(); ++i)
+	{
+		IUnitOperation* const m = _models[i];
+		const unsigned int offset = _dofOffset[i];
+		const int intermediateRes = m->residualAdjoint(t, secIdx, timeFactor, y + offset, yDot + offset, yB + offset, yBdot + offset, resB + offset, 
+			adRes + offset, adY + offset, numSensAdDirs);
+
+		// If result is already -1 (non-recoverable error), then we stick to it
+		// If result is ok or recoverable and intermediate result is recoverable, then we take intermediate result
+		if ((result >= 0) && (intermediateRes > 0))
+		{
+			result = intermediateRes;
+		}
+	}
+
+	BENCH_STOP(_timerResidual);
+	return result;
+}
+
+int ModelSystem::linearSolveAdjoint(double t, double timeFactor, double alpha, double outerTol, double* const rhs, double const* const weight,
+	double const* const yB, double const* const yBdot, double const* const resB)
+{
+	BENCH_START(_timerLinearSolve);
+
+	int result = 0;
+
+	for (unsigned int i = 0; i < _models.size(); ++i)
+	{
+		IUnitOperation* const m = _models[i];
+		const unsigned int offset = _dofOffset[i];
+		const int intermediateRes = m->linearSolveAdjoint(t, timeFactor, alpha, outerTol, rhs + offset, weight + offset, yB + offset, yBdot + offset, resB + offset);
+
+		// If result is already -1 (non-recoverable error), then we stick to it
+		// If result is ok or recoverable and intermediate result is recoverable, then we take intermediate result
+		if ((result >= 0) && (intermediateRes > 0))
+		{
+			result = intermediateRes;
+		}
+	}
+
+	BENCH_STOP(_timerLinearSolve);
+	return result;
+}
+
+int ModelSystem::residualAdjointParam(unsigned int nSens, const active& t, unsigned int secIdx, const active& timeFactor, double const* const y, 
+	double const* const yDot, double const* const yB, double* const dResDp, active* const adRes)
+{
+	BENCH_START(_timerResidualSens);
+
+	int result = 0;
+
+	// Compute parameter derivatives of the residual using AD in vector mode
+	for (unsigned int i = 0; i < _models.size(); ++i)
+	{
+		IUnitOperation* const m = _models[i];
+		const unsigned int offset = _dofOffset[i];
+		const int intermediateRes = m->residualSensFwdAdOnly(t, secIdx, timeFactor, y + offset, yDot + offset, adRes + offset);
+
+		// If result is already -1 (non-recoverable error), then we stick to it
+		// If result is ok or recoverable and intermediate result is recoverable, then we take intermediate result
+		if ((result >= 0) && (intermediateRes > 0))
+		{
+			result = intermediateRes;
+		}
+	}
+
+	// Connect units
+	residualConnectUnitOps<double, active, active>(secIdx, y, yDot, adRes);
+
+	// Contract with adjoint state
+	const unsigned int nDOFs = numDofs();
+	for (unsigned int p = 0; p < nSens; ++p)
+	{
+		double sum = 0.0;
+		for (unsigned int i = 0; i < nDOFs; ++i)
+			sum += yB[i] * adRes[i].getADValue(p);
+
+		dResDp[p] = sum;
+	}
+
+	BENCH_STOP(_timerResidualSens);
+	return result;
+}
+
 void ModelSystem::setSectionTimes(double const* secTimes, bool const* secContinuity, unsigned int nSections)
 {
 	for (IUnitOperation* m : _models)
@@ -104,9 +104,34 @@ public:
 
 	virtual int linearSolve(double t, double timeFactor, double alpha, double tol, double* const rhs, double const* const weight,
 		double const* const y, double const* const yDot, double const* const res);
+	virtual int linearSolveMultiRhs(double t, double timeFactor, double alpha, double tol, double* const* const rhs, double const* const* const weight,
+		unsigned int nRhs, double const* const y, double const* const yDot, double const* const res);
+
+	virtual int residualAdjoint(const active& t, unsigned int secIdx, const active& timeFactor, double const* const y, double const* const yDot,
+		double const* const yB, double const* const yBdot, double* const resB, active* const adRes, active* const adY, unsigned int numSensAdDirs);
+	virtual int linearSolveAdjoint(double t, double timeFactor, double alpha, double tol, double* const rhs, double const* const weight,
+		double const* const yB, double const* const yBdot, double const* const resB);
 
 	virtual void prepareADvectors(active* const adRes, active* const adY, unsigned int numSensAdDirs) const;
 
+	/**
+	 * @brief Computes the contraction of the parameter derivatives of the residual with the adjoint state
+	 * @details Computes @f$ \lambda^T \frac{\partial F}{\partial p_j} @f$ for all sensitive parameters
+	 *          @f$ p_j @f$, which is the integrand of the parameter gradient in adjoint sensitivity analysis.
+	 * @param [in] nSens Number of sensitive parameters
+	 * @param [in] t Current time point
+	 * @param [in] secIdx Index of the current section
+	 * @param [in] timeFactor Used for time transformation (pre factor of time derivatives) and to compute parameter derivatives with respect to section length
+	 * @param [in] y Pointer to global state vector
+	 * @param [in] yDot Pointer to global time derivative state vector
+	 * @param [in] yB Pointer to global adjoint state vector @f$ \lambda @f$
+	 * @param [out] dResDp Array of size @p nSens that receives the contractions
+	 * @param [in,out] adRes Pointer to global residual vector of AD datatypes for computing the parameter derivatives
+	 * @return @c 0 on success, @c -1 on non-recoverable error, and @c +1 on recoverable error
+	 */
+	int residualAdjointParam(unsigned int nSens, const active& t, unsigned int secIdx, const active& timeFactor, double const* const y, 
+		double const* const yDot, double const* const yB, double* const dResDp, active* const adRes);
+
 	virtual void applyInitialCondition(double* const vecStateY, double* const vecStateYdot);
 	virtual void applyInitialCondition(IParameterProvider& paramProvider, double* const vecStateY, double* const vecStateYdot);
 
@@ -165,6 +190,8 @@ protected:
 	std::vector<IUnitOperation*> _models; //!< Unit operation models
 	std::vector<IExternalFunction*> _extFunctions; //!< External functions
 	std::vector<unsigned int> _dofOffset; //!< Vector with DOF offsets for each unit operation
+	std::vector<double*> _rhsPtr; //!< Pointers to the unit operation parts of the right hand sides in linearSolveMultiRhs()
+	std::vector<double const*> _weightPtr; //!< Pointers to the unit operation parts of the error weights in linearSolveMultiRhs()
 	util::SlicedVector<int> _connections; //!< Vector of connection lists for each section
 	std::vector<unsigned int> _switchSectionIndex; //!< Holds indices of sections where valves are switched
 
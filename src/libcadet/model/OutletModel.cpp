@@ -230,6 +230,24 @@ int OutletModel::linearSolve(double t, double timeFactor, double alpha, double t
 	return 0;
 }
 
+int OutletModel::linearSolveMultiRhs(double t, double timeFactor, double alpha, double tol, double* const* const rhs, double const* const* const weight,
+		unsigned int nRhs, double const* const y, double const* const yDot, double const* const res)
+{
+	return 0;
+}
+
+int OutletModel::residualAdjoint(const active& t, unsigned int secIdx, const active& timeFactor, double const* const y, double const* const yDot,
+	double const* const yB, double const* const yBdot, double* const resB, active* const adRes, active* const adY, unsigned int numSensAdDirs)
+{
+	return 0;
+}
+
+int OutletModel::linearSolveAdjoint(double t, double timeFactor, double alpha, double tol, double* const rhs, double const* const weight,
+		double const* const yB, double const* const yBdot, double const* const resB)
+{
+	return 0;
+}
+
 void OutletModel::consistentIntialSensitivity(const active& t, unsigned int secIdx, const active& timeFactor, double const* vecStateY, double const* vecStateYdot,
 	std::vector<double*>& vecSensY, std::vector<double*>& vecSensYdot, active* const adRes, active* const adY)
 {
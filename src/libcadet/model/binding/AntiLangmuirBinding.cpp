@@ -29,7 +29,7 @@ namespace model
 /**
  * @brief Handles Anti-Langmuir binding model parameters that do not depend on external functions
  */
-struct AntiLangmuirParamHandler : public BindingParamHandlerBase
+struct AntiLangmuirParamHandler : public BindingParamHandlerBase<AntiLangmuirParamHandler>
 {
 	static const char* identifier() { return "MULTI_COMPONENT_ANTILANGMUIR"; }
 
@@ -79,7 +79,7 @@ struct AntiLangmuirParamHandler : public BindingParamHandlerBase
 /**
  * @brief Handles Anti-Langmuir binding model parameters that depend on an external function
  */
-struct ExtAntiLangmuirParamHandler : public ExternalBindingParamHandlerBase
+struct ExtAntiLangmuirParamHandler : public ExternalBindingParamHandlerBase<ExtAntiLangmuirParamHandler>
 {
 	static const char* identifier() { return "EXT_MULTI_COMPONENT_ANTILANGMUIR"; }
 
@@ -98,7 +98,7 @@ struct ExtAntiLangmuirParamHandler : public ExternalBindingParamHandlerBase
 		CADET_READPAR_MATRIX(qMax, paramProvider, "MCAL_QMAX", nComp, 1);
 		CADET_READPAR_MATRIX(antiLangmuir, paramProvider, "MCAL_ANTILANGMUIR", nComp, 1);
 
-		return ExternalBindingParamHandlerBase::configure(paramProvider, 4);
+		return ExternalBindingParamHandlerBase<ExtAntiLangmuirParamHandler>::configure(paramProvider, 4);
 	}
 
 	/**
@@ -117,26 +117,31 @@ struct ExtAntiLangmuirParamHandler : public ExternalBindingParamHandlerBase
 	}
 
 	/**
-	 * @brief Updates local parameter cache in order to take the external profile into account
-	 * @details This function is declared const since the actual parameters are left unchanged by the method.
-	 *         The cache is marked as mutable in order to make it writable.
+	 * @brief Computes the parameters that take the external profile into account
+	 * @details The parameters are stored in the copy of this object owned by the calling thread (see localParams()).
+	 *          This function is, thus, safe to be called concurrently.
 	 * @param [in] t Current time
 	 * @param [in] z Axial coordinate in the column
 	 * @param [in] r Radial coordinate in the bead
 	 * @param [in] secIdx Index of the current section
 	 * @param [in] nComp Number of components
 	 * @param [in] nBoundStates Array with number of bound states for each component
+	 * @return Parameters at the given position
 	 */
-	inline void update(double t, double z, double r, unsigned int secIdx, unsigned int nComp, unsigned int const* nBoundStates) const
+	inline const ExtAntiLangmuirParamHandler& update(double t, double z, double r, unsigned int secIdx, unsigned int nComp, unsigned int const* nBoundStates) const
 	{
-		evaluateExternalFunctions(t, z, r, secIdx);
+		ExtAntiLangmuirParamHandler& p = localParams();
+		p.evaluateExternalFunctions(t, z, r, secIdx);
+
 		for (unsigned int i = 0; i < nComp; ++i)
 		{
-			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(kA, i, _extFunBuffer[0]);
-			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(kD, i, _extFunBuffer[1]);
-			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(qMax, i, _extFunBuffer[2]);
-			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(antiLangmuir, i, _extFunBuffer[3]);
+			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(p, kA, i, p._extFunBuffer[0]);
+			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(p, kD, i, p._extFunBuffer[1]);
+			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(p, qMax, i, p._extFunBuffer[2]);
+			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(p, antiLangmuir, i, p._extFunBuffer[3]);
 		}
+
+		return p;
 	}
 
 	CADET_DEFINE_EXTDEP_VARIABLE(std::vector<active>, kA)
@@ -178,8 +183,79 @@ public:
 	virtual int residual(double t, double z, double r, unsigned int secIdx, double timeFactor,
 		double const* y, double const* yDot, double* res) const;
 
+	CADET_BINDINGMODEL_FIXED_AD_RESIDUAL_DECL
+	CADET_BINDINGMODEL_SPARSE_AD_RESIDUAL_DECL
+
 	virtual void setExternalFunctions(IExternalFunction** extFuns, unsigned int size) { _p.setExternalFunctions(extFuns, size); }
-	
+
+	virtual bool hasAnalyticParamDerivative(const ParameterId& pId) const
+	{
+		// Derivatives with respect to the parameters of the external dependence are not implemented
+		if (ParamHandler_t::dependsOnExternalFunctions())
+			return false;
+
+		return (pId.name == hashString("MCAL_KA")) || (pId.name == hashString("MCAL_KD")) || (pId.name == hashString("MCAL_QMAX"))
+			|| (pId.name == hashString("MCAL_ANTILANGMUIR"));
+	}
+
+	virtual void analyticParamDerivative(const ParameterId& pId, double factor, double t, double z, double r, unsigned int secIdx,
+		double const* y, double* const dRes) const
+	{
+		const unsigned int comp = pId.component;
+		if (_nBoundStates[comp] == 0)
+			return;
+
+		// Non-binding components are not present in the solid phase
+		const unsigned int bndComp = numBoundStates(_nBoundStates, comp);
+		double const* const yCp = y - _nComp;
+
+		// Residual is  k_{d,i} * q_i - k_{a,i} * c_{p,i} * q_{max,i} * (1 - \sum_j a_j * q_j / q_{max,j})
+		double qSum = 1.0;
+		unsigned int bndIdx = 0;
+		for (int i = 0; i < _nComp; ++i)
+		{
+			if (_nBoundStates[i] == 0)
+				continue;
+
+			qSum -= static_cast<double>(_p.antiLangmuir[i]) * y[bndIdx] / static_cast<double>(_p.qMax[i]);
+			++bndIdx;
+		}
+
+		if (pId.name == hashString("MCAL_KA"))
+		{
+			dRes[bndComp] -= factor * yCp[comp] * static_cast<double>(_p.qMax[comp]) * qSum;
+			return;
+		}
+		else if (pId.name == hashString("MCAL_KD"))
+		{
+			dRes[bndComp] += factor * y[bndComp];
+			return;
+		}
+
+		// Derivative of the sum with respect to the parameter
+		const double qMax = static_cast<double>(_p.qMax[comp]);
+		double dqSum = 0.0;
+		if (pId.name == hashString("MCAL_QMAX"))
+		{
+			dqSum = static_cast<double>(_p.antiLangmuir[comp]) * y[bndComp] / (qMax * qMax);
+
+			// q_{max,comp} also appears in its own equation
+			dRes[bndComp] -= factor * static_cast<double>(_p.kA[comp]) * yCp[comp] * qSum;
+		}
+		else if (pId.name == hashString("MCAL_ANTILANGMUIR"))
+			dqSum = -y[bndComp] / qMax;
+
+		bndIdx = 0;
+		for (int i = 0; i < _nComp; ++i)
+		{
+			if (_nBoundStates[i] == 0)
+				continue;
+
+			dRes[bndIdx] -= factor * static_cast<double>(_p.kA[i]) * yCp[i] * static_cast<double>(_p.qMax[i]) * dqSum;
+			++bndIdx;
+		}
+	}
+
 protected:
 	ParamHandler_t _p; //!< Handles parameters and their dependence on external functions
 
@@ -208,7 +284,7 @@ protected:
 	int residualImpl(const ParamType& t, double z, double r, unsigned int secIdx, const ParamType& timeFactor,
 		StateType const* y, CpStateType const* yCp, double const* yDot, ResidualType* res) const
 	{
-		_p.update(static_cast<double>(t), z, r, secIdx, _nComp, _nBoundStates);
+		const ParamHandler_t& p = _p.update(static_cast<double>(t), z, r, secIdx, _nComp, _nBoundStates);
 
 		// Protein equations: dq_i / dt - ( k_{a,i} * c_{p,i} * (1 - \sum q_i / q_{max,i}) - k_{d,i} * q_i) == 0
 		//               <=>  dq_i / dt == k_{a,i} * c_{p,i} * (1 - \sum q_i / q_{max,i}) - k_{d,i} * q_i
@@ -220,7 +296,7 @@ protected:
 			if (_nBoundStates[i] == 0)
 				continue;
 
-			qSum -= static_cast<ParamType>(_p.antiLangmuir[i]) * y[bndIdx] / static_cast<ParamType>(_p.qMax[i]);
+			qSum -= static_cast<ParamType>(p.antiLangmuir[i]) * y[bndIdx] / static_cast<ParamType>(p.qMax[i]);
 
 			// Next bound component
 			++bndIdx;
@@ -234,7 +310,7 @@ protected:
 				continue;
 
 			// Residual
-			res[bndIdx] = static_cast<ParamType>(_p.kD[i]) * y[bndIdx] - static_cast<ParamType>(_p.kA[i]) * yCp[i] * static_cast<ParamType>(_p.qMax[i]) * qSum;
+			res[bndIdx] = static_cast<ParamType>(p.kD[i]) * y[bndIdx] - static_cast<ParamType>(p.kA[i]) * yCp[i] * static_cast<ParamType>(p.qMax[i]) * qSum;
 
 			// Add time derivative if necessary
 			if (_kineticBinding && yDot)
@@ -252,7 +328,7 @@ protected:
 	template <typename RowIterator>
 	void jacobianImpl(double t, double z, double r, unsigned int secIdx, double const* y, double const* yCp, RowIterator jac) const
 	{
-		_p.update(t, z, r, secIdx, _nComp, _nBoundStates);
+		const ParamHandler_t& p = _p.update(t, z, r, secIdx, _nComp, _nBoundStates);
 
 		// Protein equations: dq_i / dt - ( k_{a,i} * c_{p,i} * (1 - \sum q_i / q_{max,i}) - k_{d,i} * q_i) == 0
 		double qSum = 1.0;
@@ -263,7 +339,7 @@ protected:
 			if (_nBoundStates[i] == 0)
 				continue;
 
-			qSum -= static_cast<double>(_p.antiLangmuir[i]) * y[bndIdx] / static_cast<double>(_p.qMax[i]);
+			qSum -= static_cast<double>(p.antiLangmuir[i]) * y[bndIdx] / static_cast<double>(p.qMax[i]);
 
 			// Next bound component
 			++bndIdx;
@@ -276,11 +352,11 @@ protected:
 			if (_nBoundStates[i] == 0)
 				continue;
 
-			const double ka = static_cast<double>(_p.kA[i]);
-			const double kd = static_cast<double>(_p.kD[i]);
+			const double ka = static_cast<double>(p.kA[i]);
+			const double kd = static_cast<double>(p.kD[i]);
 
 			// dres_i / dc_{p,i}
-			jac[i - bndIdx - _nComp] = -ka * static_cast<double>(_p.qMax[i]) * qSum;
+			jac[i - bndIdx - _nComp] = -ka * static_cast<double>(p.qMax[i]) * qSum;
 			// Getting to c_{p,i}: -bndIdx takes us to q_0, another -nComp to c_{p,0} and a +i to c_{p,i}.
 			//                     This means jac[i - bndIdx - nComp] corresponds to c_{p,i}.
 
@@ -293,7 +369,7 @@ protected:
 					continue;
 
 				// dres_i / dq_j
-				jac[bndIdx2 - bndIdx] = ka * yCp[i] * static_cast<double>(_p.antiLangmuir[j]) * static_cast<double>(_p.qMax[i]) / static_cast<double>(_p.qMax[j]);
+				jac[bndIdx2 - bndIdx] = ka * yCp[i] * static_cast<double>(p.antiLangmuir[j]) * static_cast<double>(p.qMax[i]) / static_cast<double>(p.qMax[j]);
 				// Getting to q_j: -bndIdx takes us to q_0, another +bndIdx2 to q_j. This means jac[bndIdx2 - bndIdx] corresponds to q_j.
 
 				++bndIdx2;
@@ -30,7 +30,7 @@ namespace model
 /**
  * @brief Handles Bi-Langmuir binding model parameters that do not depend on external functions
  */
-struct BiLangmuirParamHandler : public BindingParamHandlerBase
+struct BiLangmuirParamHandler : public BindingParamHandlerBase<BiLangmuirParamHandler>
 {
 	static const char* identifier() { return "MULTI_COMPONENT_BILANGMUIR"; }
 
@@ -89,7 +89,7 @@ struct BiLangmuirParamHandler : public BindingParamHandlerBase
 /**
  * @brief Handles Bi-Langmuir binding model parameters that depend on an external function
  */
-struct ExtBiLangmuirParamHandler : public ExternalBindingParamHandlerBase
+struct ExtBiLangmuirParamHandler : public ExternalBindingParamHandlerBase<ExtBiLangmuirParamHandler>
 {
 	static const char* identifier() { return "EXT_MULTI_COMPONENT_BILANGMUIR"; }
 
@@ -107,7 +107,7 @@ struct ExtBiLangmuirParamHandler : public ExternalBindingParamHandlerBase
 		CADET_READPAR_BOUNDSTATEDEP(util::SlicedVector<active>, active, kD, paramProvider, "MCBL_KD", nComp, numSlices);
 		CADET_READPAR_BOUNDSTATEDEP(util::SlicedVector<active>, active, qMax, paramProvider, "MCBL_QMAX", nComp, numSlices);
 
-		return ExternalBindingParamHandlerBase::configure(paramProvider, 3);
+		return ExternalBindingParamHandlerBase<ExtBiLangmuirParamHandler>::configure(paramProvider, 3);
 	}
 
 	/**
@@ -137,25 +137,30 @@ struct ExtBiLangmuirParamHandler : public ExternalBindingParamHandlerBase
 	}
 
 	/**
-	 * @brief Updates local parameter cache in order to take the external profile into account
-	 * @details This function is declared const since the actual parameters are left unchanged by the method.
-	 *         The cache is marked as mutable in order to make it writable.
+	 * @brief Computes the parameters that take the external profile into account
+	 * @details The parameters are stored in the copy of this object owned by the calling thread (see localParams()).
+	 *          This function is, thus, safe to be called concurrently.
 	 * @param [in] t Current time
 	 * @param [in] z Axial coordinate in the column
 	 * @param [in] r Radial coordinate in the bead
 	 * @param [in] secIdx Index of the current section
 	 * @param [in] nComp Number of components
 	 * @param [in] nBoundStates Array with number of bound states for each component
+	 * @return Parameters at the given position
 	 */
-	inline void update(double t, double z, double r, unsigned int secIdx, unsigned int nComp, unsigned int const* nBoundStates) const
+	inline const ExtBiLangmuirParamHandler& update(double t, double z, double r, unsigned int secIdx, unsigned int nComp, unsigned int const* nBoundStates) const
 	{
-		evaluateExternalFunctions(t, z, r, secIdx);
+		ExtBiLangmuirParamHandler& p = localParams();
+		p.evaluateExternalFunctions(t, z, r, secIdx);
+
 		for (unsigned int i = 0; i < kAT0.size(); ++i)
 		{
-			CADET_UPDATE_EXTDEP_VARIABLE_NATIVE(kA, i, _extFunBuffer[0]);
-			CADET_UPDATE_EXTDEP_VARIABLE_NATIVE(kD, i, _extFunBuffer[1]);
-			CADET_UPDATE_EXTDEP_VARIABLE_NATIVE(qMax, i, _extFunBuffer[2]);
+			CADET_UPDATE_EXTDEP_VARIABLE_NATIVE(p, kA, i, p._extFunBuffer[0]);
+			CADET_UPDATE_EXTDEP_VARIABLE_NATIVE(p, kD, i, p._extFunBuffer[1]);
+			CADET_UPDATE_EXTDEP_VARIABLE_NATIVE(p, qMax, i, p._extFunBuffer[2]);
 		}
+
+		return p;
 	}
 
 	CADET_DEFINE_EXTDEP_VARIABLE(util::SlicedVector<active>, kA)
@@ -228,6 +233,9 @@ public:
 	virtual int residual(double t, double z, double r, unsigned int secIdx, double timeFactor,
 		double const* y, double const* yDot, double* res) const;
 
+	CADET_BINDINGMODEL_FIXED_AD_RESIDUAL_DECL
+	CADET_BINDINGMODEL_SPARSE_AD_RESIDUAL_DECL
+
 	virtual void setExternalFunctions(IExternalFunction** extFuns, unsigned int size) { _p.setExternalFunctions(extFuns, size); }
 
 	virtual bool hasSalt() const CADET_NOEXCEPT { return false; }
@@ -265,14 +273,14 @@ protected:
 	int residualImpl(const ParamType& t, double z, double r, unsigned int secIdx, const ParamType& timeFactor,
 		StateType const* y, CpStateType const* yCp, double const* yDot, ResidualType* res) const
 	{
-		_p.update(static_cast<double>(t), z, r, secIdx, _nComp, _nBoundStates);
+		const ParamHandler_t& p = _p.update(static_cast<double>(t), z, r, secIdx, _nComp, _nBoundStates);
 
 		const bool hasYdot = yDot;
 
 		// Protein equations: dq_i^j / dt - ( k_{a,i}^j * c_{p,i} * (1 - \sum q_i^j / q_{max,i}^j) - k_{d,i}^j * q_i^j) == 0
 		//               <=>  dq_i^j / dt == k_{a,i}^j * c_{p,i} * (1 - \sum q_i^j / q_{max,i}^j) - k_{d,i}^j * q_i^j
 
-		const unsigned int nSites = _p.kA.slices();
+		const unsigned int nSites = p.kA.slices();
 
 		// Ordering of the states is (q_{comp,state})
 		// q_{0,0}, q{0,1}, q_{0,2}, q_{1,0}, q_{1,1}, q_{1,2}, ...
@@ -288,9 +296,9 @@ protected:
 			// y, yDot, and res point to q_{0,site}
 
 			// Get parameter slice for current binding site type
-			active const* const localKa = _p.kA[site];
-			active const* const localKd = _p.kD[site];
-			active const* const localQmax = _p.qMax[site];
+			active const* const localKa = p.kA[site];
+			active const* const localKd = p.kD[site];
+			active const* const localQmax = p.qMax[site];
 
 			ResidualType qSum = 1.0;
 			unsigned int bndIdx = 0;
@@ -337,7 +345,7 @@ protected:
 	template <typename RowIterator>
 	void jacobianImpl(double t, double z, double r, unsigned int secIdx, double const* y, double const* yCp, RowIterator jac) const
 	{
-		_p.update(t, z, r, secIdx, _nComp, _nBoundStates);
+		const ParamHandler_t& p = _p.update(t, z, r, secIdx, _nComp, _nBoundStates);
 
 		// Protein equations: dq_i^j / dt - ( k_{a,i}^j * c_{p,i} * (1 - \sum q_i^j / q_{max,i}^j) - k_{d,i}^j * q_i^j) == 0
 
@@ -346,15 +354,15 @@ protected:
 		// Ordering of the equations is the same, that is, we need nSites steps to jump from one equation of a Langmuir
 		// binding model system to the next.
 
-		const int nSites = static_cast<int>(_p.kA.slices());
+		const int nSites = static_cast<int>(p.kA.slices());
 
 		// Loop over all binding site types
 		for (unsigned int site = 0; site < nSites; ++site, ++y)
 		{
 			// Get parameter slice for current binding site type
-			active const* const localKa = _p.kA[site];
-			active const* const localKd = _p.kD[site];
-			active const* const localQmax = _p.qMax[site];
+			active const* const localKa = p.kA[site];
+			active const* const localKd = p.kD[site];
+			active const* const localQmax = p.qMax[site];
 
 			double qSum = 1.0;
 			int bndIdx = 0;
@@ -14,6 +14,7 @@
 #include "model/binding/ExternalFunctionSupport.hpp"
 #include "model/binding/BindingModelMacros.hpp"
 #include "model/binding/RefConcentrationSupport.hpp"
+#include "model/binding/PowerLookupTable.hpp"
 #include "model/ModelUtils.hpp"
 #include "cadet/Exceptions.hpp"
 #include "nonlin/Solver.hpp"
@@ -38,7 +39,7 @@ namespace model
 /**
  * @brief Handles Bi-SMA binding model parameters that do not depend on external functions
  */
-struct BiSMAParamHandler : public BindingParamHandlerBase
+struct BiSMAParamHandler : public BindingParamHandlerBase<BiSMAParamHandler>
 {
 	static const char* identifier() { return "BI_STERIC_MASS_ACTION"; }
 
@@ -114,7 +115,7 @@ struct BiSMAParamHandler : public BindingParamHandlerBase
 /**
  * @brief Handles Bi-SMA binding model parameters that depend on an external function
  */
-struct ExtBiSMAParamHandler : public ExternalBindingParamHandlerBase
+struct ExtBiSMAParamHandler : public ExternalBindingParamHandlerBase<ExtBiSMAParamHandler>
 {
 	static const char* identifier() { return "EXT_BI_STERIC_MASS_ACTION"; }
 
@@ -136,7 +137,7 @@ struct ExtBiSMAParamHandler : public ExternalBindingParamHandlerBase
 
 		readReferenceConcentrations(paramProvider, numSlices, "EXT_BISMA_", refC0, refQ);
 
-		return ExternalBindingParamHandlerBase::configure(paramProvider, 5);
+		return ExternalBindingParamHandlerBase<ExtBiSMAParamHandler>::configure(paramProvider, 5);
 	}
 
 	/**
@@ -173,29 +174,34 @@ struct ExtBiSMAParamHandler : public ExternalBindingParamHandlerBase
 	}
 
 	/**
-	 * @brief Updates local parameter cache in order to take the external profile into account
-	 * @details This function is declared const since the actual parameters are left unchanged by the method.
-	 *         The cache is marked as mutable in order to make it writable.
+	 * @brief Computes the parameters that take the external profile into account
+	 * @details The parameters are stored in the copy of this object owned by the calling thread (see localParams()).
+	 *          This function is, thus, safe to be called concurrently.
 	 * @param [in] t Current time
 	 * @param [in] z Axial coordinate in the column
 	 * @param [in] r Radial coordinate in the bead
 	 * @param [in] secIdx Index of the current section
 	 * @param [in] nComp Number of components
 	 * @param [in] nBoundStates Array with number of bound states for each component
+	 * @return Parameters at the given position
 	 */
-	inline void update(double t, double z, double r, unsigned int secIdx, unsigned int nComp, unsigned int const* nBoundStates) const
+	inline const ExtBiSMAParamHandler& update(double t, double z, double r, unsigned int secIdx, unsigned int nComp, unsigned int const* nBoundStates) const
 	{
-		evaluateExternalFunctions(t, z, r, secIdx);
+		ExtBiSMAParamHandler& p = localParams();
+		p.evaluateExternalFunctions(t, z, r, secIdx);
+
 		for (unsigned int i = 0; i < kAT0.size(); ++i)
 		{
-			CADET_UPDATE_EXTDEP_VARIABLE_NATIVE(kA, i, _extFunBuffer[0]);
-			CADET_UPDATE_EXTDEP_VARIABLE_NATIVE(kD, i, _extFunBuffer[1]);
-			CADET_UPDATE_EXTDEP_VARIABLE_NATIVE(nu, i, _extFunBuffer[2]);
-			CADET_UPDATE_EXTDEP_VARIABLE_NATIVE(sigma, i, _extFunBuffer[3]);
+			CADET_UPDATE_EXTDEP_VARIABLE_NATIVE(p, kA, i, p._extFunBuffer[0]);
+			CADET_UPDATE_EXTDEP_VARIABLE_NATIVE(p, kD, i, p._extFunBuffer[1]);
+			CADET_UPDATE_EXTDEP_VARIABLE_NATIVE(p, nu, i, p._extFunBuffer[2]);
+			CADET_UPDATE_EXTDEP_VARIABLE_NATIVE(p, sigma, i, p._extFunBuffer[3]);
 		}
 
 		for (unsigned int i = 0; i < lambdaT0.size(); ++i)
-			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(lambda, i, _extFunBuffer[4]);
+			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(p, lambda, i, p._extFunBuffer[4]);
+
+		return p;
 	}
 
 	CADET_DEFINE_EXTDEP_VARIABLE(util::SlicedVector<active>, kA)
@@ -228,6 +234,10 @@ struct ExtBiSMAParamHandler : public ExternalBindingParamHandlerBase
  *          \end{align} \f]
  *          First, all the salt components are collected in one block as they are always algebraic.
  *          Then the other components for each bound state follow.
+ *
+ *          For long simulations with fixed parameters, the powers @f$ c_{p,0}^{\nu_i} @f$ and @f$ \bar{q}_0^{\nu_i} @f$ can be
+ *          tabulated on the ranges @c BISMA_LOOKUP_SALT_RANGE and @c BISMA_LOOKUP_QBAR_RANGE by enabling @c BISMA_LOOKUP_TABLE
+ *          (see PowerLookupTable).
  * @tparam ParamHandler_t Type that can add support for external function dependence
  */
 template <class ParamHandler_t>
@@ -291,14 +301,15 @@ public:
 
 	virtual void consistentInitialState(double t, double z, double r, unsigned int secIdx, double* const vecStateY, double errorTol, 
 		active* const adRes, active* const adY, unsigned int adEqOffset, unsigned int adOffset, unsigned int diagDir, 
-		unsigned int lowerBandwidth, unsigned int upperBandwidth, double* const workingMemory, linalg::detail::DenseMatrixBase& workingMat) const
+		unsigned int lowerBandwidth, unsigned int upperBandwidth, double* const workingMemory, linalg::detail::DenseMatrixBase& workingMat,
+		BindingWarmStart* const warmStart) const
 	{
-		_p.update(t, z, r, secIdx, _nComp, _nBoundStates);
+		const ParamHandler_t& p = _p.update(t, z, r, secIdx, _nComp, _nBoundStates);
 
 		// If we have kinetic binding, there is only the algebraic salt equation
 		if (_kineticBinding)
 		{
-			const unsigned int numStates = _p.lambda.size();
+			const unsigned int numStates = p.lambda.size();
 
 			// Loop over all binding site types
 			for (unsigned int bndSite = 0; bndSite < numStates; ++bndSite)
@@ -306,10 +317,10 @@ public:
 				// Compute salt component from given bound states q_j
 				// Salt equation: q_0 - Lambda + Sum[nu_j * q_j, j] == 0 
 				//           <=>  q_0 == Lambda - Sum[nu_j * q_j, j] 
-				vecStateY[bndSite] = static_cast<double>(_p.lambda[bndSite]);
+				vecStateY[bndSite] = static_cast<double>(p.lambda[bndSite]);
 
 				// Get nu slice for bound state bndSite
-				active const* const curNu = _p.nu[bndSite];
+				active const* const curNu = p.nu[bndSite];
 
 				unsigned int bndIdx = 1;
 				for (int j = 1; j < _nComp; ++j)
@@ -333,7 +344,6 @@ public:
 
 		// Determine problem size
 		const unsigned int eqSize = numBoundStates(_nBoundStates, _nComp);
-		std::fill(workingMemory, workingMemory + _nonlinearSolver->workspaceSize(eqSize), 0.0);
 
 		// Select between analytic and AD Jacobian
 		std::function<bool(double const* const, linalg::detail::DenseMatrixBase& jac)> jacobianFunc;
@@ -374,12 +384,12 @@ public:
 			};
 		}
 
-		const bool conv = _nonlinearSolver->solve([&](double const* const x, double* const res) -> bool {
+		const bool conv = solveAlgebraicEquations([&](double const* const x, double* const res) -> bool {
 				residualImpl<double, double, double, double>(t, z, r, secIdx, 1.0, x, vecStateY - _nComp, nullptr, res); 
 				return true; 
 			}, 
 			jacobianFunc,
-			errorTol, vecStateY, workingMemory, workingMat, eqSize);
+			errorTol, vecStateY, workingMemory, workingMat, eqSize, warmStart);
 	}
 
 	virtual int residual(const active& t, double z, double r, unsigned int secIdx, const active& timeFactor, 
@@ -394,6 +404,9 @@ public:
 	virtual int residual(double t, double z, double r, unsigned int secIdx, double timeFactor, 
 		double const* y, double const* yDot, double* res) const;
 
+	CADET_BINDINGMODEL_FIXED_AD_RESIDUAL_DECL
+	CADET_BINDINGMODEL_SPARSE_AD_RESIDUAL_DECL
+
 	virtual void setExternalFunctions(IExternalFunction** extFuns, unsigned int size) { _p.setExternalFunctions(extFuns, size); }
 
 	virtual void analyticJacobian(double t, double z, double r, unsigned int secIdx, double const* y, linalg::BandMatrix::RowIterator jac) const
@@ -438,6 +451,8 @@ public:
 protected:
 	ParamHandler_t _p; //!< Handles parameters and their dependence on external functions
 	unsigned int _numBindingComp; //!< Number of binding components
+	std::vector<PowerLookupTable> _saltPowTable; //!< Lookup tables for @f$ \left( c_{p,0} / c_{\text{ref}} \right)^{\nu_i} @f$ in state-major ordering
+	std::vector<PowerLookupTable> _qBarPowTable; //!< Lookup tables for @f$ \left( \bar{q}_0 / q_{\text{ref}} \right)^{\nu_i} @f$ in state-major ordering
 
 	virtual bool configureImpl(bool reconfigure, IParameterProvider& paramProvider, unsigned int unitOpIdx)
 	{
@@ -449,17 +464,63 @@ protected:
 		// Register parameters
 		_p.registerParameters(_parameters, unitOpIdx, _nComp, _nBoundStates);
 
+		PowerLookupTableSettings lookupSettings;
+		lookupSettings.configure(paramProvider, "BISMA_");
+		configureLookupTables(paramProvider, lookupSettings, numStates);
+
 		return true;
 	}
 
+	void configureLookupTables(IParameterProvider& paramProvider, const PowerLookupTableSettings& settings, unsigned int numStates)
+	{
+		_saltPowTable.assign(_nComp * numStates, PowerLookupTable());
+		_qBarPowTable.assign(_nComp * numStates, PowerLookupTable());
+
+		if (!settings.enabled)
+			return;
+
+		if (ParamHandler_t::dependsOnExternalFunctions())
+		{
+			LOG(Warning) << "Lookup tables are not supported by " << identifier() << ", using direct evaluation";
+			return;
+		}
+
+		double cMin = 0.0;
+		double cMax = 0.0;
+		double qMin = 0.0;
+		double qMax = 0.0;
+		PowerLookupTableSettings::readRange(paramProvider, "BISMA_LOOKUP_SALT_RANGE", cMin, cMax);
+		PowerLookupTableSettings::readRange(paramProvider, "BISMA_LOOKUP_QBAR_RANGE", qMin, qMax);
+
+		// Tables are built for the arguments divided by the reference concentrations
+		for (unsigned int bndSite = 0; bndSite < numStates; ++bndSite)
+		{
+			active const* const curNu = _p.nu[bndSite];
+			const double refC0 = static_cast<double>(_p.refC0[bndSite]);
+			const double refQ = static_cast<double>(_p.refQ[bndSite]);
+
+			for (int i = 1; i < _nComp; ++i)
+			{
+				if (_nBoundStates[i] == 0)
+					continue;
+
+				const double nu = static_cast<double>(curNu[i]);
+				if (!_saltPowTable[bndSite * _nComp + i].build(nu, cMin / refC0, cMax / refC0, settings))
+					LOG(Warning) << "Salt lookup table for BISMA_NU of component " << i << " and binding site " << bndSite << " does not reach tolerance " << settings.tolerance << " with " << settings.maxPoints << " points, using direct evaluation";
+				if (!_qBarPowTable[bndSite * _nComp + i].build(nu, qMin / refQ, qMax / refQ, settings))
+					LOG(Warning) << "Bound salt lookup table for BISMA_NU of component " << i << " and binding site " << bndSite << " does not reach tolerance " << settings.tolerance << " with " << settings.maxPoints << " points, using direct evaluation";
+			}
+		}
+	}
+
 	template <typename StateType, typename CpStateType, typename ResidualType, typename ParamType>
 	int residualImpl(const ParamType& t, double z, double r, unsigned int secIdx, const ParamType& timeFactor,
 		StateType const* y, CpStateType const* yCp, double const* yDot, ResidualType* res) const
 	{
-		_p.update(static_cast<double>(t), z, r, secIdx, _nComp, _nBoundStates);
+		const ParamHandler_t& p = _p.update(static_cast<double>(t), z, r, secIdx, _nComp, _nBoundStates);
 
 		const bool hasYdot = yDot;
-		const unsigned int numStates = _p.lambda.size();
+		const unsigned int numStates = p.lambda.size();
 
 		// Ordering of the states is (q_{comp,state})
 		// q_{0,0}, q{0,1}, q_{0,2}, q_{1,0}, q_{1,1}, q_{1,2}, ...
@@ -474,10 +535,10 @@ protected:
 		{
 			// y, yDot, and res point to q_{0,site}
 
-			active const* const curNu = _p.nu[bndSite];
-			active const* const curSigma = _p.sigma[bndSite];
-			active const* const curKa = _p.kA[bndSite];
-			active const* const curKd = _p.kD[bndSite];
+			active const* const curNu = p.nu[bndSite];
+			active const* const curSigma = p.sigma[bndSite];
+			active const* const curKa = p.kA[bndSite];
+			active const* const curKd = p.kD[bndSite];
 
 			const ParamType refC0 = static_cast<ParamType>(_p.refC0[bndSite]);
 			const ParamType refQ = static_cast<ParamType>(_p.refQ[bndSite]);
@@ -485,7 +546,7 @@ protected:
 			// Salt equation: q_0 - Lambda + Sum[nu_j * q_j, j] == 0 
 			//           <=>  q_0 == Lambda - Sum[nu_j * q_j, j] 
 			// Also compute \bar{q}_0 = q_0 - Sum[sigma_j * q_j, j]
-			res[0] = y[0] - static_cast<ParamType>(_p.lambda[bndSite]);
+			res[0] = y[0] - static_cast<ParamType>(p.lambda[bndSite]);
 			ResidualType q0_bar = y[0];
 
 			// bndIdx is used as a counter inside one binding site type
@@ -516,8 +577,8 @@ protected:
 				if (_nBoundStates[i] == 0)
 					continue;
 
-				const ResidualType c0_pow_nu_divRef = pow(yCp0_divRef, static_cast<ParamType>(curNu[i]));
-				const ResidualType q0_bar_pow_nu_divRef = pow(q0_bar_divRef, static_cast<ParamType>(curNu[i]));
+				const ResidualType c0_pow_nu_divRef = tabulatedPow<ResidualType>(_saltPowTable[bndSite * _nComp + i], yCp0_divRef, static_cast<ParamType>(curNu[i]));
+				const ResidualType q0_bar_pow_nu_divRef = tabulatedPow<ResidualType>(_qBarPowTable[bndSite * _nComp + i], q0_bar_divRef, static_cast<ParamType>(curNu[i]));
 
 				// Residual
 				res[bndIdx * numStates] = static_cast<ParamType>(curKd[i]) * y[bndIdx * numStates] * c0_pow_nu_divRef - static_cast<ParamType>(curKa[i]) * yCp[i] * q0_bar_pow_nu_divRef;
@@ -538,9 +599,9 @@ protected:
 	template <typename RowIterator>
 	void jacobianImpl(double t, double z, double r, unsigned int secIdx, double const* y, double const* yCp, RowIterator jac) const
 	{
-		_p.update(t, z, r, secIdx, _nComp, _nBoundStates);
+		const ParamHandler_t& p = _p.update(t, z, r, secIdx, _nComp, _nBoundStates);
 
-		const unsigned int numStates = _p.lambda.size();
+		const unsigned int numStates = p.lambda.size();
 
 		// Ordering of the states is (q_{comp,state}, example uses 2 components, 3 binding sites)
 		// q_{0,0}, q{0,1}, q_{0,2}, q_{1,0}, q_{1,1}, q_{1,2}, ...
@@ -553,10 +614,10 @@ protected:
 			// Jump from first row to current Salt row
 			RowIterator curJac = jac + bndSite;
 
-			active const* const curNu = _p.nu[bndSite];
-			active const* const curSigma = _p.sigma[bndSite];
-			active const* const curKa = _p.kA[bndSite];
-			active const* const curKd = _p.kD[bndSite];
+			active const* const curNu = p.nu[bndSite];
+			active const* const curSigma = p.sigma[bndSite];
+			active const* const curKa = p.kA[bndSite];
+			active const* const curKd = p.kD[bndSite];
 			const double refC0 = static_cast<double>(_p.refC0[bndSite]);
 			const double refQ = static_cast<double>(_p.refQ[bndSite]);
 			double q0_bar = y[0];
@@ -605,17 +666,21 @@ protected:
 				const double kd = static_cast<double>(curKd[i]);
 				const double nu = static_cast<double>(curNu[i]);
 
-				const double c0_pow_nu     = pow(yCp0_divRef, nu);
-				const double q0_bar_pow_nu = pow(q0_bar_divRef, nu);
-				const double c0_pow_nu_m1_divRef     = pow(yCp0_divRef, nu - 1.0);
-				const double q0_bar_pow_nu_m1_divRef = pow(q0_bar_divRef, nu - 1.0) / refQ;
+				// Values and derivatives nu * x^{nu - 1} of the powers
+				double c0_pow_nu = 0.0;
+				double c0_pow_nu_deriv = 0.0;
+				double q0_bar_pow_nu = 0.0;
+				double q0_bar_pow_nu_deriv = 0.0;
+				_saltPowTable[bndSite * _nComp + i].evaluate(yCp0_divRef, nu, c0_pow_nu, c0_pow_nu_deriv);
+				_qBarPowTable[bndSite * _nComp + i].evaluate(q0_bar_divRef, nu, q0_bar_pow_nu, q0_bar_pow_nu_deriv);
+				const double q0_bar_pow_nu_deriv_divRef = q0_bar_pow_nu_deriv / refQ;
 
 				// dres_i / dc_{p,0}
-				curJac[-bndSite - _nComp - numStates * bndIdx] = kd * y[bndIdx * numStates] * nu * c0_pow_nu_m1_divRef / refC0;
+				curJac[-bndSite - _nComp - numStates * bndIdx] = kd * y[bndIdx * numStates] * c0_pow_nu_deriv / refC0;
 				// dres_i / dc_{p,i}
 				curJac[i - bndSite - _nComp - numStates * bndIdx] = -ka * q0_bar_pow_nu;
 				// dres_i / dq_{0,bndSite}
-				curJac[-bndIdx * numStates] = -ka * yCp[i] * nu * q0_bar_pow_nu_m1_divRef;
+				curJac[-bndIdx * numStates] = -ka * yCp[i] * q0_bar_pow_nu_deriv_divRef;
 
 				// Fill dres_i / dq_{j,bndSite}
 				int bndIdx2 = 1;
@@ -626,7 +691,7 @@ protected:
 						continue;
 
 					// dres_i / dq_{j,bndSite}
-					curJac[(bndIdx2 - bndIdx) * numStates] = -ka * yCp[i] * nu * q0_bar_pow_nu_m1_divRef * (-static_cast<double>(curSigma[j]));
+					curJac[(bndIdx2 - bndIdx) * numStates] = -ka * yCp[i] * q0_bar_pow_nu_deriv_divRef * (-static_cast<double>(curSigma[j]));
 					// Getting to q_j: -bndIdx * numStates takes us to q_{0,bndSite}, another +bndIdx2 * numStates to
 					// q_{j,bndSite}. This means curJac[(bndIdx2 - bndIdx) * numStates] corresponds to q_{j,bndSite}.
 
@@ -31,6 +31,61 @@ namespace cadet
 namespace model
 {
 
+namespace
+{
+	/**
+	 * @brief Performs simplified Newton iterations with a fixed factorized Jacobian
+	 * @details The iteration is aborted as soon as the Newton corrections do not contract sufficiently,
+	 *          which also detects a Jacobian that does not fit the current problem anymore. In this case,
+	 *          the initial point is restored. Like the adaptive trust-region Newton method, the iteration
+	 *          is terminated when the @f$ \ell^2 @f$-norm of the Newton correction is below @p errorTol.
+	 * @param [in] residual Function providing the residual of the nonlinear equation system
+	 * @param [in] jacobian Factorized Jacobian
+	 * @param [in] errorTol Termination criterion on the Newton correction
+	 * @param [in,out] point On entry initial guess, on exit solution or unchanged if not successful
+	 * @param [in] workingMemory Working memory of size @f$ 2n @f$, where @f$ n @f$ is the problem @p size
+	 * @param [in] size Size of the problem
+	 * @return @c true if the iteration has converged, otherwise @c false
+	 */
+	bool simplifiedNewtonIteration(const std::function<bool(double const* const, double* const)>& residual, const linalg::detail::DenseMatrixBase& jacobian,
+		double errorTol, double* const point, double* const workingMemory, unsigned int size)
+	{
+		const unsigned int maxIter = 5;
+		const double thetaMax = 0.25;
+
+		double* const dx = workingMemory;
+		double* const initialPoint = workingMemory + size;
+		std::copy(point, point + size, initialPoint);
+
+		if (!residual(point, dx) || !jacobian.solve(dx))
+			return false;
+
+		double errNorm = linalg::l2Norm(dx, size);
+		for (unsigned int kIter = 0; ; ++kIter)
+		{
+			// Apply correction (the negation has been omitted when solving with the Jacobian)
+			for (unsigned int i = 0; i < size; ++i)
+				point[i] -= dx[i];
+
+			if (errNorm <= errorTol)
+				return true;
+
+			if ((kIter >= maxIter) || !residual(point, dx) || !jacobian.solve(dx))
+				break;
+
+			// Check contraction of the corrections (negated comparison also catches NaN)
+			const double errNormNext = linalg::l2Norm(dx, size);
+			if (!(errNormNext <= thetaMax * errNorm))
+				break;
+
+			errNorm = errNormNext;
+		}
+
+		std::copy(initialPoint, initialPoint + size, point);
+		return false;
+	}
+}
+
 BindingModelBase::BindingModelBase() : _nComp(0), _nBoundStates(nullptr), _nonlinearSolver(nullptr) { }
 BindingModelBase::~BindingModelBase() CADET_NOEXCEPT
 {
@@ -87,6 +142,61 @@ bool BindingModelBase::configureNonlinearSolver(IParameterProvider& paramProvide
 	return true;	
 }
 
+bool BindingModelBase::solveAlgebraicEquations(const std::function<bool(double const* const, double* const)>& residual, 
+	const std::function<bool(double const* const, linalg::detail::DenseMatrixBase&)>& jacobian, double errorTol, double* const point, 
+	double* const workingMemory, linalg::detail::DenseMatrixBase& workingMat, unsigned int size, BindingWarmStart* const warmStart) const
+{
+	if (!warmStart)
+		return _nonlinearSolver->solve(residual, jacobian, errorTol, point, workingMemory, workingMat, size, nullptr);
+
+	++warmStart->numSolves;
+
+	const bool canStoreJacobian = (warmStart->jacobian.rows() == size) && (warmStart->jacobian.columns() == size)
+		&& (workingMat.rows() == size) && (workingMat.columns() == size);
+
+	const std::function<bool(double const* const, double* const)> countedResidual = [&](double const* const x, double* const res) -> bool
+		{
+			++warmStart->numResidualEvals;
+			return residual(x, res);
+		};
+
+	// Try to reuse the Jacobian of the previous consistent initialization
+	if (warmStart->hasJacobian && canStoreJacobian)
+	{
+		if (!warmStart->isFactorized)
+		{
+			warmStart->isFactorized = warmStart->jacobian.factorize();
+			warmStart->hasJacobian = warmStart->isFactorized;
+		}
+
+		if (warmStart->isFactorized && simplifiedNewtonIteration(countedResidual, warmStart->jacobian, errorTol, point, workingMemory, size))
+		{
+			++warmStart->numReused;
+			return true;
+		}
+	}
+
+	const std::function<bool(double const* const, linalg::detail::DenseMatrixBase&)> countedJacobian = [&](double const* const x, linalg::detail::DenseMatrixBase& mat) -> bool
+		{
+			++warmStart->numJacobianEvals;
+			if (!jacobian(x, mat))
+				return false;
+
+			// Keep a copy for the next consistent initialization
+			if (canStoreJacobian)
+			{
+				warmStart->jacobian.submatrixAssign(mat, 0, 0, size, size);
+				warmStart->hasJacobian = true;
+				warmStart->isFactorized = false;
+			}
+			return true;
+		};
+
+	// The stored Jacobian is kept even if the solver reports failure (e.g., one subsolver of a composite
+	// solver has not met its tolerance) since the contraction check above rejects unsuitable Jacobians
+	return _nonlinearSolver->solve(countedResidual, countedJacobian, errorTol, point, workingMemory, workingMat, size, &warmStart->solverState);
+}
+
 std::unordered_map<ParameterId, double> BindingModelBase::getAllParameterValues() const
 {
 	std::unordered_map<ParameterId, double> data;
@@ -141,6 +251,39 @@ unsigned int BindingModelBase::consistentInitializationWorkspaceSize() const
 	return _nonlinearSolver->workspaceSize(eqSize);
 }
 
+int BindingModelBase::residualBatch(double t, double z, double const* r, unsigned int secIdx, double timeFactor, unsigned int nShells,
+	unsigned int stride, double const* y, double const* yDot, double* res) const
+{
+	// Evaluate each shell separately
+	int retCode = 0;
+	for (unsigned int i = 0; i < nShells; ++i)
+	{
+		const int shellRet = residual(t, z, r[i], secIdx, timeFactor, y + i * stride, yDot ? yDot + i * stride : nullptr, res + i * stride);
+		if (shellRet < 0)
+			return shellRet;
+		else if (shellRet > 0)
+			retCode = shellRet;
+	}
+	return retCode;
+}
+
+void BindingModelBase::analyticJacobianBatch(double t, double z, double const* r, unsigned int secIdx, unsigned int nShells,
+	unsigned int stride, double const* y, linalg::BandMatrix::RowIterator jac) const
+{
+	// Evaluate each shell separately
+	for (unsigned int i = 0; i < nShells; ++i, jac += stride)
+		analyticJacobian(t, z, r[i], secIdx, y + i * stride, jac);
+}
+
+int BindingModelBase::residualWithJacobianBatch(double t, double z, double const* r, unsigned int secIdx, double timeFactor, unsigned int nShells,
+	unsigned int stride, double const* y, double const* yDot, double* res, linalg::BandMatrix::RowIterator jac) const
+{
+	// No intermediate results are shared
+	const int retCode = residualBatch(t, z, r, secIdx, timeFactor, nShells, stride, y, yDot, res);
+	analyticJacobianBatch(t, z, r, secIdx, nShells, stride, y, jac);
+	return retCode;
+}
+
 
 
 PureBindingModelBase::PureBindingModelBase() { }
@@ -185,7 +328,8 @@ void PureBindingModelBase::multiplyWithDerivativeJacobian(double const* yDotS, d
 
 void PureBindingModelBase::consistentInitialState(double t, double z, double r, unsigned int secIdx, double* const vecStateY, double errorTol, 
 	active* const adRes, active* const adY, unsigned int adEqOffset, unsigned int adOffset, unsigned int diagDir, 
-	unsigned int lowerBandwidth, unsigned int upperBandwidth, double* const workingMemory, linalg::detail::DenseMatrixBase& workingMat) const
+	unsigned int lowerBandwidth, unsigned int upperBandwidth, double* const workingMemory, linalg::detail::DenseMatrixBase& workingMat,
+	BindingWarmStart* const warmStart) const
 {
 	// If we have kinetic binding, there are no algebraic equations and we are done
 	if (_kineticBinding)
@@ -201,12 +345,6 @@ void PureBindingModelBase::consistentInitialState(double t, double z, double r,
 	cadet_assert(workingMat.rows() >= eqSize);
 	cadet_assert(workingMat.columns() >= eqSize);
 
-	std::fill(workingMemory, workingMemory + _nonlinearSolver->workspaceSize(eqSize), 0.0);
-
-	// Check if workingMat satisfies size requirements
-	cadet_assert(workingMat.rows() >= eqSize);
-	cadet_assert(workingMat.columns() >= eqSize);
-
 	// Select between analytic and AD Jacobian
 	std::function<bool(double const* const, linalg::detail::DenseMatrixBase& jac)> jacobianFunc;
 	if (adRes && adY)
@@ -246,12 +384,12 @@ void PureBindingModelBase::consistentInitialState(double t, double z, double r,
 		};
 	}
 
-	const bool conv = _nonlinearSolver->solve([&](double const* const x, double* const res) -> bool {
+	const bool conv = solveAlgebraicEquations([&](double const* const x, double* const res) -> bool {
 			residualCore(t, z, r, secIdx, 1.0, x, vecStateY - _nComp, nullptr, res); 
 			return true; 
 		}, 
 		jacobianFunc,
-		errorTol, vecStateY, workingMemory, workingMat, eqSize);
+		errorTol, vecStateY, workingMemory, workingMat, eqSize, warmStart);
 }
 
 void PureBindingModelBase::analyticJacobian(double t, double z, double r, unsigned int secIdx, double const* y, linalg::BandMatrix::RowIterator jac) const
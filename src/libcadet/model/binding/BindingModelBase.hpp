@@ -24,6 +24,7 @@
 
 #include <vector>
 #include <unordered_map>
+#include <functional>
 
 namespace cadet
 {
@@ -71,11 +72,24 @@ public:
 	virtual bool hasSalt() const CADET_NOEXCEPT { return false; }
 	virtual bool supportsMultistate() const CADET_NOEXCEPT { return false; }
 	virtual bool supportsNonBinding() const CADET_NOEXCEPT { return true; }
+	virtual bool hasStateIndependentJacobian() const CADET_NOEXCEPT { return false; }
 
 	virtual unsigned int consistentInitializationWorkspaceSize() const;
 
+	virtual bool supportsBatchEvaluation() const CADET_NOEXCEPT { return false; }
+	virtual int residualBatch(double t, double z, double const* r, unsigned int secIdx, double timeFactor, unsigned int nShells,
+		unsigned int stride, double const* y, double const* yDot, double* res) const;
+	virtual void analyticJacobianBatch(double t, double z, double const* r, unsigned int secIdx, unsigned int nShells,
+		unsigned int stride, double const* y, linalg::BandMatrix::RowIterator jac) const;
+	virtual int residualWithJacobianBatch(double t, double z, double const* r, unsigned int secIdx, double timeFactor, unsigned int nShells,
+		unsigned int stride, double const* y, double const* yDot, double* res, linalg::BandMatrix::RowIterator jac) const;
+
 	virtual void setExternalFunctions(IExternalFunction** extFuns, unsigned int size) { }
 
+	virtual bool hasAnalyticParamDerivative(const ParameterId& pId) const { return false; }
+	virtual void analyticParamDerivative(const ParameterId& pId, double factor, double t, double z, double r, unsigned int secIdx,
+		double const* y, double* const dRes) const { }
+
 protected:
 	int _nComp; //!< Number of components
 	unsigned int const* _nBoundStates; //!< Array with number of bound states for each component
@@ -104,6 +118,26 @@ protected:
 	 * @return @c true if the configuration was successful, otherwise @c false
 	 */
 	bool configureNonlinearSolver(IParameterProvider& paramProvider);
+
+	/**
+	 * @brief Solves the algebraic equations of the consistent initialization
+	 * @details If warm start data is given, a simplified Newton iteration with the Jacobian of the previous
+	 *          consistent initialization is attempted first. If it fails to converge quickly, the nonlinear
+	 *          solver is run, which continues with the state (e.g., trust-region radius) of its previous run.
+	 *          The last Jacobian and statistics are recorded in @p warmStart.
+	 * @param [in] residual Function providing the residual of the algebraic equations
+	 * @param [in] jacobian Function providing the Jacobian of the algebraic equations
+	 * @param [in] errorTol Error tolerance for solving the algebraic equations
+	 * @param [in,out] point On entry initial guess, on exit solution or last iterate
+	 * @param [in,out] workingMemory Working memory for nonlinear equation solvers
+	 * @param [in,out] workingMat Working matrix for nonlinear equation solvers
+	 * @param [in] size Number of algebraic equations
+	 * @param [in,out] warmStart Warm start data and statistics or @c nullptr
+	 * @return @c true if the equations have been solved successfully, otherwise @c false
+	 */
+	bool solveAlgebraicEquations(const std::function<bool(double const* const, double* const)>& residual, 
+		const std::function<bool(double const* const, linalg::detail::DenseMatrixBase&)>& jacobian, double errorTol, double* const point, 
+		double* const workingMemory, linalg::detail::DenseMatrixBase& workingMat, unsigned int size, BindingWarmStart* const warmStart) const;
 };
 
 /**
@@ -128,7 +162,8 @@ public:
 
 	virtual void consistentInitialState(double t, double z, double r, unsigned int secIdx, double* const vecStateY, double errorTol, 
 		active* const adRes, active* const adY, unsigned int adEqOffset, unsigned int adOffset, unsigned int diagDir, 
-		unsigned int lowerBandwidth, unsigned int upperBandwidth, double* const workingMemory, linalg::detail::DenseMatrixBase& workingMat) const;
+		unsigned int lowerBandwidth, unsigned int upperBandwidth, double* const workingMemory, linalg::detail::DenseMatrixBase& workingMat,
+		BindingWarmStart* const warmStart) const;
 
 	virtual void analyticJacobian(double t, double z, double r, unsigned int secIdx, double const* y, linalg::BandMatrix::RowIterator jac) const;
 	virtual void jacobianAddDiscretized(double alpha, linalg::FactorizableBandMatrix::RowIterator jac) const;
@@ -18,6 +18,68 @@
 #ifndef LIBCADET_BINDINGMODELMACROS_HPP_
 #define LIBCADET_BINDINGMODELMACROS_HPP_
 
+/**
+ * @brief Inserts the declaration of the residual() method for one compile-time sized AD datatype
+ * @details Used with CADET_FOREACH_FIXED_AD_DIRECTIONS, see CADET_BINDINGMODEL_FIXED_AD_RESIDUAL_DECL.
+ * @param N Number of AD directions of the fixedActive datatype
+ */
+#define CADET_BINDINGMODEL_FIXED_AD_RESIDUAL_DECL_N(N, UNUSED1, UNUSED2)                               \
+	virtual int residual(double t, double z, double r, unsigned int secIdx, double timeFactor,         \
+		fixedActive<N> const* y, double const* yDot, fixedActive<N>* res) const;
+
+/**
+ * @brief Inserts declarations of the residual() method variants for all compile-time sized AD datatypes
+ * @details The variants are implemented by CADET_BINDINGMODEL_RESIDUAL_BOILERPLATE_IMPL_BASE and friends.
+ */
+#define CADET_BINDINGMODEL_FIXED_AD_RESIDUAL_DECL                                                      \
+	CADET_FOREACH_FIXED_AD_DIRECTIONS(CADET_BINDINGMODEL_FIXED_AD_RESIDUAL_DECL_N, , )
+
+/**
+ * @brief Inserts the declaration of the residual() method for the sparse AD datatype
+ * @details Used with CADET_FOREACH_SPARSE_AD_TYPE, see CADET_BINDINGMODEL_SPARSE_AD_RESIDUAL_DECL.
+ * @param TYPE Sparse AD datatype
+ */
+#define CADET_BINDINGMODEL_SPARSE_AD_RESIDUAL_DECL_TYPE(TYPE, UNUSED1, UNUSED2)                        \
+	virtual int residual(const TYPE& t, double z, double r, unsigned int secIdx, const TYPE& timeFactor, \
+		double const* y, double const* yDot, TYPE* res) const;
+
+/**
+ * @brief Inserts the declaration of the residual() method variant for the sparse AD datatype
+ * @details The variant is implemented by CADET_BINDINGMODEL_RESIDUAL_BOILERPLATE_IMPL_BASE and friends.
+ */
+#define CADET_BINDINGMODEL_SPARSE_AD_RESIDUAL_DECL                                                     \
+	CADET_FOREACH_SPARSE_AD_TYPE(CADET_BINDINGMODEL_SPARSE_AD_RESIDUAL_DECL_TYPE, , )
+
+/**
+ * @brief Inserts the implementation of the residual() method for one compile-time sized AD datatype
+ * @details Used with CADET_FOREACH_FIXED_AD_DIRECTIONS by CADET_BINDINGMODEL_RESIDUAL_BOILERPLATE_IMPL_BASE.
+ * @param N Number of AD directions of the fixedActive datatype
+ * @param CLASSNAME Name of the IBindingModel implementation (including template)
+ * @param TEMPLATELINE Line before the function that may contain a template<typename TEMPLATENAME> modifier
+ */
+#define CADET_BINDINGMODEL_FIXED_AD_RESIDUAL_IMPL(N, CLASSNAME, TEMPLATELINE)                                              \
+	TEMPLATELINE                                                                                                           \
+	int CLASSNAME::residual(double t, double z, double r, unsigned int secIdx, double timeFactor,                           \
+		fixedActive<N> const* y, double const* yDot, fixedActive<N>* res) const                                            \
+	{                                                                                                                      \
+		return residualImpl<fixedActive<N>, fixedActive<N>, fixedActive<N>, double>(t, z, r, secIdx, timeFactor, y, y - _nComp, yDot, res); \
+	}
+
+/**
+ * @brief Inserts the implementation of the residual() method for the sparse AD datatype
+ * @details Used with CADET_FOREACH_SPARSE_AD_TYPE by CADET_BINDINGMODEL_RESIDUAL_BOILERPLATE_IMPL_BASE.
+ * @param TYPE Sparse AD datatype
+ * @param CLASSNAME Name of the IBindingModel implementation (including template)
+ * @param TEMPLATELINE Line before the function that may contain a template<typename TEMPLATENAME> modifier
+ */
+#define CADET_BINDINGMODEL_SPARSE_AD_RESIDUAL_IMPL(TYPE, CLASSNAME, TEMPLATELINE)                                \
+	TEMPLATELINE                                                                                                 \
+	int CLASSNAME::residual(const TYPE& t, double z, double r, unsigned int secIdx, const TYPE& timeFactor,       \
+		double const* y, double const* yDot, TYPE* res) const                                                    \
+	{                                                                                                            \
+		return residualImpl<double, double, TYPE, TYPE>(t, z, r, secIdx, timeFactor, y, y - _nComp, yDot, res); \
+	}
+
 /**
  * @brief Inserts implementations of all residual() method variants which forward to residualImpl() template function
  * @details An IBindingModel implementation has to provide residual() methods for different variants of state and
@@ -54,7 +116,10 @@
 		double const* y, double const* yDot, double* res) const                                                     \
 	{                                                                                                               \
 		return residualImpl<double, double, double, double>(t, z, r, secIdx, timeFactor, y, y - _nComp, yDot, res); \
-	}
+	}                                                                                                               \
+	                                                                                                                \
+	CADET_FOREACH_FIXED_AD_DIRECTIONS(CADET_BINDINGMODEL_FIXED_AD_RESIDUAL_IMPL, CLASSNAME, TEMPLATELINE)        \
+	CADET_FOREACH_SPARSE_AD_TYPE(CADET_BINDINGMODEL_SPARSE_AD_RESIDUAL_IMPL, CLASSNAME, TEMPLATELINE)
 
 /**
  * @brief Inserts implementations of all residual() method variants which forward to residualImpl() template function
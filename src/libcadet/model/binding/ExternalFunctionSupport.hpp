@@ -23,27 +23,33 @@
  
 #include "LoggingUtils.hpp"
 #include "Logging.hpp"
+#include "OpenMPSupport.hpp"
+#include "common/CompilerSpecific.hpp"
 
 #include <vector>
 #include <algorithm>
 #include <string>
+#include <memory>
+#include <mutex>
 
 
 #define CADET_DEFINE_EXTDEP_VARIABLE(TYPE, VAR) \
-	mutable TYPE VAR;                           \
+	TYPE VAR;                                   \
 	TYPE VAR##T0;                               \
 	TYPE VAR##T1;                               \
 	TYPE VAR##T2;                               \
 	TYPE VAR##T3;
 
-#define CADET_UPDATE_EXTDEP_VARIABLE_BRACES(VAR, IDXEXPR, EXTVAL) \
-	VAR[IDXEXPR] = VAR##T0[IDXEXPR] + EXTVAL * (VAR##T1[IDXEXPR] + EXTVAL * (VAR##T2[IDXEXPR] + EXTVAL * VAR##T3[IDXEXPR]));
+// The UPDATE macros read the coefficients of this parameter handler and write the
+// resulting parameter value into the (thread local) parameter handler DEST
+#define CADET_UPDATE_EXTDEP_VARIABLE_BRACES(DEST, VAR, IDXEXPR, EXTVAL) \
+	DEST.VAR[IDXEXPR] = VAR##T0[IDXEXPR] + EXTVAL * (VAR##T1[IDXEXPR] + EXTVAL * (VAR##T2[IDXEXPR] + EXTVAL * VAR##T3[IDXEXPR]));
 
-#define CADET_UPDATE_EXTDEP_VARIABLE_NATIVE(VAR, IDXEXPR, EXTVAL) \
-	VAR.native(IDXEXPR) = VAR##T0.native(IDXEXPR) + EXTVAL * (VAR##T1.native(IDXEXPR) + EXTVAL * (VAR##T2.native(IDXEXPR) + EXTVAL * VAR##T3.native(IDXEXPR)));
+#define CADET_UPDATE_EXTDEP_VARIABLE_NATIVE(DEST, VAR, IDXEXPR, EXTVAL) \
+	DEST.VAR.native(IDXEXPR) = VAR##T0.native(IDXEXPR) + EXTVAL * (VAR##T1.native(IDXEXPR) + EXTVAL * (VAR##T2.native(IDXEXPR) + EXTVAL * VAR##T3.native(IDXEXPR)));
 
-#define CADET_UPDATE_EXTDEP_VARIABLE(VAR, EXTVAL) \
-	VAR = VAR##T0 + EXTVAL * (VAR##T1 + EXTVAL * (VAR##T2 + EXTVAL * VAR##T3));
+#define CADET_UPDATE_EXTDEP_VARIABLE(DEST, VAR, EXTVAL) \
+	DEST.VAR = VAR##T0 + EXTVAL * (VAR##T1 + EXTVAL * (VAR##T2 + EXTVAL * VAR##T3));
 
 
 #define CADET_RESERVE_SPACE(VAR, NUMELEM) \
@@ -142,19 +148,32 @@ namespace model
 
 	/**
 	 * @brief Base class of binding model parameter classes for binding models that do not depend on external functions
+	 * @tparam ParamHandler_t Type of the derived parameter class
 	 */
+	template <class ParamHandler_t>
 	struct BindingParamHandlerBase
 	{
 		/**
-		 * @brief Updates local parameter cache in order to take the external profile into account
+		 * @brief Returns whether the parameters depend on external functions
+		 * @return @c true if the parameters depend on external functions, otherwise @c false
+		 */
+		static inline bool dependsOnExternalFunctions() CADET_NOEXCEPT { return false; }
+
+		/**
+		 * @brief Returns the parameters that take the external profile into account
+		 * @details Since there is no external dependence, the parameters themselves are returned.
 		 * @param [in] t Current time
 		 * @param [in] z Axial coordinate in the column
 		 * @param [in] r Radial coordinate in the bead
 		 * @param [in] secIdx Index of the current section
 		 * @param [in] nComp Number of components
 		 * @param [in] nBoundStates Array with number of bound states for each component
+		 * @return Parameters at the given position
 		 */
-		inline void update(double t, double z, double r, unsigned int secIdx, unsigned int nComp, unsigned int const* nBoundStates) const { }
+		inline const ParamHandler_t& update(double t, double z, double r, unsigned int secIdx, unsigned int nComp, unsigned int const* nBoundStates) const
+		{
+			return static_cast<const ParamHandler_t&>(*this);
+		}
 
 		/**
 		 * @brief Sets external functions for this binding model
@@ -164,16 +183,93 @@ namespace model
 		inline void setExternalFunctions(IExternalFunction** extFuns, unsigned int size) { }
 	};
 
+	namespace detail
+	{
+		/**
+		 * @brief Slot of the calling thread in the thread local parameter caches
+		 * @details Each thread receives a distinct slot on first call. Slots are released on thread exit and
+		 *          reused by subsequent threads, so the slots remain small as long as the number of concurrently
+		 *          running threads is small. Contrary to omp_get_thread_num(), the slot also identifies the
+		 *          thread within nested parallel regions and across independent OpenMP thread pools.
+		 */
+		class ThreadSlot
+		{
+		public:
+			static inline unsigned int get()
+			{
+				static thread_local ThreadSlot slot;
+				return slot._idx;
+			}
+
+		private:
+			ThreadSlot()
+			{
+				std::lock_guard<std::mutex> lock(mutex());
+				std::vector<unsigned int>& free = freeSlots();
+				if (free.empty())
+					_idx = nextSlot()++;
+				else
+				{
+					// Prefer small slots
+					std::vector<unsigned int>::iterator it = std::min_element(free.begin(), free.end());
+					_idx = *it;
+					free.erase(it);
+				}
+			}
+
+			~ThreadSlot()
+			{
+				std::lock_guard<std::mutex> lock(mutex());
+				freeSlots().push_back(_idx);
+			}
+
+			static inline std::mutex& mutex()
+			{
+				static std::mutex m;
+				return m;
+			}
+
+			static inline std::vector<unsigned int>& freeSlots()
+			{
+				static std::vector<unsigned int> free;
+				return free;
+			}
+
+			static inline unsigned int& nextSlot()
+			{
+				static unsigned int next = 0;
+				return next;
+			}
+
+			unsigned int _idx;
+		};
+	}
+
 	/**
 	 * @brief Base class for externally dependent binding model parameter classes
 	 * @details Configures and stores the external function used for this binding model.
+	 * 
+	 *          The parameter values at a given position depend on the external functions and are
+	 *          computed by the update() function of the derived class. Since binding models are evaluated
+	 *          concurrently from multiple threads, the values are not cached in the parameter class itself.
+	 *          Instead, each thread owns a copy of the parameter class (see localParams()) which receives
+	 *          the values. The copies are created lazily by their threads and dropped whenever the
+	 *          configuration or the external functions change.
+	 * @tparam ParamHandler_t Type of the derived parameter class
 	 */
+	template <class ParamHandler_t>
 	struct ExternalBindingParamHandlerBase
 	{	
 	public:	
 		std::vector<IExternalFunction*> _extFun; //!< Pointer to the external function
 		std::vector<int> _extFunIndex; //!< Index to the external function
-		mutable std::vector<double> _extFunBuffer; //!< Buffer for caching the evaluation of external functions
+		std::vector<double> _extFunBuffer; //!< Buffer for caching the evaluation of external functions
+
+		/**
+		 * @brief Returns whether the parameters depend on external functions
+		 * @return @c true if the parameters depend on external functions, otherwise @c false
+		 */
+		static inline bool dependsOnExternalFunctions() CADET_NOEXCEPT { return true; }
 
 		/**
 		 * @brief Sets external functions for this binding model
@@ -182,6 +278,8 @@ namespace model
 		 */
 		inline void setExternalFunctions(IExternalFunction** extFuns, int size)
 		{
+			resetLocalParams();
+
 			_extFun.clear();
 			_extFun.resize(_extFunIndex.size(), nullptr);
 			for (unsigned int i = 0; i < _extFunIndex.size(); ++i)
@@ -198,7 +296,18 @@ namespace model
 
 	protected:
 
-		ExternalBindingParamHandlerBase() : _extFun(), _extFunIndex(), _extFunBuffer() { }
+		ExternalBindingParamHandlerBase() : _extFun(), _extFunIndex(), _extFunBuffer(), _localParams() { }
+
+		// Thread local copies are not copied, the new object creates its own on demand
+		ExternalBindingParamHandlerBase(const ExternalBindingParamHandlerBase& cpy) : _extFun(cpy._extFun), _extFunIndex(cpy._extFunIndex), _extFunBuffer(cpy._extFunBuffer), _localParams() { }
+		ExternalBindingParamHandlerBase& operator=(const ExternalBindingParamHandlerBase& cpy)
+		{
+			_extFun = cpy._extFun;
+			_extFunIndex = cpy._extFunIndex;
+			_extFunBuffer = cpy._extFunBuffer;
+			resetLocalParams();
+			return *this;
+		}
 		
 		/**
 		 * @brief Configures the external data source of this externally dependent binding parameter set
@@ -208,6 +317,7 @@ namespace model
 		 */
 		inline bool configure(IParameterProvider& paramProvider, unsigned int numDepParams)
 		{
+			resetLocalParams();
 			_extFunBuffer.resize(numDepParams, 0.0);
 			
 			std::vector<int> idx;
@@ -236,14 +346,13 @@ namespace model
 
 		/**
 		 * @brief Evaluates the external functions for the different parameters
-		 * @details This function is declared const since the actual parameters are left unchanged by the method.
-		 *          The cache is marked as mutable in order to make it writable.
+		 * @details The results are stored in the buffer of this object, which should be a thread local copy.
 		 * @param [in] t Current time
 		 * @param [in] z Axial coordinate in the column
 		 * @param [in] r Radial coordinate in the bead
 		 * @param [in] secIdx Index of the current section
 		 */
-		inline void evaluateExternalFunctions(double t, double z, double r, unsigned int secIdx) const
+		inline void evaluateExternalFunctions(double t, double z, double r, unsigned int secIdx)
 		{
 			for (unsigned int i = 0; i < _extFunBuffer.size(); ++i)
 			{
@@ -255,6 +364,50 @@ namespace model
 			}
 		}
 
+		/**
+		 * @brief Returns the copy of this parameter class that is owned by the calling thread
+		 * @details The copy is created on first access. Only the calling thread accesses its copy,
+		 *          so it can be written without synchronization. Copies are keyed by the slot of the
+		 *          thread (see detail::ThreadSlot) instead of the OpenMP thread number, which is not
+		 *          unique in nested parallel regions.
+		 *
+		 *          If the slot exceeds the number of slots of this object (i.e., more threads are
+		 *          running than at configuration), a copy in thread local storage is refreshed
+		 *          from this object and returned instead. This is slower, but still correct since
+		 *          update() recomputes all cached values.
+		 * @return Thread local copy of this parameter class
+		 */
+		inline ParamHandler_t& localParams() const
+		{
+			const unsigned int slot = detail::ThreadSlot::get();
+			if (cadet_likely(slot < _localParams.size()))
+			{
+				std::unique_ptr<ParamHandler_t>& lp = _localParams[slot];
+				if (cadet_unlikely(!lp))
+					lp.reset(new ParamHandler_t(static_cast<const ParamHandler_t&>(*this)));
+				return *lp;
+			}
+
+			static thread_local std::unique_ptr<ParamHandler_t> overflow;
+			if (overflow)
+				*overflow = static_cast<const ParamHandler_t&>(*this);
+			else
+				overflow.reset(new ParamHandler_t(static_cast<const ParamHandler_t&>(*this)));
+			return *overflow;
+		}
+
+		/**
+		 * @brief Drops all thread local copies and provides slots for all threads
+		 * @details Must not be called concurrently with localParams().
+		 */
+		inline void resetLocalParams()
+		{
+			_localParams.clear();
+			_localParams.resize(std::max(omp_get_max_threads(), omp_get_num_procs()));
+		}
+
+	private:
+		mutable std::vector<std::unique_ptr<ParamHandler_t>> _localParams; //!< Thread local copies that store the current parameter values
 	};
 
 }  // namespace model
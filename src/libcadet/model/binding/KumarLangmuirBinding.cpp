@@ -13,14 +13,20 @@
 #include "model/binding/BindingModelBase.hpp"
 #include "model/binding/ExternalFunctionSupport.hpp"
 #include "model/binding/BindingModelMacros.hpp"
+#include "model/binding/PowerLookupTable.hpp"
 #include "model/ModelUtils.hpp"
 #include "cadet/Exceptions.hpp"
 #include "ParamReaderHelper.hpp"
 
+#include "LoggingUtils.hpp"
+#include "Logging.hpp"
+
 #include <functional>
 #include <unordered_map>
 #include <string>
 #include <vector>
+#include <cmath>
+#include <limits>
 
 namespace cadet
 {
@@ -31,7 +37,7 @@ namespace model
 /**
  * @brief Handles Kumar-Langmuir binding model parameters that do not depend on external functions
  */
-struct KumarLangmuirParamHandler : public BindingParamHandlerBase
+struct KumarLangmuirParamHandler : public BindingParamHandlerBase<KumarLangmuirParamHandler>
 {
 	static const char* identifier() { return "KUMAR_MULTI_COMPONENT_LANGMUIR"; }
 
@@ -87,7 +93,7 @@ struct KumarLangmuirParamHandler : public BindingParamHandlerBase
 /**
  * @brief Handles Kumar-Langmuir binding model parameters that depend on an external function
  */
-struct ExtKumarLangmuirParamHandler : public ExternalBindingParamHandlerBase
+struct ExtKumarLangmuirParamHandler : public ExternalBindingParamHandlerBase<ExtKumarLangmuirParamHandler>
 {
 	static const char* identifier() { return "EXT_KUMAR_MULTI_COMPONENT_LANGMUIR"; }
 
@@ -108,7 +114,7 @@ struct ExtKumarLangmuirParamHandler : public ExternalBindingParamHandlerBase
 		CADET_READPAR_MATRIX(qMax, paramProvider, "KMCL_QMAX", nComp, 1);
 		CADET_READPAR_MATRIX(nu, paramProvider, "KMCL_NU", nComp, 1);
 
-		return ExternalBindingParamHandlerBase::configure(paramProvider, 6);
+		return ExternalBindingParamHandlerBase<ExtKumarLangmuirParamHandler>::configure(paramProvider, 6);
 	}
 
 	/**
@@ -129,28 +135,33 @@ struct ExtKumarLangmuirParamHandler : public ExternalBindingParamHandlerBase
 	}
 
 	/**
-	 * @brief Updates local parameter cache in order to take the external profile into account
-	 * @details This function is declared const since the actual parameters are left unchanged by the method.
-	 *         The cache is marked as mutable in order to make it writable.
+	 * @brief Computes the parameters that take the external profile into account
+	 * @details The parameters are stored in the copy of this object owned by the calling thread (see localParams()).
+	 *          This function is, thus, safe to be called concurrently.
 	 * @param [in] t Current time
 	 * @param [in] z Axial coordinate in the column
 	 * @param [in] r Radial coordinate in the bead
 	 * @param [in] secIdx Index of the current section
 	 * @param [in] nComp Number of components
 	 * @param [in] nBoundStates Array with number of bound states for each component
+	 * @return Parameters at the given position
 	 */
-	inline void update(double t, double z, double r, unsigned int secIdx, unsigned int nComp, unsigned int const* nBoundStates) const
+	inline const ExtKumarLangmuirParamHandler& update(double t, double z, double r, unsigned int secIdx, unsigned int nComp, unsigned int const* nBoundStates) const
 	{
-		evaluateExternalFunctions(t, z, r, secIdx);
+		ExtKumarLangmuirParamHandler& p = localParams();
+		p.evaluateExternalFunctions(t, z, r, secIdx);
+
 		for (unsigned int i = 0; i < nComp; ++i)
 		{
-			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(kA, i, _extFunBuffer[0]);
-			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(kD, i, _extFunBuffer[1]);
-			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(kAct, i, _extFunBuffer[2]);
-			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(qMax, i, _extFunBuffer[3]);
-			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(nu, i, _extFunBuffer[4]);
+			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(p, kA, i, p._extFunBuffer[0]);
+			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(p, kD, i, p._extFunBuffer[1]);
+			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(p, kAct, i, p._extFunBuffer[2]);
+			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(p, qMax, i, p._extFunBuffer[3]);
+			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(p, nu, i, p._extFunBuffer[4]);
 		}
-		CADET_UPDATE_EXTDEP_VARIABLE(temperature, _extFunBuffer[5]);
+		CADET_UPDATE_EXTDEP_VARIABLE(p, temperature, p._extFunBuffer[5]);
+
+		return p;
 	}
 
 	CADET_DEFINE_EXTDEP_VARIABLE(active, temperature)
@@ -177,6 +188,10 @@ struct ExtKumarLangmuirParamHandler : public ExternalBindingParamHandlerBase
  *          Desorption is modified by salt (component @c 0) which does not bind. The characteristic charge @f$ \nu @f$
  *          of the protein is taken into account by the power law.
  *          See @cite Kumar2015 for details.
+ *
+ *          For long simulations with fixed parameters, the salt powers @f$ \left( c_{p,0} \right)^{\nu_i} @f$ can be
+ *          tabulated on the salt concentration range @c KMCL_LOOKUP_SALT_RANGE by enabling @c KMCL_LOOKUP_TABLE (see
+ *          PowerLookupTable). In this mode, the Arrhenius factors are precomputed as well.
  * @tparam ParamHandler_t Type that can add support for external function dependence
  */
 template <class ParamHandler_t>
@@ -211,12 +226,19 @@ public:
 	virtual int residual(double t, double z, double r, unsigned int secIdx, double timeFactor,
 		double const* y, double const* yDot, double* res) const;
 
+	CADET_BINDINGMODEL_FIXED_AD_RESIDUAL_DECL
+	CADET_BINDINGMODEL_SPARSE_AD_RESIDUAL_DECL
+
 	virtual void setExternalFunctions(IExternalFunction** extFuns, unsigned int size) { _p.setExternalFunctions(extFuns, size); }
 
 	virtual bool hasSalt() const CADET_NOEXCEPT { return true; }	
 
 protected:
 	ParamHandler_t _p; //!< Handles parameters and their dependence on external functions
+	std::vector<PowerLookupTable> _saltPowTable; //!< Lookup tables for @f$ \left( c_{p,0} \right)^{\nu_i} @f$ of each component
+	std::vector<double> _arrheniusKAct; //!< Activation temperatures used for precomputing the Arrhenius factors
+	std::vector<double> _arrheniusFactor; //!< Precomputed Arrhenius factors @f$ \exp\left( \frac{k_{\text{act},i}}{T} \right) @f$
+	double _arrheniusTemp; //!< Temperature used for precomputing the Arrhenius factors
 
 	virtual bool configureImpl(bool reconfigure, IParameterProvider& paramProvider, unsigned int unitOpIdx)
 	{
@@ -226,9 +248,62 @@ protected:
 		// Register parameters
 		_p.registerParameters(_parameters, unitOpIdx, _nComp, _nBoundStates);
 
+		PowerLookupTableSettings lookupSettings;
+		lookupSettings.configure(paramProvider, "KMCL_");
+		configureLookupTables(paramProvider, lookupSettings);
+
 		return true;
 	}
 
+	void configureLookupTables(IParameterProvider& paramProvider, const PowerLookupTableSettings& settings)
+	{
+		// NaN never compares equal, which disables the precomputed Arrhenius factors
+		_saltPowTable.assign(_nComp, PowerLookupTable());
+		_arrheniusKAct.assign(_nComp, std::numeric_limits<double>::quiet_NaN());
+		_arrheniusFactor.assign(_nComp, 0.0);
+		_arrheniusTemp = std::numeric_limits<double>::quiet_NaN();
+
+		if (!settings.enabled)
+			return;
+
+		if (ParamHandler_t::dependsOnExternalFunctions())
+		{
+			LOG(Warning) << "Lookup tables are not supported by " << identifier() << ", using direct evaluation";
+			return;
+		}
+
+		double cMin = 0.0;
+		double cMax = 0.0;
+		PowerLookupTableSettings::readRange(paramProvider, "KMCL_LOOKUP_SALT_RANGE", cMin, cMax);
+
+		_arrheniusTemp = static_cast<double>(_p.temperature);
+		for (int i = 1; i < _nComp; ++i)
+		{
+			if (_nBoundStates[i] == 0)
+				continue;
+
+			_arrheniusKAct[i] = static_cast<double>(_p.kAct[i]);
+			_arrheniusFactor[i] = std::exp(_arrheniusKAct[i] / _arrheniusTemp);
+
+			if (!_saltPowTable[i].build(static_cast<double>(_p.nu[i]), cMin, cMax, settings))
+				LOG(Warning) << "Lookup table for KMCL_NU of component " << i << " does not reach tolerance " << settings.tolerance << " with " << settings.maxPoints << " points, using direct evaluation";
+		}
+	}
+
+	template <typename ParamType>
+	ParamType arrheniusFactor(unsigned int comp, const ParamType& kAct, const ParamType& temp) const
+	{
+		return exp(kAct / temp);
+	}
+
+	double arrheniusFactor(unsigned int comp, double kAct, double temp) const
+	{
+		if ((kAct == _arrheniusKAct[comp]) && (temp == _arrheniusTemp))
+			return _arrheniusFactor[comp];
+
+		return std::exp(kAct / temp);
+	}
+
 	virtual int residualCore(double t, double z, double r, unsigned int secIdx, double timeFactor,
 		double const* y, double const* yCp, double const* yDot, double* res) const;
 	virtual int residualCore(double t, double z, double r, unsigned int secIdx, double timeFactor,
@@ -243,7 +318,7 @@ protected:
 	int residualImpl(const ParamType& t, double z, double r, unsigned int secIdx, const ParamType& timeFactor,
 		StateType const* y, CpStateType const* yCp, double const* yDot, ResidualType* res) const
 	{
-		_p.update(static_cast<double>(t), z, r, secIdx, _nComp, _nBoundStates);
+		const ParamHandler_t& p = _p.update(static_cast<double>(t), z, r, secIdx, _nComp, _nBoundStates);
 
 		// Protein equations: dq_i / dt - ( k_{a,i} * exp( k_{act,i} / T ) * c_{p,i} * q_{max,i} * (1 - \sum_j q_j / q_{max,j}) - (c_{p,0})^{\nu_i} * k_{d,i} * q_i) == 0
 		//               <=>  dq_i / dt == k_{a,i} * exp( k_{act,i} / T ) * c_{p,i} * q_{max,i} * (1 - \sum_j q_j / q_{max,j}) - (c_{p,0})^{\nu_i} * k_{d,i} * q_i
@@ -255,7 +330,7 @@ protected:
 			if (_nBoundStates[i] == 0)
 				continue;
 
-			qSum -= y[bndIdx] / static_cast<ParamType>(_p.qMax[i]);
+			qSum -= y[bndIdx] / static_cast<ParamType>(p.qMax[i]);
 
 			// Next bound component
 			++bndIdx;
@@ -269,9 +344,9 @@ protected:
 				continue;
 
 			// Residual
-			const ResidualType ka = static_cast<ParamType>(_p.kA[i]) * exp(static_cast<ParamType>(_p.kAct[i]) / static_cast<ParamType>(_p.temperature));
-			const ResidualType kd = pow(yCp[0], static_cast<ParamType>(_p.nu[i])) * static_cast<ParamType>(_p.kD[i]);
-			res[bndIdx] = kd * y[bndIdx] - ka * yCp[i] * static_cast<ParamType>(_p.qMax[i]) * qSum;
+			const ResidualType ka = static_cast<ParamType>(p.kA[i]) * arrheniusFactor(i, static_cast<ParamType>(p.kAct[i]), static_cast<ParamType>(p.temperature));
+			const ResidualType kd = tabulatedPow<ResidualType>(_saltPowTable[i], yCp[0], static_cast<ParamType>(p.nu[i])) * static_cast<ParamType>(p.kD[i]);
+			res[bndIdx] = kd * y[bndIdx] - ka * yCp[i] * static_cast<ParamType>(p.qMax[i]) * qSum;
 
 			// Add time derivative if necessary
 			if (_kineticBinding && yDot)
@@ -289,7 +364,7 @@ protected:
 	template <typename RowIterator>
 	void jacobianImpl(double t, double z, double r, unsigned int secIdx, double const* y, double const* yCp, RowIterator jac) const
 	{
-		_p.update(t, z, r, secIdx, _nComp, _nBoundStates);
+		const ParamHandler_t& p = _p.update(t, z, r, secIdx, _nComp, _nBoundStates);
 
 		// Protein equations: dq_i / dt - ( k_{a,i} * exp( k_{act,i} / T ) * c_{p,i} * q_{max,i} * (1 - \sum_j q_j / q_{max,j}) - (c_{p,0})^{\nu_i} * k_{d,i} * q_i) == 0
 		double qSum = 1.0;
@@ -300,7 +375,7 @@ protected:
 			if (_nBoundStates[i] == 0)
 				continue;
 
-			qSum -= y[bndIdx] / static_cast<double>(_p.qMax[i]);
+			qSum -= y[bndIdx] / static_cast<double>(p.qMax[i]);
 
 			// Next bound component
 			++bndIdx;
@@ -313,16 +388,20 @@ protected:
 			if (_nBoundStates[i] == 0)
 				continue;
 
-			const double ka = static_cast<double>(_p.kA[i]) * exp(static_cast<double>(_p.kAct[i]) / static_cast<double>(_p.temperature));
-			const double kd = pow(yCp[0], static_cast<double>(_p.nu[i])) * static_cast<double>(_p.kD[i]);
+			const double ka = static_cast<double>(p.kA[i]) * arrheniusFactor(i, static_cast<double>(p.kAct[i]), static_cast<double>(p.temperature));
+
+			double c0PowNu = 0.0;
+			double c0PowNuDeriv = 0.0;
+			_saltPowTable[i].evaluate(yCp[0], static_cast<double>(p.nu[i]), c0PowNu, c0PowNuDeriv);
+			const double kd = c0PowNu * static_cast<double>(p.kD[i]);
 
 			// dres_i / dc_{p,i}
-			jac[i - bndIdx - _nComp] = -ka * static_cast<double>(_p.qMax[i]) * qSum;
+			jac[i - bndIdx - _nComp] = -ka * static_cast<double>(p.qMax[i]) * qSum;
 			// Getting to c_{p,i}: -bndIdx takes us to q_0, another -nComp to c_{p,0} and a +i to c_{p,i}.
 			//                     This means jac[i - bndIdx - nComp] corresponds to c_{p,i}.
 
 			// dres_i / dc_{p,0}
-			jac[i - bndIdx - _nComp - 1] = static_cast<double>(_p.nu[i]) * pow(yCp[0], static_cast<double>(_p.nu[i]) - 1.0) * y[bndIdx];
+			jac[-bndIdx - _nComp] = c0PowNuDeriv * static_cast<double>(p.kD[i]) * y[bndIdx];
 
 			// Fill dres_i / dq_j
 			int bndIdx2 = 0;
@@ -333,7 +412,7 @@ protected:
 					continue;
 
 				// dres_i / dq_j
-				jac[bndIdx2 - bndIdx] = ka * yCp[i] * static_cast<double>(_p.qMax[i]) / static_cast<double>(_p.qMax[j]);
+				jac[bndIdx2 - bndIdx] = ka * yCp[i] * static_cast<double>(p.qMax[i]) / static_cast<double>(p.qMax[j]);
 				// Getting to q_j: -bndIdx takes us to q_0, another +bndIdx2 to q_j. This means jac[bndIdx2 - bndIdx] corresponds to q_j.
 
 				++bndIdx2;
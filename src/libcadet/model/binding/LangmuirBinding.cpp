@@ -20,6 +20,7 @@
 #include <unordered_map>
 #include <string>
 #include <vector>
+#include <algorithm>
 
 namespace cadet
 {
@@ -30,7 +31,7 @@ namespace model
 /**
  * @brief Handles Langmuir binding model parameters that do not depend on external functions
  */
-struct LangmuirParamHandler : public BindingParamHandlerBase
+struct LangmuirParamHandler : public BindingParamHandlerBase<LangmuirParamHandler>
 {
 	static const char* identifier() { return "MULTI_COMPONENT_LANGMUIR"; }
 
@@ -77,7 +78,7 @@ struct LangmuirParamHandler : public BindingParamHandlerBase
 /**
  * @brief Handles Langmuir binding model parameters that depend on an external function
  */
-struct ExtLangmuirParamHandler : public ExternalBindingParamHandlerBase
+struct ExtLangmuirParamHandler : public ExternalBindingParamHandlerBase<ExtLangmuirParamHandler>
 {
 	static const char* identifier() { return "EXT_MULTI_COMPONENT_LANGMUIR"; }
 
@@ -95,7 +96,7 @@ struct ExtLangmuirParamHandler : public ExternalBindingParamHandlerBase
 		CADET_READPAR_MATRIX(kD, paramProvider, "MCL_KD", nComp, 1);
 		CADET_READPAR_MATRIX(qMax, paramProvider, "MCL_QMAX", nComp, 1);
 
-		return ExternalBindingParamHandlerBase::configure(paramProvider, 3);
+		return ExternalBindingParamHandlerBase<ExtLangmuirParamHandler>::configure(paramProvider, 3);
 	}
 
 	/**
@@ -113,25 +114,30 @@ struct ExtLangmuirParamHandler : public ExternalBindingParamHandlerBase
 	}
 
 	/**
-	 * @brief Updates local parameter cache in order to take the external profile into account
-	 * @details This function is declared const since the actual parameters are left unchanged by the method.
-	 *         The cache is marked as mutable in order to make it writable.
+	 * @brief Computes the parameters that take the external profile into account
+	 * @details The parameters are stored in the copy of this object owned by the calling thread (see localParams()).
+	 *          This function is, thus, safe to be called concurrently.
 	 * @param [in] t Current time
 	 * @param [in] z Axial coordinate in the column
 	 * @param [in] r Radial coordinate in the bead
 	 * @param [in] secIdx Index of the current section
 	 * @param [in] nComp Number of components
 	 * @param [in] nBoundStates Array with number of bound states for each component
+	 * @return Parameters at the given position
 	 */
-	inline void update(double t, double z, double r, unsigned int secIdx, unsigned int nComp, unsigned int const* nBoundStates) const
+	inline const ExtLangmuirParamHandler& update(double t, double z, double r, unsigned int secIdx, unsigned int nComp, unsigned int const* nBoundStates) const
 	{
-		evaluateExternalFunctions(t, z, r, secIdx);
+		ExtLangmuirParamHandler& p = localParams();
+		p.evaluateExternalFunctions(t, z, r, secIdx);
+
 		for (unsigned int i = 0; i < nComp; ++i)
 		{
-			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(kA, i, _extFunBuffer[0]);
-			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(kD, i, _extFunBuffer[1]);
-			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(qMax, i, _extFunBuffer[2]);
+			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(p, kA, i, p._extFunBuffer[0]);
+			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(p, kD, i, p._extFunBuffer[1]);
+			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(p, qMax, i, p._extFunBuffer[2]);
 		}
+
+		return p;
 	}
 
 	CADET_DEFINE_EXTDEP_VARIABLE(std::vector<active>, kA)
@@ -174,8 +180,143 @@ public:
 	virtual int residual(double t, double z, double r, unsigned int secIdx, double timeFactor,
 		double const* y, double const* yDot, double* res) const;
 
+	CADET_BINDINGMODEL_FIXED_AD_RESIDUAL_DECL
+	CADET_BINDINGMODEL_SPARSE_AD_RESIDUAL_DECL
+
 	virtual void setExternalFunctions(IExternalFunction** extFuns, unsigned int size) { _p.setExternalFunctions(extFuns, size); }
 
+	virtual bool supportsBatchEvaluation() const CADET_NOEXCEPT { return !ParamHandler_t::dependsOnExternalFunctions(); }
+
+	virtual int residualBatch(double t, double z, double const* r, unsigned int secIdx, double timeFactor, unsigned int nShells,
+		unsigned int stride, double const* y, double const* yDot, double* res) const
+	{
+		// Externally dependent parameters change from shell to shell
+		if (ParamHandler_t::dependsOnExternalFunctions())
+			return PureBindingModelBase::residualBatch(t, z, r, secIdx, timeFactor, nShells, stride, y, yDot, res);
+
+		const ParamHandler_t& p = _p.update(t, z, r[0], secIdx, _nComp, _nBoundStates);
+		const bool addTimeDerivative = _kineticBinding && yDot;
+
+		// Process the shells in blocks such that the loading sums 1 - \sum_j q_j / q_{max,j} fit on the stack
+		const unsigned int blockSize = 16;
+		double qSum[blockSize];
+		for (unsigned int first = 0; first < nShells; first += blockSize)
+		{
+			const unsigned int n = std::min(blockSize, nShells - first);
+			double const* const yBlock = y + first * stride;
+			double* const resBlock = res + first * stride;
+
+			std::fill(qSum, qSum + n, 1.0);
+			unsigned int bndIdx = 0;
+			for (int i = 0; i < _nComp; ++i)
+			{
+				// Skip components without bound states (bound state index bndIdx is not advanced)
+				if (_nBoundStates[i] == 0)
+					continue;
+
+				const double qMax = static_cast<double>(p.qMax[i]);
+				double const* const q = yBlock + bndIdx;
+				for (unsigned int s = 0; s < n; ++s)
+					qSum[s] -= q[s * stride] / qMax;
+
+				++bndIdx;
+			}
+
+			bndIdx = 0;
+			for (int i = 0; i < _nComp; ++i)
+			{
+				// Skip components without bound states (bound state index bndIdx is not advanced)
+				if (_nBoundStates[i] == 0)
+					continue;
+
+				const double ka = static_cast<double>(p.kA[i]);
+				const double kd = static_cast<double>(p.kD[i]);
+				const double qMax = static_cast<double>(p.qMax[i]);
+				double const* const q = yBlock + bndIdx;
+				double const* const cp = yBlock - _nComp + i;
+				double* const resComp = resBlock + bndIdx;
+
+				for (unsigned int s = 0; s < n; ++s)
+					resComp[s * stride] = kd * q[s * stride] - ka * cp[s * stride] * qMax * qSum[s];
+
+				if (addTimeDerivative)
+				{
+					double const* const qDot = yDot + first * stride + bndIdx;
+					for (unsigned int s = 0; s < n; ++s)
+						resComp[s * stride] += timeFactor * qDot[s * stride];
+				}
+
+				++bndIdx;
+			}
+		}
+
+		return 0;
+	}
+
+	virtual void analyticJacobianBatch(double t, double z, double const* r, unsigned int secIdx, unsigned int nShells,
+		unsigned int stride, double const* y, linalg::BandMatrix::RowIterator jac) const
+	{
+		// Bypass virtual dispatch for each shell
+		for (unsigned int s = 0; s < nShells; ++s, jac += stride)
+			jacobianImpl(t, z, r[s], secIdx, y + s * stride, y + s * stride - _nComp, jac);
+	}
+
+	virtual bool hasAnalyticParamDerivative(const ParameterId& pId) const
+	{
+		// Derivatives with respect to the parameters of the external dependence are not implemented
+		if (ParamHandler_t::dependsOnExternalFunctions())
+			return false;
+
+		return (pId.name == hashString("MCL_KA")) || (pId.name == hashString("MCL_KD")) || (pId.name == hashString("MCL_QMAX"));
+	}
+
+	virtual void analyticParamDerivative(const ParameterId& pId, double factor, double t, double z, double r, unsigned int secIdx,
+		double const* y, double* const dRes) const
+	{
+		const unsigned int comp = pId.component;
+		if (_nBoundStates[comp] == 0)
+			return;
+
+		// Non-binding components are not present in the solid phase
+		const unsigned int bndComp = numBoundStates(_nBoundStates, comp);
+		double const* const yCp = y - _nComp;
+
+		// Residual is  k_{d,i} * q_i - k_{a,i} * c_{p,i} * q_{max,i} * (1 - \sum_j q_j / q_{max,j})
+		double qSum = 1.0;
+		unsigned int bndIdx = 0;
+		for (int i = 0; i < _nComp; ++i)
+		{
+			if (_nBoundStates[i] == 0)
+				continue;
+
+			qSum -= y[bndIdx] / static_cast<double>(_p.qMax[i]);
+			++bndIdx;
+		}
+
+		if (pId.name == hashString("MCL_KA"))
+			dRes[bndComp] -= factor * yCp[comp] * static_cast<double>(_p.qMax[comp]) * qSum;
+		else if (pId.name == hashString("MCL_KD"))
+			dRes[bndComp] += factor * y[bndComp];
+		else if (pId.name == hashString("MCL_QMAX"))
+		{
+			// q_{max,comp} appears in its own equation and, via the sum, in all other equations
+			const double qMax = static_cast<double>(_p.qMax[comp]);
+			const double dqSum = y[bndComp] / (qMax * qMax);
+
+			dRes[bndComp] -= factor * static_cast<double>(_p.kA[comp]) * yCp[comp] * qSum;
+
+			bndIdx = 0;
+			for (int i = 0; i < _nComp; ++i)
+			{
+				if (_nBoundStates[i] == 0)
+					continue;
+
+				dRes[bndIdx] -= factor * static_cast<double>(_p.kA[i]) * yCp[i] * static_cast<double>(_p.qMax[i]) * dqSum;
+				++bndIdx;
+			}
+		}
+	}
+
 protected:
 	ParamHandler_t _p; //!< Handles parameters and their dependence on external functions
 
@@ -204,7 +345,7 @@ protected:
 	int residualImpl(const ParamType& t, double z, double r, unsigned int secIdx, const ParamType& timeFactor,
 		StateType const* y, CpStateType const* yCp, double const* yDot, ResidualType* res) const
 	{
-		_p.update(static_cast<double>(t), z, r, secIdx, _nComp, _nBoundStates);
+		const ParamHandler_t& p = _p.update(static_cast<double>(t), z, r, secIdx, _nComp, _nBoundStates);
 
 		// Protein equations: dq_i / dt - ( k_{a,i} * c_{p,i} * q_{max,i} * (1 - \sum_j q_j / q_{max,j}) - k_{d,i} * q_i) == 0
 		//               <=>  dq_i / dt == k_{a,i} * c_{p,i} * q_{max,i} * (1 - \sum_j q_j / q_{max,j}) - k_{d,i} * q_i
@@ -216,7 +357,7 @@ protected:
 			if (_nBoundStates[i] == 0)
 				continue;
 
-			qSum -= y[bndIdx] / static_cast<ParamType>(_p.qMax[i]);
+			qSum -= y[bndIdx] / static_cast<ParamType>(p.qMax[i]);
 
 			// Next bound component
 			++bndIdx;
@@ -230,7 +371,7 @@ protected:
 				continue;
 
 			// Residual
-			res[bndIdx] = static_cast<ParamType>(_p.kD[i]) * y[bndIdx] - static_cast<ParamType>(_p.kA[i]) * yCp[i] * static_cast<ParamType>(_p.qMax[i]) * qSum;
+			res[bndIdx] = static_cast<ParamType>(p.kD[i]) * y[bndIdx] - static_cast<ParamType>(p.kA[i]) * yCp[i] * static_cast<ParamType>(p.qMax[i]) * qSum;
 
 			// Add time derivative if necessary
 			if (_kineticBinding && yDot)
@@ -248,7 +389,7 @@ protected:
 	template <typename RowIterator>
 	void jacobianImpl(double t, double z, double r, unsigned int secIdx, double const* y, double const* yCp, RowIterator jac) const
 	{
-		_p.update(t, z, r, secIdx, _nComp, _nBoundStates);
+		const ParamHandler_t& p = _p.update(t, z, r, secIdx, _nComp, _nBoundStates);
 
 		// Protein equations: dq_i / dt - ( k_{a,i} * c_{p,i} * q_{max,i} * (1 - \sum_j q_j / q_{max,j}) - k_{d,i} * q_i) == 0
 		double qSum = 1.0;
@@ -259,7 +400,7 @@ protected:
 			if (_nBoundStates[i] == 0)
 				continue;
 
-			qSum -= y[bndIdx] / static_cast<double>(_p.qMax[i]);
+			qSum -= y[bndIdx] / static_cast<double>(p.qMax[i]);
 
 			// Next bound component
 			++bndIdx;
@@ -272,11 +413,11 @@ protected:
 			if (_nBoundStates[i] == 0)
 				continue;
 
-			const double ka = static_cast<double>(_p.kA[i]);
-			const double kd = static_cast<double>(_p.kD[i]);
+			const double ka = static_cast<double>(p.kA[i]);
+			const double kd = static_cast<double>(p.kD[i]);
 
 			// dres_i / dc_{p,i}
-			jac[i - bndIdx - _nComp] = -ka * static_cast<double>(_p.qMax[i]) * qSum;
+			jac[i - bndIdx - _nComp] = -ka * static_cast<double>(p.qMax[i]) * qSum;
 			// Getting to c_{p,i}: -bndIdx takes us to q_0, another -nComp to c_{p,0} and a +i to c_{p,i}.
 			//                     This means jac[i - bndIdx - nComp] corresponds to c_{p,i}.
 
@@ -289,7 +430,7 @@ protected:
 					continue;
 
 				// dres_i / dq_j
-				jac[bndIdx2 - bndIdx] = ka * yCp[i] * static_cast<double>(_p.qMax[i]) / static_cast<double>(_p.qMax[j]);
+				jac[bndIdx2 - bndIdx] = ka * yCp[i] * static_cast<double>(p.qMax[i]) / static_cast<double>(p.qMax[j]);
 				// Getting to q_j: -bndIdx takes us to q_0, another +bndIdx2 to q_j. This means jac[bndIdx2 - bndIdx] corresponds to q_j.
 
 				++bndIdx2;
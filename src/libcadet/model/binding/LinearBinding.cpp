@@ -63,7 +63,7 @@ namespace model
 /**
  * @brief Handles linear binding model parameters that do not depend on external functions
  */
-struct LinearParamHandler : public BindingParamHandlerBase
+struct LinearParamHandler : public BindingParamHandlerBase<LinearParamHandler>
 {
 	static const char* identifier() { return "LINEAR"; }
 
@@ -108,7 +108,7 @@ struct LinearParamHandler : public BindingParamHandlerBase
 /**
  * @brief Handles linear binding model parameters that depend on an external function
  */
-struct ExtLinearParamHandler : public ExternalBindingParamHandlerBase
+struct ExtLinearParamHandler : public ExternalBindingParamHandlerBase<ExtLinearParamHandler>
 {
 	static const char* identifier() { return "EXT_LINEAR"; }
 
@@ -125,7 +125,7 @@ struct ExtLinearParamHandler : public ExternalBindingParamHandlerBase
 		CADET_READPAR_MATRIX(kA, paramProvider, "LIN_KA", nComp, 1);
 		CADET_READPAR_MATRIX(kD, paramProvider, "LIN_KD", nComp, 1);
 
-		return ExternalBindingParamHandlerBase::configure(paramProvider, 2);
+		return ExternalBindingParamHandlerBase<ExtLinearParamHandler>::configure(paramProvider, 2);
 	}
 
 	/**
@@ -142,32 +142,37 @@ struct ExtLinearParamHandler : public ExternalBindingParamHandlerBase
 	}
 
 	/**
-	 * @brief Updates local parameter cache in order to take the external profile into account
-	 * @details This function is declared const since the actual parameters are left unchanged by the method.
-	 *         The cache is marked as mutable in order to make it writable.
+	 * @brief Computes the parameters that take the external profile into account
+	 * @details The parameters are stored in the copy of this object owned by the calling thread (see localParams()).
+	 *          This function is, thus, safe to be called concurrently.
 	 * @param [in] t Current time
 	 * @param [in] z Axial coordinate in the column
 	 * @param [in] r Radial coordinate in the bead
 	 * @param [in] secIdx Index of the current section
 	 * @param [in] nComp Number of components
 	 * @param [in] nBoundStates Array with number of bound states for each component
+	 * @return Parameters at the given position
 	 */
-	inline void update(double t, double z, double r, unsigned int secIdx, unsigned int nComp, unsigned int const* nBoundStates) const
+	inline const ExtLinearParamHandler& update(double t, double z, double r, unsigned int secIdx, unsigned int nComp, unsigned int const* nBoundStates) const
 	{
-		evaluateExternalFunctions(t, z, r, secIdx);
+		ExtLinearParamHandler& p = localParams();
+		p.evaluateExternalFunctions(t, z, r, secIdx);
+
 		for (unsigned int i = 0; i < nComp; ++i)
 		{
-			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(kA, i, _extFunBuffer[0]);
-			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(kD, i, _extFunBuffer[1]);
+			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(p, kA, i, p._extFunBuffer[0]);
+			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(p, kD, i, p._extFunBuffer[1]);
 		}
+
+		return p;
 	}
 
 	// Create all variables: The CADET_DEFINE_EXTDEP_VARIABLE(TYPE, BASENAME) macro creates the variables
-	// <BASENAME> (mutable), <BASENAME>T0, <BASENAME>T1, <BASENAME>T2, and <BASENAME>T3
+	// <BASENAME>, <BASENAME>T0, <BASENAME>T1, <BASENAME>T2, and <BASENAME>T3
 	// which are all of the same type TYPE. The first variable (<BASENAME>) is used as cache for the actual
 	// value of the parameter which is computed from the coefficients <BASENAME>T0 - <BASENAME>T3 and the
-	// current value of the external source (depending on time and axial position). It is marked as mutable
-	// since it acts as a cache and has to be changed in update().
+	// current value of the external source (depending on time and axial position). The cache is only
+	// written in thread local copies of the handler (see update()).
 
 	CADET_DEFINE_EXTDEP_VARIABLE(std::vector<active>, kA)
 	CADET_DEFINE_EXTDEP_VARIABLE(std::vector<active>, kD)
@@ -286,13 +291,14 @@ public:
 
 	virtual void consistentInitialState(double t, double z, double r, unsigned int secIdx, double* const vecStateY, double errorTol, 
 		active* const adRes, active* const adY, unsigned int adEqOffset, unsigned int adOffset, unsigned int diagDir, 
-		unsigned int lowerBandwidth, unsigned int upperBandwidth, double* const workingMemory, linalg::detail::DenseMatrixBase& workingMat) const
+		unsigned int lowerBandwidth, unsigned int upperBandwidth, double* const workingMemory, linalg::detail::DenseMatrixBase& workingMat,
+		BindingWarmStart* const warmStart) const
 	{
 		// If we have kinetic binding, there are no algebraic equations and we are done
 		if (_kineticBinding)
 			return;
 
-		_p.update(t, z, r, secIdx, _nComp, _nBoundStates);
+		const ParamHandler_t& p = _p.update(t, z, r, secIdx, _nComp, _nBoundStates);
 
 		// Compute the q_i from their corresponding c_{p,i}
 
@@ -307,7 +313,7 @@ public:
 				continue;
 
 			// Solve  k_a * c_p - k_d * q == 0  for q to obtain  q = k_a / k_d * c_p
-			vecStateY[bndIdx] = static_cast<double>(_p.kA[i]) / static_cast<double>(_p.kD[i]) * yCp[i];
+			vecStateY[bndIdx] = static_cast<double>(p.kA[i]) / static_cast<double>(p.kD[i]) * yCp[i];
 
 			// Next bound component
 			++bndIdx;
@@ -342,6 +348,32 @@ public:
 		return residualImpl<double, double, double>(t, z, r, secIdx, timeFactor, y, yDot, res);
 	}
 
+	// Variants for the compile-time sized AD datatypes used for computing the Jacobian
+
+#define CADET_LINEARBINDING_FIXED_AD_RESIDUAL(N, UNUSED1, UNUSED2)                                       \
+	virtual int residual(double t, double z, double r, unsigned int secIdx, double timeFactor,           \
+		fixedActive<N> const* y, double const* yDot, fixedActive<N>* res) const                          \
+	{                                                                                                    \
+		return residualImpl<fixedActive<N>, fixedActive<N>, double>(t, z, r, secIdx, timeFactor, y, yDot, res); \
+	}
+
+	CADET_FOREACH_FIXED_AD_DIRECTIONS(CADET_LINEARBINDING_FIXED_AD_RESIDUAL, , )
+
+#undef CADET_LINEARBINDING_FIXED_AD_RESIDUAL
+
+	// Variant for the sparse AD datatype used for computing parameter sensitivities
+
+#define CADET_LINEARBINDING_SPARSE_AD_RESIDUAL(TYPE, UNUSED1, UNUSED2)                                   \
+	virtual int residual(const TYPE& t, double z, double r, unsigned int secIdx, const TYPE& timeFactor, \
+		double const* y, double const* yDot, TYPE* res) const                                            \
+	{                                                                                                    \
+		return residualImpl<double, TYPE, TYPE>(t, z, r, secIdx, timeFactor, y, yDot, res);              \
+	}
+
+	CADET_FOREACH_SPARSE_AD_TYPE(CADET_LINEARBINDING_SPARSE_AD_RESIDUAL, , )
+
+#undef CADET_LINEARBINDING_SPARSE_AD_RESIDUAL
+
 	virtual void setExternalFunctions(IExternalFunction** extFuns, unsigned int size) { _p.setExternalFunctions(extFuns, size); }
 
 	virtual void analyticJacobian(double t, double z, double r, unsigned int secIdx, double const* y, linalg::BandMatrix::RowIterator jac) const
@@ -349,6 +381,98 @@ public:
 		jacobianImpl(t, z, r, secIdx, y, jac);
 	}
 
+	virtual bool supportsBatchEvaluation() const CADET_NOEXCEPT { return !ParamHandler_t::dependsOnExternalFunctions(); }
+
+	virtual int residualBatch(double t, double z, double const* r, unsigned int secIdx, double timeFactor, unsigned int nShells,
+		unsigned int stride, double const* y, double const* yDot, double* res) const
+	{
+		// Externally dependent parameters change from shell to shell
+		if (ParamHandler_t::dependsOnExternalFunctions())
+		{
+			for (unsigned int s = 0; s < nShells; ++s)
+				residualImpl<double, double, double>(t, z, r[s], secIdx, timeFactor, y + s * stride, yDot ? yDot + s * stride : nullptr, res + s * stride);
+			return 0;
+		}
+
+		const ParamHandler_t& p = _p.update(t, z, r[0], secIdx, _nComp, _nBoundStates);
+		const bool addTimeDerivative = _kineticBinding && yDot;
+
+		unsigned int bndIdx = 0;
+		for (int i = 0; i < _nComp; ++i)
+		{
+			// Skip components without bound states (bound state index bndIdx is not advanced)
+			if (_nBoundStates[i] == 0)
+				continue;
+
+			const double ka = static_cast<double>(p.kA[i]);
+			const double kd = static_cast<double>(p.kD[i]);
+			double const* const q = y + bndIdx;
+			double const* const cp = y - _nComp + i;
+			double* const resComp = res + bndIdx;
+
+			// Shells are independent of each other, which allows vectorization
+			for (unsigned int s = 0; s < nShells; ++s)
+				resComp[s * stride] = -(ka * cp[s * stride] - kd * q[s * stride]);
+
+			if (addTimeDerivative)
+			{
+				double const* const qDot = yDot + bndIdx;
+				for (unsigned int s = 0; s < nShells; ++s)
+					resComp[s * stride] += timeFactor * qDot[s * stride];
+			}
+
+			// Next bound component
+			++bndIdx;
+		}
+
+		return 0;
+	}
+
+	virtual void analyticJacobianBatch(double t, double z, double const* r, unsigned int secIdx, unsigned int nShells,
+		unsigned int stride, double const* y, linalg::BandMatrix::RowIterator jac) const
+	{
+		// Externally dependent parameters change from shell to shell
+		if (ParamHandler_t::dependsOnExternalFunctions())
+		{
+			for (unsigned int s = 0; s < nShells; ++s, jac += stride)
+				jacobianImpl(t, z, r[s], secIdx, y + s * stride, jac);
+			return;
+		}
+
+		const ParamHandler_t& p = _p.update(t, z, r[0], secIdx, _nComp, _nBoundStates);
+
+		int bndIdx = 0;
+		for (int i = 0; i < _nComp; ++i)
+		{
+			// Skip components without bound states (bound state index bndIdx is not advanced)
+			if (_nBoundStates[i] == 0)
+				continue;
+
+			const double ka = static_cast<double>(p.kA[i]);
+			const double kd = static_cast<double>(p.kD[i]);
+
+			// See jacobianImpl() for an explanation of the offset to the liquid phase
+			const int offsetCp = i - bndIdx - _nComp;
+			linalg::BandMatrix::RowIterator jacComp = jac + bndIdx;
+			for (unsigned int s = 0; s < nShells; ++s, jacComp += stride)
+			{
+				jacComp[0] = kd; // dres / dq_i
+				jacComp[offsetCp] = -ka; // dres / dc_{p,i}
+			}
+
+			++bndIdx;
+		}
+	}
+
+	virtual int residualWithJacobianBatch(double t, double z, double const* r, unsigned int secIdx, double timeFactor, unsigned int nShells,
+		unsigned int stride, double const* y, double const* yDot, double* res, linalg::BandMatrix::RowIterator jac) const
+	{
+		// The Jacobian does not depend on the state, there is nothing to share
+		const int retCode = residualBatch(t, z, r, secIdx, timeFactor, nShells, stride, y, yDot, res);
+		analyticJacobianBatch(t, z, r, secIdx, nShells, stride, y, jac);
+		return retCode;
+	}
+
 	virtual void jacobianAddDiscretized(double alpha, linalg::FactorizableBandMatrix::RowIterator jac) const
 	{
 		// We only add time derivatives for kinetic binding
@@ -375,11 +499,41 @@ public:
 		}
 	}
 
+	virtual bool hasAnalyticParamDerivative(const ParameterId& pId) const
+	{
+		// Derivatives with respect to the parameters of the external dependence are not implemented
+		if (ParamHandler_t::dependsOnExternalFunctions())
+			return false;
+
+		return (pId.name == hashString("LIN_KA")) || (pId.name == hashString("LIN_KD"));
+	}
+
+	virtual void analyticParamDerivative(const ParameterId& pId, double factor, double t, double z, double r, unsigned int secIdx,
+		double const* y, double* const dRes) const
+	{
+		const unsigned int comp = pId.component;
+		if (_nBoundStates[comp] == 0)
+			return;
+
+		// Non-binding components are not present in the solid phase
+		const unsigned int bndIdx = numBoundStates(_nBoundStates, comp);
+
+		// Pointer to first component in liquid phase
+		double const* const yCp = y - _nComp;
+
+		// Residual is  k_d * q_i - k_a * c_{p,i}
+		if (pId.name == hashString("LIN_KA"))
+			dRes[bndIdx] -= factor * yCp[comp];
+		else if (pId.name == hashString("LIN_KD"))
+			dRes[bndIdx] += factor * y[bndIdx];
+	}
+
 
 	virtual bool hasSalt() const CADET_NOEXCEPT { return false; }
 	virtual bool supportsMultistate() const CADET_NOEXCEPT { return false; }
 	virtual bool supportsNonBinding() const CADET_NOEXCEPT { return true; }
 	virtual bool hasAlgebraicEquations() const CADET_NOEXCEPT { return !_kineticBinding; }
+	virtual bool hasStateIndependentJacobian() const CADET_NOEXCEPT { return !ParamHandler_t::dependsOnExternalFunctions(); }
 	
 protected:
 	int _nComp; //!< Number of components
@@ -394,7 +548,7 @@ protected:
 	int residualImpl(const ParamType& t, double z, double r, unsigned int secIdx, const ParamType& timeFactor,
 		StateType const* y, double const* yDot, ResidualType* res) const
 	{
-		_p.update(static_cast<double>(t), z, r, secIdx, _nComp, _nBoundStates);
+		const ParamHandler_t& p = _p.update(static_cast<double>(t), z, r, secIdx, _nComp, _nBoundStates);
 
 		// Implement k_a * c_{p,i} - k_d * q_i
 		// Note that we actually need dq / dt - [k_a * c_{p,i} - k_d * q_i] = 0
@@ -409,7 +563,7 @@ protected:
 			if (_nBoundStates[i] == 0)
 				continue;
 
-			res[bndIdx] = -(static_cast<ParamType>(_p.kA[i]) * yCp[i] - static_cast<ParamType>(_p.kD[i]) * y[bndIdx]);
+			res[bndIdx] = -(static_cast<ParamType>(p.kA[i]) * yCp[i] - static_cast<ParamType>(p.kD[i]) * y[bndIdx]);
 
 			// Add time derivative if necessary
 			if (_kineticBinding && yDot)
@@ -427,7 +581,7 @@ protected:
 	template <typename RowIterator>
 	void jacobianImpl(double t, double z, double r, unsigned int secIdx, double const* y, RowIterator jac) const
 	{
-		_p.update(t, z, r, secIdx, _nComp, _nBoundStates);
+		const ParamHandler_t& p = _p.update(t, z, r, secIdx, _nComp, _nBoundStates);
 
 		int bndIdx = 0;
 		for (int i = 0; i < _nComp; ++i)
@@ -436,8 +590,8 @@ protected:
 			if (_nBoundStates[i] == 0)
 				continue;
 
-			jac[0] = static_cast<double>(_p.kD[i]); // dres / dq_i
-			jac[i - bndIdx - _nComp] = -static_cast<double>(_p.kA[i]); // dres / dc_{p,i}
+			jac[0] = static_cast<double>(p.kD[i]); // dres / dq_i
+			jac[i - bndIdx - _nComp] = -static_cast<double>(p.kA[i]); // dres / dc_{p,i}
 			// The distance from liquid phase to solid phase is reduced for each non-binding component
 			// since a bound state is neglected. The number of neglected bound states so far is i - bndIdx.
 			// Thus, by going back nComp - (i - bndIdx) = -[ i - bndIdx - nComp ] we get to the corresponding
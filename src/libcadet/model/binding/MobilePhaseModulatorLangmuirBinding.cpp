@@ -30,7 +30,7 @@ namespace model
 /**
  * @brief Handles mobile phase modulator Langmuir binding model parameters that do not depend on external functions
  */
-struct MPMLangmuirParamHandler : public BindingParamHandlerBase
+struct MPMLangmuirParamHandler : public BindingParamHandlerBase<MPMLangmuirParamHandler>
 {
 	static const char* identifier() { return "MOBILE_PHASE_MODULATOR"; }
 
@@ -84,7 +84,7 @@ struct MPMLangmuirParamHandler : public BindingParamHandlerBase
 /**
  * @brief Handles mobile phase modulator Langmuir binding model parameters that depend on an external function
  */
-struct ExtMPMLangmuirParamHandler : public ExternalBindingParamHandlerBase
+struct ExtMPMLangmuirParamHandler : public ExternalBindingParamHandlerBase<ExtMPMLangmuirParamHandler>
 {
 	static const char* identifier() { return "EXT_MOBILE_PHASE_MODULATOR"; }
 
@@ -104,7 +104,7 @@ struct ExtMPMLangmuirParamHandler : public ExternalBindingParamHandlerBase
 		CADET_READPAR_MATRIX(gamma, paramProvider, "MPM_GAMMA", nComp, 1);
 		CADET_READPAR_MATRIX(beta, paramProvider, "MPM_BETA", nComp, 1);
 
-		return ExternalBindingParamHandlerBase::configure(paramProvider, 5);
+		return ExternalBindingParamHandlerBase<ExtMPMLangmuirParamHandler>::configure(paramProvider, 5);
 	}
 
 	/**
@@ -124,27 +124,32 @@ struct ExtMPMLangmuirParamHandler : public ExternalBindingParamHandlerBase
 	}
 
 	/**
-	 * @brief Updates local parameter cache in order to take the external profile into account
-	 * @details This function is declared const since the actual parameters are left unchanged by the method.
-	 *         The cache is marked as mutable in order to make it writable.
+	 * @brief Computes the parameters that take the external profile into account
+	 * @details The parameters are stored in the copy of this object owned by the calling thread (see localParams()).
+	 *          This function is, thus, safe to be called concurrently.
 	 * @param [in] t Current time
 	 * @param [in] z Axial coordinate in the column
 	 * @param [in] r Radial coordinate in the bead
 	 * @param [in] secIdx Index of the current section
 	 * @param [in] nComp Number of components
 	 * @param [in] nBoundStates Array with number of bound states for each component
+	 * @return Parameters at the given position
 	 */
-	inline void update(double t, double z, double r, unsigned int secIdx, unsigned int nComp, unsigned int const* nBoundStates) const
+	inline const ExtMPMLangmuirParamHandler& update(double t, double z, double r, unsigned int secIdx, unsigned int nComp, unsigned int const* nBoundStates) const
 	{
-		evaluateExternalFunctions(t, z, r, secIdx);
+		ExtMPMLangmuirParamHandler& p = localParams();
+		p.evaluateExternalFunctions(t, z, r, secIdx);
+
 		for (unsigned int i = 0; i < nComp; ++i)
 		{
-			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(kA, i, _extFunBuffer[0]);
-			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(kD, i, _extFunBuffer[1]);
-			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(qMax, i, _extFunBuffer[2]);
-			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(gamma, i, _extFunBuffer[3]);
-			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(beta, i, _extFunBuffer[4]);
+			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(p, kA, i, p._extFunBuffer[0]);
+			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(p, kD, i, p._extFunBuffer[1]);
+			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(p, qMax, i, p._extFunBuffer[2]);
+			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(p, gamma, i, p._extFunBuffer[3]);
+			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(p, beta, i, p._extFunBuffer[4]);
 		}
+
+		return p;
 	}
 
 	CADET_DEFINE_EXTDEP_VARIABLE(std::vector<active>, kA)
@@ -194,6 +199,9 @@ public:
 	virtual int residual(double t, double z, double r, unsigned int secIdx, double timeFactor,
 		double const* y, double const* yDot, double* res) const;
 
+	CADET_BINDINGMODEL_FIXED_AD_RESIDUAL_DECL
+	CADET_BINDINGMODEL_SPARSE_AD_RESIDUAL_DECL
+
 	virtual void setExternalFunctions(IExternalFunction** extFuns, unsigned int size) { _p.setExternalFunctions(extFuns, size); }
 
 	virtual bool hasSalt() const CADET_NOEXCEPT { return true; }
@@ -226,7 +234,7 @@ protected:
 	int residualImpl(const ParamType& t, double z, double r, unsigned int secIdx, const ParamType& timeFactor,
 		StateType const* y, CpStateType const* yCp, double const* yDot, ResidualType* res) const
 	{
-		_p.update(static_cast<double>(t), z, r, secIdx, _nComp, _nBoundStates);
+		const ParamHandler_t& p = _p.update(static_cast<double>(t), z, r, secIdx, _nComp, _nBoundStates);
 
 		// Salt equation: dq_0 / dt == 0
 		// Protein equations: dq_i / dt - ( k_{a,i} * exp(\gamma_i * c_{p,0}) * c_{p,i} * q_{max,i} * (1 - \sum q_i / q_{max,i}) - k_{d,i} * c_{p,0}^\beta_i * q_i) == 0
@@ -242,7 +250,7 @@ protected:
 			if (_nBoundStates[i] == 0)
 				continue;
 
-			qSum -= y[bndIdx] / static_cast<ParamType>(_p.qMax[i]);
+			qSum -= y[bndIdx] / static_cast<ParamType>(p.qMax[i]);
 
 			// Next bound component
 			++bndIdx;
@@ -272,7 +280,7 @@ protected:
 				continue;
 
 			// Residual
-			res[bndIdx] = static_cast<ParamType>(_p.kD[i]) * pow(yCp[0], static_cast<ParamType>(_p.beta[i])) * y[bndIdx] - static_cast<ParamType>(_p.kA[i]) * exp(yCp[0] * static_cast<ParamType>(_p.gamma[i])) * yCp[i] * static_cast<ParamType>(_p.qMax[i]) * qSum;
+			res[bndIdx] = static_cast<ParamType>(p.kD[i]) * pow(yCp[0], static_cast<ParamType>(p.beta[i])) * y[bndIdx] - static_cast<ParamType>(p.kA[i]) * exp(yCp[0] * static_cast<ParamType>(p.gamma[i])) * yCp[i] * static_cast<ParamType>(p.qMax[i]) * qSum;
 
 			// Add time derivative if necessary
 			if (_kineticBinding && yDot)
@@ -290,7 +298,7 @@ protected:
 	template <typename RowIterator>
 	void jacobianImpl(double t, double z, double r, unsigned int secIdx, double const* y, double const* yCp, RowIterator jac) const
 	{
-		_p.update(t, z, r, secIdx, _nComp, _nBoundStates);
+		const ParamHandler_t& p = _p.update(t, z, r, secIdx, _nComp, _nBoundStates);
 		
 		// Salt equation
 		int bndIdx = 0;
@@ -309,7 +317,7 @@ protected:
 			if (_nBoundStates[i] == 0)
 				continue;
 
-			qSum -= y[bndIdx] / static_cast<double>(_p.qMax[i]);
+			qSum -= y[bndIdx] / static_cast<double>(p.qMax[i]);
 
 			// Next bound component
 			++bndIdx;
@@ -326,11 +334,11 @@ protected:
 			if (_nBoundStates[i] == 0)
 				continue;
 
-			const double gamma = static_cast<double>(_p.gamma[i]);
-			const double beta = static_cast<double>(_p.beta[i]);
-			const double qMax = static_cast<double>(_p.qMax[i]);
-			const double ka = static_cast<double>(_p.kA[i]) * exp(gamma * yCp[0]);
-			const double kdRaw = static_cast<double>(_p.kD[i]);
+			const double gamma = static_cast<double>(p.gamma[i]);
+			const double beta = static_cast<double>(p.beta[i]);
+			const double qMax = static_cast<double>(p.qMax[i]);
+			const double ka = static_cast<double>(p.kA[i]) * exp(gamma * yCp[0]);
+			const double kdRaw = static_cast<double>(p.kD[i]);
 
 			// dres_i / dc_{p,0}
 			jac[-bndIdx - _nComp] = -ka * yCp[i] * qMax * qSum * gamma + kdRaw * beta * y[bndIdx] * pow(yCp[0], beta - 1.0);
@@ -354,7 +362,7 @@ protected:
 					continue;
 
 				// dres_i / dq_j
-				jac[bndIdx2 - bndIdx] = ka * yCp[i] * qMax / static_cast<double>(_p.qMax[j]);
+				jac[bndIdx2 - bndIdx] = ka * yCp[i] * qMax / static_cast<double>(p.qMax[j]);
 				// Getting to q_j: -bndIdx takes us to q_0, another +bndIdx2 to q_j. This means jac[bndIdx2 - bndIdx] corresponds to q_j.
 
 				++bndIdx2;
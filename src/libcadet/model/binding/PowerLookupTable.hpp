@@ -0,0 +1,327 @@
+// =============================================================================
+//  CADET - The Chromatography Analysis and Design Toolkit
+//
+//  Copyright © 2008-2016: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+/**
+ * @file
+ * Provides tabulated power functions for accelerating binding models.
+ */
+
+#ifndef LIBCADET_POWERLOOKUPTABLE_HPP_
+#define LIBCADET_POWERLOOKUPTABLE_HPP_
+
+#include "cadet/ParameterProvider.hpp"
+#include "cadet/Exceptions.hpp"
+#include "common/CompilerSpecific.hpp"
+
+#include <vector>
+#include <string>
+#include <cmath>
+#include <limits>
+
+namespace cadet
+{
+
+namespace model
+{
+
+/**
+ * @brief Settings of the lookup tables of a binding model
+ * @details The settings are read from the datasets "<PREFIX>LOOKUP_TABLE", "<PREFIX>LOOKUP_TOL",
+ *          "<PREFIX>LOOKUP_POINTS", and "<PREFIX>LOOKUP_MAXPOINTS". All of them are optional.
+ */
+struct PowerLookupTableSettings
+{
+	bool enabled; //!< Determines whether lookup tables are used
+	double tolerance; //!< Bound on the relative interpolation error
+	unsigned int nPoints; //!< Initial number of grid points
+	unsigned int maxPoints; //!< Maximum number of grid points
+
+	PowerLookupTableSettings() : enabled(false), tolerance(1e-10), nPoints(1025), maxPoints(65537) { }
+
+	/**
+	 * @brief Reads the lookup table settings from the given parameter provider
+	 * @param [in] paramProvider Parameter provider to read from
+	 * @param [in] prefix Prefix string used for assembling the parameter name
+	 */
+	inline void configure(IParameterProvider& paramProvider, const std::string& prefix)
+	{
+		*this = PowerLookupTableSettings();
+
+		if (paramProvider.exists(prefix + "LOOKUP_TABLE"))
+			enabled = paramProvider.getBool(prefix + "LOOKUP_TABLE");
+
+		if (!enabled)
+			return;
+
+		if (paramProvider.exists(prefix + "LOOKUP_TOL"))
+			tolerance = paramProvider.getDouble(prefix + "LOOKUP_TOL");
+		if (paramProvider.exists(prefix + "LOOKUP_POINTS"))
+			nPoints = paramProvider.getInt(prefix + "LOOKUP_POINTS");
+		if (paramProvider.exists(prefix + "LOOKUP_MAXPOINTS"))
+			maxPoints = paramProvider.getInt(prefix + "LOOKUP_MAXPOINTS");
+
+		if (tolerance <= 0.0)
+			throw InvalidParameterException(prefix + "LOOKUP_TOL has to be positive");
+		if (nPoints < 2)
+			throw InvalidParameterException(prefix + "LOOKUP_POINTS has to be at least 2");
+		if (maxPoints < nPoints)
+			throw InvalidParameterException(prefix + "LOOKUP_MAXPOINTS must not be smaller than " + prefix + "LOOKUP_POINTS");
+	}
+
+	/**
+	 * @brief Reads the range of a lookup table from the given parameter provider
+	 * @details The range is given as array @c [min, max] with @c 0 < @c min < @c max. Since the relative
+	 *          error of an interpolant of @f$ x^{\nu} @f$ on @f$ [0, h] @f$ does not decrease with @f$ h @f$,
+	 *          the lower bound is required to be positive.
+	 * @param [in] paramProvider Parameter provider to read from
+	 * @param [in] dataSet Name of the dataset
+	 * @param [out] lower Lower bound of the range
+	 * @param [out] upper Upper bound of the range
+	 */
+	static inline void readRange(IParameterProvider& paramProvider, const std::string& dataSet, double& lower, double& upper)
+	{
+		const std::vector<double> range = paramProvider.getDoubleArray(dataSet);
+		if (range.size() != 2)
+			throw InvalidParameterException(dataSet + " has to have two elements");
+		if ((range[0] <= 0.0) || (range[1] <= range[0]))
+			throw InvalidParameterException(dataSet + " has to satisfy 0 < min < max");
+
+		lower = range[0];
+		upper = range[1];
+	}
+};
+
+/**
+ * @brief Lookup table for the power function @f$ x \mapsto x^{\nu} @f$ with fixed exponent
+ * @details The power function is interpolated by a piecewise cubic Hermite polynomial on a uniform grid
+ *          using exact derivatives at the grid points. The interpolant is continuously differentiable and
+ *          its derivative is used for Jacobians, which keeps them consistent with the residual.
+ *
+ *          The table remembers the exponent it has been built for. Arguments outside of the tabulated range
+ *          or a different exponent (e.g., after the parameter has been changed) fall back to @c std::pow.
+ */
+class PowerLookupTable
+{
+public:
+
+	PowerLookupTable() : _exponent(0.0), _xMin(std::numeric_limits<double>::infinity()), _xMax(-std::numeric_limits<double>::infinity()), _h(1.0), _invH(1.0) { }
+
+	/**
+	 * @brief Builds the table on the interval @f$ [x_{\text{min}}, x_{\text{max}}] @f$
+	 * @details The number of grid points is doubled until the relative error at the quarter points
+	 *          of each cell is below the given tolerance. If the maximum number of points is exceeded,
+	 *          the table is left empty and every evaluation falls back to @c std::pow.
+	 * @param [in] exponent Exponent @f$ \nu @f$
+	 * @param [in] xMin Lower bound of the tabulated range
+	 * @param [in] xMax Upper bound of the tabulated range
+	 * @param [in] settings Tolerance and number of grid points
+	 * @return @c true if the table has been built successfully, otherwise @c false
+	 */
+	inline bool build(double exponent, double xMin, double xMax, const PowerLookupTableSettings& settings)
+	{
+		clear();
+
+		for (unsigned int nPoints = settings.nPoints; nPoints <= settings.maxPoints; nPoints = 2 * nPoints - 1)
+		{
+			fill(exponent, xMin, xMax, nPoints - 1);
+			if (maxRelativeError() <= settings.tolerance)
+				return true;
+
+			// Guard against overflow of the point count
+			if (nPoints > settings.maxPoints / 2)
+				break;
+		}
+
+		clear();
+		return false;
+	}
+
+	/**
+	 * @brief Removes the table so that all evaluations fall back to @c std::pow
+	 */
+	inline void clear()
+	{
+		_coeffs.clear();
+		_xMin = std::numeric_limits<double>::infinity();
+		_xMax = -std::numeric_limits<double>::infinity();
+	}
+
+	/**
+	 * @brief Returns whether the table holds data
+	 * @return @c true if the table is built, otherwise @c false
+	 */
+	inline bool empty() const CADET_NOEXCEPT { return _coeffs.empty(); }
+
+	/**
+	 * @brief Returns the number of grid points
+	 * @return Number of grid points or @c 0 if the table is empty
+	 */
+	inline unsigned int numPoints() const CADET_NOEXCEPT { return _coeffs.empty() ? 0 : _coeffs.size() / 4 + 1; }
+
+	/**
+	 * @brief Evaluates @f$ x^{\nu} @f$
+	 * @param [in] x Argument
+	 * @param [in] exponent Exponent @f$ \nu @f$
+	 * @return Interpolated value if @p x is in range and @p exponent matches the table, otherwise @c std::pow(x, exponent)
+	 */
+	inline double operator()(double x, double exponent) const
+	{
+		if ((x < _xMin) || (x > _xMax) || (exponent != _exponent))
+			return std::pow(x, exponent);
+
+		double t = 0.0;
+		double const* const c = cell(x, t);
+		return c[0] + t * (c[1] + t * (c[2] + t * c[3]));
+	}
+
+	/**
+	 * @brief Evaluates @f$ x^{\nu} @f$ and its derivative with respect to @f$ x @f$
+	 * @param [in] x Argument
+	 * @param [in] exponent Exponent @f$ \nu @f$
+	 * @param [out] val Value of @f$ x^{\nu} @f$
+	 * @param [out] deriv Derivative @f$ \nu x^{\nu - 1} @f$
+	 */
+	inline void evaluate(double x, double exponent, double& val, double& deriv) const
+	{
+		if ((x < _xMin) || (x > _xMax) || (exponent != _exponent))
+		{
+			val = std::pow(x, exponent);
+			deriv = exponent * std::pow(x, exponent - 1.0);
+			return;
+		}
+
+		double t = 0.0;
+		double const* const c = cell(x, t);
+		val = c[0] + t * (c[1] + t * (c[2] + t * c[3]));
+		deriv = (c[1] + t * (2.0 * c[2] + t * 3.0 * c[3])) * _invH;
+	}
+
+protected:
+
+	/**
+	 * @brief Locates the cell containing @p x
+	 * @param [in] x Argument in the tabulated range
+	 * @param [out] t Local coordinate of @p x in the cell, @f$ t \in [0, 1] @f$
+	 * @return Pointer to the polynomial coefficients of the cell
+	 */
+	inline double const* cell(double x, double& t) const
+	{
+		const double s = (x - _xMin) * _invH;
+		const unsigned int nCells = _coeffs.size() / 4;
+		unsigned int idx = static_cast<unsigned int>(s);
+		if (idx >= nCells)
+			idx = nCells - 1;
+
+		t = s - static_cast<double>(idx);
+		return _coeffs.data() + 4 * idx;
+	}
+
+	/**
+	 * @brief Computes the coefficients of the cubic Hermite interpolant in each cell
+	 * @details In the local coordinate @f$ t @f$ the interpolant reads @f$ c_0 + c_1 t + c_2 t^2 + c_3 t^3 @f$.
+	 * @param [in] exponent Exponent @f$ \nu @f$
+	 * @param [in] xMin Lower bound of the tabulated range
+	 * @param [in] xMax Upper bound of the tabulated range
+	 * @param [in] nCells Number of cells
+	 */
+	inline void fill(double exponent, double xMin, double xMax, unsigned int nCells)
+	{
+		_exponent = exponent;
+		_xMin = xMin;
+		_xMax = xMax;
+		_h = (xMax - xMin) / nCells;
+		_invH = 1.0 / _h;
+		_coeffs.resize(4 * nCells);
+
+		double f0 = std::pow(xMin, exponent);
+		double d0 = exponent * std::pow(xMin, exponent - 1.0) * _h;
+		for (unsigned int i = 0; i < nCells; ++i)
+		{
+			const double x1 = (i + 1 == nCells) ? xMax : xMin + (i + 1) * _h;
+			const double f1 = std::pow(x1, exponent);
+			const double d1 = exponent * std::pow(x1, exponent - 1.0) * _h;
+
+			double* const c = _coeffs.data() + 4 * i;
+			c[0] = f0;
+			c[1] = d0;
+			c[2] = 3.0 * (f1 - f0) - 2.0 * d0 - d1;
+			c[3] = 2.0 * (f0 - f1) + d0 + d1;
+
+			f0 = f1;
+			d0 = d1;
+		}
+	}
+
+	/**
+	 * @brief Computes the maximum relative interpolation error at the quarter points of the cells
+	 * @return Maximum relative error
+	 */
+	inline double maxRelativeError() const
+	{
+		const unsigned int nCells = _coeffs.size() / 4;
+		double maxErr = 0.0;
+		for (unsigned int i = 0; i < nCells; ++i)
+		{
+			double const* const c = _coeffs.data() + 4 * i;
+			for (unsigned int k = 1; k <= 3; ++k)
+			{
+				const double t = 0.25 * k;
+				const double ref = std::pow(_xMin + (i + t) * _h, _exponent);
+				const double val = c[0] + t * (c[1] + t * (c[2] + t * c[3]));
+				const double err = std::abs(val - ref) / std::abs(ref);
+
+				// Also catches NaN
+				if (!(err <= maxErr))
+					maxErr = err;
+			}
+		}
+		return maxErr;
+	}
+
+	double _exponent; //!< Exponent the table has been built for
+	double _xMin; //!< Lower bound of the tabulated range
+	double _xMax; //!< Upper bound of the tabulated range
+	double _h; //!< Grid spacing
+	double _invH; //!< Inverse grid spacing
+	std::vector<double> _coeffs; //!< Polynomial coefficients (4 per cell)
+};
+
+/**
+ * @brief Evaluates a power function using a lookup table if possible
+ * @details Only the pure @c double case is tabulated. Arguments that carry derivatives are computed
+ *          by @c pow in order to propagate derivatives exactly.
+ * @param [in] table Lookup table for the exponent
+ * @param [in] x Argument
+ * @param [in] exponent Exponent
+ * @tparam ResultType Type of the result
+ * @tparam StateType Type of the argument
+ * @tparam ExpType Type of the exponent
+ * @return Value of @f$ x^{\nu} @f$
+ */
+template <typename ResultType, typename StateType, typename ExpType>
+inline ResultType tabulatedPow(const PowerLookupTable& table, const StateType& x, const ExpType& exponent)
+{
+	using std::pow;
+	return pow(x, exponent);
+}
+
+template <>
+inline double tabulatedPow<double, double, double>(const PowerLookupTable& table, const double& x, const double& exponent)
+{
+	return table(x, exponent);
+}
+
+}  // namespace model
+
+}  // namespace cadet
+
+#endif  // LIBCADET_POWERLOOKUPTABLE_HPP_
@@ -31,7 +31,7 @@ namespace model
 /**
  * @brief Handles Saska binding model parameters that do not depend on external functions
  */
-struct SaskaParamHandler : public BindingParamHandlerBase
+struct SaskaParamHandler : public BindingParamHandlerBase<SaskaParamHandler>
 {
 	static const char* identifier() { return "SASKA"; }
 
@@ -80,7 +80,7 @@ struct SaskaParamHandler : public BindingParamHandlerBase
 /**
  * @brief Handles Saska binding model parameters that depend on an external function
  */
-struct ExtSaskaParamHandler : public ExternalBindingParamHandlerBase
+struct ExtSaskaParamHandler : public ExternalBindingParamHandlerBase<ExtSaskaParamHandler>
 {
 	static const char* identifier() { return "EXT_SASKA"; }
 
@@ -100,7 +100,7 @@ struct ExtSaskaParamHandler : public ExternalBindingParamHandlerBase
 		CADET_READPAR_MATRIX(h, paramProvider, "SASKA_H", nComp, 1);
 		CADET_READPAR_BOUNDSTATEDEP(util::SlicedVector<active>, active, k, paramProvider, "SASKA_K", nComp, nComp);
 
-		return ExternalBindingParamHandlerBase::configure(paramProvider, 2);
+		return ExternalBindingParamHandlerBase<ExtSaskaParamHandler>::configure(paramProvider, 2);
 	}
 
 	/**
@@ -117,24 +117,29 @@ struct ExtSaskaParamHandler : public ExternalBindingParamHandlerBase
 	}
 
 	/**
-	 * @brief Updates local parameter cache in order to take the external profile into account
-	 * @details This function is declared const since the actual parameters are left unchanged by the method.
-	 *         The cache is marked as mutable in order to make it writable.
+	 * @brief Computes the parameters that take the external profile into account
+	 * @details The parameters are stored in the copy of this object owned by the calling thread (see localParams()).
+	 *          This function is, thus, safe to be called concurrently.
 	 * @param [in] t Current time
 	 * @param [in] z Axial coordinate in the column
 	 * @param [in] r Radial coordinate in the bead
 	 * @param [in] secIdx Index of the current section
 	 * @param [in] nComp Number of components
 	 * @param [in] nBoundStates Array with number of bound states for each component
+	 * @return Parameters at the given position
 	 */
-	inline void update(double t, double z, double r, unsigned int secIdx, unsigned int nComp, unsigned int const* nBoundStates) const
+	inline const ExtSaskaParamHandler& update(double t, double z, double r, unsigned int secIdx, unsigned int nComp, unsigned int const* nBoundStates) const
 	{
-		evaluateExternalFunctions(t, z, r, secIdx);
+		ExtSaskaParamHandler& p = localParams();
+		p.evaluateExternalFunctions(t, z, r, secIdx);
+
 		for (unsigned int i = 0; i < nComp; ++i)
-			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(h, i, _extFunBuffer[0]);
+			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(p, h, i, p._extFunBuffer[0]);
 
 		for (unsigned int i = 0; i < nComp * nComp; ++i)
-			CADET_UPDATE_EXTDEP_VARIABLE_NATIVE(k, i, _extFunBuffer[1]);
+			CADET_UPDATE_EXTDEP_VARIABLE_NATIVE(p, k, i, p._extFunBuffer[1]);
+
+		return p;
 	}
 
 	CADET_DEFINE_EXTDEP_VARIABLE(std::vector<active>, h)
@@ -177,6 +182,9 @@ public:
 	virtual int residual(double t, double z, double r, unsigned int secIdx, double timeFactor,
 		double const* y, double const* yDot, double* res) const;
 
+	CADET_BINDINGMODEL_FIXED_AD_RESIDUAL_DECL
+	CADET_BINDINGMODEL_SPARSE_AD_RESIDUAL_DECL
+
 	virtual void setExternalFunctions(IExternalFunction** extFuns, unsigned int size) { _p.setExternalFunctions(extFuns, size); }
 
 protected:
@@ -207,7 +215,7 @@ protected:
 	int residualImpl(const ParamType& t, double z, double r, unsigned int secIdx, const ParamType& timeFactor,
 		StateType const* y, CpStateType const* yCp, double const* yDot, ResidualType* res) const
 	{
-		_p.update(static_cast<double>(t), z, r, secIdx, _nComp, _nBoundStates);
+		const ParamHandler_t& p = _p.update(static_cast<double>(t), z, r, secIdx, _nComp, _nBoundStates);
 
 		// Protein equations: dq_i / dt - ( H_i c_{p,i} + \sum_j k_{ij} c_{p,i} c_{p,j} - q_i ) == 0
 		//               <=>  dq_i / dt == H_i c_{p,i} + \sum_j k_{ij} c_{p,i} c_{p,j} - q_i
@@ -218,8 +226,8 @@ protected:
 			if (_nBoundStates[i] == 0)
 				continue;
 
-			const active h = _p.h[i];
-			active const* const kSlice = _p.k[i];
+			const active h = p.h[i];
+			active const* const kSlice = p.k[i];
 
 			// Residual
 			res[bndIdx] = -static_cast<ParamType>(h) * yCp[i] + y[bndIdx];
@@ -242,7 +250,7 @@ protected:
 	template <typename RowIterator>
 	void jacobianImpl(double t, double z, double r, unsigned int secIdx, double const* y, double const* yCp, RowIterator jac) const
 	{
-		_p.update(t, z, r, secIdx, _nComp, _nBoundStates);
+		const ParamHandler_t& p = _p.update(t, z, r, secIdx, _nComp, _nBoundStates);
 
 		// Protein equations: dq_i / dt - ( H_i c_{p,i} + \sum_j k_{ij} c_{p,i} c_{p,j} - q_i ) == 0
 		//               <=>  dq_i / dt - ( H_i c_{p,i} + c_{p,i} * \sum_j k_{ij} c_{p,j} - q_i ) == 0
@@ -253,8 +261,8 @@ protected:
 			if (_nBoundStates[i] == 0)
 				continue;
 
-			const double h = static_cast<double>(_p.h[i]);
-			active const* const kSlice = _p.k[i];
+			const double h = static_cast<double>(p.h[i]);
+			active const* const kSlice = p.k[i];
 
 			// dres_i / dc_{p,j}
 			for (int j = 0; j < _nComp; ++j)
@@ -41,7 +41,7 @@ namespace model
 /**
  * @brief Handles self association binding model parameters that do not depend on external functions
  */
-struct SelfAssociationParamHandler : public BindingParamHandlerBase
+struct SelfAssociationParamHandler : public BindingParamHandlerBase<SelfAssociationParamHandler>
 {
 	static const char* identifier() { return "SELF_ASSOCIATION"; }
 
@@ -103,7 +103,7 @@ struct SelfAssociationParamHandler : public BindingParamHandlerBase
 /**
  * @brief Handles self association binding model parameters that depend on an external function
  */
-struct ExtSelfAssociationParamHandler : public ExternalBindingParamHandlerBase
+struct ExtSelfAssociationParamHandler : public ExternalBindingParamHandlerBase<ExtSelfAssociationParamHandler>
 {
 	static const char* identifier() { return "EXT_SELF_ASSOCIATION"; }
 
@@ -125,7 +125,7 @@ struct ExtSelfAssociationParamHandler : public ExternalBindingParamHandlerBase
 		CADET_READPAR_MATRIX(sigma, paramProvider, "SAI_SIGMA", nComp, 1);
 		readReferenceConcentrations(paramProvider, "EXT_SAI_", refC0, refQ);
 
-		return ExternalBindingParamHandlerBase::configure(paramProvider, 6);
+		return ExternalBindingParamHandlerBase<ExtSelfAssociationParamHandler>::configure(paramProvider, 6);
 	}
 
 	/**
@@ -148,29 +148,34 @@ struct ExtSelfAssociationParamHandler : public ExternalBindingParamHandlerBase
 	}
 
 	/**
-	 * @brief Updates local parameter cache in order to take the external profile into account
-	 * @details This function is declared const since the actual parameters are left unchanged by the method.
-	 *         The cache is marked as mutable in order to make it writable.
+	 * @brief Computes the parameters that take the external profile into account
+	 * @details The parameters are stored in the copy of this object owned by the calling thread (see localParams()).
+	 *          This function is, thus, safe to be called concurrently.
 	 * @param [in] t Current time
 	 * @param [in] z Axial coordinate in the column
 	 * @param [in] r Radial coordinate in the bead
 	 * @param [in] secIdx Index of the current section
 	 * @param [in] nComp Number of components
 	 * @param [in] nBoundStates Array with number of bound states for each component
+	 * @return Parameters at the given position
 	 */
-	inline void update(double t, double z, double r, unsigned int secIdx, unsigned int nComp, unsigned int const* nBoundStates) const
+	inline const ExtSelfAssociationParamHandler& update(double t, double z, double r, unsigned int secIdx, unsigned int nComp, unsigned int const* nBoundStates) const
 	{
-		evaluateExternalFunctions(t, z, r, secIdx);
+		ExtSelfAssociationParamHandler& p = localParams();
+		p.evaluateExternalFunctions(t, z, r, secIdx);
+
 		for (unsigned int i = 0; i < nComp; ++i)
 		{
-			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(kA, i, _extFunBuffer[0]);
-			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(kA2, i, _extFunBuffer[1]);
-			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(kD, i, _extFunBuffer[2]);
-			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(nu, i, _extFunBuffer[3]);
-			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(sigma, i, _extFunBuffer[4]);
+			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(p, kA, i, p._extFunBuffer[0]);
+			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(p, kA2, i, p._extFunBuffer[1]);
+			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(p, kD, i, p._extFunBuffer[2]);
+			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(p, nu, i, p._extFunBuffer[3]);
+			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(p, sigma, i, p._extFunBuffer[4]);
 		}
 
-		CADET_UPDATE_EXTDEP_VARIABLE(lambda, _extFunBuffer[5]);
+		CADET_UPDATE_EXTDEP_VARIABLE(p, lambda, p._extFunBuffer[5]);
+
+		return p;
 	}
 
 	CADET_DEFINE_EXTDEP_VARIABLE(std::vector<active>, kA)
@@ -237,9 +242,10 @@ public:
 
 	virtual void consistentInitialState(double t, double z, double r, unsigned int secIdx, double* const vecStateY, double errorTol, 
 		active* const adRes, active* const adY, unsigned int adEqOffset, unsigned int adOffset, unsigned int diagDir, 
-		unsigned int lowerBandwidth, unsigned int upperBandwidth, double* const workingMemory, linalg::detail::DenseMatrixBase& workingMat) const
+		unsigned int lowerBandwidth, unsigned int upperBandwidth, double* const workingMemory, linalg::detail::DenseMatrixBase& workingMat,
+		BindingWarmStart* const warmStart) const
 	{
-		_p.update(t, z, r, secIdx, _nComp, _nBoundStates);
+		const ParamHandler_t& p = _p.update(t, z, r, secIdx, _nComp, _nBoundStates);
 
 		// If we have kinetic binding, there is only the algebraic salt equation
 		if (_kineticBinding)
@@ -257,18 +263,18 @@ public:
 				if (_nBoundStates[j] == 0)
 					continue;
 
-				const double diff = -static_cast<double>(_p.nu[j]) * vecStateY[bndIdx] - kahanCompensation;
+				const double diff = -static_cast<double>(p.nu[j]) * vecStateY[bndIdx] - kahanCompensation;
 				const double tempSum = vecStateY[0] + diff;
 				kahanCompensation = (tempSum - vecStateY[0]) - diff;
 				vecStateY[0] = tempSum;
 
-//				vecStateY[0] -= static_cast<double>(_p.nu[j]) * vecStateY[bndIdx];
+//				vecStateY[0] -= static_cast<double>(p.nu[j]) * vecStateY[bndIdx];
 
 				// Next bound component
 				++bndIdx;
 			}
 
-			const double diff = static_cast<double>(_p.lambda) - kahanCompensation;
+			const double diff = static_cast<double>(p.lambda) - kahanCompensation;
 			const double tempSum = vecStateY[0] + diff;
 			vecStateY[0] = tempSum;
 
@@ -280,7 +286,6 @@ public:
 
 		// Determine problem size
 		const unsigned int eqSize = numBoundStates(_nBoundStates, _nComp);
-		std::fill(workingMemory, workingMemory + _nonlinearSolver->workspaceSize(eqSize), 0.0);
 
 		// Select between analytic and AD Jacobian
 		std::function<bool(double const* const, linalg::detail::DenseMatrixBase& jac)> jacobianFunc;
@@ -321,12 +326,12 @@ public:
 			};
 		}
 
-		const bool conv = _nonlinearSolver->solve([&](double const* const x, double* const res) -> bool {
+		const bool conv = solveAlgebraicEquations([&](double const* const x, double* const res) -> bool {
 				residualImpl<double, double, double, double>(t, z, r, secIdx, 1.0, x, vecStateY - _nComp, nullptr, res); 
 				return true; 
 			}, 
 			jacobianFunc,
-			errorTol, vecStateY, workingMemory, workingMat, eqSize);
+			errorTol, vecStateY, workingMemory, workingMat, eqSize, warmStart);
 	}
 
 	virtual int residual(const active& t, double z, double r, unsigned int secIdx, const active& timeFactor, 
@@ -341,6 +346,9 @@ public:
 	virtual int residual(double t, double z, double r, unsigned int secIdx, double timeFactor, 
 		double const* y, double const* yDot, double* res) const;
 
+	CADET_BINDINGMODEL_FIXED_AD_RESIDUAL_DECL
+	CADET_BINDINGMODEL_SPARSE_AD_RESIDUAL_DECL
+
 	virtual void setExternalFunctions(IExternalFunction** extFuns, unsigned int size) { _p.setExternalFunctions(extFuns, size); }
 
 	virtual void analyticJacobian(double t, double z, double r, unsigned int secIdx, double const* y, linalg::BandMatrix::RowIterator jac) const
@@ -400,12 +408,12 @@ protected:
 	int residualImpl(const ParamType& t, double z, double r, unsigned int secIdx, const ParamType& timeFactor,
 		StateType const* y, CpStateType const* yCp, double const* yDot, ResidualType* res) const
 	{
-		_p.update(static_cast<double>(t), z, r, secIdx, _nComp, _nBoundStates);
+		const ParamHandler_t& p = _p.update(static_cast<double>(t), z, r, secIdx, _nComp, _nBoundStates);
 
 		// Salt equation: q_0 - Lambda + Sum[nu_j * q_j, j] == 0 
 		//           <=>  q_0 == Lambda - Sum[nu_j * q_j, j] 
 		// Also compute \bar{q}_0 = q_0 - Sum[sigma_j * q_j, j]
-		res[0] = y[0] - static_cast<ParamType>(_p.lambda);
+		res[0] = y[0] - static_cast<ParamType>(p.lambda);
 		ResidualType q0_bar = y[0];
 
 		unsigned int bndIdx = 1;
@@ -415,8 +423,8 @@ protected:
 			if (_nBoundStates[j] == 0)
 				continue;
 
-			res[0] += static_cast<ParamType>(_p.nu[j]) * y[bndIdx];
-			q0_bar -= static_cast<ParamType>(_p.sigma[j]) * y[bndIdx];
+			res[0] += static_cast<ParamType>(p.nu[j]) * y[bndIdx];
+			q0_bar -= static_cast<ParamType>(p.sigma[j]) * y[bndIdx];
 
 			// Next bound component
 			++bndIdx;
@@ -434,11 +442,11 @@ protected:
 			if (_nBoundStates[i] == 0)
 				continue;
 
-			const ResidualType c0_pow_nu = pow(yCp0_divRef, static_cast<ParamType>(_p.nu[i]));
-			const ResidualType q0_bar_pow_nu = pow(q0_bar_divRef, static_cast<ParamType>(_p.nu[i]));
+			const ResidualType c0_pow_nu = pow(yCp0_divRef, static_cast<ParamType>(p.nu[i]));
+			const ResidualType q0_bar_pow_nu = pow(q0_bar_divRef, static_cast<ParamType>(p.nu[i]));
 
 			// Residual
-			res[bndIdx] = static_cast<ParamType>(_p.kD[i]) * y[bndIdx] * c0_pow_nu - yCp[i] * (static_cast<ParamType>(_p.kA[i]) + yCp[i] * static_cast<ParamType>(_p.kA2[i])) * q0_bar_pow_nu;
+			res[bndIdx] = static_cast<ParamType>(p.kD[i]) * y[bndIdx] * c0_pow_nu - yCp[i] * (static_cast<ParamType>(p.kA[i]) + yCp[i] * static_cast<ParamType>(p.kA2[i])) * q0_bar_pow_nu;
 
 			// Add time derivative if necessary
 			if (_kineticBinding && yDot)
@@ -456,7 +464,7 @@ protected:
 	template <typename RowIterator>
 	void jacobianImpl(double t, double z, double r, unsigned int secIdx, double const* y, double const* yCp, RowIterator jac) const
 	{
-		_p.update(t, z, r, secIdx, _nComp, _nBoundStates);
+		const ParamHandler_t& p = _p.update(t, z, r, secIdx, _nComp, _nBoundStates);
 
 		double q0_bar = y[0];
 
@@ -469,10 +477,10 @@ protected:
 			if (_nBoundStates[j] == 0)
 				continue;
 
-			jac[bndIdx] = static_cast<double>(_p.nu[j]);
+			jac[bndIdx] = static_cast<double>(p.nu[j]);
 
 			// Calculate \bar{q}_0 = q_0 - Sum[sigma_j * q_j, j]
-			q0_bar -= static_cast<double>(_p.sigma[j]) * y[bndIdx];
+			q0_bar -= static_cast<double>(p.sigma[j]) * y[bndIdx];
 
 			// Next bound component
 			++bndIdx;
@@ -499,10 +507,10 @@ protected:
 			// Getting to c_{p,i}: -bndIdx takes us to q_0, another -nComp to c_{p,0} and a +i to c_{p,i}.
 			//                     This means jac[i - bndIdx - nComp] corresponds to c_{p,i}.
 
-			const double ka = static_cast<double>(_p.kA[i]);
-			const double ka2 = static_cast<double>(_p.kA2[i]);
-			const double kd = static_cast<double>(_p.kD[i]);
-			const double nu = static_cast<double>(_p.nu[i]);
+			const double ka = static_cast<double>(p.kA[i]);
+			const double ka2 = static_cast<double>(p.kA2[i]);
+			const double kd = static_cast<double>(p.kD[i]);
+			const double nu = static_cast<double>(p.nu[i]);
 
 			const double effKa = yCp[i] * (ka + ka2 * yCp[i]);
 			const double c0_pow_nu     = pow(yCp0_divRef, nu);
@@ -526,7 +534,7 @@ protected:
 					continue;
 
 				// dres_i / dq_j
-				jac[bndIdx2 - bndIdx] = -effKa * yCp[i] * nu * q0_bar_pow_nu_m1_divRef * (-static_cast<double>(_p.sigma[j]));
+				jac[bndIdx2 - bndIdx] = -effKa * yCp[i] * nu * q0_bar_pow_nu_m1_divRef * (-static_cast<double>(p.sigma[j]));
 				// Getting to q_j: -bndIdx takes us to q_0, another +bndIdx2 to q_j. This means jac[bndIdx2 - bndIdx] corresponds to q_j.
 
 				++bndIdx2;
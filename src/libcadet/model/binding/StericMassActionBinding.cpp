@@ -20,6 +20,8 @@
 #include "ParamReaderHelper.hpp"
 
 #include <functional>
+#include <algorithm>
+#include <cmath>
 #include <unordered_map>
 #include <string>
 #include <vector>
@@ -39,7 +41,7 @@ namespace model
 /**
  * @brief Handles SMA binding model parameters that do not depend on external functions
  */
-struct SMAParamHandler : public BindingParamHandlerBase
+struct SMAParamHandler : public BindingParamHandlerBase<SMAParamHandler>
 {
 	static const char* identifier() { return "STERIC_MASS_ACTION"; }
 
@@ -97,7 +99,7 @@ struct SMAParamHandler : public BindingParamHandlerBase
 /**
  * @brief Handles SMA binding model parameters that depend on an external function
  */
-struct ExtSMAParamHandler : public ExternalBindingParamHandlerBase
+struct ExtSMAParamHandler : public ExternalBindingParamHandlerBase<ExtSMAParamHandler>
 {
 	static const char* identifier() { return "EXT_STERIC_MASS_ACTION"; }
 
@@ -118,7 +120,7 @@ struct ExtSMAParamHandler : public ExternalBindingParamHandlerBase
 		CADET_READPAR_MATRIX(sigma, paramProvider, "SMA_SIGMA", nComp, 1);
 		readReferenceConcentrations(paramProvider, "EXT_SMA_", refC0, refQ);
 
-		return ExternalBindingParamHandlerBase::configure(paramProvider, 5);
+		return ExternalBindingParamHandlerBase<ExtSMAParamHandler>::configure(paramProvider, 5);
 	}
 
 	/**
@@ -140,28 +142,33 @@ struct ExtSMAParamHandler : public ExternalBindingParamHandlerBase
 	}
 
 	/**
-	 * @brief Updates local parameter cache in order to take the external profile into account
-	 * @details This function is declared const since the actual parameters are left unchanged by the method.
-	 *         The cache is marked as mutable in order to make it writable.
+	 * @brief Computes the parameters that take the external profile into account
+	 * @details The parameters are stored in the copy of this object owned by the calling thread (see localParams()).
+	 *          This function is, thus, safe to be called concurrently.
 	 * @param [in] t Current time
 	 * @param [in] z Axial coordinate in the column
 	 * @param [in] r Radial coordinate in the bead
 	 * @param [in] secIdx Index of the current section
 	 * @param [in] nComp Number of components
 	 * @param [in] nBoundStates Array with number of bound states for each component
+	 * @return Parameters at the given position
 	 */
-	inline void update(double t, double z, double r, unsigned int secIdx, unsigned int nComp, unsigned int const* nBoundStates) const
+	inline const ExtSMAParamHandler& update(double t, double z, double r, unsigned int secIdx, unsigned int nComp, unsigned int const* nBoundStates) const
 	{
-		evaluateExternalFunctions(t, z, r, secIdx);
+		ExtSMAParamHandler& p = localParams();
+		p.evaluateExternalFunctions(t, z, r, secIdx);
+
 		for (unsigned int i = 0; i < nComp; ++i)
 		{
-			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(kA, i, _extFunBuffer[0]);
-			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(kD, i, _extFunBuffer[1]);
-			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(nu, i, _extFunBuffer[2]);
-			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(sigma, i, _extFunBuffer[3]);
+			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(p, kA, i, p._extFunBuffer[0]);
+			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(p, kD, i, p._extFunBuffer[1]);
+			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(p, nu, i, p._extFunBuffer[2]);
+			CADET_UPDATE_EXTDEP_VARIABLE_BRACES(p, sigma, i, p._extFunBuffer[3]);
 		}
 
-		CADET_UPDATE_EXTDEP_VARIABLE(lambda, _extFunBuffer[4]);
+		CADET_UPDATE_EXTDEP_VARIABLE(p, lambda, p._extFunBuffer[4]);
+
+		return p;
 	}
 
 	CADET_DEFINE_EXTDEP_VARIABLE(std::vector<active>, kA)
@@ -191,7 +198,7 @@ class StericMassActionBindingBase : public BindingModelBase
 {
 public:
 
-	StericMassActionBindingBase() { }
+	StericMassActionBindingBase() : _singleBoundState(false) { }
 	virtual ~StericMassActionBindingBase() CADET_NOEXCEPT { }
 
 	static const char* identifier() { return ParamHandler_t::identifier(); }
@@ -204,6 +211,9 @@ public:
 		// Guarantee that salt has exactly one bound state
 		if (nBound[0] != 1)
 			throw InvalidParameterException("Steric Mass Action binding model requires exactly one bound state for salt component");
+
+		// Bound state index equals component index if each component has exactly one bound state
+		_singleBoundState = std::all_of(nBound, nBound + nComp, [](unsigned int n) { return n == 1; });
 	}
 
 	virtual void getAlgebraicBlock(unsigned int& idxStart, unsigned int& len) const
@@ -227,9 +237,10 @@ public:
 
 	virtual void consistentInitialState(double t, double z, double r, unsigned int secIdx, double* const vecStateY, double errorTol, 
 		active* const adRes, active* const adY, unsigned int adEqOffset, unsigned int adOffset, unsigned int diagDir, 
-		unsigned int lowerBandwidth, unsigned int upperBandwidth, double* const workingMemory, linalg::detail::DenseMatrixBase& workingMat) const
+		unsigned int lowerBandwidth, unsigned int upperBandwidth, double* const workingMemory, linalg::detail::DenseMatrixBase& workingMat,
+		BindingWarmStart* const warmStart) const
 	{
-		_p.update(t, z, r, secIdx, _nComp, _nBoundStates);
+		const ParamHandler_t& p = _p.update(t, z, r, secIdx, _nComp, _nBoundStates);
 
 		// If we have kinetic binding, there is only the algebraic salt equation
 		if (_kineticBinding)
@@ -237,7 +248,7 @@ public:
 			// Compute salt component from given bound states q_j
 			// Salt equation: q_0 - Lambda + Sum[nu_j * q_j, j] == 0 
 			//           <=>  q_0 == Lambda - Sum[nu_j * q_j, j] 
-			vecStateY[0] = static_cast<double>(_p.lambda);
+			vecStateY[0] = static_cast<double>(p.lambda);
 
 			unsigned int bndIdx = 1;
 			for (int j = 1; j < _nComp; ++j)
@@ -246,7 +257,7 @@ public:
 				if (_nBoundStates[j] == 0)
 					continue;
 
-				vecStateY[0] -= static_cast<double>(_p.nu[j]) * vecStateY[bndIdx];
+				vecStateY[0] -= static_cast<double>(p.nu[j]) * vecStateY[bndIdx];
 
 				// Next bound component
 				++bndIdx;
@@ -260,7 +271,6 @@ public:
 
 		// Determine problem size
 		const unsigned int eqSize = numBoundStates(_nBoundStates, _nComp);
-		std::fill(workingMemory, workingMemory + _nonlinearSolver->workspaceSize(eqSize), 0.0);
 
 		// Select between analytic and AD Jacobian
 		std::function<bool(double const* const, linalg::detail::DenseMatrixBase& jac)> jacobianFunc;
@@ -301,12 +311,12 @@ public:
 			};
 		}
 
-		const bool conv = _nonlinearSolver->solve([&](double const* const x, double* const res) -> bool {
+		const bool conv = solveAlgebraicEquations([&](double const* const x, double* const res) -> bool {
 				residualImpl<double, double, double, double>(t, z, r, secIdx, 1.0, x, vecStateY - _nComp, nullptr, res); 
 				return true; 
 			}, 
 			jacobianFunc,
-			errorTol, vecStateY, workingMemory, workingMat, eqSize);
+			errorTol, vecStateY, workingMemory, workingMat, eqSize, warmStart);
 	}
 
 	virtual int residual(const active& t, double z, double r, unsigned int secIdx, const active& timeFactor, 
@@ -321,6 +331,9 @@ public:
 	virtual int residual(double t, double z, double r, unsigned int secIdx, double timeFactor, 
 		double const* y, double const* yDot, double* res) const;
 
+	CADET_BINDINGMODEL_FIXED_AD_RESIDUAL_DECL
+	CADET_BINDINGMODEL_SPARSE_AD_RESIDUAL_DECL
+
 	virtual void setExternalFunctions(IExternalFunction** extFuns, unsigned int size) { _p.setExternalFunctions(extFuns, size); }
 
 	virtual void analyticJacobian(double t, double z, double r, unsigned int secIdx, double const* y, linalg::BandMatrix::RowIterator jac) const
@@ -328,6 +341,43 @@ public:
 		jacobianImpl(t, z, r, secIdx, y, y - _nComp, jac);
 	}
 
+	virtual bool supportsBatchEvaluation() const CADET_NOEXCEPT { return !ParamHandler_t::dependsOnExternalFunctions(); }
+
+	virtual int residualBatch(double t, double z, double const* r, unsigned int secIdx, double timeFactor, unsigned int nShells,
+		unsigned int stride, double const* y, double const* yDot, double* res) const
+	{
+		// Externally dependent parameters change from shell to shell
+		if (ParamHandler_t::dependsOnExternalFunctions() || !_singleBoundState)
+			return BindingModelBase::residualBatch(t, z, r, secIdx, timeFactor, nShells, stride, y, yDot, res);
+
+		singleBoundStateBatchImpl<true, false>(t, z, r, secIdx, timeFactor, nShells, stride, y, yDot, res, nullptr);
+		return 0;
+	}
+
+	virtual void analyticJacobianBatch(double t, double z, double const* r, unsigned int secIdx, unsigned int nShells,
+		unsigned int stride, double const* y, linalg::BandMatrix::RowIterator jac) const
+	{
+		if (ParamHandler_t::dependsOnExternalFunctions() || !_singleBoundState)
+		{
+			// Bypass virtual dispatch for each shell
+			for (unsigned int s = 0; s < nShells; ++s, jac += stride)
+				jacobianImpl(t, z, r[s], secIdx, y + s * stride, y + s * stride - _nComp, jac);
+			return;
+		}
+
+		singleBoundStateBatchImpl<false, true>(t, z, r, secIdx, 0.0, nShells, stride, y, nullptr, nullptr, &jac);
+	}
+
+	virtual int residualWithJacobianBatch(double t, double z, double const* r, unsigned int secIdx, double timeFactor, unsigned int nShells,
+		unsigned int stride, double const* y, double const* yDot, double* res, linalg::BandMatrix::RowIterator jac) const
+	{
+		if (ParamHandler_t::dependsOnExternalFunctions() || !_singleBoundState)
+			return BindingModelBase::residualWithJacobianBatch(t, z, r, secIdx, timeFactor, nShells, stride, y, yDot, res, jac);
+
+		singleBoundStateBatchImpl<true, true>(t, z, r, secIdx, timeFactor, nShells, stride, y, yDot, res, &jac);
+		return 0;
+	}
+
 	virtual void jacobianAddDiscretized(double alpha, linalg::FactorizableBandMatrix::RowIterator jac) const
 	{
 		// We only add time derivatives for kinetic binding
@@ -357,6 +407,82 @@ public:
 			res[i] = multiplier * yDotS[i];
 	}
 
+	virtual bool hasAnalyticParamDerivative(const ParameterId& pId) const
+	{
+		// Derivatives with respect to the parameters of the external dependence are not implemented
+		if (ParamHandler_t::dependsOnExternalFunctions())
+			return false;
+
+		return (pId.name == hashString("SMA_LAMBDA")) || (pId.name == hashString("SMA_KA")) || (pId.name == hashString("SMA_KD"))
+			|| (pId.name == hashString("SMA_NU")) || (pId.name == hashString("SMA_SIGMA"));
+	}
+
+	virtual void analyticParamDerivative(const ParameterId& pId, double factor, double t, double z, double r, unsigned int secIdx,
+		double const* y, double* const dRes) const
+	{
+		// Salt equation: q_0 - Lambda + Sum[nu_j * q_j, j] == 0
+		if (pId.name == hashString("SMA_LAMBDA"))
+		{
+			dRes[0] -= factor;
+			return;
+		}
+
+		// Salt parameters (except for Lambda) do not appear in the equations
+		const unsigned int comp = pId.component;
+		if ((comp == 0) || (_nBoundStates[comp] == 0))
+			return;
+
+		// Non-binding components are not present in the solid phase
+		const unsigned int bndComp = numBoundStates(_nBoundStates, comp);
+		double const* const yCp = y - _nComp;
+
+		double q0_bar = y[0];
+		unsigned int bndIdx = 1;
+		for (int j = 1; j < _nComp; ++j)
+		{
+			if (_nBoundStates[j] == 0)
+				continue;
+
+			q0_bar -= static_cast<double>(_p.sigma[j]) * y[bndIdx];
+			++bndIdx;
+		}
+
+		const double refC0 = static_cast<double>(_p.refC0);
+		const double refQ = static_cast<double>(_p.refQ);
+		const double yCp0_divRef = yCp[0] / refC0;
+		const double q0_bar_divRef = q0_bar / refQ;
+
+		// Protein equations: k_{d,i} * q_i * c_{p,0}^{nu_i} - k_{a,i} * c_{p,i} * \bar{q}_0^{nu_i} == 0
+		const double nu = static_cast<double>(_p.nu[comp]);
+		if (pId.name == hashString("SMA_KA"))
+			dRes[bndComp] -= factor * yCp[comp] * std::pow(q0_bar_divRef, nu);
+		else if (pId.name == hashString("SMA_KD"))
+			dRes[bndComp] += factor * y[bndComp] * std::pow(yCp0_divRef, nu);
+		else if (pId.name == hashString("SMA_NU"))
+		{
+			dRes[0] += factor * y[bndComp];
+
+			const double c0_pow_nu = std::pow(yCp0_divRef, nu);
+			const double q0_bar_pow_nu = std::pow(q0_bar_divRef, nu);
+			dRes[bndComp] += factor * (static_cast<double>(_p.kD[comp]) * y[bndComp] * c0_pow_nu * std::log(yCp0_divRef)
+				- static_cast<double>(_p.kA[comp]) * yCp[comp] * q0_bar_pow_nu * std::log(q0_bar_divRef));
+		}
+		else if (pId.name == hashString("SMA_SIGMA"))
+		{
+			// sigma_comp enters all protein equations through \bar{q}_0
+			bndIdx = 1;
+			for (int i = 1; i < _nComp; ++i)
+			{
+				if (_nBoundStates[i] == 0)
+					continue;
+
+				const double nuI = static_cast<double>(_p.nu[i]);
+				dRes[bndIdx] += factor * static_cast<double>(_p.kA[i]) * yCp[i] * nuI * std::pow(q0_bar_divRef, nuI - 1.0) * y[bndComp] / refQ;
+				++bndIdx;
+			}
+		}
+	}
+
 	virtual bool hasSalt() const CADET_NOEXCEPT { return true; }
 	virtual bool supportsMultistate() const CADET_NOEXCEPT { return false; }
 	virtual bool supportsNonBinding() const CADET_NOEXCEPT { return true; }
@@ -364,6 +490,7 @@ public:
 
 protected:
 	ParamHandler_t _p; //!< Handles parameters and their dependence on external functions
+	bool _singleBoundState; //!< Determines whether each component (including salt) has exactly one bound state
 
 	virtual bool configureImpl(bool reconfigure, IParameterProvider& paramProvider, unsigned int unitOpIdx)
 	{
@@ -380,12 +507,12 @@ protected:
 	int residualImpl(const ParamType& t, double z, double r, unsigned int secIdx, const ParamType& timeFactor,
 		StateType const* y, CpStateType const* yCp, double const* yDot, ResidualType* res) const
 	{
-		_p.update(static_cast<double>(t), z, r, secIdx, _nComp, _nBoundStates);
+		const ParamHandler_t& p = _p.update(static_cast<double>(t), z, r, secIdx, _nComp, _nBoundStates);
 
 		// Salt equation: q_0 - Lambda + Sum[nu_j * q_j, j] == 0 
 		//           <=>  q_0 == Lambda - Sum[nu_j * q_j, j] 
 		// Also compute \bar{q}_0 = q_0 - Sum[sigma_j * q_j, j]
-		res[0] = y[0] - static_cast<ParamType>(_p.lambda);
+		res[0] = y[0] - static_cast<ParamType>(p.lambda);
 		ResidualType q0_bar = y[0];
 
 		unsigned int bndIdx = 1;
@@ -395,8 +522,8 @@ protected:
 			if (_nBoundStates[j] == 0)
 				continue;
 
-			res[0] += static_cast<ParamType>(_p.nu[j]) * y[bndIdx];
-			q0_bar -= static_cast<ParamType>(_p.sigma[j]) * y[bndIdx];
+			res[0] += static_cast<ParamType>(p.nu[j]) * y[bndIdx];
+			q0_bar -= static_cast<ParamType>(p.sigma[j]) * y[bndIdx];
 
 			// Next bound component
 			++bndIdx;
@@ -416,11 +543,11 @@ protected:
 			if (_nBoundStates[i] == 0)
 				continue;
 
-			const ResidualType c0_pow_nu = pow(yCp0_divRef, static_cast<ParamType>(_p.nu[i]));
-			const ResidualType q0_bar_pow_nu = pow(q0_bar_divRef, static_cast<ParamType>(_p.nu[i]));
+			const ResidualType c0_pow_nu = pow(yCp0_divRef, static_cast<ParamType>(p.nu[i]));
+			const ResidualType q0_bar_pow_nu = pow(q0_bar_divRef, static_cast<ParamType>(p.nu[i]));
 
 			// Residual
-			res[bndIdx] = static_cast<ParamType>(_p.kD[i]) * y[bndIdx] * c0_pow_nu - static_cast<ParamType>(_p.kA[i]) * yCp[i] * q0_bar_pow_nu;
+			res[bndIdx] = static_cast<ParamType>(p.kD[i]) * y[bndIdx] * c0_pow_nu - static_cast<ParamType>(p.kA[i]) * yCp[i] * q0_bar_pow_nu;
 
 			// Add time derivative if necessary
 			if (_kineticBinding && yDot)
@@ -438,7 +565,7 @@ protected:
 	template <typename RowIterator>
 	void jacobianImpl(double t, double z, double r, unsigned int secIdx, double const* y, double const* yCp, RowIterator jac) const
 	{
-		_p.update(t, z, r, secIdx, _nComp, _nBoundStates);
+		const ParamHandler_t& p = _p.update(t, z, r, secIdx, _nComp, _nBoundStates);
 
 		double q0_bar = y[0];
 
@@ -451,10 +578,10 @@ protected:
 			if (_nBoundStates[j] == 0)
 				continue;
 
-			jac[bndIdx] = static_cast<double>(_p.nu[j]);
+			jac[bndIdx] = static_cast<double>(p.nu[j]);
 
 			// Calculate \bar{q}_0 = q_0 - Sum[sigma_j * q_j, j]
-			q0_bar -= static_cast<double>(_p.sigma[j]) * y[bndIdx];
+			q0_bar -= static_cast<double>(p.sigma[j]) * y[bndIdx];
 
 			// Next bound component
 			++bndIdx;
@@ -481,9 +608,9 @@ protected:
 			// Getting to c_{p,i}: -bndIdx takes us to q_0, another -nComp to c_{p,0} and a +i to c_{p,i}.
 			//                     This means jac[i - bndIdx - nComp] corresponds to c_{p,i}.
 
-			const double ka = static_cast<double>(_p.kA[i]);
-			const double kd = static_cast<double>(_p.kD[i]);
-			const double nu = static_cast<double>(_p.nu[i]);
+			const double ka = static_cast<double>(p.kA[i]);
+			const double kd = static_cast<double>(p.kD[i]);
+			const double nu = static_cast<double>(p.nu[i]);
 
 			const double c0_pow_nu     = pow(yCp0_divRef, nu);
 			const double q0_bar_pow_nu = pow(q0_bar_divRef, nu);
@@ -506,7 +633,7 @@ protected:
 					continue;
 
 				// dres_i / dq_j
-				jac[bndIdx2 - bndIdx] = -ka * yCp[i] * q0_bar_pow_nu_m1_divRef * (-static_cast<double>(_p.sigma[j]));
+				jac[bndIdx2 - bndIdx] = -ka * yCp[i] * q0_bar_pow_nu_m1_divRef * (-static_cast<double>(p.sigma[j]));
 				// Getting to q_j: -bndIdx takes us to q_0, another +bndIdx2 to q_j. This means jac[bndIdx2 - bndIdx] corresponds to q_j.
 
 				++bndIdx2;
@@ -520,6 +647,176 @@ protected:
 			++jac;
 		}
 	}
+
+	/**
+	 * @brief Evaluates residual and / or Jacobian on a contiguous set of particle shells
+	 * @details Requires that each component has exactly one bound state and that the parameters do not
+	 *          depend on external functions. The shells are processed in blocks. In each shell, the
+	 *          logarithms of @f$ c_{p,0} @f$ and @f$ \bar{q}_0 @f$ are computed once and all powers
+	 *          @f$ x^{\nu_i} = \exp(\nu_i \log x) @f$ are obtained from them. The loops over the shells
+	 *          of a block are independent, which allows vectorization. Residual and Jacobian share the powers.
+	 *          
+	 *          Blocks with a non-positive salt concentration or @f$ \bar{q}_0 @f$ in any shell are
+	 *          evaluated by residualImpl() and jacobianImpl() instead.
+	 * @param [in] t Current time point
+	 * @param [in] z Axial position in normalized coordinates (column inlet = 0, column outlet = 1)
+	 * @param [in] r Array with radial position in normalized coordinates of each shell
+	 * @param [in] secIdx Index of the current section
+	 * @param [in] timeFactor Factor premultiplied to time derivatives
+	 * @param [in] nShells Number of particle shells
+	 * @param [in] stride Distance between two consecutive shells in @p y, @p yDot, @p res, and in the rows of @p jac
+	 * @param [in] y Pointer to first bound state of the first shell
+	 * @param [in] yDot Pointer to first bound state time derivative of the first shell or @c nullptr
+	 * @param [out] res Pointer to first bound state residual of the first shell (unused if @p wantRes is @c false)
+	 * @param [in] jac Pointer to the row iterator of the first bound states row of the first shell or @c nullptr if @p wantJac is @c false
+	 * @tparam wantRes Determines whether the residual is evaluated
+	 * @tparam wantJac Determines whether the Jacobian is evaluated
+	 */
+	template <bool wantRes, bool wantJac>
+	void singleBoundStateBatchImpl(double t, double z, double const* r, unsigned int secIdx, double timeFactor, unsigned int nShells,
+		unsigned int stride, double const* y, double const* yDot, double* res, linalg::BandMatrix::RowIterator const* jac) const
+	{
+		const ParamHandler_t& p = _p.update(t, z, r[0], secIdx, _nComp, _nBoundStates);
+		const bool addTimeDerivative = wantRes && _kineticBinding && yDot;
+
+		const double lambda = static_cast<double>(p.lambda);
+		const double refC0 = static_cast<double>(_p.refC0);
+		const double refQ = static_cast<double>(_p.refQ);
+
+		// Process the shells in blocks such that the intermediates fit on the stack
+		const unsigned int blockSize = 16;
+		double saltRes[blockSize];
+		double q0_bar[blockSize];
+		double logC0[blockSize];
+		double logQ0_bar[blockSize];
+		double c0_pow_nu[blockSize];
+		double q0_bar_pow_nu[blockSize];
+
+		for (unsigned int first = 0; first < nShells; first += blockSize)
+		{
+			const unsigned int n = std::min(blockSize, nShells - first);
+			double const* const yBlock = y + first * stride;
+			double const* const yCp0 = yBlock - _nComp;
+
+			// Salt equation: q_0 - Lambda + Sum[nu_j * q_j, j] == 0 
+			// Also compute \bar{q}_0 = q_0 - Sum[sigma_j * q_j, j]
+			for (unsigned int s = 0; s < n; ++s)
+			{
+				saltRes[s] = yBlock[s * stride] - lambda;
+				q0_bar[s] = yBlock[s * stride];
+			}
+
+			for (int j = 1; j < _nComp; ++j)
+			{
+				const double nu = static_cast<double>(p.nu[j]);
+				const double sigma = static_cast<double>(p.sigma[j]);
+				double const* const q = yBlock + j;
+				for (unsigned int s = 0; s < n; ++s)
+				{
+					saltRes[s] += nu * q[s * stride];
+					q0_bar[s] -= sigma * q[s * stride];
+				}
+			}
+
+			// Logarithms are only defined for positive values
+			bool positive = true;
+			for (unsigned int s = 0; s < n; ++s)
+				positive = positive && (yCp0[s * stride] > 0.0) && (q0_bar[s] > 0.0);
+
+			if (!positive)
+			{
+				for (unsigned int s = first; s < first + n; ++s)
+				{
+					double const* const yShell = y + s * stride;
+					if (wantRes)
+						residualImpl<double, double, double, double>(t, z, r[s], secIdx, timeFactor, yShell, yShell - _nComp, yDot ? yDot + s * stride : nullptr, res + s * stride);
+					if (wantJac)
+						jacobianImpl(t, z, r[s], secIdx, yShell, yShell - _nComp, *jac + static_cast<int>(s * stride));
+				}
+				continue;
+			}
+
+			for (unsigned int s = 0; s < n; ++s)
+			{
+				logC0[s] = std::log(yCp0[s * stride] / refC0);
+				logQ0_bar[s] = std::log(q0_bar[s] / refQ);
+			}
+
+			if (wantRes)
+			{
+				double* const resBlock = res + first * stride;
+				for (unsigned int s = 0; s < n; ++s)
+					resBlock[s * stride] = saltRes[s];
+			}
+
+			if (wantJac)
+			{
+				// Salt equation: q_0 - Lambda + Sum[nu_j * q_j, j] == 0
+				linalg::BandMatrix::RowIterator jacShell = *jac + static_cast<int>(first * stride);
+				for (unsigned int s = 0; s < n; ++s, jacShell += stride)
+				{
+					jacShell[0] = 1.0;
+					for (int j = 1; j < _nComp; ++j)
+						jacShell[j] = static_cast<double>(p.nu[j]);
+				}
+			}
+
+			// Protein equations: dq_i / dt - ( k_{a,i} * c_{p,i} * \bar{q}_0^{nu_i} - k_{d,i} * q_i * c_{p,0}^{nu_i} ) == 0
+			for (int i = 1; i < _nComp; ++i)
+			{
+				const double ka = static_cast<double>(p.kA[i]);
+				const double kd = static_cast<double>(p.kD[i]);
+				const double nu = static_cast<double>(p.nu[i]);
+				double const* const q = yBlock + i;
+				double const* const cp = yCp0 + i;
+
+				for (unsigned int s = 0; s < n; ++s)
+				{
+					c0_pow_nu[s] = std::exp(nu * logC0[s]);
+					q0_bar_pow_nu[s] = std::exp(nu * logQ0_bar[s]);
+				}
+
+				if (wantRes)
+				{
+					double* const resComp = res + first * stride + i;
+					for (unsigned int s = 0; s < n; ++s)
+						resComp[s * stride] = kd * q[s * stride] * c0_pow_nu[s] - ka * cp[s * stride] * q0_bar_pow_nu[s];
+
+					if (addTimeDerivative)
+					{
+						double const* const qDot = yDot + first * stride + i;
+						for (unsigned int s = 0; s < n; ++s)
+							resComp[s * stride] += timeFactor * qDot[s * stride];
+					}
+				}
+
+				if (wantJac)
+				{
+					// Bound state index equals component index, see jacobianImpl() for an explanation of the offsets
+					linalg::BandMatrix::RowIterator jacComp = *jac + static_cast<int>(first * stride + i);
+					for (unsigned int s = 0; s < n; ++s, jacComp += stride)
+					{
+						// Derivatives of the powers are given by d/dx x^nu = nu * x^nu / x
+						const double dq0_bar = -ka * cp[s * stride] * nu * q0_bar_pow_nu[s] / q0_bar[s];
+
+						// dres_i / dc_{p,0}
+						jacComp[-i - _nComp] = kd * q[s * stride] * nu * c0_pow_nu[s] / yCp0[s * stride];
+						// dres_i / dc_{p,i}
+						jacComp[-_nComp] = -ka * q0_bar_pow_nu[s];
+						// dres_i / dq_0
+						jacComp[-i] = dq0_bar;
+
+						// dres_i / dq_j
+						for (int j = 1; j < _nComp; ++j)
+							jacComp[j - i] = -dq0_bar * static_cast<double>(p.sigma[j]);
+
+						// Add to dres_i / dq_i
+						jacComp[0] += kd * c0_pow_nu[s];
+					}
+				}
+			}
+		}
+	}
 };
 
 CADET_BINDINGMODEL_RESIDUAL_TEMPLATED_BOILERPLATE_IMPL(StericMassActionBindingBase, ParamHandler_t)
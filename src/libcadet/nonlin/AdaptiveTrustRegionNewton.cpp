@@ -35,12 +35,15 @@ bool AdaptiveTrustRegionNewtonSolver::configure(IParameterProvider& paramProvide
 }
 
 bool AdaptiveTrustRegionNewtonSolver::solve(std::function<bool(double const* const, double* const)> residual, std::function<bool(double const* const, linalg::detail::DenseMatrixBase& jac)> jacobian,
-		double tol, double* const point, double* const workingMemory, linalg::detail::DenseMatrixBase& jacMatrix, unsigned int size) const
+		double tol, double* const point, double* const workingMemory, linalg::detail::DenseMatrixBase& jacMatrix, unsigned int size, SolverState* const state) const
 {
+	// Continue with the damping factor of a previous solve if available
+	const double damping = (state && (state->damping > 0.0)) ? state->damping : _initDamping;
+
 	return adaptiveTrustRegionNewtonMethod(residual, [&](double const* const x, double* const y) -> bool {
 			return jacobian(x, jacMatrix) && jacMatrix.factorize() && jacMatrix.solve(y);
 		},
-		_maxIter, tol, _initDamping, _minDamping, point, workingMemory, size);
+		_maxIter, tol, damping, _minDamping, point, workingMemory, size, state);
 }
 
 
@@ -59,15 +62,18 @@ bool RobustAdaptiveTrustRegionNewtonSolver::configure(IParameterProvider& paramP
 }
 
 bool RobustAdaptiveTrustRegionNewtonSolver::solve(std::function<bool(double const* const, double* const)> residual, std::function<bool(double const* const, linalg::detail::DenseMatrixBase& jac)> jacobian,
-		double tol, double* const point, double* const workingMemory, linalg::detail::DenseMatrixBase& jacMatrix, unsigned int size) const
+		double tol, double* const point, double* const workingMemory, linalg::detail::DenseMatrixBase& jacMatrix, unsigned int size, SolverState* const state) const
 {
+	// Continue with the damping factor of a previous solve if available
+	const double damping = (state && (state->damping > 0.0)) ? state->damping : _initDamping;
+
 	return robustAdaptiveTrustRegionNewtonMethod(residual, [&](double const* const x, double* const y) -> bool {
 			return jacobian(x, jacMatrix) && jacMatrix.factorize() && jacMatrix.solve(y);
 		},
 		[&](double* const y) -> bool {
 			return jacMatrix.solve(y);
 		},
-		_maxIter, tol, _initDamping, _minDamping, point, workingMemory, size);
+		_maxIter, tol, damping, _minDamping, point, workingMemory, size, state);
 }
 
 
@@ -100,6 +100,7 @@ namespace nonlin
 	 * @param [in,out] point On entry initial guess, on exit solution or last iterate
 	 * @param [in] workingMemory Additional memory of size @f$ 4n @f$ required for performing the iterations, where @f$ n @f$ is the problem @p size
 	 * @param [in] size Size of the problem (i.e., number of equations, length of residual, columns of Jacobian etc.)
+	 * @param [in,out] state Receives the final damping factor and the number of iterations (see SolverState), may be @c nullptr
 	 * @tparam IterateOutputPolicy Policy that handles output of intermediate values (useful for debugging), see VoidNewtonIterateOutputPolicy
 	 * @return @c true if a solution meeting the residual tolerance was found, @c false otherwise
 	 * @todo Make algorithm more robust by providing means to solver and residual functions to trigger decrease of damping factor (e.g. for negative concentrations)
@@ -107,7 +108,8 @@ namespace nonlin
 	 */
 	template <typename IterateOutputPolicy = VoidNewtonIterateOutputPolicy>
 	bool adaptiveTrustRegionNewtonMethod(std::function<bool(double const* const, double* const)> residual, std::function<bool(double const* const, double* const)> jacobianSolver,
-		unsigned int maxIter, double resTol, double damping, double minDamping, double* const point, double* const workingMemory, unsigned int size)
+		unsigned int maxIter, double resTol, double damping, double minDamping, double* const point, double* const workingMemory, unsigned int size,
+		SolverState* const state = nullptr)
 	{
 		const double thetaMax = 0.25; // Determines whether switch to quasi-newton updates is performed (not implemented)
 		const bool restricted = false; // Determines if restricted monotonicity test is used
@@ -122,7 +124,7 @@ namespace nonlin
 
 		// Evaluate residual
 		if (!residual(point, lastResidual))
-			return false;
+			return detail::finishSolve(state, false, 0, damping);
 
 		// Copy residual
 		std::copy(lastResidual, lastResidual + size, dx);
@@ -136,12 +138,12 @@ namespace nonlin
 		{
 			// Convergence test
 			if (residualNorm <= resTol)
-				return true;
+				return detail::finishSolve(state, true, kIter, damping);
 
 			// Solve F'(x) * dx = F(x)
 			// Since we have omitted the minus sign here, we have to take care of the negation later
 			if (!jacobianSolver(point, dx))
-				return false;
+				return detail::finishSolve(state, false, kIter + 1, damping);
 
 			if (kIter > 0)
 			{
@@ -162,7 +164,7 @@ namespace nonlin
 
 				// Evaluate residual
 				if (!residual(trialPoint, residualMem))
-					return false;
+					return detail::finishSolve(state, false, kIter + 1, damping);
 
 				residualNorm = linalg::l2Norm(residualMem, size);
 
@@ -199,7 +201,7 @@ namespace nonlin
 
 			// Check if regularity test failed or line search loop was aborted because of other reasons
 			if (damping < minDamping)
-				return false;
+				return detail::finishSolve(state, false, kIter + 1, damping);
 
 			IterateOutputPolicy::outerIteration(kIter + 1, residualNorm, residualMem, trialPoint, dx, size);
 
@@ -208,7 +210,7 @@ namespace nonlin
 			std::copy(residualMem, residualMem + size, lastResidual);
 			std::copy(residualMem, residualMem + size, dx);
 		}
-		return false;
+		return detail::finishSolve(state, false, maxIter, damping);
 	}
 
 	/**
@@ -230,7 +232,7 @@ namespace nonlin
 		virtual unsigned int numTuningParameters() const { return 3; }
 
 		virtual bool solve(std::function<bool(double const* const, double* const)> residual, std::function<bool(double const* const, linalg::detail::DenseMatrixBase& jac)> jacobian,
-			double tol, double* const point, double* const workingMemory, linalg::detail::DenseMatrixBase& jacMatrix, unsigned int size) const;
+			double tol, double* const point, double* const workingMemory, linalg::detail::DenseMatrixBase& jacMatrix, unsigned int size, SolverState* const state) const;
 	
 	protected:
 		double _initDamping; //!< Initial damping factor
@@ -301,6 +303,7 @@ namespace nonlin
 	 * @param [in,out] point On entry initial guess, on exit solution or last iterate
 	 * @param [in] workingMemory Additional memory of size @f$ 4n @f$ required for performing the iterations, where @f$ n @f$ is the problem @p size
 	 * @param [in] size Size of the problem (i.e., number of equations, length of residual, columns of Jacobian etc.)
+	 * @param [in,out] state Receives the final damping factor and the number of iterations (see SolverState), may be @c nullptr
 	 * @tparam IterateOutputPolicy Policy that handles output of intermediate values (useful for debugging), see VoidNewtonIterateOutputPolicy
 	 * @return @c true if a solution meeting the residual tolerance was found, @c false otherwise
 	 * @todo Make algorithm more robust by providing means to solver and residual functions to trigger decrease of damping factor (e.g. for negative concentrations)
@@ -309,7 +312,7 @@ namespace nonlin
 	template <typename IterateOutputPolicy = VoidNewtonIterateOutputPolicy>
 	bool robustAdaptiveTrustRegionNewtonMethod(std::function<bool(double const* const, double* const)> residual, std::function<bool(double const* const, double* const)> jacobianSolver,
 		std::function<bool(double* const)> jacobianResolver, unsigned int maxIter, double errTol, double damping, double minDamping, double* const point, 
-		double* const workingMemory, unsigned int size)
+		double* const workingMemory, unsigned int size, SolverState* const state = nullptr)
 	{
 		const double thetaMax = 0.25; // Determines whether switch to quasi-newton updates is performed (not implemented)
 		const bool restricted = false; // Determines if restricted monotonicity test is used
@@ -323,7 +326,7 @@ namespace nonlin
 
 		// Evaluate residual
 		if (!residual(point, dx))
-			return false;
+			return detail::finishSolve(state, false, 0, damping);
 
 		double errNorm = 0.0;
 		double lastErrNorm = 0.0;
@@ -335,7 +338,7 @@ namespace nonlin
 			// Solve F'(x) * dx = F(x)
 			// Since we have omitted the minus sign here, we have to take care of the negation later
 			if (!jacobianSolver(point, dx))
-				return false;
+				return detail::finishSolve(state, false, kIter + 1, damping);
 
 			lastErrNorm = errNorm;
 			errNorm = linalg::l2Norm(dx, size);
@@ -349,7 +352,7 @@ namespace nonlin
 				// Note that we have to negate dx here since we didn't do that when solving with the Jacobian above
 				for (unsigned int i = 0; i < size; ++i)
 					point[i] -= dx[i];
-				return true;
+				return detail::finishSolve(state, true, kIter + 1, damping);
 			}
 
 			if (kIter > 0)
@@ -374,12 +377,12 @@ namespace nonlin
 
 				// Evaluate residual and solve linear system
 				if (!residual(trialPoint, lastResidual))
-					return false;
+					return detail::finishSolve(state, false, kIter + 1, damping);
 
 				std::copy(lastResidual, lastResidual + size, lastDxBar);
 
 				if (!jacobianResolver(lastDxBar))
-					return false;
+					return detail::finishSolve(state, false, kIter + 1, damping);
 
 				errNormTrial = linalg::l2Norm(lastDxBar, size);
 				const double theta = errNormTrial / errNorm;
@@ -409,7 +412,7 @@ namespace nonlin
 					// Note that we have to negate dx here since we didn't do that when solving with the Jacobian above
 					for (unsigned int i = 0; i < size; ++i)
 						point[i] -= lastDxBar[i];
-					return true;
+					return detail::finishSolve(state, true, kIter + 1, damping);
 				}
 
 				if (dampingNew >= 4.0 * damping)
@@ -424,14 +427,14 @@ namespace nonlin
 
 			// Check if regularity test failed or line search loop was aborted because of other reasons
 			if (damping < minDamping)
-				return false;
+				return detail::finishSolve(state, false, kIter + 1, damping);
 
 			// Copy accepted point
 			std::copy(trialPoint, trialPoint + size, point);
 			std::copy(lastResidual, lastResidual + size, dx);
 		}
 
-		return false;
+		return detail::finishSolve(state, false, maxIter, damping);
 	}
 
 	/**
@@ -453,7 +456,7 @@ namespace nonlin
 		virtual unsigned int numTuningParameters() const { return 3; }
 
 		virtual bool solve(std::function<bool(double const* const, double* const)> residual, std::function<bool(double const* const, linalg::detail::DenseMatrixBase& jac)> jacobian,
-			double tol, double* const point, double* const workingMemory, linalg::detail::DenseMatrixBase& jacMatrix, unsigned int size) const;
+			double tol, double* const point, double* const workingMemory, linalg::detail::DenseMatrixBase& jacMatrix, unsigned int size, SolverState* const state) const;
 	
 	protected:
 		double _initDamping; //!< Initial damping factor
@@ -54,11 +54,11 @@ bool CompositeSolver::configure(IParameterProvider& paramProvider)
 }
 
 bool CompositeSolver::solve(std::function<bool(double const* const, double* const)> residual, std::function<bool(double const* const, linalg::detail::DenseMatrixBase& jac)> jacobian,
-		double tol, double* const point, double* const workingMemory, linalg::detail::DenseMatrixBase& jacMatrix, unsigned int size) const
+		double tol, double* const point, double* const workingMemory, linalg::detail::DenseMatrixBase& jacMatrix, unsigned int size, SolverState* const state) const
 {
 	bool success = true;
 	for (std::vector<Solver*>::const_iterator it = _solvers.begin(); it != _solvers.end(); ++it)
-		success = (*it)->solve(residual, jacobian, tol, point, workingMemory, jacMatrix, size) && success;
+		success = (*it)->solve(residual, jacobian, tol, point, workingMemory, jacMatrix, size, state) && success;
 
 	return success;
 }
@@ -47,7 +47,7 @@ namespace nonlin
 		virtual unsigned int numTuningParameters() const;
 
 		virtual bool solve(std::function<bool(double const* const, double* const)> residual, std::function<bool(double const* const, linalg::detail::DenseMatrixBase& jac)> jacobian,
-			double tol, double* const point, double* const workingMemory, linalg::detail::DenseMatrixBase& jacMatrix, unsigned int size) const;
+			double tol, double* const point, double* const workingMemory, linalg::detail::DenseMatrixBase& jacMatrix, unsigned int size, SolverState* const state) const;
 
 		virtual void addSubsolver(Solver* const solver);
 
@@ -33,9 +33,10 @@ bool LevenbergMarquardtSolver::configure(IParameterProvider& paramProvider)
 }
 
 bool LevenbergMarquardtSolver::solve(std::function<bool(double const* const, double* const)> residual, std::function<bool(double const* const, linalg::detail::DenseMatrixBase& jac)> jacobian,
-		double tol, double* const point, double* const workingMemory, linalg::detail::DenseMatrixBase& jacMatrix, unsigned int size) const
+		double tol, double* const point, double* const workingMemory, linalg::detail::DenseMatrixBase& jacMatrix, unsigned int size, SolverState* const state) const
 {
-	return levenbergMarquardt(residual, jacobian, _maxIter, tol, _initDamping, point, workingMemory, jacMatrix, size);
+	// The damping factor of the state is not used since it refers to trust-region methods
+	return levenbergMarquardt(residual, jacobian, _maxIter, tol, _initDamping, point, workingMemory, jacMatrix, size, state);
 }
 
 
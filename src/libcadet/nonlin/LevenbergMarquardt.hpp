@@ -111,13 +111,15 @@ namespace nonlin
 	 * @param [in] workingMemory Additional memory of size @f$ 7n @f$ required for performing the iterations, where @f$ n @f$ is the problem @p size
 	 * @param [in,out] jacMatrix Dense matrix used for storing and solving the linear systems (e.g., the Jacobian)
 	 * @param [in] size Size of the problem (i.e., number of equations, length of residual, columns of Jacobian etc.)
+	 * @param [in,out] state Receives the number of iterations (see SolverState), may be @c nullptr
 	 * @tparam IterateOutputPolicy Policy that handles output of intermediate values (useful for debugging), see VoidLMIterateOutputPolicy
 	 * @return @c true if a solution meeting the residual tolerance was found, @c false otherwise
 	 * @todo Implement scaling of linear systems and norms
 	 */
 	template <typename IterateOutputPolicy = VoidLMIterateOutputPolicy>
 	bool levenbergMarquardt(std::function<bool(double const* const, double* const)> residual, std::function<bool(double const* const, linalg::detail::DenseMatrixBase& jac)> jacobian,
-		unsigned int maxIter, double resTol, double damping, double* const point, double* const workingMemory, linalg::detail::DenseMatrixBase& jacMatrix, unsigned int size)
+		unsigned int maxIter, double resTol, double damping, double* const point, double* const workingMemory, linalg::detail::DenseMatrixBase& jacMatrix, unsigned int size,
+		SolverState* const state = nullptr)
 	{
 		const double dampingMultiplier = 10.0;
 		const unsigned int maxTrials = 10;
@@ -139,9 +141,9 @@ namespace nonlin
 
 		// Get residual and Jacobian
 		if (!residual(point, residualMem))
-			return false;
+			return detail::countIterations(state, false, 0);
 		if (!jacobian(point, jacMatrix))
-			return false;
+			return detail::countIterations(state, false, 0);
 
 		// Compute residual sum of squares
 		double residualSumSq = linalg::l2NormSquared(residualMem, size);
@@ -154,10 +156,11 @@ namespace nonlin
 
 		// Check if initial point is already optimal
 		if (detail::checkLevenbergMarquardtConvergence(std::numeric_limits<double>::infinity(), residualSumSq, linalg::linfNorm(newResidual, size), resTol, tolOpt, relFactor))
-			return true;
+			return detail::countIterations(state, true, 0);
 
 		// Main loop
-		for (unsigned int kIter = 0; kIter < maxIter; ++kIter)
+		unsigned int kIter = 0;
+		for (; kIter < maxIter; ++kIter)
 		{
 			// Copy jacobian matrix into system matrix and reset the rest
 			factoredJac.submatrixAssign(jacMatrix, 0, 0, jacMatrix.rows(), jacMatrix.columns());
@@ -178,7 +181,7 @@ namespace nonlin
 
 			// Compute step
 			if (!factoredJac.leastSquaresSolve(dx, workspace, 2 * size))
-				return false;
+				return detail::countIterations(state, false, kIter + 1);
 
 			// Compute trial step x_trial = x_cur + step
 			for (unsigned int i = 0; i < size; ++i)
@@ -186,7 +189,7 @@ namespace nonlin
 
 			// Evaluate residual at new position
 			if (!residual(trialPoint, newResidual))
-				return false;
+				return detail::countIterations(state, false, kIter + 1);
 
 			const double trialSumSq = linalg::l2NormSquared(newResidual, size);
 			if (trialSumSq < residualSumSq)
@@ -204,7 +207,7 @@ namespace nonlin
 				{
 					// Previous step was not successful, so we still need to evaluate the Jacobian
 					if (!jacobian(trialPoint, jacMatrix))
-						return false;
+						return detail::countIterations(state, false, kIter + 1);
 				}
 
 				// Compute gradient J^T r
@@ -215,7 +218,7 @@ namespace nonlin
 
 				// Check convergence
 				if (detail::checkLevenbergMarquardtConvergence(trialSumSq, residualSumSq, maxGrad, resTol, tolOpt, relFactor))
-					return true;
+					return detail::countIterations(state, true, kIter + 1);
 
 				// Update residual sum of squares
 				residualSumSq = trialSumSq;
@@ -237,7 +240,7 @@ namespace nonlin
 			}
 		}
 
-		return false;
+		return detail::countIterations(state, false, kIter);
 	}
 
 	/**
@@ -259,7 +262,7 @@ namespace nonlin
 		virtual unsigned int numTuningParameters() const { return 2; }
 
 		virtual bool solve(std::function<bool(double const* const, double* const)> residual, std::function<bool(double const* const, linalg::detail::DenseMatrixBase& jac)> jacobian,
-			double tol, double* const point, double* const workingMemory, linalg::detail::DenseMatrixBase& jacMatrix, unsigned int size) const;
+			double tol, double* const point, double* const workingMemory, linalg::detail::DenseMatrixBase& jacMatrix, unsigned int size, SolverState* const state) const;
 	
 	protected:
 		double _initDamping; //!< Initial damping factor
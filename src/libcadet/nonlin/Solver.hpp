@@ -36,6 +36,61 @@ namespace linalg
 namespace nonlin
 {
 
+	/**
+	 * @brief Warm start information and statistics of nonlinear solves
+	 * @details A positive @c damping on entry replaces the initial damping factor (i.e., the trust-region
+	 *          radius) of adaptive trust-region Newton methods. On successful exit, it holds the damping
+	 *          factor of the last accepted step, which is a good initial guess for subsequent solves of
+	 *          similar problems. On failure, it is reset to @c 0 in order to select the configured
+	 *          initial damping factor next time.
+	 *          
+	 *          The number of iterations is accumulated over all solves.
+	 */
+	struct SolverState
+	{
+		SolverState() : damping(0.0), numIterations(0) { }
+
+		double damping; //!< Damping factor of the last accepted step or non-positive value for default
+		unsigned int numIterations; //!< Accumulated number of iterations
+	};
+
+	namespace detail
+	{
+		/**
+		 * @brief Records the outcome of a solve in the given SolverState
+		 * @param [in,out] state Warm start information and statistics or @c nullptr
+		 * @param [in] converged Determines whether the solve has been successful
+		 * @param [in] numIter Number of performed iterations
+		 * @param [in] damping Damping factor of the last accepted step
+		 * @return Value of @p converged
+		 */
+		inline bool finishSolve(SolverState* const state, bool converged, unsigned int numIter, double damping)
+		{
+			if (state)
+			{
+				state->numIterations += numIter;
+				state->damping = converged ? damping : 0.0;
+			}
+			return converged;
+		}
+
+		/**
+		 * @brief Records the number of iterations of a solve in the given SolverState
+		 * @details The damping factor of the SolverState is left untouched, which is used by
+		 *          methods whose damping factor is not a trust-region radius.
+		 * @param [in,out] state Warm start information and statistics or @c nullptr
+		 * @param [in] converged Determines whether the solve has been successful
+		 * @param [in] numIter Number of performed iterations
+		 * @return Value of @p converged
+		 */
+		inline bool countIterations(SolverState* const state, bool converged, unsigned int numIter)
+		{
+			if (state)
+				state->numIterations += numIter;
+			return converged;
+		}
+	}
+
 	/**
 	 * @brief General interface for all nonlinear equation solvers
 	 * @details Solves nonlinear equations @f$ F(x) = 0 @f$, where @f$ F\colon \mathds{R}^n \to \mathds{R}^n @f$
@@ -96,10 +151,11 @@ namespace nonlin
 		 * @param [in] workingMemory Additional memory, size is given by workspaceSize() function
 		 * @param [in,out] jacMatrix Dense matrix used for storing and solving the linear systems (e.g., the Jacobian)
 		 * @param [in] size Size of the problem (i.e., number of equations, length of residual, columns of Jacobian etc.)
+		 * @param [in,out] state Warm start information and statistics (see SolverState) or @c nullptr
 		 * @return @c true if a solution meeting the residual tolerance was found, @c false otherwise
 		 */
 		virtual bool solve(std::function<bool(double const* const, double* const)> residual, std::function<bool(double const* const, linalg::detail::DenseMatrixBase& jac)> jacobian,
-			double tol, double* const point, double* const workingMemory, linalg::detail::DenseMatrixBase& jacMatrix, unsigned int size) const = 0;
+			double tol, double* const point, double* const workingMemory, linalg::detail::DenseMatrixBase& jacMatrix, unsigned int size, SolverState* const state) const = 0;
 	};
 
 	/**
@@ -0,0 +1,197 @@
+// =============================================================================
+//  CADET - The Chromatography Analysis and Design Toolkit
+//
+//  Copyright © 2008-2016: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+/**
+ * @file
+ * Provides an in-memory parameter provider and a small test case for tests that run full simulations
+ */
+
+#ifndef CADETTEST_SIMULATIONTESTHELPER_HPP_
+#define CADETTEST_SIMULATIONTESTHELPER_HPP_
+
+#include <vector>
+#include <string>
+#include <map>
+
+#include "cadet/cadet.hpp"
+
+/**
+ * @brief Parameter provider that keeps all parameters in memory
+ * @details Parameters are addressed by their full path (scopes separated by slashes).
+ */
+class MemoryParameterProvider : public cadet::IParameterProvider
+{
+public:
+
+	MemoryParameterProvider() { }
+	virtual ~MemoryParameterProvider() CADET_NOEXCEPT { }
+
+	void set(const std::string& path, double val) { _data[path].doubles.assign(1, val); _data[path].isArray = false; }
+	void set(const std::string& path, int val) { _data[path].ints.assign(1, val); _data[path].isArray = false; }
+	void set(const std::string& path, const std::string& val) { _data[path].strings.assign(1, val); _data[path].isArray = false; }
+	void set(const std::string& path, const std::vector<double>& val) { _data[path].doubles = val; _data[path].isArray = true; }
+	void set(const std::string& path, const std::vector<int>& val) { _data[path].ints = val; _data[path].isArray = true; }
+
+	virtual double getDouble(const std::string& paramName) { return entry(paramName).doubles.at(0); }
+	virtual int getInt(const std::string& paramName) { return entry(paramName).ints.at(0); }
+	virtual uint64_t getUint64(const std::string& paramName) { return entry(paramName).ints.at(0); }
+	virtual bool getBool(const std::string& paramName) { return entry(paramName).ints.at(0); }
+	virtual std::string getString(const std::string& paramName) { return entry(paramName).strings.at(0); }
+	virtual std::vector<double> getDoubleArray(const std::string& paramName) { return entry(paramName).doubles; }
+	virtual std::vector<int> getIntArray(const std::string& paramName) { return entry(paramName).ints; }
+
+	virtual std::vector<uint64_t> getUint64Array(const std::string& paramName)
+	{
+		const std::vector<int>& data = entry(paramName).ints;
+		return std::vector<uint64_t>(data.begin(), data.end());
+	}
+
+	virtual std::vector<bool> getBoolArray(const std::string& paramName)
+	{
+		const std::vector<int>& data = entry(paramName).ints;
+		return std::vector<bool>(data.begin(), data.end());
+	}
+
+	virtual std::vector<std::string> getStringArray(const std::string& paramName) { return entry(paramName).strings; }
+
+	virtual bool exists(const std::string& paramName)
+	{
+		const std::string path = fullPath(paramName);
+		if (_data.find(path) != _data.end())
+			return true;
+
+		// Check for scope
+		std::map<std::string, Entry>::const_iterator it = _data.lower_bound(path + "/");
+		return (it != _data.end()) && (it->first.compare(0, path.size() + 1, path + "/") == 0);
+	}
+
+	virtual bool isArray(const std::string& paramName) { return entry(paramName).isArray; }
+
+	virtual void pushScope(const std::string& scope) { _scopes.push_back(scope); }
+	virtual void popScope() { _scopes.pop_back(); }
+
+private:
+
+	struct Entry
+	{
+		std::vector<double> doubles;
+		std::vector<int> ints;
+		std::vector<std::string> strings;
+		bool isArray;
+	};
+
+	std::map<std::string, Entry> _data;
+	std::vector<std::string> _scopes;
+
+	std::string fullPath(const std::string& paramName) const
+	{
+		std::string path;
+		for (const std::string& s : _scopes)
+			path += s + "/";
+		return path + paramName;
+	}
+
+	const Entry& entry(const std::string& paramName) const
+	{
+		std::map<std::string, Entry>::const_iterator it = _data.find(fullPath(paramName));
+		if (it == _data.end())
+			throw cadet::InvalidParameterException("Parameter " + fullPath(paramName) + " not found");
+		return it->second;
+	}
+};
+
+/**
+ * @brief Configures a single component load-wash-elution case with linear isotherm
+ * @param [out] pp Parameter provider
+ * @param [in] adJacobian Determines whether the Jacobian is computed by AD
+ * @param [in] extBinding Determines whether the isotherm depends on an external profile
+ */
+inline void createLinearModel(MemoryParameterProvider& pp, bool adJacobian, bool extBinding)
+{
+	pp.set("model/unit_000/UNIT_TYPE", std::string("GENERAL_RATE_MODEL"));
+	pp.set("model/unit_000/NCOMP", 1);
+
+	pp.set("model/unit_000/VELOCITY", 5.75e-4);
+	pp.set("model/unit_000/COL_DISPERSION", 5.75e-8);
+	pp.set("model/unit_000/FILM_DIFFUSION", std::vector<double>(1, 6.9e-6));
+	pp.set("model/unit_000/PAR_DIFFUSION", std::vector<double>(1, 7e-10));
+	pp.set("model/unit_000/PAR_SURFDIFFUSION", std::vector<double>(1, 0.0));
+
+	pp.set("model/unit_000/COL_LENGTH", 0.014);
+	pp.set("model/unit_000/PAR_RADIUS", 4.5e-5);
+	pp.set("model/unit_000/COL_POROSITY", 0.37);
+	pp.set("model/unit_000/PAR_POROSITY", 0.75);
+
+	pp.set("model/unit_000/INIT_C", std::vector<double>(1, 0.0));
+	pp.set("model/unit_000/INIT_Q", std::vector<double>(1, 0.0));
+
+	if (extBinding)
+	{
+		pp.set("model/unit_000/ADSORPTION_MODEL", std::string("EXT_LINEAR"));
+		pp.set("model/unit_000/adsorption/IS_KINETIC", 0);
+		pp.set("model/unit_000/adsorption/EXTFUN", std::vector<int>(1, 0));
+		pp.set("model/unit_000/adsorption/EXT_LIN_KA", std::vector<double>(1, 35.5));
+		pp.set("model/unit_000/adsorption/EXT_LIN_KA_T", std::vector<double>(1, 5.0));
+		pp.set("model/unit_000/adsorption/EXT_LIN_KA_TT", std::vector<double>(1, -0.5));
+		pp.set("model/unit_000/adsorption/EXT_LIN_KA_TTT", std::vector<double>(1, 0.0));
+		pp.set("model/unit_000/adsorption/EXT_LIN_KD", std::vector<double>(1, 1000.0));
+		pp.set("model/unit_000/adsorption/EXT_LIN_KD_T", std::vector<double>(1, 50.0));
+		pp.set("model/unit_000/adsorption/EXT_LIN_KD_TT", std::vector<double>(1, 0.0));
+		pp.set("model/unit_000/adsorption/EXT_LIN_KD_TTT", std::vector<double>(1, 0.0));
+
+		// Externally dependent parameters vary along the column and in time
+		pp.set("model/external/source_000/EXTFUN_TYPE", std::string("LINEAR_INTERP_DATA"));
+		pp.set("model/external/source_000/TIME", std::vector<double>({0.0, 100.0, 200.0, 300.0}));
+		pp.set("model/external/source_000/DATA", std::vector<double>({0.0, 2.0, 1.0, 3.0}));
+		pp.set("model/external/source_000/VELOCITY", 0.01);
+	}
+	else
+	{
+		pp.set("model/unit_000/ADSORPTION_MODEL", std::string("LINEAR"));
+		pp.set("model/unit_000/adsorption/IS_KINETIC", 0);
+		pp.set("model/unit_000/adsorption/LIN_KA", std::vector<double>(1, 35.5));
+		pp.set("model/unit_000/adsorption/LIN_KD", std::vector<double>(1, 1000.0));
+	}
+
+	pp.set("model/unit_000/discretization/NCOL", 10);
+	pp.set("model/unit_000/discretization/NPAR", 4);
+	pp.set("model/unit_000/discretization/NBOUND", std::vector<int>(1, 1));
+	pp.set("model/unit_000/discretization/PAR_DISC_TYPE", std::string("EQUIDISTANT_PAR"));
+	pp.set("model/unit_000/discretization/USE_ANALYTIC_JACOBIAN", adJacobian ? 0 : 1);
+	pp.set("model/unit_000/discretization/MAX_KRYLOV", 0);
+	pp.set("model/unit_000/discretization/GS_TYPE", 1);
+	pp.set("model/unit_000/discretization/MAX_RESTARTS", 10);
+	pp.set("model/unit_000/discretization/SCHUR_SAFETY", 1e-8);
+	pp.set("model/unit_000/discretization/weno/WENO_ORDER", 3);
+	pp.set("model/unit_000/discretization/weno/BOUNDARY_MODEL", 0);
+	pp.set("model/unit_000/discretization/weno/WENO_EPS", 1e-12);
+
+	pp.set("model/unit_001/UNIT_TYPE", std::string("INLET"));
+	pp.set("model/unit_001/INLET_TYPE", std::string("PIECEWISE_CUBIC_POLY"));
+	pp.set("model/unit_001/NCOMP", 1);
+
+	const double constCoeff[] = {1.0, 0.0};
+	for (unsigned int sec = 0; sec < 2; ++sec)
+	{
+		const std::string scope = "model/unit_001/sec_00" + std::to_string(sec) + "/";
+		pp.set(scope + "CONST_COEFF", std::vector<double>(1, constCoeff[sec]));
+		pp.set(scope + "LIN_COEFF", std::vector<double>(1, 0.0));
+		pp.set(scope + "QUAD_COEFF", std::vector<double>(1, 0.0));
+		pp.set(scope + "CUBE_COEFF", std::vector<double>(1, 0.0));
+	}
+
+	pp.set("model/connections/NSWITCHES", 1);
+	pp.set("model/connections/switch_000/SECTION", 0);
+	pp.set("model/connections/switch_000/CONNECTIONS", std::vector<int>({1, 0, -1, -1}));
+}
+
+#endif  // CADETTEST_SIMULATIONTESTHELPER_HPP_
@@ -0,0 +1,264 @@
+// =============================================================================
+//  CADET - The Chromatography Analysis and Design Toolkit
+//
+//  Copyright © 2008-2016: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+/**
+ * @file
+ * Compares the gradient of the integral of the outlet concentration computed by adjoint
+ * sensitivity analysis with the integral of the forward sensitivities of the outlet.
+ * The linear load-wash-elution case has a discontinuous section transition, at which
+ * the adjoint system is reinitialized. Afterwards, forward sensitivities are integrated
+ * by the same simulator to check that they have been restored.
+ */
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <algorithm>
+
+#include "cadet/cadet.hpp"
+#include "cadet/QuadratureObjective.hpp"
+#include "SimulationTestHelper.hpp"
+
+/**
+ * @brief Records the outlet concentration of the column and its sensitivities
+ */
+class OutletRecorder : public cadet::ISolutionRecorder
+{
+public:
+	OutletRecorder() : _cur(nullptr) { }
+
+	virtual void clear()
+	{
+		_solution.clear();
+		_sensitivities.clear();
+	}
+
+	virtual void prepare(unsigned int numDofs, unsigned int numSens, unsigned int numTimesteps) { }
+	virtual void notifyIntegrationStart(unsigned int numDofs, unsigned int numSens, unsigned int numTimesteps)
+	{
+		clear();
+		_sensitivities.resize(numSens);
+	}
+
+	virtual void unitOperationStructure(cadet::UnitOpIdx idx, const cadet::IModel& model, const cadet::ISolutionExporter& exporter) { }
+	virtual void beginTimestep(double t) { }
+
+	virtual void beginUnitOperation(cadet::UnitOpIdx idx, const cadet::IModel& model, const cadet::ISolutionExporter& exporter)
+	{
+		if (!_cur || (idx != 0))
+			return;
+
+		unsigned int stride = 0;
+		_cur->push_back(exporter.outlet(stride)[0]);
+	}
+
+	virtual void endUnitOperation() { }
+	virtual void endTimestep() { }
+	virtual void beginSolution() { _cur = &_solution; }
+	virtual void endSolution() { _cur = nullptr; }
+	virtual void beginSolutionDerivative() { }
+	virtual void endSolutionDerivative() { }
+	virtual void beginSensitivity(const cadet::ParameterId& pId, unsigned int sensIdx) { _cur = &_sensitivities[sensIdx]; }
+	virtual void endSensitivity(const cadet::ParameterId& pId, unsigned int sensIdx) { _cur = nullptr; }
+	virtual void beginSensitivityDerivative(const cadet::ParameterId& pId, unsigned int sensIdx) { }
+	virtual void endSensitivityDerivative(const cadet::ParameterId& pId, unsigned int sensIdx) { }
+
+	inline const std::vector<double>& solution() const { return _solution; }
+	inline const std::vector<double>& sensitivity(unsigned int idx) const { return _sensitivities[idx]; }
+
+protected:
+	std::vector<double> _solution; //!< Outlet concentration
+	std::vector<std::vector<double>> _sensitivities; //!< Sensitivities of the outlet concentration
+	std::vector<double>* _cur; //!< Storage of the current solution or sensitivity, or @c nullptr
+};
+
+/**
+ * @brief Integral of the outlet concentration of the column
+ */
+class OutletObjective : public cadet::IQuadratureObjective
+{
+public:
+	OutletObjective(unsigned int idx) : _idx(idx) { }
+
+	virtual double integrand(double t, double const* const y, unsigned int nDof)
+	{
+		return y[_idx];
+	}
+
+	virtual void stateGradient(double t, double const* const y, unsigned int nDof, double* const grad)
+	{
+		std::fill(grad, grad + nDof, 0.0);
+		grad[_idx] = 1.0;
+	}
+
+protected:
+	unsigned int _idx; //!< Index of the outlet concentration in the state vector
+};
+
+/**
+ * @brief Integrates tabulated data by the composite Simpson rule on each section
+ * @param [in] data Data on an equidistant grid with spacing @p h that includes the section times
+ * @param [in] h Grid spacing
+ * @param [in] sectionStart Indices of the grid points at the section times
+ * @return Integral
+ */
+double integrateSimpson(const std::vector<double>& data, double h, const std::vector<unsigned int>& sectionStart)
+{
+	double result = 0.0;
+	for (unsigned int sec = 0; sec < sectionStart.size() - 1; ++sec)
+	{
+		for (unsigned int i = sectionStart[sec]; i < sectionStart[sec + 1]; i += 2)
+			result += h / 3.0 * (data[i] + 4.0 * data[i + 1] + data[i + 2]);
+	}
+	return result;
+}
+
+/**
+ * @brief Creates a simulator with the linear load-wash-elution case
+ * @param [in] builder Model builder
+ * @param [in] sensParams Sensitive parameters
+ * @return Simulator
+ */
+cadet::ISimulator* createSimulator(cadet::IModelBuilder* builder, const std::vector<cadet::ParameterId>& sensParams)
+{
+	MemoryParameterProvider pp;
+	createLinearModel(pp, false, false);
+
+	cadet::ISimulator* const sim = cadetCreateSimulator();
+
+	pp.pushScope("model");
+	cadet::IModelSystem* const model = builder->createSystem(pp);
+
+	sim->initializeModel(*model);
+	sim->setSectionTimes({0.0, 10.0, 300.0}, {false});
+	sim->setInitialCondition(pp);
+	pp.popScope();
+
+	sim->configureTimeIntegrator(1e-8, 1e-10, 1e-6, 100000);
+
+	for (const cadet::ParameterId& id : sensParams)
+		sim->setSensitiveParameter(id, 1e-6);
+	sim->initializeFwdSensitivities();
+
+	return sim;
+}
+
+/**
+ * @brief Compares two values relative to the given scale
+ * @param [in] name Name of the value
+ * @param [in] val Value
+ * @param [in] ref Reference value
+ * @param [in] scale Scale of the values
+ * @param [in] tol Relative tolerance
+ * @return @c true if the values agree, otherwise @c false
+ */
+bool compareValue(const std::string& name, double val, double ref, double scale, double tol)
+{
+	const double diff = std::abs(val - ref) / scale;
+	std::cout << name << ": " << val << " vs " << ref << " (rel. diff " << diff << ")";
+	if (diff <= tol)
+	{
+		std::cout << " => PASSED\n";
+		return true;
+	}
+
+	std::cout << " => FAILED\n";
+	return false;
+}
+
+int main(int argc, char** argv)
+{
+	using cadet::makeParamId;
+	using cadet::CompIndep;
+	using cadet::BoundPhaseIndep;
+	using cadet::ReactionIndep;
+	using cadet::SectionIndep;
+
+	std::vector<cadet::ParameterId> sensParams;
+	sensParams.push_back(makeParamId("COL_POROSITY", 0, CompIndep, BoundPhaseIndep, ReactionIndep, SectionIndep));
+	sensParams.push_back(makeParamId("FILM_DIFFUSION", 0, 0, BoundPhaseIndep, ReactionIndep, SectionIndep));
+	sensParams.push_back(makeParamId("LIN_KA", 0, 0, 0, ReactionIndep, SectionIndep));
+
+	// The column (unit 0) comes first in the state vector and its last bulk cell (NCOL = 10) is the outlet
+	const unsigned int outletIdx = 9;
+
+	// Equidistant solution times that include the section transition
+	const double h = 0.1;
+	const unsigned int nTimes = 3001;
+	const std::vector<unsigned int> sectionStart = {0, 100, 3000};
+	std::vector<double> solTimes(nTimes);
+	for (unsigned int i = 0; i < nTimes; ++i)
+		solTimes[i] = i * h;
+
+	cadet::IModelBuilder* const builder = cadetCreateModelBuilder();
+
+	// Reference: Integrate the forward sensitivities of the outlet
+	std::vector<double> refGradient(sensParams.size());
+	std::vector<std::vector<double>> refLastSens;
+	double refObjective = 0.0;
+	{
+		OutletRecorder recorder;
+		cadet::ISimulator* const sim = createSimulator(builder, sensParams);
+		sim->setSolutionTimes(solTimes);
+		sim->setSolutionRecorder(&recorder);
+		sim->integrate();
+
+		refObjective = integrateSimpson(recorder.solution(), h, sectionStart);
+		for (unsigned int i = 0; i < sensParams.size(); ++i)
+			refGradient[i] = integrateSimpson(recorder.sensitivity(i), h, sectionStart);
+
+		unsigned int len = 0;
+		for (double const* s : sim->getLastSensitivities(len))
+			refLastSens.push_back(std::vector<double>(s, s + len));
+
+		cadetDestroySimulator(sim);
+	}
+
+	bool success = true;
+
+	// Adjoint gradient followed by forward sensitivities on the same simulator
+	{
+		OutletObjective objective(outletIdx);
+		std::vector<double> gradient;
+
+		cadet::ISimulator* const sim = createSimulator(builder, sensParams);
+		const double objValue = sim->integrateAdjoint(objective, 100, gradient);
+
+		success = compareValue("Objective", objValue, refObjective, std::abs(refObjective), 1e-4) && success;
+		for (unsigned int i = 0; i < sensParams.size(); ++i)
+			success = compareValue("Gradient " + std::to_string(i), gradient[i], refGradient[i], std::abs(refGradient[i]), 1e-3) && success;
+
+		sim->setSolutionTimes(solTimes);
+		sim->integrate();
+
+		unsigned int len = 0;
+		const std::vector<double const*> sens = sim->getLastSensitivities(len);
+		double diff = 0.0;
+		double scale = 1.0;
+		for (unsigned int i = 0; i < sens.size(); ++i)
+		{
+			for (unsigned int j = 0; j < len; ++j)
+			{
+				diff = std::max(diff, std::abs(sens[i][j] - refLastSens[i][j]));
+				scale = std::max(scale, std::abs(refLastSens[i][j]));
+			}
+		}
+
+		success = compareValue("Forward sensitivities after adjoint", diff / scale, 0.0, 1.0, 1e-10) && success;
+
+		cadetDestroySimulator(sim);
+	}
+
+	cadetDestroyModelBuilder(builder);
+	return success ? 0 : 1;
+}
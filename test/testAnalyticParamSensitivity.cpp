@@ -0,0 +1,299 @@
+// =============================================================================
+//  CADET - The Chromatography Analysis and Design Toolkit
+//
+//  Copyright © 2008-2016: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+/**
+ * @file
+ * Compares the hand-coded parameter derivatives of the general rate model residual
+ * (USE_ANALYTIC_PARAM_SENS) with the ones computed by AD. Each parameter of the model
+ * that supports analytic derivatives (transport, film, particle, and surface diffusion,
+ * as well as the binding model parameters) is checked on its own and all of them together.
+ */
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <algorithm>
+#include <random>
+#include <unordered_map>
+
+#include "ConfigurationHelper.hpp"
+#include "BindingModelFactory.hpp"
+#include "model/GeneralRateModel.hpp"
+#include "ParamIdUtil.hpp"
+#include "AutoDiff.hpp"
+#include "SimulationTestHelper.hpp"
+
+/**
+ * @brief Configuration helper that only provides binding models
+ */
+class BindingConfigHelper : public cadet::IConfigHelper
+{
+public:
+	virtual cadet::IInletProfile* createInletProfile(const std::string& type) const { return nullptr; }
+	virtual cadet::model::IBindingModel* createBindingModel(const std::string& name) const { return _factory.create(name); }
+	virtual cadet::IExternalFunction* createExternalFunction(const std::string& type) const { return nullptr; }
+
+private:
+	cadet::BindingModelFactory _factory;
+};
+
+/**
+ * @brief Configures a general rate model with the given binding model
+ * @param [out] pp Parameter provider
+ * @param [in] binding Name of the binding model
+ * @param [in] kinetic Determines whether the binding is kinetic
+ * @param [in] analyticParamSens Determines whether parameter derivatives are computed analytically
+ */
+void createModel(MemoryParameterProvider& pp, const std::string& binding, bool kinetic, bool analyticParamSens)
+{
+	const unsigned int nComp = 4;
+
+	pp.set("UNIT_TYPE", std::string("GENERAL_RATE_MODEL"));
+	pp.set("NCOMP", static_cast<int>(nComp));
+
+	pp.set("VELOCITY", 5.75e-4);
+	pp.set("COL_DISPERSION", 5.75e-8);
+	pp.set("FILM_DIFFUSION", std::vector<double>({6.9e-6, 1.4e-5, 2.1e-5, 2.8e-5}));
+	pp.set("PAR_DIFFUSION", std::vector<double>({7e-10, 9.1e-10, 1.1e-9, 1.3e-9}));
+	pp.set("PAR_SURFDIFFUSION", std::vector<double>({1e-11, 2e-11, 3e-11, 4e-11}));
+
+	pp.set("COL_LENGTH", 0.014);
+	pp.set("PAR_RADIUS", 4.5e-5);
+	pp.set("COL_POROSITY", 0.37);
+	pp.set("PAR_POROSITY", 0.75);
+
+	pp.set("INIT_C", std::vector<double>(nComp, 0.0));
+	pp.set("INIT_Q", std::vector<double>(nComp, 0.0));
+
+	pp.set("ADSORPTION_MODEL", binding);
+	pp.set("adsorption/IS_KINETIC", kinetic ? 1 : 0);
+	if (binding == "MULTI_COMPONENT_LANGMUIR")
+	{
+		pp.set("adsorption/MCL_KA", std::vector<double>({1.5, 2.5, 3.5, 4.5}));
+		pp.set("adsorption/MCL_KD", std::vector<double>({2.0, 2.5, 3.0, 3.5}));
+		pp.set("adsorption/MCL_QMAX", std::vector<double>({30.0, 40.0, 50.0, 60.0}));
+	}
+	else if (binding == "STERIC_MASS_ACTION")
+	{
+		pp.set("adsorption/SMA_LAMBDA", 20.0);
+		pp.set("adsorption/SMA_KA", std::vector<double>({0.0, 2.5, 3.5, 4.5}));
+		pp.set("adsorption/SMA_KD", std::vector<double>({0.0, 2.5, 3.0, 3.5}));
+		pp.set("adsorption/SMA_NU", std::vector<double>({0.0, 1.3, 2.1, 1.7}));
+		pp.set("adsorption/SMA_SIGMA", std::vector<double>({0.0, 0.1, 0.15, 0.2}));
+	}
+
+	pp.set("discretization/NCOL", 7);
+	pp.set("discretization/NPAR", 4);
+	pp.set("discretization/NBOUND", std::vector<int>(nComp, 1));
+	pp.set("discretization/PAR_DISC_TYPE", std::string("EQUIDISTANT_PAR"));
+	pp.set("discretization/USE_ANALYTIC_JACOBIAN", 1);
+	pp.set("discretization/USE_ANALYTIC_PARAM_SENS", analyticParamSens ? 1 : 0);
+	pp.set("discretization/MAX_KRYLOV", 0);
+	pp.set("discretization/GS_TYPE", 1);
+	pp.set("discretization/MAX_RESTARTS", 10);
+	pp.set("discretization/SCHUR_SAFETY", 1e-8);
+	pp.set("discretization/weno/WENO_ORDER", 3);
+	pp.set("discretization/weno/BOUNDARY_MODEL", 0);
+	pp.set("discretization/weno/WENO_EPS", 1e-12);
+}
+
+/**
+ * @brief Evaluates the parameter derivatives of the residual
+ * @param [in] grm Configured model
+ * @param [in] params Sensitive parameters
+ * @param [in] y State vector
+ * @param [in] yDot Time derivative of the state vector
+ * @param [out] derivs Derivatives of the residual with respect to each parameter
+ * @return @c true if all parameters have been found and the residual has been evaluated, otherwise @c false
+ */
+bool evaluateDerivatives(cadet::model::GeneralRateModel& grm, const std::vector<cadet::ParameterId>& params, const std::vector<double>& y,
+	const std::vector<double>& yDot, std::vector<std::vector<double>>& derivs)
+{
+	const unsigned int n = grm.numDofs();
+	const unsigned int dirOffset = grm.requiredADdirs();
+	cadet::ad::DirectionScope adDirScope(dirOffset + params.size());
+
+	grm.clearSensParams();
+	for (unsigned int i = 0; i < params.size(); ++i)
+	{
+		if (!grm.setSensitiveParameter(params[i], dirOffset + i, 1.0))
+			return false;
+	}
+
+	std::vector<cadet::active> adRes(n);
+	if (grm.residualSensFwdAdOnly(cadet::active(0.3), 0, cadet::active(1.3), y.data(), yDot.data(), adRes.data()) != 0)
+		return false;
+
+	derivs.assign(params.size(), std::vector<double>(n, 0.0));
+	for (unsigned int i = 0; i < params.size(); ++i)
+	{
+		for (unsigned int j = 0; j < n; ++j)
+			derivs[i][j] = adRes[j].getADValue(dirOffset + i);
+	}
+	return true;
+}
+
+/**
+ * @brief Compares two vectors relative to the magnitude of the reference
+ * @param [in] a Vector
+ * @param [in] b Reference vector
+ * @return Maximum difference relative to the largest magnitude of the reference
+ */
+double relDiff(const std::vector<double>& a, const std::vector<double>& b)
+{
+	double scale = 0.0;
+	double diff = 0.0;
+	for (unsigned int i = 0; i < b.size(); ++i)
+	{
+		scale = std::max(scale, std::abs(b[i]));
+		diff = std::max(diff, std::abs(a[i] - b[i]));
+	}
+
+	if (scale == 0.0)
+		return diff;
+	return diff / scale;
+}
+
+/**
+ * @brief Compares analytic and AD parameter derivatives for the given binding model
+ * @param [in] helper Configuration helper
+ * @param [in] binding Name of the binding model
+ * @param [in] kinetic Determines whether the binding is kinetic
+ * @param [in] supported Names of the parameters with analytic derivatives
+ * @return @c true if all derivatives agree, otherwise @c false
+ */
+bool runTest(BindingConfigHelper& helper, const std::string& binding, bool kinetic, const std::vector<std::string>& supported)
+{
+	MemoryParameterProvider ppAnalytic;
+	MemoryParameterProvider ppAd;
+	createModel(ppAnalytic, binding, kinetic, true);
+	createModel(ppAd, binding, kinetic, false);
+
+	cadet::model::GeneralRateModel grmAnalytic(0);
+	cadet::model::GeneralRateModel grmAd(0);
+	if (!grmAnalytic.configure(ppAnalytic, helper) || !grmAd.configure(ppAd, helper))
+	{
+		std::cout << binding << ": configuration failed => FAILED\n";
+		return false;
+	}
+	grmAnalytic.notifyDiscontinuousSectionTransition(0.0, 0);
+	grmAd.notifyDiscontinuousSectionTransition(0.0, 0);
+
+	// Collect all parameters with analytic derivatives
+	std::vector<cadet::ParameterId> params;
+	const std::unordered_map<cadet::ParameterId, double> allParams = grmAd.getAllParameterValues();
+	for (const std::pair<const cadet::ParameterId, double>& p : allParams)
+	{
+		for (const std::string& name : supported)
+		{
+			if (p.first.name == cadet::hashStringRuntime(name))
+				params.push_back(p.first);
+		}
+	}
+
+	// Random state with positive entries
+	const unsigned int n = grmAd.numDofs();
+	std::mt19937 rng(7);
+	std::uniform_real_distribution<double> dist(0.0, 1.0);
+	std::vector<double> y(n);
+	std::vector<double> yDot(n);
+	for (unsigned int i = 0; i < n; ++i)
+	{
+		y[i] = 1.5 + dist(rng);
+		yDot[i] = dist(rng) - 0.5;
+	}
+
+	const double tol = 1e-10;
+	bool success = true;
+
+	// Each parameter on its own
+	for (const cadet::ParameterId& pId : params)
+	{
+		const std::vector<cadet::ParameterId> single(1, pId);
+		std::vector<std::vector<double>> derivAnalytic;
+		std::vector<std::vector<double>> derivAd;
+		if (!evaluateDerivatives(grmAnalytic, single, y, yDot, derivAnalytic) || !evaluateDerivatives(grmAd, single, y, yDot, derivAd))
+		{
+			std::cout << binding << ": evaluation failed for " << pId << " => FAILED\n";
+			success = false;
+			continue;
+		}
+
+		const double diff = relDiff(derivAnalytic[0], derivAd[0]);
+		if (!(diff <= tol))
+		{
+			std::cout << binding << (kinetic ? " (kinetic)" : " (quasi-stationary)") << ": " << pId << " differs by " << diff << " => FAILED\n";
+			success = false;
+		}
+	}
+
+	// All parameters at once
+	{
+		std::vector<std::vector<double>> derivAnalytic;
+		std::vector<std::vector<double>> derivAd;
+		if (!evaluateDerivatives(grmAnalytic, params, y, yDot, derivAnalytic) || !evaluateDerivatives(grmAd, params, y, yDot, derivAd))
+		{
+			std::cout << binding << ": evaluation failed for all parameters => FAILED\n";
+			success = false;
+		}
+		else
+		{
+			for (unsigned int i = 0; i < params.size(); ++i)
+			{
+				const double diff = relDiff(derivAnalytic[i], derivAd[i]);
+				if (!(diff <= tol))
+				{
+					std::cout << binding << (kinetic ? " (kinetic)" : " (quasi-stationary)") << ": " << params[i] << " differs by " << diff << " in combined run => FAILED\n";
+					success = false;
+				}
+			}
+		}
+	}
+
+	std::cout << binding << (kinetic ? " (kinetic)" : " (quasi-stationary)") << ": " << params.size() << " parameters";
+	return success;
+}
+
+int main(int argc, char** argv)
+{
+	// Parameters are created with the maximum number of directions, as done by the simulator
+	cadet::ad::setDirections(cadet::ad::getMaxDirections());
+
+	const std::vector<std::string> transport = {"COL_DISPERSION", "VELOCITY", "COL_LENGTH", "COL_POROSITY",
+		"FILM_DIFFUSION", "PAR_DIFFUSION", "PAR_SURFDIFFUSION"};
+
+	std::vector<std::string> langmuir = transport;
+	langmuir.insert(langmuir.end(), {"MCL_KA", "MCL_KD", "MCL_QMAX"});
+
+	std::vector<std::string> sma = transport;
+	sma.insert(sma.end(), {"SMA_LAMBDA", "SMA_KA", "SMA_KD", "SMA_NU", "SMA_SIGMA"});
+
+	BindingConfigHelper helper;
+	bool success = true;
+	for (unsigned int kinetic = 0; kinetic < 2; ++kinetic)
+	{
+		for (const std::pair<std::string, const std::vector<std::string>*>& b : {std::make_pair(std::string("MULTI_COMPONENT_LANGMUIR"), &langmuir),
+			std::make_pair(std::string("STERIC_MASS_ACTION"), &sma)})
+		{
+			if (runTest(helper, b.first, kinetic, *b.second))
+				std::cout << " => PASSED\n";
+			else
+			{
+				std::cout << " => FAILED\n";
+				success = false;
+			}
+		}
+	}
+
+	return success ? 0 : 1;
+}
@@ -0,0 +1,91 @@
+// =============================================================================
+//  CADET - The Chromatography Analysis and Design Toolkit
+//
+//  Copyright © 2008-2016: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+
+#include "linalg/BandMatrix.hpp"
+#include "linalg/BandMatrixBatch.hpp"
+
+/**
+ * @brief Fills a band matrix with pseudo-random values that require pivoting
+ */
+void fillMatrix(cadet::linalg::FactorizableBandMatrix& fbm, unsigned int seed)
+{
+	for (unsigned int row = 0; row < fbm.rows(); ++row)
+	{
+		const int lower = std::max(-static_cast<int>(fbm.lowerBandwidth()), -static_cast<int>(row));
+		const int upper = std::min(static_cast<int>(fbm.upperBandwidth()), static_cast<int>(fbm.rows() - row) - 1);
+		for (int col = lower; col <= upper; ++col)
+			fbm.centered(row, col) = std::sin(1.3 * (seed + 1) * (row + 1) + 0.7 * col) + ((col == 0) ? 0.1 : 0.0);
+	}
+}
+
+bool testBatch(unsigned int numMatrices, unsigned int rows, unsigned int lowerBand, unsigned int upperBand, unsigned int first, unsigned int count)
+{
+	using cadet::linalg::FactorizableBandMatrix;
+	using cadet::linalg::FactorizedBandMatrixBatch;
+
+	std::cout << numMatrices << " matrices, " << rows << " rows, Bandwidth " << lowerBand << " + 1 + " << upperBand << ", solve " << first << " - " << first + count - 1;
+
+	std::vector<FactorizableBandMatrix> mats(numMatrices);
+	FactorizedBandMatrixBatch batch;
+	batch.resize(numMatrices, rows, lowerBand, upperBand);
+
+	for (unsigned int i = 0; i < numMatrices; ++i)
+	{
+		mats[i].resize(rows, lowerBand, upperBand);
+		fillMatrix(mats[i], i);
+		mats[i].factorize();
+		batch.pack(i, mats[i]);
+	}
+
+	// Right hand sides with some padding between them
+	const unsigned int rhsStride = rows + 3;
+	std::vector<double> rhsRef(count * rhsStride, 0.0);
+	for (unsigned int i = 0; i < rhsRef.size(); ++i)
+		rhsRef[i] = std::cos(0.1 * i);
+	std::vector<double> rhs(rhsRef);
+
+	for (unsigned int i = 0; i < count; ++i)
+		mats[first + i].solve(rhsRef.data() + i * rhsStride);
+
+	std::vector<double> work(count * rows, 0.0);
+	batch.solve(rhs.data(), rhsStride, first, count, work.data());
+
+	for (unsigned int i = 0; i < rhs.size(); ++i)
+	{
+		if (std::abs(rhs[i] - rhsRef[i]) > 1e-10 * std::max(1.0, std::abs(rhsRef[i])))
+		{
+			std::cout << " => FAILED at element " << i << ": " << rhs[i] << " vs " << rhsRef[i] << "\n";
+			return false;
+		}
+	}
+	std::cout << " => PASSED\n";
+	return true;
+}
+
+int main(int argc, char** argv)
+{
+	bool success = true;
+
+	success = testBatch(1, 8, 2, 3, 0, 1) && success;
+	success = testBatch(5, 8, 2, 3, 0, 5) && success;
+	success = testBatch(7, 12, 3, 1, 2, 4) && success;
+	success = testBatch(16, 30, 4, 6, 0, 16) && success;
+	success = testBatch(16, 30, 4, 6, 9, 7) && success;
+	success = testBatch(4, 6, 0, 2, 0, 4) && success;
+	success = testBatch(4, 6, 2, 0, 1, 3) && success;
+
+	return success ? 0 : 1;
+}
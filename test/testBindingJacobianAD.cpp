@@ -0,0 +1,194 @@
+// =============================================================================
+//  CADET - The Chromatography Analysis and Design Toolkit
+//
+//  Copyright © 2008-2016: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+/**
+ * @file
+ * Compares the analytic Jacobians of binding models with the ones computed by AD. The
+ * Kumar-Langmuir and Bi-SMA models are checked with direct evaluation of their power terms
+ * and with lookup tables (whose derivatives are only accurate up to the table tolerance).
+ */
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <algorithm>
+#include <random>
+
+#include "BindingModelFactory.hpp"
+#include "model/BindingModel.hpp"
+#include "linalg/BandMatrix.hpp"
+#include "AutoDiff.hpp"
+#include "SimulationTestHelper.hpp"
+
+/**
+ * @brief Sets the parameters of the Kumar-Langmuir binding model
+ * @param [out] pp Parameter provider
+ * @param [in] lookup Determines whether lookup tables are used
+ */
+void createKumarLangmuir(MemoryParameterProvider& pp, bool lookup)
+{
+	pp.set("KMCL_TEMP", 298.0);
+	pp.set("KMCL_KA", std::vector<double>({0.0, 3.5, 1.59, 7.7}));
+	pp.set("KMCL_KD", std::vector<double>({0.0, 10.0, 12.0, 8.0}));
+	pp.set("KMCL_KACT", std::vector<double>({0.0, 20.0, 35.0, 10.0}));
+	pp.set("KMCL_QMAX", std::vector<double>({0.0, 10.0, 12.0, 15.0}));
+	pp.set("KMCL_NU", std::vector<double>({0.0, 1.7, 2.3, 0.8}));
+
+	pp.set("KMCL_LOOKUP_TABLE", lookup);
+	pp.set("KMCL_LOOKUP_SALT_RANGE", std::vector<double>({10.0, 500.0}));
+}
+
+/**
+ * @brief Sets the parameters of the Bi-SMA binding model with two binding site types
+ * @param [out] pp Parameter provider
+ * @param [in] lookup Determines whether lookup tables are used
+ */
+void createBiSMA(MemoryParameterProvider& pp, bool lookup)
+{
+	pp.set("BISMA_LAMBDA", std::vector<double>({1200.0, 900.0}));
+	pp.set("BISMA_KA", std::vector<double>({0.0, 35.5, 1.59, 7.7, 0.0, 20.0, 2.1, 3.3}));
+	pp.set("BISMA_KD", std::vector<double>({0.0, 1000.0, 1000.0, 1000.0, 0.0, 800.0, 900.0, 700.0}));
+	pp.set("BISMA_NU", std::vector<double>({0.0, 4.7, 5.29, 3.7, 0.0, 3.1, 4.2, 2.5}));
+	pp.set("BISMA_SIGMA", std::vector<double>({0.0, 11.83, 10.6, 10.0, 0.0, 9.1, 8.5, 7.2}));
+	pp.set("BISMA_REFC0", std::vector<double>({50.0, 60.0}));
+	pp.set("BISMA_REFQ", std::vector<double>({1000.0, 800.0}));
+
+	pp.set("BISMA_LOOKUP_TABLE", lookup);
+	pp.set("BISMA_LOOKUP_SALT_RANGE", std::vector<double>({10.0, 500.0}));
+	pp.set("BISMA_LOOKUP_QBAR_RANGE", std::vector<double>({10.0, 2000.0}));
+}
+
+/**
+ * @brief Compares analytic and AD Jacobian of a binding model at random states
+ * @param [in] factory Binding model factory
+ * @param [in] name Name of the binding model
+ * @param [in] kinetic Determines whether the binding is kinetic
+ * @param [in] lookup Determines whether lookup tables are used
+ * @param [in] tol Tolerance of the relative difference
+ * @return @c true if the Jacobians agree, otherwise @c false
+ */
+bool runTest(const cadet::BindingModelFactory& factory, const std::string& name, bool kinetic, bool lookup, double tol)
+{
+	const unsigned int nComp = 4;
+	const unsigned int nStates = (name == "BI_STERIC_MASS_ACTION") ? 2 : 1;
+
+	MemoryParameterProvider pp;
+	pp.set("IS_KINETIC", kinetic ? 1 : 0);
+	if (name == "BI_STERIC_MASS_ACTION")
+		createBiSMA(pp, lookup);
+	else
+		createKumarLangmuir(pp, lookup);
+
+	// Kumar-Langmuir requires non-binding salt
+	std::vector<unsigned int> nBound(nComp, nStates);
+	if (name == "KUMAR_MULTI_COMPONENT_LANGMUIR")
+		nBound[0] = 0;
+
+	std::vector<unsigned int> boundOffset(nComp, 0);
+	unsigned int nTotalBound = 0;
+	for (unsigned int i = 0; i < nComp; ++i)
+	{
+		boundOffset[i] = nTotalBound;
+		nTotalBound += nBound[i];
+	}
+
+	cadet::model::IBindingModel* const binding = factory.create(name);
+	binding->configureModelDiscretization(nComp, nBound.data(), boundOffset.data());
+	binding->configure(pp, 0);
+
+	// The state consists of the liquid phase followed by the bound states
+	const unsigned int n = nComp + nTotalBound;
+
+	cadet::linalg::BandMatrix jac;
+	jac.resize(n, n, n);
+
+	std::vector<cadet::active> adY(n);
+	std::vector<cadet::active> adRes(nTotalBound);
+	std::vector<double> y(n);
+
+	std::mt19937 rng(5);
+	std::uniform_real_distribution<double> dist(0.0, 1.0);
+
+	double maxDiff = 0.0;
+	for (unsigned int rep = 0; rep < 20; ++rep)
+	{
+		// Salt concentration within the range of the lookup tables, Bi-SMA salt bound states
+		// well above the sum of the shielded binding sites
+		y[0] = 20.0 + 200.0 * dist(rng);
+		for (unsigned int i = 1; i < nComp; ++i)
+			y[i] = 2.0 * dist(rng);
+		for (unsigned int i = 0; i < nBound[0]; ++i)
+			y[nComp + i] = 500.0 + 400.0 * dist(rng);
+		for (unsigned int i = nBound[0]; i < nTotalBound; ++i)
+			y[nComp + i] = 5.0 * dist(rng);
+
+		jac.setAll(0.0);
+		binding->analyticJacobian(0.0, 0.0, 0.5, 0, y.data() + nComp, jac.row(nComp));
+
+		{
+			cadet::ad::DirectionScope adDirScope(n);
+			for (unsigned int i = 0; i < n; ++i)
+			{
+				adY[i] = y[i];
+				adY[i].setADValue(i, 1.0);
+			}
+
+			binding->residual(0.0, 0.0, 0.5, 0, 1.0, adY.data() + nComp, nullptr, adRes.data());
+
+			for (unsigned int row = 0; row < nTotalBound; ++row)
+			{
+				for (unsigned int col = 0; col < n; ++col)
+				{
+					const double ref = adRes[row].getADValue(col);
+					const double val = jac.centered(nComp + row, static_cast<int>(col) - static_cast<int>(nComp + row));
+					maxDiff = std::max(maxDiff, std::abs(val - ref) / std::max(1.0, std::abs(ref)));
+				}
+			}
+		}
+	}
+
+	delete binding;
+
+	std::cout << name << (kinetic ? " (kinetic" : " (quasi-stationary") << (lookup ? ", lookup table)" : ")") << ": max rel diff " << maxDiff;
+	return maxDiff <= tol;
+}
+
+int main(int argc, char** argv)
+{
+	// Parameters are created with the maximum number of directions, as done by the simulator
+	cadet::ad::setDirections(cadet::ad::getMaxDirections());
+
+	cadet::BindingModelFactory factory;
+
+	bool success = true;
+	for (const std::string& name : {std::string("KUMAR_MULTI_COMPONENT_LANGMUIR"), std::string("BI_STERIC_MASS_ACTION")})
+	{
+		for (unsigned int kinetic = 0; kinetic < 2; ++kinetic)
+		{
+			for (unsigned int lookup = 0; lookup < 2; ++lookup)
+			{
+				// The lookup tables interpolate the power terms with relative tolerance 1e-10,
+				// their derivatives are less accurate
+				if (runTest(factory, name, kinetic, lookup, lookup ? 1e-6 : 1e-12))
+					std::cout << " => PASSED\n";
+				else
+				{
+					std::cout << " => FAILED\n";
+					success = false;
+				}
+			}
+		}
+	}
+
+	return success ? 0 : 1;
+}
@@ -0,0 +1,170 @@
+// =============================================================================
+//  CADET - The Chromatography Analysis and Design Toolkit
+//
+//  Copyright © 2008-2016: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+/**
+ * @file
+ * Compares simulations with and without reusing factorizations of the Jacobian.
+ * Without sensitivities, the modified Newton method changes the results within
+ * the error tolerances of the time integrator. With forward sensitivities, reuse
+ * is disabled and the results have to agree up to round-off.
+ */
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <algorithm>
+
+#include "cadet/cadet.hpp"
+#include "SimulationTestHelper.hpp"
+
+struct Result
+{
+	std::vector<double> solution; //!< Last state
+	std::vector<std::vector<double>> sensitivities; //!< Last sensitivity states
+};
+
+/**
+ * @brief Runs the linear load-wash-elution case
+ * @param [in] reuse Determines whether factorizations of the Jacobian are reused
+ * @param [in] sensParams Sensitive parameters
+ * @param [out] res Last state and sensitivity states
+ */
+void simulate(bool reuse, const std::vector<cadet::ParameterId>& sensParams, Result& res)
+{
+	MemoryParameterProvider pp;
+	createLinearModel(pp, false, false);
+
+	cadet::IModelBuilder* const builder = cadetCreateModelBuilder();
+	cadet::ISimulator* const sim = cadetCreateSimulator();
+
+	pp.pushScope("model");
+	cadet::IModelSystem* const model = builder->createSystem(pp);
+
+	sim->initializeModel(*model);
+	sim->setSectionTimes({0.0, 10.0, 300.0}, {false});
+	sim->setInitialCondition(pp);
+	pp.popScope();
+
+	sim->configureTimeIntegrator(1e-6, 1e-8, 1e-6, 10000);
+	sim->setSolutionTimes({0.0, 100.0, 200.0, 300.0});
+	sim->setJacobianReuse(reuse, 0.4);
+
+	if (!sensParams.empty())
+	{
+		for (const cadet::ParameterId& id : sensParams)
+			sim->setSensitiveParameter(id, 1e-6);
+		sim->initializeFwdSensitivities();
+	}
+
+	sim->integrate();
+
+	unsigned int len = 0;
+	double const* const sol = sim->getLastSolution(len);
+	res.solution.assign(sol, sol + len);
+
+	const std::vector<double const*> sens = sim->getLastSensitivities(len);
+	res.sensitivities.clear();
+	for (double const* s : sens)
+		res.sensitivities.push_back(std::vector<double>(s, s + len));
+
+	cadetDestroySimulator(sim);
+	cadetDestroyModelBuilder(builder);
+}
+
+/**
+ * @brief Compares two vectors elementwise relative to the magnitude of the reference
+ * @param [in] a Vector
+ * @param [in] b Reference vector
+ * @param [in] tol Tolerance
+ * @return @c true if the vectors agree, otherwise @c false
+ */
+bool compareVectors(const std::vector<double>& a, const std::vector<double>& b, double tol)
+{
+	if (a.size() != b.size())
+		return false;
+
+	double scale = 1.0;
+	for (double v : b)
+		scale = std::max(scale, std::abs(v));
+
+	for (unsigned int i = 0; i < a.size(); ++i)
+	{
+		if (std::abs(a[i] - b[i]) > tol * scale)
+			return false;
+	}
+	return true;
+}
+
+bool compareResults(const Result& a, const Result& b, double tol)
+{
+	if (!compareVectors(a.solution, b.solution, tol) || (a.sensitivities.size() != b.sensitivities.size()))
+		return false;
+
+	for (unsigned int i = 0; i < a.sensitivities.size(); ++i)
+	{
+		if (!compareVectors(a.sensitivities[i], b.sensitivities[i], tol))
+			return false;
+	}
+	return true;
+}
+
+int main(int argc, char** argv)
+{
+	using cadet::makeParamId;
+	using cadet::CompIndep;
+	using cadet::BoundPhaseIndep;
+	using cadet::ReactionIndep;
+	using cadet::SectionIndep;
+
+	std::vector<cadet::ParameterId> sensParams;
+	sensParams.push_back(makeParamId("COL_POROSITY", 0, CompIndep, BoundPhaseIndep, ReactionIndep, SectionIndep));
+	sensParams.push_back(makeParamId("LIN_KA", 0, 0, 0, ReactionIndep, SectionIndep));
+
+	bool success = true;
+
+	// Without sensitivities
+	{
+		Result ref;
+		Result reuse;
+		simulate(false, std::vector<cadet::ParameterId>(), ref);
+		simulate(true, std::vector<cadet::ParameterId>(), reuse);
+
+		std::cout << "Reuse without sensitivities";
+		if (compareResults(reuse, ref, 1e-4))
+			std::cout << " => PASSED\n";
+		else
+		{
+			std::cout << " => FAILED\n";
+			success = false;
+		}
+	}
+
+	// With forward sensitivities, reuse is disabled
+	{
+		Result ref;
+		Result reuse;
+		simulate(false, sensParams, ref);
+		simulate(true, sensParams, reuse);
+
+		std::cout << "Reuse with sensitivities";
+		if (compareResults(reuse, ref, 1e-10))
+			std::cout << " => PASSED\n";
+		else
+		{
+			std::cout << " => FAILED\n";
+			success = false;
+		}
+	}
+
+	return success ? 0 : 1;
+}
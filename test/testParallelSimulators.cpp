@@ -0,0 +1,189 @@
+// =============================================================================
+//  CADET - The Chromatography Analysis and Design Toolkit
+//
+//  Copyright © 2008-2016: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+/**
+ * @file
+ * Runs several simulations with different sets of sensitive parameters (and, thus,
+ * different numbers of AD directions) concurrently and compares them to serial runs.
+ * The concurrent runs use multiple OpenMP threads each, whereas the serial runs are
+ * single-threaded.
+ */
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <thread>
+#include <cmath>
+#include <algorithm>
+
+#include "cadet/cadet.hpp"
+#include "SimulationTestHelper.hpp"
+
+struct TestCase
+{
+	bool adJacobian; //!< Determines whether the Jacobian is computed by AD
+	bool extBinding; //!< Determines whether the isotherm depends on an external profile
+	std::vector<cadet::ParameterId> sensParams; //!< Sensitive parameters
+};
+
+struct Result
+{
+	std::vector<double> solution; //!< Last state
+	std::vector<std::vector<double>> sensitivities; //!< Last sensitivity states
+};
+
+/**
+ * @brief Runs the simulation of the given test case
+ * @param [in] tc Test case
+ * @param [out] res Last state and sensitivity states
+ * @param [in] nThreads Number of OpenMP threads used by the simulator
+ */
+void simulate(const TestCase& tc, Result& res, unsigned int nThreads)
+{
+	MemoryParameterProvider pp;
+	createLinearModel(pp, tc.adJacobian, tc.extBinding);
+
+	cadet::IModelBuilder* const builder = cadetCreateModelBuilder();
+	cadet::ISimulator* const sim = cadetCreateSimulator();
+
+	pp.pushScope("model");
+	cadet::IModelSystem* const model = builder->createSystem(pp);
+
+	sim->initializeModel(*model);
+	sim->setSectionTimes({0.0, 10.0, 300.0}, {false});
+	sim->setInitialCondition(pp);
+	pp.popScope();
+
+	sim->setNumThreads(nThreads);
+	sim->configureTimeIntegrator(1e-6, 1e-8, 1e-6, 10000);
+	sim->setSolutionTimes({0.0, 100.0, 200.0, 300.0});
+
+	if (!tc.sensParams.empty())
+	{
+		for (const cadet::ParameterId& id : tc.sensParams)
+			sim->setSensitiveParameter(id, 1e-6);
+		sim->initializeFwdSensitivities();
+	}
+
+	sim->integrate();
+
+	unsigned int len = 0;
+	double const* const sol = sim->getLastSolution(len);
+	res.solution.assign(sol, sol + len);
+
+	const std::vector<double const*> sens = sim->getLastSensitivities(len);
+	res.sensitivities.clear();
+	for (double const* s : sens)
+		res.sensitivities.push_back(std::vector<double>(s, s + len));
+
+	cadetDestroySimulator(sim);
+	cadetDestroyModelBuilder(builder);
+}
+
+bool compareVectors(const std::vector<double>& a, const std::vector<double>& b)
+{
+	if (a.size() != b.size())
+		return false;
+
+	for (unsigned int i = 0; i < a.size(); ++i)
+	{
+		if (std::abs(a[i] - b[i]) > 1e-10 * std::max(1.0, std::abs(b[i])))
+			return false;
+	}
+	return true;
+}
+
+bool compareResults(const Result& a, const Result& b)
+{
+	if (!compareVectors(a.solution, b.solution) || (a.sensitivities.size() != b.sensitivities.size()))
+		return false;
+
+	for (unsigned int i = 0; i < a.sensitivities.size(); ++i)
+	{
+		if (!compareVectors(a.sensitivities[i], b.sensitivities[i]))
+			return false;
+	}
+	return true;
+}
+
+int main(int argc, char** argv)
+{
+	using cadet::makeParamId;
+	using cadet::CompIndep;
+	using cadet::BoundPhaseIndep;
+	using cadet::ReactionIndep;
+	using cadet::SectionIndep;
+
+	// Different sets of sensitive parameters and Jacobian methods require different numbers of AD directions
+	std::vector<TestCase> cases(7);
+	for (TestCase& tc : cases)
+		tc.extBinding = false;
+
+	cases[0].adJacobian = false;
+
+	cases[1].adJacobian = false;
+	cases[1].sensParams.push_back(makeParamId("COL_POROSITY", 0, CompIndep, BoundPhaseIndep, ReactionIndep, SectionIndep));
+
+	cases[2].adJacobian = true;
+	cases[2].sensParams.push_back(makeParamId("COL_POROSITY", 0, CompIndep, BoundPhaseIndep, ReactionIndep, SectionIndep));
+	cases[2].sensParams.push_back(makeParamId("LIN_KA", 0, 0, 0, ReactionIndep, SectionIndep));
+
+	cases[3].adJacobian = false;
+	cases[3].sensParams.push_back(makeParamId("FILM_DIFFUSION", 0, 0, BoundPhaseIndep, ReactionIndep, SectionIndep));
+	cases[3].sensParams.push_back(makeParamId("PAR_DIFFUSION", 0, 0, BoundPhaseIndep, ReactionIndep, SectionIndep));
+	cases[3].sensParams.push_back(makeParamId("PAR_POROSITY", 0, CompIndep, BoundPhaseIndep, ReactionIndep, SectionIndep));
+
+	cases[4].adJacobian = true;
+
+	// Externally dependent binding models cache their parameters in each thread
+	cases[5].adJacobian = false;
+	cases[5].extBinding = true;
+	cases[5].sensParams.push_back(makeParamId("EXT_LIN_KA", 0, 0, 0, ReactionIndep, SectionIndep));
+
+	cases[6].adJacobian = true;
+	cases[6].extBinding = true;
+	cases[6].sensParams.push_back(makeParamId("EXT_LIN_KA_T", 0, 0, 0, ReactionIndep, SectionIndep));
+
+	std::vector<Result> serial(cases.size());
+	for (unsigned int i = 0; i < cases.size(); ++i)
+		simulate(cases[i], serial[i], 1);
+
+	bool success = true;
+	for (unsigned int rep = 0; rep < 3; ++rep)
+	{
+		std::vector<Result> parallel(cases.size());
+		std::vector<std::thread> threads;
+		threads.reserve(cases.size());
+
+		for (unsigned int i = 0; i < cases.size(); ++i)
+			threads.push_back(std::thread(simulate, std::cref(cases[i]), std::ref(parallel[i]), 4));
+
+		for (std::thread& t : threads)
+			t.join();
+
+		for (unsigned int i = 0; i < cases.size(); ++i)
+		{
+			std::cout << "Run " << rep << ", case " << i << " (" << cases[i].sensParams.size() << " sensitivities, "
+				<< (cases[i].adJacobian ? "AD" : "analytic") << " Jacobian" << (cases[i].extBinding ? ", external binding)" : ")");
+
+			if (compareResults(parallel[i], serial[i]))
+				std::cout << " => PASSED\n";
+			else
+			{
+				std::cout << " => FAILED\n";
+				success = false;
+			}
+		}
+	}
+
+	return success ? 0 : 1;
+}
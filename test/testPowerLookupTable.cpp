@@ -0,0 +1,175 @@
+// =============================================================================
+//  CADET - The Chromatography Analysis and Design Toolkit
+//
+//  Copyright © 2008-2016: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+/**
+ * @file
+ * Compares the values and derivatives of tabulated power functions with std::pow
+ * across the tabulated range, at its edges, and outside of it.
+ */
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+#include "model/binding/PowerLookupTable.hpp"
+
+struct TestCase
+{
+	double exponent; //!< Exponent
+	double xMin; //!< Lower bound of the tabulated range
+	double xMax; //!< Upper bound of the tabulated range
+};
+
+double relError(double val, double ref)
+{
+	return std::abs(val - ref) / std::max(std::abs(ref), 1e-300);
+}
+
+/**
+ * @brief Checks a lookup table at the given point
+ * @param [in] table Lookup table
+ * @param [in] tc Test case
+ * @param [in] x Argument
+ * @param [in] tolVal Tolerance of the relative error of the value
+ * @param [in] tolDeriv Tolerance of the relative error of the derivative
+ * @param [in,out] maxErrVal Maximum relative error of the value
+ * @param [in,out] maxErrDeriv Maximum relative error of the derivative
+ * @return @c true if the errors are within the tolerances, otherwise @c false
+ */
+bool checkPoint(const cadet::model::PowerLookupTable& table, const TestCase& tc, double x, double tolVal, double tolDeriv, double& maxErrVal, double& maxErrDeriv)
+{
+	const double refVal = std::pow(x, tc.exponent);
+	const double refDeriv = tc.exponent * std::pow(x, tc.exponent - 1.0);
+
+	double val = 0.0;
+	double deriv = 0.0;
+	table.evaluate(x, tc.exponent, val, deriv);
+
+	const double errVal = relError(val, refVal);
+	const double errDeriv = relError(deriv, refDeriv);
+	const double errOp = relError(table(x, tc.exponent), refVal);
+	const double errTab = relError(cadet::model::tabulatedPow<double>(table, x, tc.exponent), refVal);
+
+	maxErrVal = std::max(maxErrVal, std::max(errVal, std::max(errOp, errTab)));
+	maxErrDeriv = std::max(maxErrDeriv, errDeriv);
+
+	if ((errVal <= tolVal) && (errOp <= tolVal) && (errTab <= tolVal) && (errDeriv <= tolDeriv))
+		return true;
+
+	std::cout << "  x = " << x << ": value error " << errVal << ", derivative error " << errDeriv << "\n";
+	return false;
+}
+
+/**
+ * @brief Checks that the table falls back to std::pow
+ * @param [in] table Lookup table
+ * @param [in] x Argument
+ * @param [in] exponent Exponent
+ * @return @c true if the results coincide with std::pow, otherwise @c false
+ */
+bool checkFallback(const cadet::model::PowerLookupTable& table, double x, double exponent)
+{
+	double val = 0.0;
+	double deriv = 0.0;
+	table.evaluate(x, exponent, val, deriv);
+
+	return (val == std::pow(x, exponent)) && (deriv == exponent * std::pow(x, exponent - 1.0)) && (table(x, exponent) == std::pow(x, exponent));
+}
+
+int main(int argc, char** argv)
+{
+	const std::vector<TestCase> cases = {
+		{1.5, 0.1, 10.0},
+		{0.3, 0.1, 2.0},
+		{-1.2, 0.5, 50.0},
+		{2.7, 1e-2, 1.0},
+		{4.0, 1.0, 20.0}
+	};
+
+	cadet::model::PowerLookupTableSettings settings;
+	settings.enabled = true;
+
+	bool success = true;
+	for (const TestCase& tc : cases)
+	{
+		bool caseSuccess = true;
+		cadet::model::PowerLookupTable table;
+
+		if (!table.build(tc.exponent, tc.xMin, tc.xMax, settings) || table.empty())
+		{
+			std::cout << "Exponent " << tc.exponent << " on [" << tc.xMin << ", " << tc.xMax << "]: build failed => FAILED\n";
+			success = false;
+			continue;
+		}
+
+		// The table controls the error at the quarter points of each cell where the error of a cubic
+		// Hermite interpolant is largest; derivatives lose one order of the grid spacing
+		const double tolVal = 2.0 * settings.tolerance;
+		const double tolDeriv = 1e-6;
+		double maxErrVal = 0.0;
+		double maxErrDeriv = 0.0;
+
+		// Interior points that do not align with the grid
+		const unsigned int nSamples = 10 * table.numPoints() + 7;
+		for (unsigned int i = 0; i <= nSamples; ++i)
+		{
+			const double x = tc.xMin + (tc.xMax - tc.xMin) * static_cast<double>(i) / nSamples;
+			caseSuccess = checkPoint(table, tc, x, tolVal, tolDeriv, maxErrVal, maxErrDeriv) && caseSuccess;
+		}
+
+		// Edges of the range are interpolated exactly up to round-off
+		caseSuccess = checkPoint(table, tc, tc.xMin, 1e-14, 1e-12, maxErrVal, maxErrDeriv) && caseSuccess;
+		caseSuccess = checkPoint(table, tc, tc.xMax, 1e-14, 1e-12, maxErrVal, maxErrDeriv) && caseSuccess;
+		caseSuccess = checkPoint(table, tc, std::nextafter(tc.xMax, tc.xMin), tolVal, tolDeriv, maxErrVal, maxErrDeriv) && caseSuccess;
+		caseSuccess = checkPoint(table, tc, std::nextafter(tc.xMin, tc.xMax), tolVal, tolDeriv, maxErrVal, maxErrDeriv) && caseSuccess;
+
+		// Arguments outside of the range and other exponents fall back to std::pow
+		caseSuccess = checkFallback(table, 0.5 * tc.xMin, tc.exponent) && caseSuccess;
+		caseSuccess = checkFallback(table, 2.0 * tc.xMax, tc.exponent) && caseSuccess;
+		caseSuccess = checkFallback(table, 0.5 * (tc.xMin + tc.xMax), tc.exponent + 0.1) && caseSuccess;
+
+		std::cout << "Exponent " << tc.exponent << " on [" << tc.xMin << ", " << tc.xMax << "] with " << table.numPoints()
+			<< " points: max value error " << maxErrVal << ", max derivative error " << maxErrDeriv;
+
+		if (caseSuccess)
+			std::cout << " => PASSED\n";
+		else
+		{
+			std::cout << " => FAILED\n";
+			success = false;
+		}
+	}
+
+	// Tables that do not reach the tolerance are dropped
+	{
+		cadet::model::PowerLookupTableSettings tight;
+		tight.enabled = true;
+		tight.tolerance = 1e-16;
+		tight.nPoints = 5;
+		tight.maxPoints = 33;
+
+		cadet::model::PowerLookupTable table;
+		const bool built = table.build(1.5, 0.1, 10.0, tight);
+
+		std::cout << "Unattainable tolerance";
+		if (!built && table.empty() && checkFallback(table, 1.0, 1.5))
+			std::cout << " => PASSED\n";
+		else
+		{
+			std::cout << " => FAILED\n";
+			success = false;
+		}
+	}
+
+	return success ? 0 : 1;
+}
@@ -0,0 +1,209 @@
+// =============================================================================
+//  CADET - The Chromatography Analysis and Design Toolkit
+//
+//  Copyright © 2008-2016: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+/**
+ * @file
+ * Compares the batched evaluation of the steric mass action binding model (fused residual and
+ * Jacobian as well as separate residual and Jacobian) with the evaluation of each particle shell.
+ */
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <algorithm>
+#include <random>
+
+#include "BindingModelFactory.hpp"
+#include "model/BindingModel.hpp"
+#include "linalg/BandMatrix.hpp"
+#include "SimulationTestHelper.hpp"
+
+struct TestCase
+{
+	bool kinetic; //!< Determines whether the binding is kinetic
+	bool nonBinding; //!< Determines whether one component does not bind (disables the fused kernel)
+	bool fallback; //!< Determines whether a block contains a shell with negative salt concentration
+};
+
+/**
+ * @brief Returns the maximum elementwise relative difference of two vectors
+ * @param [in] a Vector
+ * @param [in] b Reference vector
+ * @return Maximum relative difference
+ */
+double maxRelDiff(const std::vector<double>& a, const std::vector<double>& b)
+{
+	double diff = 0.0;
+	for (unsigned int i = 0; i < a.size(); ++i)
+		diff = std::max(diff, std::abs(a[i] - b[i]) / std::max(1.0, std::abs(b[i])));
+	return diff;
+}
+
+/**
+ * @brief Returns the maximum elementwise relative difference of two band matrices
+ * @param [in] a Matrix
+ * @param [in] b Reference matrix
+ * @param [in] bandwidth Lower and upper bandwidth
+ * @return Maximum relative difference
+ */
+double maxRelDiff(const cadet::linalg::BandMatrix& a, const cadet::linalg::BandMatrix& b, int bandwidth)
+{
+	const int n = static_cast<int>(b.rows());
+	double diff = 0.0;
+	for (int i = 0; i < n; ++i)
+	{
+		for (int d = -bandwidth; d <= bandwidth; ++d)
+		{
+			if ((i + d < 0) || (i + d >= n))
+				continue;
+
+			const double ref = b.centered(i, d);
+			diff = std::max(diff, std::abs(a.centered(i, d) - ref) / std::max(1.0, std::abs(ref)));
+		}
+	}
+	return diff;
+}
+
+/**
+ * @brief Runs a test case
+ * @param [in] factory Binding model factory
+ * @param [in] tc Test case
+ * @return @c true if batched and per-shell evaluation agree, otherwise @c false
+ */
+bool runTest(const cadet::BindingModelFactory& factory, const TestCase& tc)
+{
+	const unsigned int nComp = 5;
+	const unsigned int nShells = 37;
+	const double timeFactor = 1.3;
+
+	MemoryParameterProvider pp;
+	pp.set("IS_KINETIC", tc.kinetic ? 1 : 0);
+	pp.set("SMA_LAMBDA", 1200.0);
+	pp.set("SMA_KA", std::vector<double>({0.0, 35.5, 1.59, 7.7, 2.1}));
+	pp.set("SMA_KD", std::vector<double>({0.0, 1000.0, 1000.0, 1000.0, 900.0}));
+	pp.set("SMA_NU", std::vector<double>({0.0, 4.7, 5.29, 3.7, 2.0}));
+	pp.set("SMA_SIGMA", std::vector<double>({0.0, 11.83, 10.6, 10.0, 7.5}));
+	pp.set("SMA_REFC0", 50.0);
+	pp.set("SMA_REFQ", 1000.0);
+
+	cadet::model::IBindingModel* const binding = factory.create("STERIC_MASS_ACTION");
+
+	std::vector<unsigned int> nBound(nComp, 1);
+	if (tc.nonBinding)
+		nBound[3] = 0;
+
+	std::vector<unsigned int> boundOffset(nComp, 0);
+	unsigned int nTotalBound = 0;
+	for (unsigned int i = 0; i < nComp; ++i)
+	{
+		boundOffset[i] = nTotalBound;
+		nTotalBound += nBound[i];
+	}
+
+	binding->configureModelDiscretization(nComp, nBound.data(), boundOffset.data());
+	binding->configure(pp, 0);
+
+	// Each shell consists of the liquid phase followed by the bound states
+	const unsigned int stride = nComp + nTotalBound;
+	const unsigned int n = nShells * stride;
+
+	std::mt19937 rng(3);
+	std::uniform_real_distribution<double> dist(0.0, 1.0);
+	std::vector<double> y(n);
+	std::vector<double> yDot(n);
+	std::vector<double> r(nShells);
+	for (unsigned int s = 0; s < nShells; ++s)
+	{
+		double* const ys = y.data() + s * stride;
+		ys[0] = 50.0 + 100.0 * dist(rng);
+		for (unsigned int i = 1; i < nComp; ++i)
+			ys[i] = dist(rng);
+
+		ys[nComp] = 1200.0 * (0.2 + 0.5 * dist(rng));
+		for (unsigned int i = 1; i < nTotalBound; ++i)
+			ys[nComp + i] = 10.0 * dist(rng);
+
+		r[s] = static_cast<double>(s) / nShells;
+	}
+	for (double& v : yDot)
+		v = dist(rng);
+
+	if (tc.fallback)
+		y[20 * stride] = -1.0;
+
+	// Reference: evaluate each shell
+	cadet::linalg::BandMatrix jacRef;
+	cadet::linalg::BandMatrix jacFused;
+	cadet::linalg::BandMatrix jacSep;
+	jacRef.resize(n, stride, stride);
+	jacFused.resize(n, stride, stride);
+	jacSep.resize(n, stride, stride);
+	jacRef.setAll(0.0);
+	jacFused.setAll(0.0);
+	jacSep.setAll(0.0);
+
+	std::vector<double> resRef(n, 0.0);
+	std::vector<double> resFused(n, 0.0);
+	std::vector<double> resSep(n, 0.0);
+
+	for (unsigned int s = 0; s < nShells; ++s)
+	{
+		const unsigned int offset = s * stride + nComp;
+		binding->residual(0.0, 0.0, r[s], 0, timeFactor, y.data() + offset, yDot.data() + offset, resRef.data() + offset);
+		binding->analyticJacobian(0.0, 0.0, r[s], 0, y.data() + offset, jacRef.row(offset));
+	}
+
+	binding->residualWithJacobianBatch(0.0, 0.0, r.data(), 0, timeFactor, nShells, stride, y.data() + nComp, yDot.data() + nComp,
+		resFused.data() + nComp, jacFused.row(nComp));
+
+	binding->residualBatch(0.0, 0.0, r.data(), 0, timeFactor, nShells, stride, y.data() + nComp, yDot.data() + nComp, resSep.data() + nComp);
+	binding->analyticJacobianBatch(0.0, 0.0, r.data(), 0, nShells, stride, y.data() + nComp, jacSep.row(nComp));
+
+	const double tol = 1e-12;
+	const double diffResFused = maxRelDiff(resFused, resRef);
+	const double diffJacFused = maxRelDiff(jacFused, jacRef, stride);
+	const double diffResSep = maxRelDiff(resSep, resRef);
+	const double diffJacSep = maxRelDiff(jacSep, jacRef, stride);
+
+	std::cout << (tc.kinetic ? "Kinetic" : "Quasi-stationary") << (tc.nonBinding ? ", non-binding component" : "")
+		<< (tc.fallback ? ", fallback block" : "") << (binding->supportsBatchEvaluation() ? ", native batch" : "")
+		<< ": fused res " << diffResFused << " jac " << diffJacFused << ", separate res " << diffResSep << " jac " << diffJacSep;
+
+	delete binding;
+
+	return (diffResFused <= tol) && (diffJacFused <= tol) && (diffResSep <= tol) && (diffJacSep <= tol);
+}
+
+int main(int argc, char** argv)
+{
+	cadet::BindingModelFactory factory;
+
+	bool success = true;
+	for (unsigned int i = 0; i < 8; ++i)
+	{
+		TestCase tc;
+		tc.kinetic = (i & 1);
+		tc.nonBinding = (i & 2);
+		tc.fallback = (i & 4);
+
+		if (runTest(factory, tc))
+			std::cout << " => PASSED\n";
+		else
+		{
+			std::cout << " => FAILED\n";
+			success = false;
+		}
+	}
+
+	return success ? 0 : 1;
+}
@@ -0,0 +1,471 @@
+// =============================================================================
+//  CADET - The Chromatography Analysis and Design Toolkit
+//
+//  Copyright © 2008-2016: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <algorithm>
+
+#include "ConfigurationHelper.hpp"
+#include "BindingModelFactory.hpp"
+#include "model/GeneralRateModel.hpp"
+#include "AutoDiff.hpp"
+#include "linalg/DenseMatrix.hpp"
+#include "linalg/SparseLU.hpp"
+#include "SimulationTestHelper.hpp"
+
+/**
+ * @brief Creates a pseudo-random sparsity pattern with a dominant diagonal and some dense rows and columns
+ * @details The dense last rows and columns mimic the coupling of all other unknowns to the fluxes in the GRM.
+ */
+void createPattern(unsigned int n, unsigned int numDense, unsigned int seed, std::vector<unsigned int>& rowStart, std::vector<unsigned int>& colIdx)
+{
+	rowStart.clear();
+	colIdx.clear();
+	rowStart.push_back(0);
+	for (unsigned int row = 0; row < n; ++row)
+	{
+		for (unsigned int col = 0; col < n; ++col)
+		{
+			const bool dense = (row >= n - numDense) || (col >= n - numDense);
+			const bool band = (col + 2 >= row) && (col <= row + 1);
+			const bool scattered = ((row * 7 + col * 13 + seed) % 11) == 0;
+			if (dense || band || scattered)
+				colIdx.push_back(col);
+		}
+		rowStart.push_back(colIdx.size());
+	}
+}
+
+double value(unsigned int row, unsigned int col, unsigned int seed)
+{
+	const double val = std::sin(1.3 * (seed + 1) * (row + 1) + 0.7 * col);
+	return (row == col) ? val + 10.0 : val;
+}
+
+bool testSolve(unsigned int n, unsigned int numDense, unsigned int seed)
+{
+	using cadet::linalg::DenseMatrix;
+	using cadet::linalg::FactorizableSparseMatrix;
+
+	std::cout << n << " rows, " << numDense << " dense rows and columns, seed " << seed;
+
+	std::vector<unsigned int> rowStart;
+	std::vector<unsigned int> colIdx;
+	createPattern(n, numDense, seed, rowStart, colIdx);
+
+	FactorizableSparseMatrix sm;
+	sm.analyzePattern(n, rowStart, colIdx);
+
+	DenseMatrix dm;
+	dm.resize(n, n);
+
+	// Refactorize with different values to check that the symbolic phase is reusable
+	for (unsigned int rep = 0; rep < 2; ++rep)
+	{
+		sm.setAll(0.0);
+		dm.setAll(0.0);
+		for (unsigned int row = 0; row < n; ++row)
+		{
+			for (unsigned int i = rowStart[row]; i < rowStart[row + 1]; ++i)
+			{
+				const double val = value(row, colIdx[i], seed + rep);
+				sm.addElement(row, colIdx[i], val);
+				dm.native(row, colIdx[i]) += val;
+			}
+		}
+
+		if (!sm.factorize() || !dm.factorize())
+		{
+			std::cout << " => FAILED to factorize\n";
+			return false;
+		}
+
+		std::vector<double> rhsRef(n, 0.0);
+		for (unsigned int i = 0; i < n; ++i)
+			rhsRef[i] = std::cos(0.1 * i + rep);
+		std::vector<double> rhs(rhsRef);
+
+		dm.solve(rhsRef.data());
+		sm.solve(rhs.data());
+
+		for (unsigned int i = 0; i < n; ++i)
+		{
+			if (std::abs(rhs[i] - rhsRef[i]) > 1e-10 * std::max(1.0, std::abs(rhsRef[i])))
+			{
+				std::cout << " => FAILED at element " << i << ": " << rhs[i] << " vs " << rhsRef[i] << "\n";
+				return false;
+			}
+		}
+
+		// Solve the transposed system and check the residual A^T x - b
+		std::vector<double> rhsT(n, 0.0);
+		for (unsigned int i = 0; i < n; ++i)
+			rhsT[i] = std::sin(0.3 * i + rep);
+		std::vector<double> solT(rhsT);
+		sm.solveTransposed(solT.data());
+
+		std::vector<double> resT(rhsT);
+		for (unsigned int row = 0; row < n; ++row)
+		{
+			for (unsigned int i = rowStart[row]; i < rowStart[row + 1]; ++i)
+				resT[colIdx[i]] -= value(row, colIdx[i], seed + rep) * solT[row];
+		}
+
+		for (unsigned int i = 0; i < n; ++i)
+		{
+			if (std::abs(resT[i]) > 1e-10 * std::max(1.0, std::abs(rhsT[i])))
+			{
+				std::cout << " => FAILED transposed solve at element " << i << ": residual " << resT[i] << "\n";
+				return false;
+			}
+		}
+	}
+
+	std::cout << " => PASSED (" << colIdx.size() << " non-zeros, " << sm.numNonZero() << " in factors)\n";
+	return true;
+}
+
+double zeroPivotValue(unsigned int row, unsigned int col)
+{
+	if (row == col)
+		return (row % 3 == 0) ? 0.0 : 4.0 + std::sin(row);
+	return 1.0 + 0.1 * col;
+}
+
+/**
+ * @brief Solves a tridiagonal system whose natural order elimination encounters a zero pivot
+ * @details Every third diagonal element is zero. The pivot of the first row is perturbed, which is corrected
+ *          by iterative refinement. The other pivots are created by the elimination.
+ * @param [in] n Number of rows
+ */
+bool testZeroPivot(unsigned int n)
+{
+	using cadet::linalg::DenseMatrix;
+	using cadet::linalg::FactorizableSparseMatrix;
+
+	std::cout << n << " rows with zero diagonal elements";
+
+	std::vector<unsigned int> rowStart(1, 0);
+	std::vector<unsigned int> colIdx;
+	for (unsigned int row = 0; row < n; ++row)
+	{
+		for (unsigned int col = (row > 0) ? row - 1 : 0; col < std::min(row + 2, n); ++col)
+			colIdx.push_back(col);
+		rowStart.push_back(colIdx.size());
+	}
+
+	FactorizableSparseMatrix sm;
+	sm.analyzePattern(n, rowStart, colIdx);
+
+	DenseMatrix dm;
+	dm.resize(n, n);
+	dm.setAll(0.0);
+
+	for (unsigned int row = 0; row < n; ++row)
+	{
+		for (unsigned int i = rowStart[row]; i < rowStart[row + 1]; ++i)
+		{
+			const unsigned int col = colIdx[i];
+			const double val = zeroPivotValue(row, col);
+			sm(row, col) = val;
+			dm.native(row, col) = val;
+		}
+	}
+
+	if (!sm.factorize() || !dm.factorize())
+	{
+		std::cout << " => FAILED to factorize\n";
+		return false;
+	}
+
+	std::vector<double> rhsRef(n, 0.0);
+	for (unsigned int i = 0; i < n; ++i)
+		rhsRef[i] = std::cos(0.1 * i);
+	std::vector<double> rhs(rhsRef);
+
+	dm.solve(rhsRef.data());
+	if (!sm.solve(rhs.data()))
+	{
+		std::cout << " => FAILED to solve\n";
+		return false;
+	}
+
+	for (unsigned int i = 0; i < n; ++i)
+	{
+		if (std::abs(rhs[i] - rhsRef[i]) > 1e-10 * std::max(1.0, std::abs(rhsRef[i])))
+		{
+			std::cout << " => FAILED at element " << i << ": " << rhs[i] << " vs " << rhsRef[i] << "\n";
+			return false;
+		}
+	}
+
+	// Solve the transposed system and check the residual A^T x - b
+	std::vector<double> rhsT(n, 0.0);
+	for (unsigned int i = 0; i < n; ++i)
+		rhsT[i] = std::sin(0.3 * i);
+	std::vector<double> solT(rhsT);
+	if (!sm.solveTransposed(solT.data()))
+	{
+		std::cout << " => FAILED to solve transposed system\n";
+		return false;
+	}
+
+	for (unsigned int row = 0; row < n; ++row)
+	{
+		for (unsigned int i = rowStart[row]; i < rowStart[row + 1]; ++i)
+			rhsT[colIdx[i]] -= zeroPivotValue(row, colIdx[i]) * solT[row];
+	}
+
+	for (unsigned int i = 0; i < n; ++i)
+	{
+		if (std::abs(rhsT[i]) > 1e-10)
+		{
+			std::cout << " => FAILED transposed solve at element " << i << ": residual " << rhsT[i] << "\n";
+			return false;
+		}
+	}
+
+	std::cout << " => PASSED (" << sm.numPerturbedPivots() << " perturbed pivots)\n";
+	return sm.numPerturbedPivots() > 0;
+}
+
+/**
+ * @brief Configuration helper that only provides binding models
+ */
+class BindingConfigHelper : public cadet::IConfigHelper
+{
+public:
+	virtual cadet::IInletProfile* createInletProfile(const std::string& type) const { return nullptr; }
+	virtual cadet::model::IBindingModel* createBindingModel(const std::string& name) const { return _factory.create(name); }
+	virtual cadet::IExternalFunction* createExternalFunction(const std::string& type) const { return nullptr; }
+
+private:
+	cadet::BindingModelFactory _factory;
+};
+
+/**
+ * @brief Configures a general rate model with quasi-stationary linear binding that uses the sparse direct solver
+ * @details The first component does not desorb. Its binding equation has no diagonal element and its pivot is
+ *          only created by fill-in from the time derivative of the bound state in the liquid phase equation.
+ *          First order WENO (upwind) makes the residual linear in the state.
+ * @param [out] pp Parameter provider
+ */
+void createGrmModel(MemoryParameterProvider& pp)
+{
+	pp.set("UNIT_TYPE", std::string("GENERAL_RATE_MODEL"));
+	pp.set("NCOMP", 2);
+
+	pp.set("VELOCITY", 5.75e-4);
+	pp.set("COL_DISPERSION", 5.75e-8);
+	pp.set("FILM_DIFFUSION", std::vector<double>({6.9e-6, 1.4e-5}));
+	pp.set("PAR_DIFFUSION", std::vector<double>({7e-10, 9.1e-10}));
+	pp.set("PAR_SURFDIFFUSION", std::vector<double>({0.0, 0.0}));
+
+	pp.set("COL_LENGTH", 0.014);
+	pp.set("PAR_RADIUS", 4.5e-5);
+	pp.set("COL_POROSITY", 0.37);
+	pp.set("PAR_POROSITY", 0.75);
+
+	pp.set("INIT_C", std::vector<double>(2, 0.0));
+	pp.set("INIT_Q", std::vector<double>(2, 0.0));
+
+	pp.set("ADSORPTION_MODEL", std::string("LINEAR"));
+	pp.set("adsorption/IS_KINETIC", 0);
+	pp.set("adsorption/LIN_KA", std::vector<double>({35.5, 10.0}));
+	pp.set("adsorption/LIN_KD", std::vector<double>({0.0, 1000.0}));
+
+	pp.set("discretization/NCOL", 6);
+	pp.set("discretization/NPAR", 3);
+	pp.set("discretization/NBOUND", std::vector<int>(2, 1));
+	pp.set("discretization/PAR_DISC_TYPE", std::string("EQUIDISTANT_PAR"));
+	pp.set("discretization/USE_ANALYTIC_JACOBIAN", 1);
+	pp.set("discretization/LINEAR_SOLVER", std::string("SPARSE_DIRECT"));
+	pp.set("discretization/MAX_KRYLOV", 0);
+	pp.set("discretization/GS_TYPE", 1);
+	pp.set("discretization/MAX_RESTARTS", 10);
+	pp.set("discretization/SCHUR_SAFETY", 1e-8);
+	pp.set("discretization/weno/WENO_ORDER", 1);
+	pp.set("discretization/weno/BOUNDARY_MODEL", 0);
+	pp.set("discretization/weno/WENO_EPS", 1e-12);
+}
+
+/**
+ * @brief Checks the solution of a linear system with the assembled Jacobian of a general rate model
+ * @details The time-discretized Jacobian @f$ \partial F / \partial y + \alpha \partial F / \partial \dot{y} @f$ is
+ *          assembled column by column from residual evaluations (the residual is linear). The system is solved
+ *          by the sparse LU decomposition of this matrix and by the model's own sparse direct solver, which
+ *          assembles the matrix from its blocks. Both are compared to a dense LU decomposition with partial
+ *          pivoting. The transposed solves are checked by their residual.
+ * @param [in] alpha Value of \f$ \alpha \f$ (arises from BDF time discretization)
+ */
+bool testGrmJacobian(double alpha)
+{
+	using cadet::linalg::DenseMatrix;
+	using cadet::linalg::FactorizableSparseMatrix;
+
+	std::cout << "GRM Jacobian with alpha = " << alpha;
+
+	BindingConfigHelper helper;
+	MemoryParameterProvider pp;
+	createGrmModel(pp);
+
+	cadet::model::GeneralRateModel grm(0);
+	if (!grm.configure(pp, helper))
+	{
+		std::cout << " => FAILED to configure\n";
+		return false;
+	}
+	grm.notifyDiscontinuousSectionTransition(0.0, 0);
+
+	// Assemble the Jacobian column by column
+	const unsigned int n = grm.numDofs();
+	std::vector<double> y(n, 0.0);
+	std::vector<double> yDot(n, 0.0);
+	std::vector<double> res0(n, 0.0);
+	std::vector<double> res(n, 0.0);
+	grm.residual(0.0, 0, 1.0, y.data(), yDot.data(), res0.data());
+
+	std::vector<double> jac(n * n, 0.0);
+	for (unsigned int col = 0; col < n; ++col)
+	{
+		y[col] = 1.0;
+		yDot[col] = alpha;
+		grm.residual(0.0, 0, 1.0, y.data(), yDot.data(), res.data());
+		y[col] = 0.0;
+		yDot[col] = 0.0;
+
+		for (unsigned int row = 0; row < n; ++row)
+			jac[row * n + col] = res[row] - res0[row];
+	}
+
+	// Extract sparsity pattern
+	std::vector<unsigned int> rowStart(1, 0);
+	std::vector<unsigned int> colIdx;
+	for (unsigned int row = 0; row < n; ++row)
+	{
+		for (unsigned int col = 0; col < n; ++col)
+		{
+			if (jac[row * n + col] != 0.0)
+				colIdx.push_back(col);
+		}
+		rowStart.push_back(colIdx.size());
+	}
+
+	FactorizableSparseMatrix sm;
+	sm.analyzePattern(n, rowStart, colIdx);
+	for (unsigned int row = 0; row < n; ++row)
+	{
+		for (unsigned int i = rowStart[row]; i < rowStart[row + 1]; ++i)
+			sm(row, colIdx[i]) = jac[row * n + colIdx[i]];
+	}
+
+	DenseMatrix dm;
+	dm.resize(n, n);
+	for (unsigned int row = 0; row < n; ++row)
+	{
+		for (unsigned int col = 0; col < n; ++col)
+			dm.native(row, col) = jac[row * n + col];
+	}
+
+	if (!sm.factorize() || !dm.factorize())
+	{
+		std::cout << " => FAILED to factorize\n";
+		return false;
+	}
+
+	std::vector<double> rhsRef(n, 0.0);
+	for (unsigned int i = 0; i < n; ++i)
+		rhsRef[i] = std::cos(0.1 * i);
+	std::vector<double> rhs(rhsRef);
+	std::vector<double> rhsGrm(rhsRef);
+
+	// Compute Jacobian of the model and solve with its sparse direct solver
+	const std::vector<double> weight(n, 1.0);
+	grm.residualWithJacobian(0.0, 0, 1.0, y.data(), yDot.data(), res.data(), nullptr, nullptr, 0);
+
+	dm.solve(rhsRef.data());
+	if (!sm.solve(rhs.data()) || (grm.linearSolve(0.0, 1.0, alpha, 1e-10, rhsGrm.data(), weight.data(), y.data(), yDot.data(), res.data()) != 0))
+	{
+		std::cout << " => FAILED to solve\n";
+		return false;
+	}
+
+	const double normRef = std::abs(*std::max_element(rhsRef.begin(), rhsRef.end(), [](double a, double b) { return std::abs(a) < std::abs(b); }));
+	for (unsigned int i = 0; i < n; ++i)
+	{
+		if ((std::abs(rhs[i] - rhsRef[i]) > 1e-10 * normRef) || (std::abs(rhsGrm[i] - rhsRef[i]) > 1e-10 * normRef))
+		{
+			std::cout << " => FAILED at element " << i << ": " << rhs[i] << " and " << rhsGrm[i] << " vs " << rhsRef[i] << "\n";
+			return false;
+		}
+	}
+
+	// Solve the transposed system and check the residual A^T x - b
+	std::vector<double> rhsT(n, 0.0);
+	for (unsigned int i = 0; i < n; ++i)
+		rhsT[i] = std::sin(0.3 * i);
+	std::vector<double> solT(rhsT);
+	std::vector<double> solTGrm(rhsT);
+	if (!sm.solveTransposed(solT.data()) || (grm.linearSolveAdjoint(0.0, 1.0, alpha, 1e-10, solTGrm.data(), weight.data(), y.data(), yDot.data(), res.data()) != 0))
+	{
+		std::cout << " => FAILED to solve transposed system\n";
+		return false;
+	}
+
+	std::vector<double> resT(rhsT);
+	std::vector<double> resTGrm(rhsT);
+	double scale = 0.0;
+	for (unsigned int row = 0; row < n; ++row)
+	{
+		for (unsigned int col = 0; col < n; ++col)
+		{
+			resT[col] -= jac[row * n + col] * solT[row];
+			resTGrm[col] -= jac[row * n + col] * solTGrm[row];
+			scale = std::max(scale, std::abs(jac[row * n + col] * solT[row]));
+		}
+	}
+
+	for (unsigned int i = 0; i < n; ++i)
+	{
+		if ((std::abs(resT[i]) > 1e-12 * scale) || (std::abs(resTGrm[i]) > 1e-12 * scale))
+		{
+			std::cout << " => FAILED transposed solve at element " << i << ": residuals " << resT[i] << " and " << resTGrm[i] << "\n";
+			return false;
+		}
+	}
+
+	std::cout << " => PASSED (" << sm.numPerturbedPivots() << " perturbed pivots)\n";
+	return true;
+}
+
+int main(int argc, char** argv)
+{
+	bool success = true;
+
+	success = testSolve(1, 0, 0) && success;
+	success = testSolve(10, 0, 1) && success;
+	success = testSolve(10, 2, 2) && success;
+	success = testSolve(50, 5, 3) && success;
+	success = testSolve(120, 12, 4) && success;
+
+	success = testZeroPivot(30) && success;
+
+	success = testGrmJacobian(1e3) && success;
+	success = testGrmJacobian(1.0) && success;
+	success = testGrmJacobian(1e-6) && success;
+	success = testGrmJacobian(1e-8) && success;
+	success = testGrmJacobian(1e-10) && success;
+
+	return success ? 0 : 1;
+}